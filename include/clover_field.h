@@ -61,6 +61,20 @@ namespace quda {
 #endif
     }
 
+    /**
+       @brief Helper function that returns whether we have enabled
+       recomputing the clover term from the gauge field inside the
+       dslash, in place of storing the clover field.
+    */
+    constexpr bool on_the_fly()
+    {
+#ifdef ON_THE_FLY_CLOVER
+      return true;
+#else
+      return false;
+#endif
+    }
+
     inline bool isNative(QudaCloverFieldOrder order, QudaPrecision precision)
     {
       if (precision == QUDA_DOUBLE_PRECISION) {
@@ -99,6 +113,7 @@ namespace quda {
     double mu2;       /** Chiral twisted mass term */
     double epsilon2;  /** Flavor twisted mass term */
     double rho;       /** Hasenbusch rho term */
+    const GaugeField *gauge; /** Extended gauge field to recompute the clover term from (on-the-fly clover only) */
 
     QudaCloverFieldOrder order; /** Field order */
     QudaFieldCreate create;     /** Creation type */
@@ -142,6 +157,7 @@ namespace quda {
       mu2(0.0),
       epsilon2(0.0),
       rho(0.0),
+      gauge(nullptr),
       location(QUDA_INVALID_FIELD_LOCATION)
     {
     }
@@ -156,6 +172,7 @@ namespace quda {
       mu2(param.mu2),
       epsilon2(param.epsilon2),
       rho(param.rho),
+      gauge(param.gauge),
       location(param.location)
     {
     }
@@ -174,6 +191,7 @@ namespace quda {
       mu2(twist_flavor != QUDA_TWIST_NO ? 4. * inv_param.kappa * inv_param.kappa * inv_param.mu * inv_param.mu : 0.0),
       epsilon2(twist_flavor == QUDA_TWIST_NONDEG_DOUBLET ? 4.0 * inv_param.kappa * inv_param.kappa * inv_param.epsilon * inv_param.epsilon : 0.0),
       rho(inv_param.clover_rho),
+      gauge(nullptr),
       location(QUDA_INVALID_FIELD_LOCATION)
     {
       siteSubset = QUDA_FULL_SITE_SUBSET;
@@ -210,6 +228,8 @@ namespace quda {
     double epsilon2; // flavour twisted mass squared
     double rho;
 
+    GaugeField *gauge; /** Gauge field copy the clover term is recomputed from, if on the fly */
+
     QudaCloverFieldOrder order;
     QudaFieldCreate create;
 
@@ -266,6 +286,22 @@ namespace quda {
     */
     bool Reconstruct() const { return reconstruct; }
 
+    /**
+       @return If the clover term is not stored, but is recomputed
+       from the gauge field where it is applied
+    */
+    bool OnTheFly() const { return gauge; }
+
+    /**
+       @return The extended gauge field from which an on-the-fly
+       clover field is recomputed
+    */
+    const GaugeField &Gauge() const
+    {
+      if (!gauge) errorQuda("Clover field %p is not an on-the-fly field", this);
+      return *gauge;
+    }
+
     /**
        @return True if the field is stored in an internal field order
        for the given precision.
@@ -486,18 +522,37 @@ namespace quda {
   */
   void cloverInvert(CloverField &clover, bool computeTraceLog);
 
+  /**
+     @brief Compute the clover field directly from the gauge field,
+     together with its inverse and trace log if requested.  This is a
+     single pass that does the work of computeFmunu, computeClover and
+     cloverInvert without storing the field strength tensor.
+
+     @param[out] clover The clover field (and its inverse if requested)
+     @param[in] u Extended gauge field, with its ghost zone exchanged
+     @param[in] coeff Clover coefficient
+     @param[in] invert Whether to compute the clover inverse
+     @param[in] computeTraceLog Whether to compute the trace logarithm of the clover term
+  */
+  void computeCloverInvert(CloverField &clover, const GaugeField &u, double coeff, bool invert, bool computeTraceLog);
+
   /**
      @brief Compute the force contribution from the solver solution fields
 
      Force(x, mu) = U(x, mu) * sum_i=1^nvec ( P_mu^+ x(x+mu) p(x)^\dag  +  P_mu^- p(x+mu) x(x)^\dag )
 
+     The sum over the solution fields is formed before the force
+     field is updated, so the interior is a single pass over the force
+     field.
+
       M = A_even - kappa^2 * Dslash * A_odd^{-1} * Dslash
       x(even) = M^{-1} b(even)
       x(odd)  = A_odd^{-1} * Dslash * x(even)
       p(even) = M * x(even)
       p(odd)  = A_odd^{-1} * Dslash^dag * M * x(even).
 
-     @param force[out,in] The resulting force field
+     @param force[out,in] The resulting force field, either full or
+     compressed traceless anti-hermitian (reconstruct 10)
      @param U The input gauge field
      @param x Solution field (both parities)
      @param p Intermediate vectors (both parities)
@@ -509,7 +564,8 @@ namespace quda {
   /**
      @brief Compute the outer product from the solver solution fields
      arising from the diagonal term of the fermion bilinear in
-     direction mu,nu and sum to outer product field.
+     direction mu,nu and sum to outer product field.  Up to
+     MAX_NVECTOR solution fields are summed per pass.
 
      @param oprod[out,in] Computed outer product field (tensor matrix field)
      @param x[in] Solution field (both parities)
@@ -535,7 +591,8 @@ namespace quda {
      mu,nu and compute the resulting force given the outer-product
      field
 
-     @param force The computed force field (read/write update)
+     @param force The computed force field (read/write update), either
+     full or compressed traceless anti-hermitian (reconstruct 10)
      @param gauge The input gauge field
      @param oprod The input outer-product field (tensor matrix field)
      @param coeff Multiplicative coefficient (e.g., clover coefficient)
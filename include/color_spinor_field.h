@@ -376,6 +376,9 @@ namespace quda
     ColorSpinorField *even;
     ColorSpinorField *odd;
 
+    // reduced-precision host copy of the field while spilled with compression
+    ColorSpinorField *spill_field;
+
     //! used for deflation eigenvector sets etc.:
     CompositeColorSpinorFieldDescriptor composite_descr; // containes info about the set
     //
@@ -474,6 +477,16 @@ namespace quda
     */
     void createComms(int nFace, bool spin_project = true);
 
+    /**
+       @brief Set the precision used for the ghost zone, e.g., to
+       compress the halo exchange below the field precision.  The
+       ghost buffers and comms handles are resized on the subsequent
+       call to createComms.
+       @param[in] ghost_precision The new ghost precision (if
+       QUDA_INVALID_PRECISION the field precision is used)
+    */
+    void setGhostPrecision(QudaPrecision ghost_precision) const;
+
     /**
        @brief Packs the ColorSpinorField's ghost zone
        @param[in] nFace How many faces to pack (depth)
@@ -775,6 +788,23 @@ namespace quda
     */
     void restore() const;
 
+    /**
+       @brief Spill the field data to host memory and release its
+       device allocation.  If the spill precision is lower than the
+       field precision, the field is written at that precision
+       directly to mapped host memory.
+       @param[in] spill_precision Precision at which to store the spilled data
+       @return Number of bytes transferred to the host
+    */
+    size_t spill(QudaPrecision spill_precision = QUDA_INVALID_PRECISION);
+
+    /**
+       @brief Reallocate the device storage of a spilled field and
+       copy its data back from host memory
+       @return Number of bytes transferred to the device
+    */
+    size_t refill();
+
     /**
       @brief Copy all contents of the field to a host buffer.
       @param[in] the host buffer to copy to.
@@ -833,6 +863,28 @@ namespace quda
   void copyGenericColorSpinor(ColorSpinorField &dst, const ColorSpinorField &src, QudaFieldLocation location,
                               void *Dst = nullptr, const void *Src = nullptr);
 
+  /**
+     @brief Whether the threaded, cache-blocked host reordering
+     engine supports copying between these two fields.  This covers
+     the SPACE_SPIN_COLOR, SPACE_COLOR_SPIN and FLOATN orders in double
+     and single precision with no basis change.
+     @param[in] dst The destination field
+     @param[in] src The source field
+     @return Whether reorderHost can be used
+  */
+  bool reorderHostSupported(const ColorSpinorField &dst, const ColorSpinorField &src);
+
+  /**
+     @brief Copy and reorder between two color-spinor fields on the
+     host using the threaded, cache-blocked host reordering engine.
+     The achieved bandwidth is reported at debug verbosity.
+     @param[out] dst The destination field
+     @param[in] src The source field
+     @param[out] Dst Optional host buffer to write to instead of dst
+     @param[in] Src Optional host buffer to read from instead of src
+  */
+  void reorderHost(ColorSpinorField &dst, const ColorSpinorField &src, void *Dst = nullptr, const void *Src = nullptr);
+
   void genericSource(ColorSpinorField &a, QudaSourceType sourceType, int x, int s, int c);
   int genericCompare(const ColorSpinorField &a, const ColorSpinorField &b, int tol);
 
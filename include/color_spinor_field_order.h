@@ -952,8 +952,12 @@ namespace quda
        @tparam huge_alloc Template parameter that enables 64-bit
        pointer arithmetic for huge allocations (e.g., packed set of
        vectors).  Default is to use 32-bit pointer arithmetic.
+       @tparam ghostFloat Storage data type of the ghost zone.  If this
+       is a fixed-point type, each ghost site carries its own norm,
+       allowing the halo to be compressed below the field precision.
      */
-    template <typename Float, int Ns, int Nc, int N_, bool spin_project = false, bool huge_alloc = false>
+    template <typename Float, int Ns, int Nc, int N_, bool spin_project = false, bool huge_alloc = false,
+              typename ghostFloat = Float>
     struct FloatNOrder {
       static_assert((2 * Ns * Nc) % N_ == 0, "Internal degrees of freedom not divisible by short-vector length");
       static constexpr int length = 2 * Ns * Nc;
@@ -963,11 +967,11 @@ namespace quda
       // if spin projecting, check that short vector length is compatible, if not halve the vector length
       static constexpr int N_ghost = !spin_project ? N : (Ns * Nc) % N == 0 ? N : N / 2;
       static constexpr int M_ghost = length_ghost / N_ghost;
-      using Accessor = FloatNOrder<Float, Ns, Nc, N, spin_project, huge_alloc>;
+      using Accessor = FloatNOrder<Float, Ns, Nc, N, spin_project, huge_alloc, ghostFloat>;
       using real = typename mapper<Float>::type;
       using complex = complex<real>;
       using Vector = typename VectorType<Float, N>::type;
-      using GhostVector = typename VectorType<Float, N_ghost>::type;
+      using GhostVector = typename VectorType<ghostFloat, N_ghost>::type;
       using AllocInt = typename AllocType<huge_alloc>::type;
       using norm_type = float;
       Float *field;
@@ -976,13 +980,13 @@ namespace quda
       const AllocInt norm_offset;
       int volumeCB;
       int faceVolumeCB[4];
-      mutable Float *ghost[8];
+      mutable ghostFloat *ghost[8];
       mutable norm_type *ghost_norm[8];
       int nParity;
       void *backup_h; //! host memory for backing up the field when tuning
       size_t bytes;
 
-      FloatNOrder(const ColorSpinorField &a, int nFace = 1, Float *buffer = 0, Float **ghost_ = 0) :
+      FloatNOrder(const ColorSpinorField &a, int nFace = 1, Float *buffer = 0, ghostFloat **ghost_ = 0) :
         field(buffer ? buffer : (Float *)a.V()),
         norm(buffer ? reinterpret_cast<norm_type *>(reinterpret_cast<char *>(buffer) + a.NormOffset()) :
                       const_cast<norm_type *>(reinterpret_cast<const norm_type *>(a.Norm()))),
@@ -1001,11 +1005,12 @@ namespace quda
       {
         for (int dim = 0; dim < 4; dim++) {
           for (int dir = 0; dir < 2; dir++) {
-            ghost[2 * dim + dir] = comm_dim_partitioned(dim) ? static_cast<Float *>(ghost_[2 * dim + dir]) : nullptr;
+            ghost[2 * dim + dir]
+              = comm_dim_partitioned(dim) ? static_cast<ghostFloat *>(ghost_[2 * dim + dir]) : nullptr;
             ghost_norm[2 * dim + dir] = !comm_dim_partitioned(dim) ?
               nullptr :
               reinterpret_cast<norm_type *>(static_cast<char *>(ghost_[2 * dim + dir])
-                                            + nParity * length_ghost * faceVolumeCB[dim] * sizeof(Float));
+                                            + nParity * length_ghost * faceVolumeCB[dim] * sizeof(ghostFloat));
           }
         }
       }
@@ -1082,8 +1087,9 @@ namespace quda
       __device__ __host__ inline void loadGhost(complex out[length_ghost / 2], int x, int dim, int dir, int parity = 0) const
       {
         real v[length_ghost];
-        norm_type nrm
-          = isFixed<Float>::value ? vector_load<float>(ghost_norm[2 * dim + dir], parity * faceVolumeCB[dim] + x) : 0.0;
+        norm_type nrm = isFixed<ghostFloat>::value ?
+          vector_load<float>(ghost_norm[2 * dim + dir], parity * faceVolumeCB[dim] + x) :
+          0.0;
 
 #pragma unroll
         for (int i = 0; i < M_ghost; i++) {
@@ -1091,7 +1097,7 @@ namespace quda
             ghost[2 * dim + dir], parity * faceVolumeCB[dim] * M_ghost + i * faceVolumeCB[dim] + x);
 #pragma unroll
           for (int j = 0; j < N_ghost; j++)
-            copy_and_scale(v[i * N_ghost + j], reinterpret_cast<Float *>(&vecTmp)[j], nrm);
+            copy_and_scale(v[i * N_ghost + j], reinterpret_cast<ghostFloat *>(&vecTmp)[j], nrm);
         }
 
 #pragma unroll
@@ -1108,7 +1114,7 @@ namespace quda
           v[2 * i + 1] = in[i].imag();
         }
 
-        if (isFixed<Float>::value) {
+        if (isFixed<ghostFloat>::value) {
           norm_type max_[length_ghost / 2];
           // two-pass to increase ILP (assumes length divisible by two, e.g. complex-valued)
 #pragma unroll
@@ -1117,9 +1123,9 @@ namespace quda
           norm_type scale = 0.0;
 #pragma unroll
           for (int i = 0; i < length_ghost / 2; i++) scale = fmaxf(max_[i], scale);
-          ghost_norm[2 * dim + dir][parity * faceVolumeCB[dim] + x] = scale * fixedInvMaxValue<Float>::value;
+          ghost_norm[2 * dim + dir][parity * faceVolumeCB[dim] + x] = scale * fixedInvMaxValue<ghostFloat>::value;
 
-          real scale_inv = fdividef(fixedMaxValue<Float>::value, scale);
+          real scale_inv = fdividef(fixedMaxValue<ghostFloat>::value, scale);
 #pragma unroll
           for (int i = 0; i < length_ghost; i++) v[i] = v[i] * scale_inv;
         }
@@ -1129,7 +1135,8 @@ namespace quda
           GhostVector vecTmp;
           // first do scalar copy converting into storage type
 #pragma unroll
-          for (int j = 0; j < N_ghost; j++) copy_scaled(reinterpret_cast<Float *>(&vecTmp)[j], v[i * N_ghost + j]);
+          for (int j = 0; j < N_ghost; j++)
+            copy_scaled(reinterpret_cast<ghostFloat *>(&vecTmp)[j], v[i * N_ghost + j]);
           // second do vectorized copy into memory
           vector_store(ghost[2 * dim + dir], parity * faceVolumeCB[dim] * M_ghost + i * faceVolumeCB[dim] + x, vecTmp);
         }
@@ -1491,35 +1498,44 @@ namespace quda
   } // namespace colorspinor
 
   // Use traits to reduce the template explosion
-  template <typename T, int Ns, int Nc, bool project = false, bool huge_alloc = false> struct colorspinor_mapper {
+  template <typename T, int Ns, int Nc, bool project = false, bool huge_alloc = false, typename ghostFloat = T>
+  struct colorspinor_mapper {
   };
 
   // double precision
-  template <int Nc, bool huge_alloc> struct colorspinor_mapper<double, 4, Nc, false, huge_alloc> {
-    typedef colorspinor::FloatNOrder<double, 4, Nc, 2, false, huge_alloc> type;
+  template <int Nc, bool huge_alloc, typename ghostFloat>
+  struct colorspinor_mapper<double, 4, Nc, false, huge_alloc, ghostFloat> {
+    typedef colorspinor::FloatNOrder<double, 4, Nc, 2, false, huge_alloc, ghostFloat> type;
   };
-  template <int Nc, bool huge_alloc> struct colorspinor_mapper<double, 4, Nc, true, huge_alloc> {
-    typedef colorspinor::FloatNOrder<double, 4, Nc, 2, true, huge_alloc> type;
+  template <int Nc, bool huge_alloc, typename ghostFloat>
+  struct colorspinor_mapper<double, 4, Nc, true, huge_alloc, ghostFloat> {
+    typedef colorspinor::FloatNOrder<double, 4, Nc, 2, true, huge_alloc, ghostFloat> type;
   };
-  template <int Nc, bool huge_alloc> struct colorspinor_mapper<double, 2, Nc, false, huge_alloc> {
-    typedef colorspinor::FloatNOrder<double, 2, Nc, 2, false, huge_alloc> type;
+  template <int Nc, bool huge_alloc, typename ghostFloat>
+  struct colorspinor_mapper<double, 2, Nc, false, huge_alloc, ghostFloat> {
+    typedef colorspinor::FloatNOrder<double, 2, Nc, 2, false, huge_alloc, ghostFloat> type;
   };
-  template <int Nc, bool huge_alloc> struct colorspinor_mapper<double, 1, Nc, false, huge_alloc> {
-    typedef colorspinor::FloatNOrder<double, 1, Nc, 2, false, huge_alloc> type;
+  template <int Nc, bool huge_alloc, typename ghostFloat>
+  struct colorspinor_mapper<double, 1, Nc, false, huge_alloc, ghostFloat> {
+    typedef colorspinor::FloatNOrder<double, 1, Nc, 2, false, huge_alloc, ghostFloat> type;
   };
 
   // single precision
-  template <int Nc, bool huge_alloc> struct colorspinor_mapper<float, 4, Nc, false, huge_alloc> {
-    typedef colorspinor::FloatNOrder<float, 4, Nc, 4, false, huge_alloc> type;
+  template <int Nc, bool huge_alloc, typename ghostFloat>
+  struct colorspinor_mapper<float, 4, Nc, false, huge_alloc, ghostFloat> {
+    typedef colorspinor::FloatNOrder<float, 4, Nc, 4, false, huge_alloc, ghostFloat> type;
   };
-  template <int Nc, bool huge_alloc> struct colorspinor_mapper<float, 4, Nc, true, huge_alloc> {
-    typedef colorspinor::FloatNOrder<float, 4, Nc, 4, true, huge_alloc> type;
+  template <int Nc, bool huge_alloc, typename ghostFloat>
+  struct colorspinor_mapper<float, 4, Nc, true, huge_alloc, ghostFloat> {
+    typedef colorspinor::FloatNOrder<float, 4, Nc, 4, true, huge_alloc, ghostFloat> type;
   };
-  template <int Nc, bool huge_alloc> struct colorspinor_mapper<float, 2, Nc, false, huge_alloc> {
-    typedef colorspinor::FloatNOrder<float, 2, Nc, 2, false, huge_alloc> type;
+  template <int Nc, bool huge_alloc, typename ghostFloat>
+  struct colorspinor_mapper<float, 2, Nc, false, huge_alloc, ghostFloat> {
+    typedef colorspinor::FloatNOrder<float, 2, Nc, 2, false, huge_alloc, ghostFloat> type;
   };
-  template <int Nc, bool huge_alloc> struct colorspinor_mapper<float, 1, Nc, false, huge_alloc> {
-    typedef colorspinor::FloatNOrder<float, 1, Nc, 2, false, huge_alloc> type;
+  template <int Nc, bool huge_alloc, typename ghostFloat>
+  struct colorspinor_mapper<float, 1, Nc, false, huge_alloc, ghostFloat> {
+    typedef colorspinor::FloatNOrder<float, 1, Nc, 2, false, huge_alloc, ghostFloat> type;
   };
 
 #ifdef FLOAT8
@@ -1529,31 +1545,39 @@ namespace quda
 #endif
 
   // half precision
-  template <int Nc, bool huge_alloc> struct colorspinor_mapper<short, 4, Nc, false, huge_alloc> {
-    typedef colorspinor::FloatNOrder<short, 4, Nc, FLOATN, false, huge_alloc> type;
+  template <int Nc, bool huge_alloc, typename ghostFloat>
+  struct colorspinor_mapper<short, 4, Nc, false, huge_alloc, ghostFloat> {
+    typedef colorspinor::FloatNOrder<short, 4, Nc, FLOATN, false, huge_alloc, ghostFloat> type;
   };
-  template <int Nc, bool huge_alloc> struct colorspinor_mapper<short, 4, Nc, true, huge_alloc> {
-    typedef colorspinor::FloatNOrder<short, 4, Nc, FLOATN, true, huge_alloc> type;
+  template <int Nc, bool huge_alloc, typename ghostFloat>
+  struct colorspinor_mapper<short, 4, Nc, true, huge_alloc, ghostFloat> {
+    typedef colorspinor::FloatNOrder<short, 4, Nc, FLOATN, true, huge_alloc, ghostFloat> type;
   };
-  template <int Nc, bool huge_alloc> struct colorspinor_mapper<short, 2, Nc, false, huge_alloc> {
-    typedef colorspinor::FloatNOrder<short, 2, Nc, 2, false, huge_alloc> type;
+  template <int Nc, bool huge_alloc, typename ghostFloat>
+  struct colorspinor_mapper<short, 2, Nc, false, huge_alloc, ghostFloat> {
+    typedef colorspinor::FloatNOrder<short, 2, Nc, 2, false, huge_alloc, ghostFloat> type;
   };
-  template <int Nc, bool huge_alloc> struct colorspinor_mapper<short, 1, Nc, false, huge_alloc> {
-    typedef colorspinor::FloatNOrder<short, 1, Nc, 2, false, huge_alloc> type;
+  template <int Nc, bool huge_alloc, typename ghostFloat>
+  struct colorspinor_mapper<short, 1, Nc, false, huge_alloc, ghostFloat> {
+    typedef colorspinor::FloatNOrder<short, 1, Nc, 2, false, huge_alloc, ghostFloat> type;
   };
 
   // quarter precision
-  template <int Nc, bool huge_alloc> struct colorspinor_mapper<int8_t, 4, Nc, false, huge_alloc> {
-    typedef colorspinor::FloatNOrder<int8_t, 4, Nc, FLOATN, false, huge_alloc> type;
+  template <int Nc, bool huge_alloc, typename ghostFloat>
+  struct colorspinor_mapper<int8_t, 4, Nc, false, huge_alloc, ghostFloat> {
+    typedef colorspinor::FloatNOrder<int8_t, 4, Nc, FLOATN, false, huge_alloc, ghostFloat> type;
   };
-  template <int Nc, bool huge_alloc> struct colorspinor_mapper<int8_t, 4, Nc, true, huge_alloc> {
-    typedef colorspinor::FloatNOrder<int8_t, 4, Nc, FLOATN, true, huge_alloc> type;
+  template <int Nc, bool huge_alloc, typename ghostFloat>
+  struct colorspinor_mapper<int8_t, 4, Nc, true, huge_alloc, ghostFloat> {
+    typedef colorspinor::FloatNOrder<int8_t, 4, Nc, FLOATN, true, huge_alloc, ghostFloat> type;
   };
-  template <int Nc, bool huge_alloc> struct colorspinor_mapper<int8_t, 2, Nc, false, huge_alloc> {
-    typedef colorspinor::FloatNOrder<int8_t, 2, Nc, 2, false, huge_alloc> type;
+  template <int Nc, bool huge_alloc, typename ghostFloat>
+  struct colorspinor_mapper<int8_t, 2, Nc, false, huge_alloc, ghostFloat> {
+    typedef colorspinor::FloatNOrder<int8_t, 2, Nc, 2, false, huge_alloc, ghostFloat> type;
   };
-  template <int Nc, bool huge_alloc> struct colorspinor_mapper<int8_t, 1, Nc, false, huge_alloc> {
-    typedef colorspinor::FloatNOrder<int8_t, 1, Nc, 2, false, huge_alloc> type;
+  template <int Nc, bool huge_alloc, typename ghostFloat>
+  struct colorspinor_mapper<int8_t, 1, Nc, false, huge_alloc, ghostFloat> {
+    typedef colorspinor::FloatNOrder<int8_t, 1, Nc, 2, false, huge_alloc, ghostFloat> type;
   };
 
 #undef FLOATN
@@ -1,9 +1,56 @@
 #pragma once
 
+#include <vector>
 #include <quda_internal.h>
 #include <quda.h>
 
 namespace quda
 {
   void contractQuda(const ColorSpinorField &x, const ColorSpinorField &y, void *result, QudaContractType cType);
+
+  /**
+     @brief Contract x and y and project onto spatial momenta, summing
+     over each timeslice.  Sparse momentum sets are projected with
+     phase factors fused into the contraction; dense sets use a
+     spatial FFT of the contraction.  Either way only the summed
+     correlators are returned.
+     @param[in] x Left spinor (conjugated)
+     @param[in] y Right spinor
+     @param[out] result Correlators, indexed as ((m * 16 + g) * T + t)
+     with t the global timeslice
+     @param[in] cType Which type of contraction (open or degrand-rossi)
+     @param[in] source_position Global coordinates of the source, which
+     is the origin of the phase exp(-i p.(x - x_0))
+     @param[in] mom Spatial momenta in units of 2 pi / L, three per momentum
+     @param[in] n_mom Number of momenta
+   */
+  void contractSummedQuda(const ColorSpinorField &x, const ColorSpinorField &y, std::vector<Complex> &result,
+                          QudaContractType cType, const int *source_position, const int *mom, int n_mom);
+
+  /**
+     @brief Meson two-point functions of two propagators for a list of
+     gamma insertions, C(t) = sum_x Tr[G_snk S_1(x) G_src g5 S_2(x)^dag g5],
+     evaluated in a single pass over the propagators
+     @param[in] S1 The 12 spin-color columns of the first propagator,
+     with column = 3 * spin + color
+     @param[in] S2 The 12 spin-color columns of the second propagator
+     @param[out] result Correlators, indexed as (k * T + t) with t the
+     global timeslice
+     @param[in] gamma Sink and source gamma structure of each insertion,
+     two per insertion in the QudaContractType Degrand-Rossi ordering
+     @param[in] n_gamma Number of insertions
+   */
+  void contractMesonQuda(const std::vector<ColorSpinorField *> &S1, const std::vector<ColorSpinorField *> &S2,
+                         std::vector<Complex> &result, const int *gamma, int n_gamma);
+
+  /**
+     @brief Nucleon-like two-point function with color antisymmetric
+     contractions, for the interpolator eps_abc (q_1a^T C g5 q_2b) q_1c
+     projected with (1 + g4) / 2
+     @param[in] S1 The 12 spin-color columns of the doubly represented flavor
+     @param[in] S2 The 12 spin-color columns of the singly represented flavor
+     @param[out] result Correlator for each global timeslice
+   */
+  void contractBaryonQuda(const std::vector<ColorSpinorField *> &S1, const std::vector<ColorSpinorField *> &S2,
+                          std::vector<Complex> &result);
 } // namespace quda
@@ -58,6 +58,8 @@ namespace quda {
 
     QudaPrecision halo_precision; // only does something for DiracCoarse at present
 
+    QudaPrecision wilson_halo_precision; // compressed halo precision for the Wilson dslash (DiracWilson only)
+
     // for multigrid only
     Transfer *transfer; 
     Dirac *dirac;
@@ -83,6 +85,7 @@ namespace quda {
       tmp1(0),
       tmp2(0),
       halo_precision(QUDA_INVALID_PRECISION),
+      wilson_halo_precision(QUDA_INVALID_PRECISION),
       need_bidirectional(false),
 #ifdef QUDA_MMA_AVAILABLE
       use_mma(true),
@@ -114,6 +117,7 @@ namespace quda {
       printfQuda("tm_rho = %g\n", tm_rho);
       printfQuda("epsilon = %g\n", epsilon);
       printfQuda("halo_precision = %d\n", halo_precision);
+      printfQuda("wilson_halo_precision = %d\n", wilson_halo_precision);
       for (int i=0; i<QUDA_MAX_DIM; i++) printfQuda("commDim[%d] = %d\n", i, commDim[i]);
       for (int i = 0; i < Ls; i++)
         printfQuda(
@@ -415,6 +419,8 @@ namespace quda {
   class DiracWilson : public Dirac {
 
   protected:
+    QudaPrecision wilson_halo_precision; // precision of the compressed halo, QUDA_INVALID_PRECISION for none
+
     void initConstants();
 
   public:
@@ -2008,6 +2014,23 @@ public:
     virtual void operator()(ColorSpinorField &out, const ColorSpinorField &in, ColorSpinorField &Tmp1,
                             ColorSpinorField &Tmp2) const = 0;
 
+    /**
+       @brief Apply the operator to each vector of a set in turn,
+       out[i] = A in[i], sharing the temporaries between the
+       applications.  This is a loop over single applications, not a
+       batched application.
+       @param[out] out Output vectors
+       @param[in] in Input vectors
+       @param[in] Tmp1 Temporary used by the operator
+       @param[in] Tmp2 Temporary used by the operator
+    */
+    void apply(std::vector<ColorSpinorField *> &out, const std::vector<ColorSpinorField *> &in,
+               ColorSpinorField &Tmp1, ColorSpinorField &Tmp2) const
+    {
+      if (out.size() != in.size()) errorQuda("Output batch size %lu does not match input %lu", out.size(), in.size());
+      for (auto i = 0u; i < in.size(); i++) (*this)(*out[i], *in[i], Tmp1, Tmp2);
+    }
+
     unsigned long long flops() const { return dirac->Flops(); }
 
     QudaMatPCType getMatPCType() const { return dirac->getMatPCType(); }
@@ -237,9 +237,17 @@ namespace quda
     return true;
   }
 
-  template <typename Float_, int nDim_> struct DslashArg {
+  /**
+     @brief Base parameter struct for the dslash kernels
+     @tparam Float_ Storage type of the fields
+     @tparam nDim_ Number of dimensions of the operator
+     @tparam ghostFloat_ Storage type of the spinor halo: if this is
+     lower precision than Float_ the halo exchange is compressed
+   */
+  template <typename Float_, int nDim_, typename ghostFloat_ = Float_> struct DslashArg {
 
     using Float = Float_;
+    using ghostFloat = ghostFloat_;
     using real = typename mapper<Float>::type;
     static constexpr int nDim = nDim_;
 
@@ -351,6 +359,8 @@ namespace quda
       }
 
       if (in.Location() == QUDA_CUDA_FIELD_LOCATION) {
+        // set the halo precision this dslash packs to, resetting any compression left by a prior dslash
+        in.setGhostPrecision(static_cast<QudaPrecision>(sizeof(ghostFloat)));
         // create comms buffers - need to do this before we grab the dslash constants
         const_cast<ColorSpinorField &>(in).createComms(nFace, spin_project);
       }
@@ -403,7 +413,8 @@ namespace quda
     }
   };
 
-  template <typename Float, int nDim> std::ostream &operator<<(std::ostream &out, const DslashArg<Float, nDim> &arg)
+  template <typename Float, int nDim, typename ghostFloat>
+  std::ostream &operator<<(std::ostream &out, const DslashArg<Float, nDim, ghostFloat> &arg)
   {
     out << "parity = " << arg.parity << std::endl;
     out << "nParity = " << arg.nParity << std::endl;
@@ -155,9 +155,13 @@ namespace quda
      @param[in] dagger Whether this is for the dagger operator
      @param[in] comm_override Override for which dimensions are partitioned
      @param[in] profile The TimeProfile used for profiling the dslash
+     @param[in] halo_precision Precision of the halo exchange: if
+     below the field precision the halo is compressed to this
+     precision, with a per-site norm for fixed-point halos
   */
   void ApplyWilson(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U, double kappa,
-                   const ColorSpinorField &x, int parity, bool dagger, const int *comm_override, TimeProfile &profile);
+                   const ColorSpinorField &x, int parity, bool dagger, const int *comm_override, TimeProfile &profile,
+                   QudaPrecision halo_precision = QUDA_INVALID_PRECISION);
 
   /**
      @brief Driver for applying the Wilson-clover stencil
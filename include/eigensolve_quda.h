@@ -38,6 +38,8 @@ namespace quda
     int max_restarts;
     int check_interval;
     int batched_rotate;
+    bool gemm_rotate;
+    int gemm_rotate_workspace;
     int block_size;
     int iter;
     int iter_converged;
@@ -49,6 +51,8 @@ namespace quda
 
     std::vector<double> residua;
 
+    host_timer_t rotate_timer; /** Time spent rotating the Krylov space */
+
     // Device side vector workspace
     std::vector<ColorSpinorField *> r;
     std::vector<ColorSpinorField *> d_vecs_tmp;
@@ -146,6 +150,15 @@ namespace quda
     */
     void matVec(const DiracMatrix &mat, ColorSpinorField &out, const ColorSpinorField &in);
 
+    /**
+       @brief Applies the specified matVec operation to a block of
+       vectors through the batched operator
+       @param[in] mat Matrix operator
+       @param[in] out Output spinors
+       @param[in] in Input spinors
+    */
+    void matVec(const DiracMatrix &mat, std::vector<ColorSpinorField *> &out, const std::vector<ColorSpinorField *> &in);
+
     /**
        @brief Promoted the specified matVec operation:
        M, Mdag, MMdag, MdagM to a Chebyshev polynomial
@@ -155,6 +168,17 @@ namespace quda
     */
     void chebyOp(const DiracMatrix &mat, ColorSpinorField &out, const ColorSpinorField &in);
 
+    /**
+       @brief Promoted the specified matVec operation to a Chebyshev
+       polynomial, applied to a block of vectors at once.  Each degree
+       is a batched matVec followed by a single fused recurrence
+       kernel over the whole block.
+       @param[in] mat Matrix operator
+       @param[in] out Output spinors
+       @param[in] in Input spinors
+    */
+    void chebyOp(const DiracMatrix &mat, std::vector<ColorSpinorField *> &out, const std::vector<ColorSpinorField *> &in);
+
     /**
        @brief Estimate the spectral radius of the operator for the max value of the
        Chebyshev polynomial
@@ -633,6 +657,41 @@ namespace quda
                  const QudaEigSpectrumType spec_type);
   };
 
+  /**
+     @brief Whether the tiled GEMM rotation supports the given field
+     @param[in] v Representative field of the space to be rotated
+     @return True if supported
+  */
+  bool rotateGEMMSupported(const ColorSpinorField &v);
+
+  /**
+     @brief Rotate a vector space in place, v_j = sum_i v_i rot(i, j)
+     for j < keep.  The rotation is performed as a sequence of dense
+     GEMMs over tiles of the vectors, with a workspace of at most
+     (roughly) workspace vectors.
+     @param[in,out] v The vector space, of which the first dim are rotated
+     @param[in] rot Row-major dim x keep rotation matrix (double or Complex)
+     @param[in] is_complex Whether rot is a complex matrix
+     @param[in] dim The number of rows in the rotation matrix
+     @param[in] keep The number of columns in the rotation matrix
+     @param[in] workspace The tile workspace size in units of vectors
+  */
+  void rotateGEMM(std::vector<ColorSpinorField *> &v, const void *rot, bool is_complex, int dim, int keep,
+                  int workspace);
+
+  /**
+     @brief Fused Chebyshev three-term recurrence over a block of
+     vectors, y_i = a * Ax_i + b * x_i + c * y_i.  Ax may alias y.
+     @param[in,out] y The vectors C_{m-1}, overwritten with C_{m+1}
+     @param[in] x The vectors C_{m}
+     @param[in] Ax The operator applied to C_{m}
+     @param[in] a Coefficient of Ax
+     @param[in] b Coefficient of x
+     @param[in] c Coefficient of y
+  */
+  void chebyRecurrence(std::vector<ColorSpinorField *> &y, const std::vector<ColorSpinorField *> &x,
+                       const std::vector<ColorSpinorField *> &Ax, double a, double b, double c);
+
   /**
      arpack_solve()
 
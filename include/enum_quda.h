@@ -551,6 +551,19 @@ typedef enum QudaWFlowType_s {
   QUDA_WFLOW_TYPE_INVALID = QUDA_INVALID_ENUM
 } QudaWFlowType;
 
+typedef enum QudaHMCIntegratorType_s {
+  QUDA_HMC_LEAPFROG,       // second-order leapfrog
+  QUDA_HMC_OMELYAN,        // second-order minimum-norm (Omelyan) scheme
+  QUDA_HMC_FORCE_GRADIENT, // fourth-order force-gradient scheme
+  QUDA_HMC_INTEGRATOR_INVALID = QUDA_INVALID_ENUM
+} QudaHMCIntegratorType;
+
+typedef enum QudaHMCTermType_s {
+  QUDA_HMC_GAUGE_TERM,    // plaquette plus rectangle gauge action evaluated internally
+  QUDA_HMC_EXTERNAL_TERM, // action and force supplied through callbacks
+  QUDA_HMC_TERM_INVALID = QUDA_INVALID_ENUM
+} QudaHMCTermType;
+
 // Allows to choose an appropriate external library
 typedef enum QudaExtLibType_s {
   QUDA_CUSOLVE_EXTLIB,
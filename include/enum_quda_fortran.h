@@ -494,6 +494,17 @@
 #define QUDA_CONTRACT_GAMMA_S34 15
 #define QUDA_CONTRACT_GAMMA_INVALID QUDA_INVALID_ENUM
 
+#define QudaHMCIntegratorType integer(4)
+#define QUDA_HMC_LEAPFROG 0
+#define QUDA_HMC_OMELYAN 1
+#define QUDA_HMC_FORCE_GRADIENT 2
+#define QUDA_HMC_INTEGRATOR_INVALID QUDA_INVALID_ENUM
+
+#define QudaHMCTermType integer(4)
+#define QUDA_HMC_GAUGE_TERM 0
+#define QUDA_HMC_EXTERNAL_TERM 1
+#define QUDA_HMC_TERM_INVALID QUDA_INVALID_ENUM
+
 #define QudaExtLibType integer(4)
 #define QUDA_CUSOLVE_EXTLIB 0
 #define QUDA_EIGEN_EXTLIB 1
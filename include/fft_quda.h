@@ -0,0 +1,159 @@
+#pragma once
+
+#include <vector>
+#include <quda_internal.h>
+
+/**
+   @file fft_quda.h
+
+   @brief Complex-to-complex FFTs of lattice-ordered data.  Data are
+   stored lexicographically over the local four-dimensional volume
+   (x fastest), with a batch of fields at a stride of the local
+   volume.  Transforms along dimensions that are local to this
+   process are done using the native FFT library of the target (e.g.,
+   cuFFT) for device data, or the built-in mixed-radix FFT for host
+   data.  Transforms along partitioned dimensions are done with the
+   built-in FFT following a distributed transpose, so each process
+   transforms complete lines over the global extent.  Transforms are
+   unnormalized.
+ */
+
+namespace quda
+{
+
+  namespace fft
+  {
+
+    constexpr int forward = -1;
+    constexpr int inverse = 1;
+
+    /**
+       The native namespace is where target-specific FFT libraries are
+       deployed.  In the case of CUDA, this corresponds to cuFFT.
+     */
+    namespace native
+    {
+
+      /**
+         @return Whether a native FFT library is available
+       */
+      bool available();
+
+      /**
+         @brief Create a batched plan for an in-place transform of
+         rank-dimensional arrays, where element i of batch b is found
+         at b * dist + i * stride
+         @param[in] rank Dimension of the transform (at most 3)
+         @param[in] n Array extents, slowest varying first
+         @param[in] stride Stride between consecutive array elements
+         @param[in] dist Stride between batches
+         @param[in] batch Number of batches
+         @param[in] precision Precision of the data
+         @return Opaque plan handle
+       */
+      void *create(int rank, const int n[], int stride, int dist, int batch, QudaPrecision precision);
+
+      /**
+         @brief Execute a plan in place
+         @param[in] plan The plan
+         @param[in,out] data Device pointer to the data
+         @param[in] direction Transform direction (fft::forward or fft::inverse)
+         @param[in] precision Precision of the data
+       */
+      void execute(void *plan, void *data, int direction, QudaPrecision precision);
+
+      /**
+         @brief Destroy a plan
+         @param[in] plan The plan
+       */
+      void destroy(void *plan);
+
+    } // namespace native
+
+    /**
+       The generic namespace holds the built-in host FFT, which
+       supports all extents (using radix 2, 3, 4 and generic odd prime
+       butterflies) and is threaded over lines with OpenMP.
+     */
+    namespace generic
+    {
+
+      /**
+         @brief Transform host data along a single dimension that is
+         local to this process
+         @param[in,out] data Host pointer to the data
+         @param[in] X Local lattice dimensions
+         @param[in] dim Dimension to transform
+         @param[in] n_batch Number of fields
+         @param[in] direction Transform direction
+         @param[in] precision Precision of the data
+       */
+      void transform(void *data, const int X[4], int dim, int n_batch, int direction, QudaPrecision precision);
+
+      /**
+         @brief Transform host data along a single partitioned
+         dimension.  The lines along dim are distributed evenly over
+         the processes in that dimension by an all-to-all exchange,
+         transformed over the global extent, and returned.
+         @param[in,out] data Host pointer to the data
+         @param[in] X Local lattice dimensions
+         @param[in] dim Dimension to transform
+         @param[in] n_batch Number of fields
+         @param[in] direction Transform direction
+         @param[in] precision Precision of the data
+       */
+      void transform_distributed(void *data, const int X[4], int dim, int n_batch, int direction,
+                                 QudaPrecision precision);
+
+    } // namespace generic
+
+    /**
+       @brief Multi-dimensional transform of a batch of lattice
+       fields in a given location
+     */
+    class Plan
+    {
+      struct NativePlan {
+        void *handle;  // native plan
+        size_t offset; // element offset between executions
+        int count;     // number of executions
+      };
+
+      int X[4];
+      bool dims[4];
+      int n_batch;
+      QudaPrecision precision;
+      QudaFieldLocation location;
+      std::vector<NativePlan> plans;
+
+    public:
+      /**
+         @param[in] X Local lattice dimensions
+         @param[in] dims Which dimensions to transform
+         @param[in] n_batch Number of fields
+         @param[in] precision Precision of the data (single or double)
+         @param[in] location Location of the data
+       */
+      Plan(const int X[4], const bool dims[4], int n_batch, QudaPrecision precision, QudaFieldLocation location);
+
+      ~Plan();
+
+      Plan(const Plan &) = delete;
+      Plan &operator=(const Plan &) = delete;
+
+      /**
+         @brief Apply the transform in place
+         @param[in,out] data Pointer to the data
+         @param[in] direction Transform direction (fft::forward or fft::inverse)
+       */
+      void apply(void *data, int direction);
+
+      /**
+         @return Estimated flops of a single application
+       */
+      double flops() const;
+    };
+
+  } // namespace fft
+
+} // namespace quda
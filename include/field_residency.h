@@ -0,0 +1,136 @@
+#pragma once
+
+#include <vector>
+#include <lattice_field.h>
+
+/**
+   @file field_residency.h
+
+   @brief Device-memory oversubscription manager.  Large fields that
+   persist between API calls (null-space vectors, deflation spaces,
+   chronological bases, smeared gauge fields) can be registered as
+   spillable.  When device memory runs short, either because an
+   allocation fails or because it would exceed the budget set with
+   QUDA_DEVICE_MEMORY_BUDGET (in MiB), the least-recently-used
+   registered fields are spilled to host memory, and are paged back
+   to the device when next acquired.  Optionally, color-spinor fields
+   can be spilled at reduced precision (QUDA_SPILL_PRECISION, set to
+   the number of bytes per real number), trading accuracy for PCIe
+   traffic and host memory.
+
+   A registered field may only be accessed between a call to
+   acquire(), which refills it if needed, and the matching call to
+   release(); fields that are never acquired must not be accessed
+   once registered.  Aliases and references to a registered field's
+   storage are not updated when it is refilled, so such fields must
+   not be registered.
+ */
+
+namespace quda
+{
+
+  namespace residency
+  {
+
+    /**
+       @brief Spill and refill statistics
+     */
+    struct Stats {
+      long long spills;    // number of fields spilled to the host
+      long long refills;   // number of fields paged back to the device
+      size_t spill_bytes;  // bytes transferred to the host
+      size_t refill_bytes; // bytes transferred back to the device
+      size_t freed_bytes;  // device memory released by spilling
+    };
+
+    /**
+       @brief Register a field as spillable.  Fields not allocated in
+       device memory, and fields already registered, are ignored.
+       @param[in] field The field to register
+     */
+    void add(LatticeField &field);
+
+    /**
+       @brief Deregister a field.  This is called when a field is
+       destroyed, so need not be called explicitly.
+       @param[in] field The field to deregister
+     */
+    void remove(const LatticeField &field);
+
+    /**
+       @brief Mark a field as in use: if it is spilled it is paged
+       back to the device, and it will not be spilled until the
+       matching release.  Unregistered fields are ignored.
+       @param[in] field The field to acquire
+     */
+    void acquire(LatticeField &field);
+
+    /**
+       @brief Mark a field as no longer in use, so it is again a
+       candidate for spilling.  Unregistered fields are ignored.
+       @param[in] field The field to release
+     */
+    void release(LatticeField &field);
+
+    template <typename T> void add(const std::vector<T *> &fields)
+    {
+      for (auto &f : fields) add(*f);
+    }
+
+    template <typename T> void acquire(const std::vector<T *> &fields)
+    {
+      for (auto &f : fields) acquire(*f);
+    }
+
+    template <typename T> void release(const std::vector<T *> &fields)
+    {
+      for (auto &f : fields) release(*f);
+    }
+
+    /**
+       @brief Spill least-recently-used fields that are not in use
+       until at least the requested number of bytes has been freed,
+       or no candidates remain.  The copies to the host are stream
+       ordered, but the freed allocations are then released to the
+       device, which synchronizes it.
+       @param[in] bytes Amount of device memory to free
+       @return Amount of device memory freed
+     */
+    size_t evict(size_t bytes);
+
+    /**
+       @brief Ensure that an allocation of the requested size fits
+       within the device memory budget, spilling fields if needed.
+       This is called by the device allocator, and is a no-op if no
+       budget has been set.
+       @param[in] bytes Size of the pending allocation
+     */
+    void reserve(size_t bytes);
+
+    /**
+       @brief Set the device memory budget (zero for no budget)
+       @param[in] bytes Budget in bytes
+     */
+    void set_budget(size_t bytes);
+
+    /**
+       @brief Set the precision at which color-spinor fields are
+       spilled (QUDA_INVALID_PRECISION for the native precision)
+       @param[in] precision Spill precision
+     */
+    void set_spill_precision(QudaPrecision precision);
+
+    /**
+       @return The spill and refill statistics
+     */
+    const Stats &get_stats();
+
+    /**
+       @brief Print the spill and refill statistics, if any spills
+       have occurred
+     */
+    void print_stats();
+
+  } // namespace residency
+
+} // namespace quda
@@ -613,6 +613,21 @@ namespace quda {
     */
     void restore() const;
 
+    /**
+       @brief Spill the gauge field to pinned host memory and release
+       its device allocation.  Gauge fields are always spilled at
+       their native precision.
+       @return Number of bytes transferred to the host
+    */
+    size_t spill(QudaPrecision = QUDA_INVALID_PRECISION);
+
+    /**
+       @brief Reallocate the device storage of a spilled gauge field
+       and copy its data back from host memory
+       @return Number of bytes transferred to the device
+    */
+    size_t refill();
+
     /**
       @brief If managed memory and prefetch is enabled, prefetch
       the gauge field and buffers to the CPU or the GPU
@@ -755,6 +770,28 @@ namespace quda {
   void copyGenericGauge(GaugeField &out, const GaugeField &in, QudaFieldLocation location, void *Out = 0, void *In = 0,
                         void **ghostOut = 0, void **ghostIn = 0, int type = 0);
 
+  /**
+     @brief Whether the threaded, cache-blocked host reordering
+     engine supports copying the body between these two gauge fields.
+     This covers the QDP, MILC and FLOAT2 orders with no
+     reconstruction, in double and single precision.
+     @param[in] out The output field
+     @param[in] in The input field
+     @return Whether reorderHost can be used
+  */
+  bool reorderHostSupported(const GaugeField &out, const GaugeField &in);
+
+  /**
+     @brief Copy and reorder the body of a gauge field on the host
+     using the threaded, cache-blocked host reordering engine.  The
+     achieved bandwidth is reported at debug verbosity.
+     @param[out] out The output field
+     @param[in] in The input field
+     @param[out] Out Optional host buffer to write to instead of out
+     @param[in] In Optional host buffer to read from instead of in
+  */
+  void reorderHost(GaugeField &out, const GaugeField &in, void *Out = nullptr, const void *In = nullptr);
+
   /**
     @brief This function is used for copying from a source gauge field to a destination gauge field
       with an offset.
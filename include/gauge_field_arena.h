@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <gauge_field.h>
+
+/**
+   @file gauge_field_arena.h
+
+   @brief Device memory arena for the intermediate gauge fields of a
+   pipeline that is run repeatedly, e.g., link smearing after every
+   gauge update.  The arena is a single allocation split into slots,
+   and fields are created as references into a slot, so repeated runs
+   with the same geometry do not allocate.  Fields whose lifetimes do
+   not overlap may share a slot, which is sized for the largest of
+   them.
+ */
+
+namespace quda
+{
+
+  class GaugeFieldArena
+  {
+    void *buffer = nullptr;         // the arena allocation
+    size_t bytes = 0;               // size of the allocation
+    std::vector<size_t> slot_offset; // offset of each slot
+    std::vector<size_t> slot_bytes;  // size of each slot
+
+  public:
+    GaugeFieldArena() = default;
+    GaugeFieldArena(const GaugeFieldArena &) = delete;
+    GaugeFieldArena &operator=(const GaugeFieldArena &) = delete;
+    ~GaugeFieldArena();
+
+    /**
+       @brief Return the number of bytes a device field with the given
+       parameters occupies
+       @param[in] param Field parameters
+     */
+    static size_t Bytes(const GaugeFieldParam &param);
+
+    /**
+       @brief Lay out the arena, reallocating only if the layout
+       requires more memory than the present allocation.  All fields
+       created from the arena must have been destroyed.
+       @param[in] slot The fields that share each slot
+     */
+    void reserve(const std::vector<std::vector<GaugeFieldParam>> &slot);
+
+    /**
+       @brief Create a device field that references a given slot.  The
+       field contents are undefined.
+       @param[in] slot The slot index
+       @param[in] param Field parameters, which must be among those the slot was reserved for
+     */
+    std::unique_ptr<cudaGaugeField> create(int slot, const GaugeFieldParam &param);
+
+    /**
+       @brief Release the arena allocation
+     */
+    void free();
+
+    /**
+       @brief Return the size of the arena allocation
+     */
+    size_t Size() const { return bytes; }
+  };
+
+} // namespace quda
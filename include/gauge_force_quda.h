@@ -4,7 +4,9 @@
 namespace quda {
 
   /**
-     @brief Compute the gauge-force contribution to the momentum
+     @brief Compute the gauge-force contribution to the momentum.
+     The paths are compiled into a program that forms the partial
+     products shared between paths only once per site.
      @param[out] mom Momentum field
      @param[in] u Gauge field (extended when running on multiple GPUs)
      @param[in] coeff Step-size coefficient
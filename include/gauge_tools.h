@@ -1,3 +1,4 @@
+#include <vector>
 #include <random_quda.h>
 #include <timer.h>
 
@@ -13,6 +14,43 @@ namespace quda
    */
   void gaugeObservables(GaugeField &u, QudaGaugeObservableParam &param, TimeProfile &profile);
 
+  /**
+   * @brief Compute the plaquette, clover-leaf field energy and
+   * topological charge, and optionally the rectangle and the charge
+   * density, in a single pass over the gauge field without forming
+   * the field-strength tensor.
+   * @param[in] u Extended gauge field upon which we are measuring.
+   * @param[in,out] param Parameter struct that defines which
+   * optional observables we are making and the resulting observables.
+   * @param[out] qdensity Charge density, in the same location as u,
+   * if requested
+   */
+  void gaugeObservablesFused(const GaugeField &u, QudaGaugeObservableParam &param, void *qdensity);
+
+  /**
+   * @brief Compute the volume-averaged Polyakov loop, by extending a
+   * temporal line one link at a time around the lattice.
+   * @param[out] ploop Real and imaginary parts of the Polyakov loop
+   * @param[out] density Optional device array of complex doubles,
+   * into which the loop at each local spatial site is written
+   * @param[in] u Extended gauge field upon which we are measuring
+   */
+  void polyakovLoop(double ploop[2], void *density, const GaugeField &u);
+
+  /**
+   * @brief Compute all R x T Wilson loops up to the given extents,
+   * averaged over the volume and the spatial orientations.  The
+   * spatial and temporal lines are built incrementally, so each
+   * extent reuses the products from the previous one, and all
+   * temporal extents at a given R are summed in a single batched
+   * reduction.
+   * @param[out] loops The R x T loop at index (R - 1) * t_max + T - 1
+   * @param[in] u Extended gauge field upon which we are measuring
+   * @param[in] r_max Maximum spatial extent
+   * @param[in] t_max Maximum temporal extent
+   */
+  void wilsonLoops(std::vector<double> &loops, const GaugeField &u, int r_max, int t_max);
+
   /**
    * @brief Project the input gauge field onto the SU(3) group.  This
    * is a destructive operation.  The number of link failures is
@@ -107,8 +145,13 @@ namespace quda
      @param[in] dataOr Input gauge field
      @param[in] epsilon Step size
      @param[in] wflow_type Wilson (1x1) or Symanzik improved (2x1) staples
+     @param[in] err Optional temp space for the embedded second-order
+     step, in which case the local integration error is estimated
+     @return The maximum over links of the distance between the
+     third- and second-order steps if err is set, else zero
   */
-  void WFlowStep(GaugeField &out, GaugeField &temp, GaugeField &in, double epsilon, QudaWFlowType wflow_type);
+  double WFlowStep(GaugeField &out, GaugeField &temp, GaugeField &in, double epsilon, QudaWFlowType wflow_type,
+                   GaugeField *err = nullptr);
 
   /**
    * @brief Gauge fixing with overrelaxation with support for single and multi GPU.
@@ -127,7 +170,10 @@ namespace quda
                       const double relax_boost, const double tolerance, const int reunit_interval, const int stopWtheta);
 
   /**
-   * @brief Gauge fixing with Steepest descent method with FFTs with support for single GPU only.
+   * @brief Gauge fixing with Steepest descent method with FFTs.  Device
+   * and native-order host fields are supported.  On partitioned
+   * lattices the field must be extended, and the FFTs along partitioned
+   * dimensions use distributed transposes.
    * @param[in,out] data, quda gauge field
    * @param[in] gauge_dir, 3 for Coulomb gauge fixing, other for Landau gauge fixing
    * @param[in] Nsteps, maximum number of steps to perform gauge fixing
@@ -1,11 +1,15 @@
 #ifndef _GAUGE_UPDATE_QUDA_H_
 #define _GAUGE_UPDATE_QUDA_H_
 
+#include <cstddef>
+
 namespace quda {
 
+  class GaugeField;
+
   /**
      Evolve the gauge field by step size dt using the momentuim field
-     @param out Updated gauge field
+     @param out Updated gauge field, which may alias the input field
      @param dt Step size 
      @param in Input gauge field
      @param mom Momentum field
@@ -15,6 +19,69 @@ namespace quda {
   void updateGaugeField(GaugeField &out, double dt, const GaugeField& in, 
 			const GaugeField& mom, bool conj_mom, bool exact);
 
+  /**
+     Evolve the gauge field with a combination of the momentum and a
+     force field, out = exp(a mom + b force) in, as needed for the
+     displaced links of force-gradient integrators.  The exponential
+     is exact.  With out distinct from in, this writes a temporary
+     shifted field and leaves in untouched, and the momentum is not
+     read when a is zero.
+     @param out Updated gauge field, which may alias the input field
+     @param a Coefficient of the momentum
+     @param in Input gauge field
+     @param mom Momentum field
+     @param b Coefficient of the force
+     @param force Force field, in the same layout as the momentum
+     @param conj_mom Whether we conjugate the exponent
+   */
+  void updateGaugeField(GaugeField &out, double a, const GaugeField &in, const GaugeField &mom, double b,
+                        const GaugeField &force, bool conj_mom);
+
+  /**
+     @brief Per-link parameters of the exponential of a momentum
+     field.  They scale linearly with the step size, so after the
+     first update that uses the cache has computed them, further
+     updates with the same momentum at any step size skip the spectral
+     part of the exponential.  Since the momentum is usually updated in
+     place, the cache must be invalidated whenever it changes.
+   */
+  class GaugeUpdateCache
+  {
+    void *exp_param = nullptr;       // (u, w) of each momentum link at unit step
+    size_t bytes = 0;                // size of the allocation
+    const GaugeField *mom = nullptr; // momentum the parameters belong to, or nullptr when invalid
+    bool conj_mom = false;           // whether the parameters belong to the conjugate momentum
+
+  public:
+    GaugeUpdateCache() = default;
+    GaugeUpdateCache(const GaugeUpdateCache &) = delete;
+    GaugeUpdateCache &operator=(const GaugeUpdateCache &) = delete;
+    ~GaugeUpdateCache();
+
+    /**
+       @brief Mark the cache as invalid, which must be done whenever the momentum changes
+     */
+    void invalidate() { mom = nullptr; }
+
+    friend void updateGaugeField(GaugeField &out, double dt, const GaugeField &in, const GaugeField &mom,
+                                 GaugeUpdateCache &cache, bool conj_mom);
+  };
+
+  /**
+     Evolve the gauge field by step size dt using the momentum field,
+     reusing the parameters of the exponential stored in the cache
+     when it is valid for this momentum, and computing them otherwise.
+     The exponential is exact.
+     @param out Updated gauge field, which may alias the input field
+     @param dt Step size
+     @param in Input gauge field
+     @param mom Momentum field
+     @param cache Cache of the exponential parameters of mom
+     @param conj_mom Whether we conjugate the momentum in the exponential
+   */
+  void updateGaugeField(GaugeField &out, double dt, const GaugeField &in, const GaugeField &mom,
+                        GaugeUpdateCache &cache, bool conj_mom);
+
 } // namespace quda
 
 #endif // _GAUGE_UPDATE_QUDA_H_
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <quda.h>
+#include <gauge_field.h>
+#include <timer.h>
+
+namespace quda
+{
+
+  /**
+     @brief Multi-timescale molecular-dynamics integrator that runs a
+     complete HMC trajectory on resident fields.  Level l applies the
+     forces of the terms assigned to it with the scheme
+     integrator[l], and each of its position updates integrates level
+     l + 1 over the same interval; on the innermost level the position
+     update is the gauge-field update itself.  The boundary momentum
+     updates of consecutive steps are merged, so a leapfrog step costs
+     one force evaluation per level, an Omelyan step two and a
+     force-gradient step three.
+   */
+  class HMCIntegrator
+  {
+    /**
+       Merged plaquette and rectangle staples of the gauge terms on a
+       given level, in the layout expected by gaugeForce
+     */
+    struct GaugePaths {
+      std::vector<int> path;         // path storage
+      std::vector<int *> path_ptr;   // pointer to each path
+      int **input_path[4];           // paths of each direction
+      std::vector<int> length;       // length of each path
+      std::vector<double> coeff;     // coefficient of each path (including beta / 3)
+      int num_paths = 0;             // number of paths per direction
+      std::string name;              // name reported to the force monitor
+      int term = -1;                 // first gauge term on the level, under which telemetry is reported
+    };
+
+    QudaHMCParam &param;
+    GaugeField &u;    // the gauge field, evolved in place
+    GaugeField &u_ex; // extended copy of u used by the gauge terms
+    GaugeField &mom;  // the momentum field
+    const std::function<void(const GaugeField &)> &gauge_updated; // called whenever the gauge terms' field changes
+    TimeProfile &profile;
+
+    GaugePaths gauge_paths[QUDA_MAX_HMC_LEVEL];
+    int n_term[QUDA_MAX_HMC_LEVEL];     // number of terms on each level
+    int n_external[QUDA_MAX_HMC_LEVEL]; // number of external terms on each level
+
+    std::unique_ptr<GaugeField> u_init; // initial gauge field, restored on rejection
+    std::unique_ptr<GaugeField> u_fg;   // displaced gauge field, or u saved across the displacement
+    std::unique_ptr<GaugeField> f_fg;   // force that sets the force-gradient displacement
+    std::unique_ptr<GaugeField> f_tel;  // force of a single term, measured for the telemetry
+
+    bool telemetry;                       // whether telemetry is collected
+    int fg_stage = 0;                     // force-gradient stage of the current force evaluations
+    int step[QUDA_MAX_HMC_LEVEL] = {};    // current step on each level
+    int trajectory_index = 0;             // index of the current trajectory in the telemetry
+    std::vector<QudaHMCTelemetry> records; // telemetry records of the current trajectory
+
+    /**
+       @brief Evaluate the action of each term, and return the sum
+       @param[in] init Whether the actions are written to action_init or action_final
+     */
+    double action(bool init);
+
+    /**
+       @brief Update the gauge field U = exp(dt P) U
+     */
+    void updateGauge(double dt);
+
+    /**
+       @brief Update a momentum-like field P = P + dt F with the force
+       of a single term.  With telemetry the force is first computed
+       on its own so that it can be measured.
+       @param[in,out] p The field being updated
+       @param[in] level The level of the term
+       @param[in] term Index of the term
+       @param[in] dt The step size
+       @param[in] force Function that adds a multiple of the term's force to a field
+     */
+    void applyForce(GaugeField &p, int level, int term, double dt,
+                    const std::function<void(GaugeField &, double)> &force);
+
+    /**
+       @brief Write the telemetry of the trajectory to the history,
+       the telemetry file and the telemetry callback
+     */
+    void flushTelemetry();
+
+    /**
+       @brief Update a momentum-like field P = P + dt F with the force of the terms on a given level
+     */
+    void updateMom(GaugeField &p, int level, double dt);
+
+    /**
+       @brief Update the momentum with the force evaluated on the
+       displaced field exp(xi F) U, where F is the force of the terms
+       on the given level.  When the level has only gauge terms the
+       displaced field is written to a temporary and u is left
+       untouched; external terms read u, so otherwise u is displaced in
+       place and restored afterwards.
+     */
+    void updateMomForceGradient(int level, double dt, double xi);
+
+    /**
+       @brief Integrate a given level over a time interval with n_step[level] steps
+     */
+    void integrate(int level, double tau);
+
+  public:
+    /**
+       @brief Prepare the integrator
+       @param[in,out] param Integrator parameters and action terms
+       @param[in,out] u Gauge field
+       @param[in,out] u_ex Extended copy of the gauge field, refreshed by gauge_updated
+       @param[in,out] mom Momentum field
+       @param[in] gauge_updated Function called with the field the gauge
+       terms should see whenever it has changed, which must refresh u_ex
+       from it, and when it is u any other derived fields
+       @param[in] profile TimeProfile instance used for profiling
+     */
+    HMCIntegrator(QudaHMCParam &param, GaugeField &u, GaugeField &u_ex, GaugeField &mom,
+                  const std::function<void(const GaugeField &)> &gauge_updated, TimeProfile &profile);
+
+    /**
+       @brief Run a trajectory, writing the actions and the Metropolis
+       outcome to param
+     */
+    void trajectory();
+  };
+
+  /**
+     @return The HMC telemetry records of all trajectories since the last flush
+   */
+  std::vector<QudaHMCTelemetry> &hmcTelemetryHistory();
+
+} // namespace quda
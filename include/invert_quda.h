@@ -9,9 +9,25 @@
 #include <eigensolve_quda.h>
 #include <vector>
 #include <memory>
+#include <algorithm>
 
 namespace quda {
 
+  /**
+     Running totals of the iterations and time of all solves reported
+     back to a QudaInvertParam, used to attribute solver cost to the
+     HMC force evaluations
+   */
+  struct SolverCost {
+    long long iter = 0;
+    double secs = 0.0;
+  };
+
+  /**
+     @return The running solver cost totals
+   */
+  SolverCost &solverCost();
+
   /**
      SolverParam is the meta data used to define linear solvers.
    */
@@ -248,6 +264,27 @@ namespace quda {
     /** Which external lib to use in the solver */
     QudaExtLibType extlib_type;
 
+    /** Whether to collect per-iteration telemetry */
+    bool telemetry;
+
+    /** File to append the telemetry of each solve to (if non-empty) */
+    std::string telemetry_file;
+
+    /** User callback the telemetry of each solve is passed to (if set) */
+    void (*telemetry_callback)(const QudaSolverTelemetry *, int, void *);
+
+    /** User data passed through to the telemetry callback */
+    void *telemetry_data;
+
+    /** Whether to adapt the reliable-update delta during the solve */
+    bool adaptive_reliable;
+
+    /** The number of reliable updates performed (output) */
+    int reliable_updates;
+
+    /** The largest ratio of true to iterated residual norm at a reliable update (output) */
+    double max_reliable_gap;
+
     /**
        Default constructor
      */
@@ -256,7 +293,13 @@ namespace quda {
       compute_true_res(true),
       sloppy_converge(false),
       verbosity_precondition(QUDA_SILENT),
-      mg_instance(false)
+      mg_instance(false),
+      telemetry(false),
+      telemetry_callback(nullptr),
+      telemetry_data(nullptr),
+      adaptive_reliable(false),
+      reliable_updates(0),
+      max_reliable_gap(0.0)
     {
       ;
     }
@@ -328,7 +371,14 @@ namespace quda {
       is_preconditioner(false),
       global_reduction(true),
       mg_instance(false),
-      extlib_type(param.extlib_type)
+      extlib_type(param.extlib_type),
+      telemetry(param.solver_telemetry == QUDA_BOOLEAN_TRUE),
+      telemetry_file(param.solver_telemetry == QUDA_BOOLEAN_TRUE ? param.solver_telemetry_file : ""),
+      telemetry_callback(param.solver_telemetry_callback),
+      telemetry_data(param.solver_telemetry_data),
+      adaptive_reliable(param.adaptive_reliable == QUDA_BOOLEAN_TRUE),
+      reliable_updates(0),
+      max_reliable_gap(0.0)
     {
       if (deflate) { eig_param = *(static_cast<QudaEigParam *>(param.eig_param)); }
       for (int i=0; i<num_offset; i++) {
@@ -403,7 +453,14 @@ namespace quda {
       is_preconditioner(param.is_preconditioner),
       global_reduction(param.global_reduction),
       mg_instance(param.mg_instance),
-      extlib_type(param.extlib_type)
+      extlib_type(param.extlib_type),
+      telemetry(param.telemetry),
+      telemetry_file(param.telemetry_file),
+      telemetry_callback(param.telemetry_callback),
+      telemetry_data(param.telemetry_data),
+      adaptive_reliable(param.adaptive_reliable),
+      reliable_updates(0),
+      max_reliable_gap(0.0)
     {
       for (int i=0; i<num_offset; i++) {
 	offset[i] = param.offset[i];
@@ -433,6 +490,8 @@ namespace quda {
       reduceDouble(gflops);
       param.gflops += gflops;
       param.secs += secs;
+      solverCost().iter += iter;
+      solverCost().secs += secs;
       if (offset >= 0) {
 	param.true_res_offset[offset] = true_res_offset[offset];
         param.iter_res_offset[offset] = iter_res_offset[offset];
@@ -450,6 +509,10 @@ namespace quda {
       param.ca_lambda_min = ca_lambda_min;
       param.ca_lambda_max = ca_lambda_max;
 
+      param.reliable_updates += reliable_updates;
+      param.max_reliable_gap = std::max(param.max_reliable_gap, max_reliable_gap);
+      if (adaptive_reliable) param.reliable_delta = delta;
+
       if (deflate) *static_cast<QudaEigParam *>(param.eig_param) = eig_param;
     }
 
@@ -460,6 +523,113 @@ namespace quda {
 
   };
 
+  /**
+     Categories of solver work whose time is split out in the telemetry
+   */
+  enum class SolverTimer { op, blas, reduce, n };
+
+  /**
+     @brief Per-iteration convergence telemetry for a single solver
+     instance.  A record is appended for each iteration report, and at
+     the end of each solve the records are added to the global
+     telemetry history, appended to the telemetry file and passed to
+     the user callback.  The operator, BLAS and reduction timers use
+     device events, so only synchronize when telemetry is enabled.
+   */
+  class SolverTelemetry
+  {
+    const SolverParam &param;
+    std::vector<QudaSolverTelemetry> records;
+    device_timer_t timer[static_cast<int>(SolverTimer::n)];
+    double last[static_cast<int>(SolverTimer::n)];
+    host_timer_t wall;
+    int reliable_updates;
+    QudaPrecision precision;
+    int solve;
+
+  public:
+    SolverTelemetry(const SolverParam &param);
+
+    /**
+       @brief Start timing a given category of work
+     */
+    void start(SolverTimer t) { timer[static_cast<int>(t)].start(); }
+
+    /**
+       @brief Stop timing a given category of work
+     */
+    void stop(SolverTimer t) { timer[static_cast<int>(t)].stop(); }
+
+    /**
+       @brief Flag that a reliable update has been performed
+     */
+    void reliableUpdate() { reliable_updates++; }
+
+    /**
+       @brief Append a record for the present iteration
+       @param[in] k iteration count
+       @param[in] r2 L2 norm squared of the residual
+       @param[in] b2 L2 norm squared of the source
+       @param[in] hq2 Heavy quark residual
+     */
+    void record(int k, double r2, double b2, double hq2);
+
+    /**
+       @brief Complete the present solve, publishing its records
+     */
+    void flush();
+  };
+
+  /**
+     @return The telemetry records of all solves since the last flush
+   */
+  std::vector<QudaSolverTelemetry> &solverTelemetryHistory();
+
+  /**
+     @brief Controller that selects the sloppy precision across
+     solves.  After each solve the precision is raised if the solve
+     failed to converge or showed a large true/iterated residual gap,
+     and is lowered again once enough consecutive solves have
+     converged cleanly.  Each failed attempt at a lower precision
+     doubles the number of clean solves required before the next.
+     The precondition, refinement and eigensolver precisions are
+     capped at the selected sloppy precision, relative to the values
+     requested when the controller was initialized.
+   */
+  class PrecisionController
+  {
+    QudaPrecision precision; // the present sloppy precision
+    QudaPrecision failed;    // the highest precision a solve has failed at
+    int streak;              // consecutive clean solves at the present precision
+    int patience;            // clean solves required before lowering the precision
+    QudaPrecision requested[3]; // requested precondition, refinement and eigensolver precisions
+    bool init;
+
+  public:
+    PrecisionController() :
+      precision(QUDA_INVALID_PRECISION),
+      failed(QUDA_INVALID_PRECISION),
+      streak(0),
+      patience(2),
+      requested {QUDA_INVALID_PRECISION, QUDA_INVALID_PRECISION, QUDA_INVALID_PRECISION},
+      init(false)
+    {
+    }
+
+    /**
+       @brief Set the sloppy precision for the next solve, and cap
+       the precisions that must not exceed it
+       @param[in,out] param The parameters of the next solve
+     */
+    void select(QudaInvertParam &param);
+
+    /**
+       @brief Update the controller from the outcome of a solve
+       @param[in] param The parameters of the completed solve
+     */
+    void update(const QudaInvertParam &param);
+  };
+
   class Solver {
 
   protected:
@@ -477,6 +647,37 @@ namespace quda {
     bool recompute_evals;   /** If true, instruct the solver to recompute evals from an existing deflation space. */
     std::vector<ColorSpinorField *> evecs; /** Holds the eigenvectors. */
     std::vector<Complex> evals;            /** Holds the eigenvalues. */
+    std::unique_ptr<SolverTelemetry> telemetry; /** Telemetry, only set if enabled */
+
+    /**
+       @brief Start the telemetry timer for a category of work (no-op
+       if telemetry is disabled)
+     */
+    void telemetryStart(SolverTimer t)
+    {
+      if (telemetry) telemetry->start(t);
+    }
+
+    /**
+       @brief Stop the telemetry timer for a category of work (no-op
+       if telemetry is disabled)
+     */
+    void telemetryStop(SolverTimer t)
+    {
+      if (telemetry) telemetry->stop(t);
+    }
+
+    /**
+       @brief Account for a reliable update, and if adaptive reliable
+       updates are enabled, adapt delta from the gap between the true
+       and iterated residual: a large gap means the sloppy iterates
+       have drifted, so delta is increased to update more often, while
+       a negligible gap means delta is decreased to update less often.
+       @param[in,out] delta The reliable-update delta
+       @param[in] r2_iter Iterated residual norm squared prior to the update
+       @param[in] r2_true True residual norm squared following the update
+     */
+    void reliableUpdate(double &delta, double r2_iter, double r2_true);
 
   public:
     Solver(const DiracMatrix &mat, const DiracMatrix &matSloppy, const DiracMatrix &matPrecon,
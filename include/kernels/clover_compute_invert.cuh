@@ -0,0 +1,114 @@
+#pragma once
+
+#include <gauge_field_order.h>
+#include <clover_field_order.h>
+#include <index_helper.cuh>
+#include <kernels/field_strength_tensor.cuh>
+#include <kernels/clover_compute.cuh>
+#include <kernels/clover_invert.cuh>
+
+namespace quda
+{
+
+  template <typename store_t_, QudaReconstructType recon, bool twist_>
+  struct CloverComputeInvertArg : public ReduceArg<array<double, 2>> {
+    using reduce_t = array<double, 2>;
+    using store_t = store_t_;
+    using real = typename mapper<store_t>::type;
+    using Float = store_t; // gauge precision, as required by computeFmunu
+    static constexpr bool twist = twist_;
+    static constexpr int nColor = 3;
+    static constexpr int nSpin = 4;
+
+    using Gauge = typename gauge_mapper<Float, recon>::type;
+    using Clover = typename clover_mapper<store_t>::type;
+    // we must disable clover reconstruction when writing the inverse
+    using CloverInv = typename clover_mapper<store_t, 72, false, false>::type;
+
+    const Gauge u;
+    Clover clover;
+    CloverInv inverse;
+    int X[4]; // grid dimensions
+    int border[4];
+    real coeff;
+    bool compute_inverse;
+    bool compute_tr_log;
+    real mu2_minus_epsilon2;
+
+    CloverComputeInvertArg(CloverField &field, const GaugeField &u, double coeff, bool compute_inverse,
+                           bool compute_tr_log) :
+      ReduceArg<reduce_t>(dim3(field.VolumeCB(), 2, 1)),
+      u(u),
+      clover(field, false),
+      inverse(field, compute_inverse),
+      coeff(coeff),
+      compute_inverse(compute_inverse),
+      compute_tr_log(compute_tr_log),
+      mu2_minus_epsilon2(field.Mu2() - field.Epsilon2())
+    {
+      for (int dir = 0; dir < 4; ++dir) {
+        X[dir] = field.X()[dir];
+        border[dir] = (u.X()[dir] - X[dir]) / 2;
+      }
+    }
+
+    __device__ __host__ auto init() const { return reduce_t{0, 0}; }
+  };
+
+  /**
+     Compute the clover term of a site from the gauge field, and
+     optionally its inverse and trace log, without storing the field
+     strength tensor.
+  */
+  template <typename Arg> struct CloverComputeInvert : plus<array<double, 2>> {
+    using reduce_t = array<double, 2>;
+    using plus<reduce_t>::operator();
+    const Arg &arg;
+    constexpr CloverComputeInvert(const Arg &arg) : arg(arg) {}
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline reduce_t operator()(reduce_t &value, int x_cb, int parity)
+    {
+      using real = typename Arg::real;
+      constexpr int N = Arg::nColor * Arg::nSpin / 2;
+      using Mat = HMatrix<real, N>;
+
+      int x[4];
+      int X[4];
+      getCoords(x, x_cb, arg.X, parity);
+      for (int dir = 0; dir < 4; ++dir) {
+        x[dir] += arg.border[dir];
+        X[dir] = arg.X[dir] + 2 * arg.border[dir];
+      }
+
+      // F[1,0], F[2,0], F[2,1], F[3,0], F[3,1], F[3,2]
+      Matrix<complex<real>, Arg::nColor> F[6];
+      typename Arg::Float plaq;
+      F[0] = computeFmunu<1, 0>(arg, x, X, parity, plaq);
+      F[1] = computeFmunu<2, 0>(arg, x, X, parity, plaq);
+      F[2] = computeFmunu<2, 1>(arg, x, X, parity, plaq);
+      F[3] = computeFmunu<3, 0>(arg, x, X, parity, plaq);
+      F[4] = computeFmunu<3, 1>(arg, x, X, parity, plaq);
+      F[5] = computeFmunu<3, 2>(arg, x, X, parity, plaq);
+
+      Mat A[2];
+      cloverAssemble(A, F, arg.coeff);
+
+      double trLogA = 0.0;
+#pragma unroll
+      for (int ch = 0; ch < 2; ch++) {
+        if (arg.compute_inverse || arg.compute_tr_log) {
+          Mat Ainv = invertCloverBlock(A[ch], arg, trLogA);
+          if (arg.compute_inverse) arg.inverse(x_cb, parity, ch) = Ainv;
+        }
+        A[ch] *= static_cast<real>(0.5); // factor of two is inherent to QUDA clover storage
+        arg.clover(x_cb, parity, ch) = A[ch];
+      }
+
+      reduce_t result{0, 0};
+      parity ? result[1] = trLogA : result[0] = trLogA;
+      return operator()(result, value);
+    }
+  };
+
+} // namespace quda
@@ -6,8 +6,15 @@
 namespace quda
 {
 
-  template <typename Float, QudaReconstructType recon> struct CloverDerivArg : kernel_param<> {
-    using Force = typename gauge_mapper<Float, QUDA_RECONSTRUCT_NO>::type;
+  /**
+     The force may be stored compressed (reconstruct 10), in which
+     case the accumulated force is projected to traceless
+     anti-hermitian form before it is stored.
+   */
+  template <typename Float, QudaReconstructType recon, QudaReconstructType recon_f = QUDA_RECONSTRUCT_NO>
+  struct CloverDerivArg : kernel_param<> {
+    static constexpr bool compressed_force = recon_f == QUDA_RECONSTRUCT_10;
+    using Force = typename gauge_mapper<Float, recon_f>::type;
     using Oprod = typename gauge_mapper<Float, QUDA_RECONSTRUCT_NO>::type;
     using Gauge = typename gauge_mapper<Float, recon>::type;
     using real = typename mapper<Float>::type;
@@ -264,6 +271,7 @@ namespace quda
       // Write to array
       Link F = arg.force(mu, x_cb, parity == 0 ? arg.parity : 1 - arg.parity);
       F += arg.coeff * force;
+      if (Arg::compressed_force) makeAntiHerm(F);
       arg.force(mu, x_cb, parity == 0 ? arg.parity : 1 - arg.parity) = F;
     }
   };
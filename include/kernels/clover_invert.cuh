@@ -39,6 +39,35 @@ namespace quda
     __device__ __host__ auto init() const { return reduce_t{0, 0}; }
   };
 
+  /**
+     @brief Invert a chiral block of the clover term using a Cholesky
+     decomposition, accumulating its trace log if requested
+     @param[in] A The chiral block, without the factor of 1/2 used in native storage
+     @param[in] arg Kernel argument, which sets the twist and whether to compute the trace log
+     @param[in,out] trLogA The trace log accumulator
+     @return The inverse, including the factor of 1/2 used in native storage
+  */
+  template <typename Arg, typename Mat>
+  __device__ __host__ inline Mat invertCloverBlock(Mat A, const Arg &arg, double &trLogA)
+  {
+    using real = typename Arg::real;
+    constexpr int N = Arg::nColor * Arg::nSpin / 2;
+
+    if (Arg::twist) { // Compute (T^2 + mu2 - epsilon2) first, then invert
+      A = A.square();
+      A += arg.mu2_minus_epsilon2;
+    }
+
+    // compute the Cholesky decomposition
+    linalg::Cholesky<HMatrix, clover::cholesky_t<real>, N> cholesky(A);
+
+    // Accumulate trlogA
+    if (arg.compute_tr_log)
+      for (int j = 0; j < N; j++) trLogA += 2.0 * log(cholesky.D(j));
+
+    return static_cast<real>(0.5) * cholesky.template invert<Mat>(); // return full inverse
+  }
+
   template <typename Arg> struct InvertClover : plus<array<double, 2>> {
     using reduce_t = array<double, 2>;
     using plus<reduce_t>::operator();
@@ -60,21 +89,7 @@ namespace quda
       for (int ch = 0; ch < 2; ch++) {
         Mat A = arg.clover(x_cb, parity, ch);
         A *= static_cast<real>(2.0); // factor of two is inherent to QUDA clover storage
-
-        if (Arg::twist) { // Compute (T^2 + mu2 - epsilon2) first, then invert
-          A = A.square();
-          A += arg.mu2_minus_epsilon2;
-        }
-
-        // compute the Cholesky decomposition
-        linalg::Cholesky<HMatrix, clover::cholesky_t<real>, N> cholesky(A);
-
-        // Accumulate trlogA
-        if (arg.compute_tr_log)
-          for (int j = 0; j < N; j++) trLogA += 2.0 * log(cholesky.D(j));
-
-        Mat Ainv = static_cast<real>(0.5) * cholesky.template invert<Mat>(); // return full inverse
-        arg.inverse(x_cb, parity, ch) = Ainv;
+        arg.inverse(x_cb, parity, ch) = invertCloverBlock(A, arg, trLogA);
       }
 
       reduce_t result{0, 0};
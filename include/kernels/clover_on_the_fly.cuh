@@ -0,0 +1,158 @@
+#pragma once
+
+#include <quda_matrix.h>
+#include <gauge_field_order.h>
+#include <clover_field.h>
+#include <index_helper.cuh>
+#include <kernels/field_strength_tensor.cuh>
+
+namespace quda
+{
+
+  /*
+    Put into clover order
+    Upper-left block (chirality index 0)
+       /                                                                                \
+       |  1 + c*I*(F[0,1] - F[2,3]) ,     c*I*(F[1,2] - F[0,3]) + c*(F[0,2] + F[1,3])   |
+       |                                                                                |
+       |  c*I*(F[1,2] - F[0,3]) - c*(F[0,2] + F[1,3]),   1 - c*I*(F[0,1] - F[2,3])      |
+       |                                                                                |
+       \                                                                                /
+
+       /
+       | 1 - c*I*(F[0] - F[5]),   -c*I*(F[2] - F[3]) - c*(F[1] + F[4])
+       |
+       |  -c*I*(F[2] -F[3]) + c*(F[1] + F[4]),   1 + c*I*(F[0] - F[5])
+       |
+       \
+
+     Lower-right block (chirality index 1)
+
+       /                                                                  \
+       |  1 - c*I*(F[0] + F[5]),  -c*I*(F[2] + F[3]) - c*(F[1] - F[4])    |
+       |                                                                  |
+       |  -c*I*(F[2]+F[3]) + c*(F[1]-F[4]),     1 + c*I*(F[0] + F[5])     |
+       \                                                                  /
+  */
+  /**
+     @brief Assemble the chiral blocks of the clover term from the
+     field-strength tensor
+     @param[out] A The chiral blocks, without the factor of 1/2 used in native storage
+     @param[in] F The field-strength tensor F[1,0], F[2,0], F[2,1], F[3,0], F[3,1], F[3,2]
+     @param[in] c The clover coefficient
+  */
+  template <typename real, int N, typename Link>
+  __device__ __host__ inline void cloverAssemble(HMatrix<real, N> (&A)[2], const Link (&F)[6], real c)
+  {
+    using Complex = complex<real>;
+    Complex I(0.0,1.0);
+    Complex coeff(0.0, c);
+    Link block1[2], block2[2];
+    block1[0] = coeff*(F[0]-F[5]); // (18 + 6*9=) 72 floating-point ops
+    block1[1] = coeff*(F[0]+F[5]); // 72 floating-point ops
+    block2[0] = c*(F[1]+F[4] - I*(F[2]-F[3])); // 126 floating-point ops
+    block2[1] = c*(F[1]-F[4] - I*(F[2]+F[3])); // 126 floating-point ops
+
+    // This uses lots of unnecessary memory
+#pragma unroll
+    for (int ch=0; ch<2; ++ch) {
+      // c = 0(1) => positive(negative) chiral block
+      // Compute real diagonal elements
+#pragma unroll
+      for (int i=0; i<N/2; ++i) {
+        A[ch](i+0,i+0) = 1.0 - block1[ch](i,i).real();
+        A[ch](i+3,i+3) = 1.0 + block1[ch](i,i).real();
+      }
+
+      // Compute off diagonal components
+      // First row
+      A[ch](1,0) = -block1[ch](1,0);
+      // Second row
+      A[ch](2,0) = -block1[ch](2,0);
+      A[ch](2,1) = -block1[ch](2,1);
+      // Third row
+      A[ch](3,0) =  block2[ch](0,0);
+      A[ch](3,1) =  block2[ch](0,1);
+      A[ch](3,2) =  block2[ch](0,2);
+      // Fourth row
+      A[ch](4,0) =  block2[ch](1,0);
+      A[ch](4,1) =  block2[ch](1,1);
+      A[ch](4,2) =  block2[ch](1,2);
+      A[ch](4,3) =  block1[ch](1,0);
+      // Fifth row
+      A[ch](5,0) =  block2[ch](2,0);
+      A[ch](5,1) =  block2[ch](2,1);
+      A[ch](5,2) =  block2[ch](2,2);
+      A[ch](5,3) =  block1[ch](2,0);
+      A[ch](5,4) =  block1[ch](2,1);
+    } // ch
+  }
+
+
+  /**
+     @brief Accessor that recomputes the clover term of a site from
+     the gauge field held by an on-the-fly clover field, in place of
+     reading a materialized clover field.  The gauge field is
+     extended in the partitioned dimensions, so that all the links of
+     the clover leaves are local.
+     @tparam store_t Storage precision of the gauge field
+     @tparam recon Reconstruction type of the gauge field
+  */
+  template <typename store_t, QudaReconstructType recon> struct CloverOnTheFly {
+    using Float = typename mapper<store_t>::type; // computeFmunu requires the register type
+    using Gauge = typename gauge_mapper<store_t, recon>::type;
+
+    const Gauge u;
+    int X[4];      // local grid dimensions
+    int border[4]; // width of the gauge field extension
+    Float coeff;
+
+    /**
+       @brief Constructor, with the same signature as the clover field
+       accessors so it can replace them directly
+       @param[in] clover The on-the-fly clover field
+     */
+    CloverOnTheFly(const CloverField &clover, bool = false) : u(clover.Gauge()), coeff(clover.Coeff())
+    {
+      for (int dir = 0; dir < 4; dir++) {
+        X[dir] = clover.X()[dir];
+        border[dir] = (clover.Gauge().X()[dir] - X[dir]) / 2;
+      }
+    }
+
+    /**
+       @brief Compute both chiral blocks of the clover term of a site,
+       including the factor of 1/2 of the native clover storage
+       @param[out] A The chiral blocks
+       @param[in] x_cb Checkerboarded site index
+       @param[in] parity Site parity
+     */
+    template <int N>
+    __device__ __host__ inline void operator()(HMatrix<Float, N> (&A)[2], int x_cb, int parity) const
+    {
+      int x[4];
+      int X_[4];
+      getCoords(x, x_cb, X, parity);
+#pragma unroll
+      for (int dir = 0; dir < 4; dir++) {
+        x[dir] += border[dir];
+        X_[dir] = X[dir] + 2 * border[dir];
+      }
+
+      // F[1,0], F[2,0], F[2,1], F[3,0], F[3,1], F[3,2]
+      Matrix<complex<Float>, 3> F[6];
+      Float plaq;
+      F[0] = computeFmunu<1, 0>(*this, x, X_, parity, plaq);
+      F[1] = computeFmunu<2, 0>(*this, x, X_, parity, plaq);
+      F[2] = computeFmunu<2, 1>(*this, x, X_, parity, plaq);
+      F[3] = computeFmunu<3, 0>(*this, x, X_, parity, plaq);
+      F[4] = computeFmunu<3, 1>(*this, x, X_, parity, plaq);
+      F[5] = computeFmunu<3, 2>(*this, x, X_, parity, plaq);
+
+      cloverAssemble(A, F, coeff);
+#pragma unroll
+      for (int ch = 0; ch < 2; ch++) A[ch] *= static_cast<Float>(0.5);
+    }
+  };
+
+} // namespace quda
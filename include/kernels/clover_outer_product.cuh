@@ -1,5 +1,6 @@
 #pragma once
 
+#include <vector>
 #include <gauge_field_order.h>
 #include <color_spinor_field_order.h>
 #include <quda_matrix.h>
@@ -8,16 +9,28 @@
 
 namespace quda {
 
-  template <typename Float, int nColor_, QudaReconstructType recon, int dim_ = -1>
+  constexpr int clover_oprod_max_vector = 16; // maximum number of quark fields per interior launch
+
+  /**
+     The fields of a batch share their geometry, so a single accessor
+     per input is kept and only the field pointers are swapped when
+     loading a given field.  The exterior kernels read the ghost zones
+     of the first field of the batch only.  The force may be stored
+     compressed (reconstruct 10), in which case each update is
+     projected to traceless anti-hermitian form before it is stored.
+   */
+  template <typename Float, int nColor_, QudaReconstructType recon, QudaReconstructType recon_f, int dim_ = -1>
   struct CloverForceArg : kernel_param<> {
     using real = typename mapper<Float>::type;
     static constexpr int nColor = nColor_;
     static constexpr int nSpin = 4;
     static constexpr int dim = dim_;
     static constexpr int spin_project = true;
+    static constexpr bool compressed_force = recon_f == QUDA_RECONSTRUCT_10;
     using F = typename colorspinor_mapper<Float, nSpin, nColor, spin_project>::type;
     using Gauge = typename gauge_mapper<Float, recon, 18>::type;
-    using Force = typename gauge_mapper<Float, QUDA_RECONSTRUCT_NO, 18>::type;
+    using Force = typename gauge_mapper<Float, recon_f>::type;
+    using Spinor = ColorSpinor<real, nColor, nSpin>;
 
     Force force;
     const F inA;
@@ -25,28 +38,54 @@ namespace quda {
     const F inC;
     const F inD;
     const Gauge U;
+    Float *a[clover_oprod_max_vector]; // field pointer of each inA in the batch
+    Float *b[clover_oprod_max_vector]; // field pointer of each inB in the batch
+    Float *c[clover_oprod_max_vector]; // field pointer of each inC in the batch
+    Float *d[clover_oprod_max_vector]; // field pointer of each inD in the batch
+    size_t norm_offset;
+    int n_vector;
     int X[4];
     int parity;
     int displacement;
     bool partitioned[4];
-    real coeff;
+    real coeff[clover_oprod_max_vector];
 
-    CloverForceArg(GaugeField &force, const GaugeField &U, const ColorSpinorField &inA, const ColorSpinorField &inB,
-                   const ColorSpinorField &inC, const ColorSpinorField &inD, const unsigned int parity, const double coeff) :
-      kernel_param(dim3(dim == -1 ? inA.VolumeCB() : inA.GhostFaceCB()[dim])),
+    CloverForceArg(GaugeField &force, const GaugeField &U, const std::vector<ColorSpinorField *> &inA,
+                   const std::vector<ColorSpinorField *> &inB, const std::vector<ColorSpinorField *> &inC,
+                   const std::vector<ColorSpinorField *> &inD, int first, int n_vector, const unsigned int parity,
+                   const std::vector<double> &coeff) :
+      kernel_param(dim3(dim == -1 ? inA[first]->VolumeCB() : inA[first]->GhostFaceCB()[dim])),
       force(force),
-      inA(inA),
-      inB(inB),
-      inC(inC),
-      inD(inD),
+      inA(*inA[first]),
+      inB(*inB[first]),
+      inC(*inC[first]),
+      inD(*inD[first]),
       U(U),
+      norm_offset(inA[first]->NormOffset()),
+      n_vector(n_vector),
       parity(parity),
-      displacement(1),
-      coeff(coeff)
+      displacement(1)
     {
+      if (n_vector > clover_oprod_max_vector)
+        errorQuda("Batch size %d exceeds maximum %d", n_vector, clover_oprod_max_vector);
+      for (int i = 0; i < n_vector; i++) {
+        a[i] = static_cast<Float *>(inA[first + i]->V());
+        b[i] = static_cast<Float *>(inB[first + i]->V());
+        c[i] = static_cast<Float *>(inC[first + i]->V());
+        d[i] = static_cast<Float *>(inD[first + i]->V());
+        this->coeff[i] = coeff[first + i];
+      }
       for (int i=0; i<4; ++i) this->X[i] = U.X()[i];
       for (int i=0; i<4; ++i) this->partitioned[i] = commDimPartitioned(i) ? true : false;
     }
+
+    __device__ __host__ inline Spinor load(const F &f, Float *v, int x_cb) const
+    {
+      F g = f;
+      g.field = v;
+      g.norm = reinterpret_cast<typename F::norm_type *>(reinterpret_cast<char *>(v) + norm_offset);
+      return g(x_cb, 0);
+    }
   };
 
   template <typename Arg> struct Interior {
@@ -57,12 +96,9 @@ namespace quda {
     __device__ __host__ inline void operator()(int x_cb)
     {
       using Complex = complex<typename Arg::real>;
-      using Spinor = ColorSpinor<typename Arg::real, Arg::nColor, Arg::nSpin>;
+      using Spinor = typename Arg::Spinor;
       using Link = Matrix<Complex, Arg::nColor>;
 
-      Spinor A = arg.inA(x_cb, 0);
-      Spinor C = arg.inC(x_cb, 0);
-
 #pragma unroll
       for (int dim=0; dim<4; ++dim) {
         int shift[4] = {0, 0, 0, 0};
@@ -70,18 +106,27 @@ namespace quda {
         const int nbr_idx = neighborIndex(x_cb, shift, arg.partitioned, arg.parity, arg.X);
 
         if (nbr_idx >= 0) {
-          Spinor B_shift = arg.inB(nbr_idx, 0);
-          Spinor D_shift = arg.inD(nbr_idx, 0);
+          // accumulate the weighted spin traces of the whole batch before applying the link
+          Link result;
+          for (int i = 0; i < arg.n_vector; i++) {
+            Spinor A = arg.load(arg.inA, arg.a[i], x_cb);
+            Spinor C = arg.load(arg.inC, arg.c[i], x_cb);
+            Spinor B_shift = arg.load(arg.inB, arg.b[i], nbr_idx);
+            Spinor D_shift = arg.load(arg.inD, arg.d[i], nbr_idx);
+
+            B_shift = (B_shift.project(dim,1)).reconstruct(dim,1);
+            Link oprod = outerProdSpinTrace(B_shift,A);
 
-          B_shift = (B_shift.project(dim,1)).reconstruct(dim,1);
-          Link result = outerProdSpinTrace(B_shift,A);
+            D_shift = (D_shift.project(dim,-1)).reconstruct(dim,-1);
+            oprod += outerProdSpinTrace(D_shift,C);
 
-          D_shift = (D_shift.project(dim,-1)).reconstruct(dim,-1);
-          result += outerProdSpinTrace(D_shift,C);
+            result += arg.coeff[i] * oprod;
+          }
 
           Link temp = arg.force(dim, x_cb, arg.parity);
           Link U = arg.U(dim, x_cb, arg.parity);
-          result = temp + U*result*arg.coeff;
+          result = temp + U*result;
+          if (Arg::compressed_force) makeAntiHerm(result);
           arg.force(dim, x_cb, arg.parity) = result;
         }
       } // dim
@@ -116,7 +161,8 @@ namespace quda {
 
       Link temp = arg.force(Arg::dim, bulk_cb_idx, arg.parity);
       Link U = arg.U(Arg::dim, bulk_cb_idx, arg.parity);
-      result = temp + U*result*arg.coeff;
+      result = temp + U*result*arg.coeff[0];
+      if (Arg::compressed_force) makeAntiHerm(result);
       arg.force(Arg::dim, bulk_cb_idx, arg.parity) = result;
     }
   };
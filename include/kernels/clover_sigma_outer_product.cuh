@@ -8,36 +8,57 @@ namespace quda
 {
 
   // This is the maximum number of color spinors we can process in a single kernel
-  // FIXME - make this multi-RHS once we have the multi-RHS framework developed
-#define MAX_NVECTOR 1
+#define MAX_NVECTOR 16
 
-  template <typename Float, int nColor_, int nvector_>
+  /**
+     The fields of a batch share their geometry, so a single accessor
+     per input is kept and only the field pointers are swapped when
+     loading a given field.
+   */
+  template <typename Float, int nColor_>
   struct CloverSigmaOprodArg : kernel_param<> {
     using real = typename mapper<Float>::type;
     static constexpr int nColor = nColor_;
     static constexpr int nSpin = 4;
-    static constexpr int nvector = nvector_;
     using Oprod = typename gauge_mapper<Float, QUDA_RECONSTRUCT_NO, 18>::type;
     using F = typename colorspinor_mapper<Float, nSpin, nColor>::type;
+    using Spinor = ColorSpinor<real, nColor, nSpin>;
 
     Oprod oprod;
-    const F inA[nvector];
-    const F inB[nvector];
-    real coeff[nvector][2];
+    const F inA;
+    const F inB;
+    Float *a[MAX_NVECTOR]; // field pointer of each inA in the batch
+    Float *b[MAX_NVECTOR]; // field pointer of each inB in the batch
+    size_t norm_offset;
+    int nvector;
+    real coeff[MAX_NVECTOR][2];
 
     CloverSigmaOprodArg(GaugeField &oprod, const std::vector<ColorSpinorField*> &inA,
                         const std::vector<ColorSpinorField*> &inB,
                         const std::vector<std::vector<double>> &coeff_) :
       kernel_param(dim3(oprod.VolumeCB(), 2, 6)),
       oprod(oprod),
-      inA{*inA[0]},
-      inB{*inB[0]}
+      inA(*inA[0]),
+      inB(*inB[0]),
+      norm_offset(inA[0]->NormOffset()),
+      nvector(inA.size())
     {
+      if (nvector > MAX_NVECTOR) errorQuda("Batch size %d exceeds maximum %d", nvector, MAX_NVECTOR);
       for (int i = 0; i < nvector; i++) {
+        a[i] = static_cast<Float *>(inA[i]->V());
+        b[i] = static_cast<Float *>(inB[i]->V());
         coeff[i][0] = coeff_[i][0];
         coeff[i][1] = coeff_[i][1];
       }
     }
+
+    __device__ __host__ inline Spinor load(const F &f, Float *v, int x_cb, int parity) const
+    {
+      F g = f;
+      g.field = v;
+      g.norm = reinterpret_cast<typename F::norm_type *>(reinterpret_cast<char *>(v) + norm_offset);
+      return g(x_cb, parity);
+    }
   };
 
   template <int mu, int nu, typename Arg>
@@ -47,10 +68,9 @@ namespace quda
     using Link = Matrix<complex<typename Arg::real>, Arg::nColor>;
     Link result;
 
-#pragma unroll
-    for (int i = 0; i < Arg::nvector; i++) {
-      const Spinor A = arg.inA[i](x_cb, parity);
-      const Spinor B = arg.inB[i](x_cb, parity);
+    for (int i = 0; i < arg.nvector; i++) {
+      const Spinor A = arg.load(arg.inA, arg.a[i], x_cb, parity);
+      const Spinor B = arg.load(arg.inB, arg.b[i], x_cb, parity);
       Spinor C = A.sigma(nu, mu); // multiply by sigma_mu_nu
       result += arg.coeff[i][parity] * outerProdSpinTrace(C, B);
     }
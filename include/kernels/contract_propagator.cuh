@@ -0,0 +1,331 @@
+#pragma once
+
+#include <color_spinor_field_order.h>
+#include <index_helper.cuh>
+#include <quda_matrix.h>
+#include <array.h>
+#include <kernel.h>
+#include <reduction_kernel.h>
+
+namespace quda
+{
+
+  /**
+     The 16 Degrand-Rossi gamma structures, in the order used by the
+     contraction kernels (see degrandRossiProject), are all
+     permutation matrices with phases: row mu of gamma g has a single
+     non-zero entry in column gammaCol(g, mu) equal to
+     i^gammaPhase(g, mu).  Each is packed into an int, with two bits
+     for each column followed by two bits for each phase.
+   */
+  __device__ __host__ constexpr int gammaPack(int c0, int c1, int c2, int c3, int p0, int p1, int p2, int p3)
+  {
+    return c0 | (c1 << 2) | (c2 << 4) | (c3 << 6) | (p0 << 8) | (p1 << 10) | (p2 << 12) | (p3 << 14);
+  }
+
+  __device__ __host__ constexpr int gammaCol(int gamma, int mu) { return (gamma >> (2 * mu)) & 3; }
+
+  __device__ __host__ constexpr int gammaPhase(int gamma, int mu) { return (gamma >> (8 + 2 * mu)) & 3; }
+
+  /**
+     @brief Packed Degrand-Rossi gamma structure g, where the phases
+     are powers of i, e.g., 3 is -i
+   */
+  __device__ __host__ constexpr int gammaDR(int g)
+  {
+    switch (g) {
+    case 0: return gammaPack(0, 1, 2, 3, 0, 0, 0, 0);
+    case 1: return gammaPack(3, 2, 1, 0, 1, 1, 3, 3);
+    case 2: return gammaPack(3, 2, 1, 0, 2, 0, 0, 2);
+    case 3: return gammaPack(2, 3, 0, 1, 1, 3, 3, 1);
+    case 4: return gammaPack(2, 3, 0, 1, 0, 0, 0, 0);
+    case 5: return gammaPack(0, 1, 2, 3, 0, 0, 2, 2);
+    case 6: return gammaPack(3, 2, 1, 0, 1, 1, 1, 1);
+    case 7: return gammaPack(3, 2, 1, 0, 2, 0, 2, 0);
+    case 8: return gammaPack(2, 3, 0, 1, 1, 3, 1, 3);
+    case 9: return gammaPack(2, 3, 0, 1, 0, 0, 2, 2);
+    case 10: return gammaPack(0, 1, 2, 3, 0, 2, 0, 2);
+    case 11: return gammaPack(2, 3, 0, 1, 3, 3, 1, 1);
+    case 12: return gammaPack(1, 0, 3, 2, 2, 2, 0, 0);
+    case 13: return gammaPack(1, 0, 3, 2, 0, 0, 0, 0);
+    case 14: return gammaPack(1, 0, 3, 2, 3, 1, 1, 3);
+    case 15: return gammaPack(0, 1, 2, 3, 2, 2, 0, 0);
+    default: return -1;
+    }
+  }
+
+  /**
+     @brief Product of two packed gamma structures
+   */
+  __device__ __host__ constexpr int gammaMul(int a, int b)
+  {
+    return gammaPack(gammaCol(b, gammaCol(a, 0)), gammaCol(b, gammaCol(a, 1)), gammaCol(b, gammaCol(a, 2)),
+                     gammaCol(b, gammaCol(a, 3)), (gammaPhase(a, 0) + gammaPhase(b, gammaCol(a, 0))) & 3,
+                     (gammaPhase(a, 1) + gammaPhase(b, gammaCol(a, 1))) & 3,
+                     (gammaPhase(a, 2) + gammaPhase(b, gammaCol(a, 2))) & 3,
+                     (gammaPhase(a, 3) + gammaPhase(b, gammaCol(a, 3))) & 3);
+  }
+
+  /**
+     @brief i^k
+   */
+  template <typename real> __device__ __host__ inline complex<real> iPow(int k)
+  {
+    switch (k & 3) {
+    case 0: return complex<real>(1.0, 0.0);
+    case 1: return complex<real>(0.0, 1.0);
+    case 2: return complex<real>(-1.0, 0.0);
+    default: return complex<real>(0.0, -1.0);
+    }
+  }
+
+  /**
+     @brief Dense 4x4 matrix of a packed gamma structure
+   */
+  template <typename real> __device__ __host__ inline Matrix<complex<real>, 4> gammaMatrix(int gamma)
+  {
+    Matrix<complex<real>, 4> G;
+#pragma unroll
+    for (int mu = 0; mu < 4; mu++) G(mu, gammaCol(gamma, mu)) = iPow<real>(gammaPhase(gamma, mu));
+    return G;
+  }
+
+  constexpr int contract_max_gamma = 16; // maximum number of gamma insertions per meson launch
+  constexpr int propagator_n_column = 12; // spin-color columns of a propagator, column = 3 * spin + color
+
+  /**
+     A pair of propagators, each given by its 12 spin-color columns.
+     The columns share their geometry, so a single accessor per
+     propagator is kept and only the field pointers are swapped when
+     loading a column.
+   */
+  template <typename Float, int nColor_> struct PropagatorArg {
+    using real = typename mapper<Float>::type;
+    static constexpr int nSpin = 4;
+    static constexpr int nColor = nColor_;
+    static_assert(nColor == 3, "Only nColor=3 enabled at this time");
+    static constexpr bool spin_project = true;
+    static constexpr bool spinor_direct_load = false; // false means texture load
+    using F = typename colorspinor_mapper<Float, nSpin, nColor, spin_project, spinor_direct_load>::type;
+    using Vector = ColorSpinor<real, nColor, nSpin>;
+
+    F S1;
+    F S2;
+    Float *s1[propagator_n_column];
+    Float *s2[propagator_n_column];
+    size_t norm_offset;
+    int X[4];
+    int spatial_volume;
+
+    PropagatorArg(const std::vector<ColorSpinorField *> &S1, const std::vector<ColorSpinorField *> &S2) :
+      S1(*S1[0]), S2(*S2[0]), norm_offset(S1[0]->NormOffset()), spatial_volume(S1[0]->Volume() / S1[0]->X()[3])
+    {
+      for (int i = 0; i < propagator_n_column; i++) {
+        s1[i] = static_cast<Float *>(S1[i]->V());
+        s2[i] = static_cast<Float *>(S2[i]->V());
+      }
+      for (int dir = 0; dir < 4; dir++) X[dir] = S1[0]->X()[dir];
+    }
+
+    __device__ __host__ inline Vector column(const F &f, Float *const *v, int i, int x_cb, int parity) const
+    {
+      F g = f;
+      g.field = v[i];
+      g.norm = reinterpret_cast<typename F::norm_type *>(reinterpret_cast<char *>(v[i]) + norm_offset);
+      return g(x_cb, parity);
+    }
+
+    /**
+       @brief Load column i = 3 * spin + color of the first propagator
+     */
+    __device__ __host__ inline Vector S1_(int i, int x_cb, int parity) const { return column(S1, s1, i, x_cb, parity); }
+
+    /**
+       @brief Load column i = 3 * spin + color of the second propagator
+     */
+    __device__ __host__ inline Vector S2_(int i, int x_cb, int parity) const { return column(S2, s2, i, x_cb, parity); }
+  };
+
+  /**
+     Meson two-point functions of a pair of point-to-all propagators
+     for a list of sink and source gamma insertions,
+     C(t) = sum_x Tr[G_snk S_1(x) G_src g5 S_2(x)^dag g5],
+     with each timeslice a batch of the multi-reduction.
+   */
+  template <typename Float, int nColor_>
+  struct MesonContractArg : ReduceArg<array<double, 2 * contract_max_gamma>>, PropagatorArg<Float, nColor_> {
+    using reduce_t = array<double, 2 * contract_max_gamma>;
+    int snk[contract_max_gamma]; // packed sink gamma structures
+    int src[contract_max_gamma]; // packed source gamma structures
+    int n_gamma;
+
+    MesonContractArg(const std::vector<ColorSpinorField *> &S1, const std::vector<ColorSpinorField *> &S2,
+                     const int *gamma, int n_gamma) :
+      ReduceArg<reduce_t>(dim3(S1[0]->Volume() / S1[0]->X()[3], 1, S1[0]->X()[3]), S1[0]->X()[3]),
+      PropagatorArg<Float, nColor_>(S1, S2),
+      n_gamma(n_gamma)
+    {
+      for (int k = 0; k < n_gamma; k++) {
+        snk[k] = gammaDR(gamma[2 * k + 0]);
+        src[k] = gammaDR(gamma[2 * k + 1]);
+      }
+    }
+
+    __device__ __host__ reduce_t init() const { return reduce_t {}; }
+  };
+
+  template <typename Arg> struct MesonContract : plus<typename Arg::reduce_t> {
+    using reduce_t = typename Arg::reduce_t;
+    using plus<reduce_t>::operator();
+    const Arg &arg;
+    constexpr MesonContract(const Arg &arg) : arg(arg) {}
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline reduce_t operator()(reduce_t &value, int s, int, int t)
+    {
+      using real = typename Arg::real;
+      using Vector = typename Arg::Vector;
+      constexpr int nColor = Arg::nColor;
+
+      int x[4] = {s % arg.X[0], (s / arg.X[0]) % arg.X[1], s / (arg.X[0] * arg.X[1]), t};
+      int parity = (x[0] + x[1] + x[2] + x[3]) & 1;
+      int x_cb = (t * arg.spatial_volume + s) >> 1;
+      auto g5 = [](int mu) { return mu < 2 ? 1 : -1; };
+
+      complex<real> sum[contract_max_gamma];
+#pragma unroll
+      for (int k = 0; k < contract_max_gamma; k++) sum[k] = 0.0;
+
+      // the tile is the three color columns of S_1 at one source spin, reused for each source spin of S_2
+      for (int a = 0; a < 4; a++) {
+        Vector s1[nColor];
+#pragma unroll
+        for (int c = 0; c < nColor; c++) s1[c] = arg.S1_(a * nColor + c, x_cb, parity);
+
+        for (int b = 0; b < 4; b++) {
+          bool needed = false;
+          for (int k = 0; k < arg.n_gamma; k++) needed = needed || gammaCol(arg.src[k], a) == b;
+          if (!needed) continue;
+
+          // w(mu, nu) = sum_c' S_2(mu c, b c')^* S_1(nu c, a c')
+          complex<real> w[4][4];
+#pragma unroll
+          for (int c = 0; c < nColor; c++) {
+            Vector s2 = arg.S2_(b * nColor + c, x_cb, parity);
+#pragma unroll
+            for (int mu = 0; mu < 4; mu++)
+#pragma unroll
+              for (int nu = 0; nu < 4; nu++)
+                w[mu][nu] = c == 0 ? innerProduct(s2, s1[c], mu, nu) : w[mu][nu] + innerProduct(s2, s1[c], mu, nu);
+          }
+
+          for (int k = 0; k < arg.n_gamma; k++) {
+            if (gammaCol(arg.src[k], a) != b) continue;
+            complex<real> tr = 0.0;
+#pragma unroll
+            for (int mu = 0; mu < 4; mu++)
+              tr += static_cast<real>(g5(mu)) * iPow<real>(gammaPhase(arg.snk[k], mu)) * w[mu][gammaCol(arg.snk[k], mu)];
+            sum[k] += static_cast<real>(g5(b)) * iPow<real>(gammaPhase(arg.src[k], a)) * tr;
+          }
+        }
+      }
+
+      reduce_t result;
+#pragma unroll
+      for (int k = 0; k < contract_max_gamma; k++) {
+        result[2 * k + 0] = sum[k].real();
+        result[2 * k + 1] = sum[k].imag();
+      }
+      return plus<reduce_t>::operator()(result, value);
+    }
+  };
+
+  /**
+     Nucleon-like two-point function of a doubly represented flavor
+     S_1 and a singly represented flavor S_2, using the interpolator
+     eps_abc (q_1a^T C g5 q_2b) q_1c.  With the color blocks S^{aa'}
+     as 4x4 spin matrices and Q^{cc'} = (C g5 S_2^{cc'} C g5)^T,
+     C(t) = sum_x eps_abc eps_a'b'c' { Tr[P S_1^{aa'}] Tr[S_1^{bb'} Q^{cc'}]
+                                       + Tr[P S_1^{aa'} Q^{cc'} S_1^{bb'}] },
+     where P = (1 + g4) / 2 and C = g2 g4.
+   */
+  template <typename Float, int nColor_>
+  struct BaryonContractArg : ReduceArg<array<double, 2>>, PropagatorArg<Float, nColor_> {
+    using reduce_t = array<double, 2>;
+
+    BaryonContractArg(const std::vector<ColorSpinorField *> &S1, const std::vector<ColorSpinorField *> &S2) :
+      ReduceArg<reduce_t>(dim3(S1[0]->Volume() / S1[0]->X()[3], 1, S1[0]->X()[3]), S1[0]->X()[3]),
+      PropagatorArg<Float, nColor_>(S1, S2)
+    {
+    }
+
+    __device__ __host__ reduce_t init() const { return reduce_t {}; }
+  };
+
+  template <typename Arg> struct BaryonContract : plus<typename Arg::reduce_t> {
+    using reduce_t = typename Arg::reduce_t;
+    using plus<reduce_t>::operator();
+    const Arg &arg;
+    constexpr BaryonContract(const Arg &arg) : arg(arg) {}
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline reduce_t operator()(reduce_t &value, int s, int, int t)
+    {
+      using real = typename Arg::real;
+      using Vector = typename Arg::Vector;
+      using Spin = Matrix<complex<real>, 4>;
+
+      int x[4] = {s % arg.X[0], (s / arg.X[0]) % arg.X[1], s / (arg.X[0] * arg.X[1]), t};
+      int parity = (x[0] + x[1] + x[2] + x[3]) & 1;
+      int x_cb = (t * arg.spatial_volume + s) >> 1;
+
+      constexpr int Cg5 = gammaMul(gammaMul(gammaDR(2), gammaDR(4)), gammaDR(5));
+      Spin G = gammaMatrix<real>(Cg5);
+      Spin P = gammaMatrix<real>(gammaDR(4));
+#pragma unroll
+      for (int mu = 0; mu < 4; mu++) P(mu, mu) = P(mu, mu) + complex<real>(1.0, 0.0);
+      P = static_cast<real>(0.5) * P;
+      auto trace = [](const Spin &M) { return M(0, 0) + M(1, 1) + M(2, 2) + M(3, 3); };
+
+      // color permutations and their signs
+      constexpr int eps[6][4] = {{0, 1, 2, 1}, {1, 2, 0, 1}, {2, 0, 1, 1}, {0, 2, 1, -1}, {2, 1, 0, -1}, {1, 0, 2, -1}};
+
+      complex<real> sum = 0.0;
+      for (int j = 0; j < 6; j++) {
+        // the tiles are the four spin columns of the propagators at the source colors a', b' and c'
+        Vector s1a[4], s1b[4], s2c[4];
+#pragma unroll
+        for (int mu = 0; mu < 4; mu++) {
+          s1a[mu] = arg.S1_(mu * 3 + eps[j][0], x_cb, parity);
+          s1b[mu] = arg.S1_(mu * 3 + eps[j][1], x_cb, parity);
+          s2c[mu] = arg.S2_(mu * 3 + eps[j][2], x_cb, parity);
+        }
+
+        for (int i = 0; i < 6; i++) {
+          Spin A, B, D;
+#pragma unroll
+          for (int mu = 0; mu < 4; mu++) {
+#pragma unroll
+            for (int nu = 0; nu < 4; nu++) {
+              A(mu, nu) = s1a[nu](mu, eps[i][0]);
+              B(mu, nu) = s1b[nu](mu, eps[i][1]);
+              D(mu, nu) = s2c[nu](mu, eps[i][2]);
+            }
+          }
+          Spin GDG = G * D * G;
+          Spin Q;
+#pragma unroll
+          for (int mu = 0; mu < 4; mu++)
+#pragma unroll
+            for (int nu = 0; nu < 4; nu++) Q(mu, nu) = GDG(nu, mu);
+          Spin PA = P * A;
+          complex<real> c = trace(PA) * trace(B * Q) + trace(PA * Q * B);
+          sum += static_cast<real>(eps[i][3] * eps[j][3]) * c;
+        }
+      }
+
+      return plus<reduce_t>::operator()(reduce_t {sum.real(), sum.imag()}, value);
+    }
+  };
+
+} // namespace quda
@@ -4,7 +4,9 @@
 #include <index_helper.cuh>
 #include <quda_matrix.h>
 #include <matrix_field.h>
+#include <array.h>
 #include <kernel.h>
+#include <reduction_kernel.h>
 
 namespace quda
 {
@@ -64,6 +66,160 @@ namespace quda
     }
   };
 
+  /**
+     @brief Spin contract the color contracted spinors with the 16
+     Degrand-Rossi gamma structures
+     @param[out] A The 16 spin projections, G_idx = 4*rho + tau
+     @param[in] spin_elem The color inner products <\phi(x)_{\mu} | \phi(y)_{\nu}>
+   */
+  template <typename real>
+  __device__ __host__ inline void degrandRossiProject(complex<real> A[16], const complex<real> spin_elem[4][4])
+  {
+    complex<real> I(0.0, 1.0);
+    complex<real> result_local(0.0, 0.0);
+
+    // Spin contract: <\phi(x)_{\mu} \Gamma_{mu,nu}^{rho,tau} \phi(y)_{\nu}>
+    // The rho index runs slowest.
+    // Layout is defined in enum_quda.h: G_idx = 4*rho + tau
+    // DMH: Hardcoded to Degrand-Rossi. Need a template on Gamma basis.
+
+    int G_idx = 0;
+
+    // SCALAR
+    // G_idx = 0: I
+    result_local = 0.0;
+    result_local += spin_elem[0][0];
+    result_local += spin_elem[1][1];
+    result_local += spin_elem[2][2];
+    result_local += spin_elem[3][3];
+    A[G_idx++] = result_local;
+
+    // VECTORS
+    // G_idx = 1: \gamma_1
+    result_local = 0.0;
+    result_local += I * spin_elem[0][3];
+    result_local += I * spin_elem[1][2];
+    result_local -= I * spin_elem[2][1];
+    result_local -= I * spin_elem[3][0];
+    A[G_idx++] = result_local;
+
+    // G_idx = 2: \gamma_2
+    result_local = 0.0;
+    result_local -= spin_elem[0][3];
+    result_local += spin_elem[1][2];
+    result_local += spin_elem[2][1];
+    result_local -= spin_elem[3][0];
+    A[G_idx++] = result_local;
+
+    // G_idx = 3: \gamma_3
+    result_local = 0.0;
+    result_local += I * spin_elem[0][2];
+    result_local -= I * spin_elem[1][3];
+    result_local -= I * spin_elem[2][0];
+    result_local += I * spin_elem[3][1];
+    A[G_idx++] = result_local;
+
+    // G_idx = 4: \gamma_4
+    result_local = 0.0;
+    result_local += spin_elem[0][2];
+    result_local += spin_elem[1][3];
+    result_local += spin_elem[2][0];
+    result_local += spin_elem[3][1];
+    A[G_idx++] = result_local;
+
+    // PSEUDO-SCALAR
+    // G_idx = 5: \gamma_5
+    result_local = 0.0;
+    result_local += spin_elem[0][0];
+    result_local += spin_elem[1][1];
+    result_local -= spin_elem[2][2];
+    result_local -= spin_elem[3][3];
+    A[G_idx++] = result_local;
+
+    // PSEUDO-VECTORS
+    // DMH: Careful here... we may wish to use  \gamma_1,2,3,4\gamma_5 for pseudovectors
+    // G_idx = 6: \gamma_5\gamma_1
+    result_local = 0.0;
+    result_local += I * spin_elem[0][3];
+    result_local += I * spin_elem[1][2];
+    result_local += I * spin_elem[2][1];
+    result_local += I * spin_elem[3][0];
+    A[G_idx++] = result_local;
+
+    // G_idx = 7: \gamma_5\gamma_2
+    result_local = 0.0;
+    result_local -= spin_elem[0][3];
+    result_local += spin_elem[1][2];
+    result_local -= spin_elem[2][1];
+    result_local += spin_elem[3][0];
+    A[G_idx++] = result_local;
+
+    // G_idx = 8: \gamma_5\gamma_3
+    result_local = 0.0;
+    result_local += I * spin_elem[0][2];
+    result_local -= I * spin_elem[1][3];
+    result_local += I * spin_elem[2][0];
+    result_local -= I * spin_elem[3][1];
+    A[G_idx++] = result_local;
+
+    // G_idx = 9: \gamma_5\gamma_4
+    result_local = 0.0;
+    result_local += spin_elem[0][2];
+    result_local += spin_elem[1][3];
+    result_local -= spin_elem[2][0];
+    result_local -= spin_elem[3][1];
+    A[G_idx++] = result_local;
+
+    // TENSORS
+    // G_idx = 10: (i/2) * [\gamma_1, \gamma_2]
+    result_local = 0.0;
+    result_local += spin_elem[0][0];
+    result_local -= spin_elem[1][1];
+    result_local += spin_elem[2][2];
+    result_local -= spin_elem[3][3];
+    A[G_idx++] = result_local;
+
+    // G_idx = 11: (i/2) * [\gamma_1, \gamma_3]
+    result_local = 0.0;
+    result_local -= I * spin_elem[0][2];
+    result_local -= I * spin_elem[1][3];
+    result_local += I * spin_elem[2][0];
+    result_local += I * spin_elem[3][1];
+    A[G_idx++] = result_local;
+
+    // G_idx = 12: (i/2) * [\gamma_1, \gamma_4]
+    result_local = 0.0;
+    result_local -= spin_elem[0][1];
+    result_local -= spin_elem[1][0];
+    result_local += spin_elem[2][3];
+    result_local += spin_elem[3][2];
+    A[G_idx++] = result_local;
+
+    // G_idx = 13: (i/2) * [\gamma_2, \gamma_3]
+    result_local = 0.0;
+    result_local += spin_elem[0][1];
+    result_local += spin_elem[1][0];
+    result_local += spin_elem[2][3];
+    result_local += spin_elem[3][2];
+    A[G_idx++] = result_local;
+
+    // G_idx = 14: (i/2) * [\gamma_2, \gamma_4]
+    result_local = 0.0;
+    result_local -= I * spin_elem[0][1];
+    result_local += I * spin_elem[1][0];
+    result_local += I * spin_elem[2][3];
+    result_local -= I * spin_elem[3][2];
+    A[G_idx++] = result_local;
+
+    // G_idx = 15: (i/2) * [\gamma_3, \gamma_4]
+    result_local = 0.0;
+    result_local -= spin_elem[0][0];
+    result_local -= spin_elem[1][1];
+    result_local += spin_elem[2][2];
+    result_local += spin_elem[3][3];
+    A[G_idx++] = result_local;
+  }
+
   template <typename Arg> struct DegrandRossiContract {
     const Arg &arg;
     constexpr DegrandRossiContract(const Arg &arg) : arg(arg) {}
@@ -79,9 +235,7 @@ namespace quda
       Vector x = arg.x(x_cb, parity);
       Vector y = arg.y(x_cb, parity);
 
-      complex<real> I(0.0, 1.0);
       complex<real> spin_elem[nSpin][nSpin];
-      complex<real> result_local(0.0, 0.0);
 
       // Color contract: <\phi(x)_{\mu} | \phi(y)_{\nu}>
       // The Bra is conjugated
@@ -89,151 +243,235 @@ namespace quda
         for (int nu = 0; nu < nSpin; nu++) { spin_elem[mu][nu] = innerProduct(x, y, mu, nu); }
       }
 
-      Matrix<complex<real>, nSpin> A_;
-      auto A = A_.data;
-
-      // Spin contract: <\phi(x)_{\mu} \Gamma_{mu,nu}^{rho,tau} \phi(y)_{\nu}>
-      // The rho index runs slowest.
-      // Layout is defined in enum_quda.h: G_idx = 4*rho + tau
-      // DMH: Hardcoded to Degrand-Rossi. Need a template on Gamma basis.
-
-      int G_idx = 0;
-
-      // SCALAR
-      // G_idx = 0: I
-      result_local = 0.0;
-      result_local += spin_elem[0][0];
-      result_local += spin_elem[1][1];
-      result_local += spin_elem[2][2];
-      result_local += spin_elem[3][3];
-      A[G_idx++] = result_local;
-
-      // VECTORS
-      // G_idx = 1: \gamma_1
-      result_local = 0.0;
-      result_local += I * spin_elem[0][3];
-      result_local += I * spin_elem[1][2];
-      result_local -= I * spin_elem[2][1];
-      result_local -= I * spin_elem[3][0];
-      A[G_idx++] = result_local;
-
-      // G_idx = 2: \gamma_2
-      result_local = 0.0;
-      result_local -= spin_elem[0][3];
-      result_local += spin_elem[1][2];
-      result_local += spin_elem[2][1];
-      result_local -= spin_elem[3][0];
-      A[G_idx++] = result_local;
-
-      // G_idx = 3: \gamma_3
-      result_local = 0.0;
-      result_local += I * spin_elem[0][2];
-      result_local -= I * spin_elem[1][3];
-      result_local -= I * spin_elem[2][0];
-      result_local += I * spin_elem[3][1];
-      A[G_idx++] = result_local;
-
-      // G_idx = 4: \gamma_4
-      result_local = 0.0;
-      result_local += spin_elem[0][2];
-      result_local += spin_elem[1][3];
-      result_local += spin_elem[2][0];
-      result_local += spin_elem[3][1];
-      A[G_idx++] = result_local;
-
-      // PSEUDO-SCALAR
-      // G_idx = 5: \gamma_5
-      result_local = 0.0;
-      result_local += spin_elem[0][0];
-      result_local += spin_elem[1][1];
-      result_local -= spin_elem[2][2];
-      result_local -= spin_elem[3][3];
-      A[G_idx++] = result_local;
-
-      // PSEUDO-VECTORS
-      // DMH: Careful here... we may wish to use  \gamma_1,2,3,4\gamma_5 for pseudovectors
-      // G_idx = 6: \gamma_5\gamma_1
-      result_local = 0.0;
-      result_local += I * spin_elem[0][3];
-      result_local += I * spin_elem[1][2];
-      result_local += I * spin_elem[2][1];
-      result_local += I * spin_elem[3][0];
-      A[G_idx++] = result_local;
-
-      // G_idx = 7: \gamma_5\gamma_2
-      result_local = 0.0;
-      result_local -= spin_elem[0][3];
-      result_local += spin_elem[1][2];
-      result_local -= spin_elem[2][1];
-      result_local += spin_elem[3][0];
-      A[G_idx++] = result_local;
-
-      // G_idx = 8: \gamma_5\gamma_3
-      result_local = 0.0;
-      result_local += I * spin_elem[0][2];
-      result_local -= I * spin_elem[1][3];
-      result_local += I * spin_elem[2][0];
-      result_local -= I * spin_elem[3][1];
-      A[G_idx++] = result_local;
-
-      // G_idx = 9: \gamma_5\gamma_4
-      result_local = 0.0;
-      result_local += spin_elem[0][2];
-      result_local += spin_elem[1][3];
-      result_local -= spin_elem[2][0];
-      result_local -= spin_elem[3][1];
-      A[G_idx++] = result_local;
-
-      // TENSORS
-      // G_idx = 10: (i/2) * [\gamma_1, \gamma_2]
-      result_local = 0.0;
-      result_local += spin_elem[0][0];
-      result_local -= spin_elem[1][1];
-      result_local += spin_elem[2][2];
-      result_local -= spin_elem[3][3];
-      A[G_idx++] = result_local;
-
-      // G_idx = 11: (i/2) * [\gamma_1, \gamma_3]
-      result_local = 0.0;
-      result_local -= I * spin_elem[0][2];
-      result_local -= I * spin_elem[1][3];
-      result_local += I * spin_elem[2][0];
-      result_local += I * spin_elem[3][1];
-      A[G_idx++] = result_local;
-
-      // G_idx = 12: (i/2) * [\gamma_1, \gamma_4]
-      result_local = 0.0;
-      result_local -= spin_elem[0][1];
-      result_local -= spin_elem[1][0];
-      result_local += spin_elem[2][3];
-      result_local += spin_elem[3][2];
-      A[G_idx++] = result_local;
-
-      // G_idx = 13: (i/2) * [\gamma_2, \gamma_3]
-      result_local = 0.0;
-      result_local += spin_elem[0][1];
-      result_local += spin_elem[1][0];
-      result_local += spin_elem[2][3];
-      result_local += spin_elem[3][2];
-      A[G_idx++] = result_local;
-
-      // G_idx = 14: (i/2) * [\gamma_2, \gamma_4]
-      result_local = 0.0;
-      result_local -= I * spin_elem[0][1];
-      result_local += I * spin_elem[1][0];
-      result_local += I * spin_elem[2][3];
-      result_local -= I * spin_elem[3][2];
-      A[G_idx++] = result_local;
-
-      // G_idx = 15: (i/2) * [\gamma_3, \gamma_4]
-      result_local = 0.0;
-      result_local -= spin_elem[0][0];
-      result_local -= spin_elem[1][1];
-      result_local += spin_elem[2][2];
-      result_local += spin_elem[3][3];
-      A[G_idx++] = result_local;
-
-      arg.s.save(A_, x_cb, parity);
+      Matrix<complex<real>, nSpin> A;
+      degrandRossiProject(A.data, spin_elem);
+
+      arg.s.save(A, x_cb, parity);
+    }
+  };
+  /**
+     @brief Color contract x and y at a given site and spin project
+     according to the contraction type
+     @param[out] A The 16 spin projections
+     @param[in] arg Kernel argument holding the x and y accessors
+     @param[in] x_cb Checkerboard site index
+     @param[in] parity Site parity
+   */
+  template <QudaContractType type, typename Arg>
+  __device__ __host__ inline void contractSite(complex<typename Arg::real> A[16], const Arg &arg, int x_cb, int parity)
+  {
+    constexpr int nSpin = Arg::nSpin;
+    using real = typename Arg::real;
+    using Vector = ColorSpinor<real, Arg::nColor, nSpin>;
+
+    Vector x = arg.x(x_cb, parity);
+    Vector y = arg.y(x_cb, parity);
+
+    complex<real> spin_elem[nSpin][nSpin];
+#pragma unroll
+    for (int mu = 0; mu < nSpin; mu++) {
+#pragma unroll
+      for (int nu = 0; nu < nSpin; nu++) { spin_elem[mu][nu] = innerProduct(x, y, mu, nu); }
+    }
+
+    if (type == QUDA_CONTRACT_TYPE_DR) {
+      degrandRossiProject(A, spin_elem);
+    } else {
+#pragma unroll
+      for (int mu = 0; mu < nSpin; mu++)
+#pragma unroll
+        for (int nu = 0; nu < nSpin; nu++) A[mu * nSpin + nu] = spin_elem[mu][nu];
+    }
+  }
+
+  constexpr int contract_max_mom = 32; // maximum number of momenta per phase-factor projection
+
+  /**
+     Fused contraction and momentum projection, where each timeslice
+     and momentum is a batch of the multi-reduction, so only the summed
+     correlators leave the kernel.  The phase is exp(-i p.(x - x_0)),
+     with p in units of 2 pi / L.
+   */
+  template <typename Float, int nColor_, QudaContractType type_>
+  struct ContractionFTArg : ReduceArg<array<double, 32>> {
+    using reduce_t = array<double, 32>;
+    using real = typename mapper<Float>::type;
+    static constexpr int nSpin = 4;
+    static constexpr int nColor = nColor_;
+    static constexpr QudaContractType type = type_;
+    static constexpr bool spin_project = true;
+    static constexpr bool spinor_direct_load = false; // false means texture load
+    using F = typename colorspinor_mapper<Float, nSpin, nColor, spin_project, spinor_direct_load>::type;
+
+    F x;
+    F y;
+    int X[4];          // local grid dimensions
+    int offset[3];     // global coordinate of the local origin relative to the source
+    double phase[3];   // 2 pi / L for each spatial dimension
+    int spatial_volume;
+    int mom[contract_max_mom][3];
+
+    ContractionFTArg(const ColorSpinorField &x, const ColorSpinorField &y, const int *source_position,
+                     const int *mom, int n_mom) :
+      ReduceArg<reduce_t>(dim3(x.Volume() / x.X()[3], 1, n_mom * x.X()[3]), n_mom * x.X()[3]),
+      x(x),
+      y(y),
+      spatial_volume(x.Volume() / x.X()[3])
+    {
+      for (int dir = 0; dir < 4; dir++) X[dir] = x.X()[dir];
+      for (int dir = 0; dir < 3; dir++) {
+        offset[dir] = comm_coord(dir) * X[dir] - source_position[dir];
+        phase[dir] = 2.0 * M_PI / (comm_dim(dir) * X[dir]);
+      }
+      for (int m = 0; m < n_mom; m++)
+        for (int dir = 0; dir < 3; dir++) this->mom[m][dir] = mom[3 * m + dir];
+    }
+
+    __device__ __host__ reduce_t init() const { return reduce_t {}; }
+  };
+
+  template <typename Arg> struct ContractionFT : plus<typename Arg::reduce_t> {
+    using reduce_t = typename Arg::reduce_t;
+    using plus<reduce_t>::operator();
+    const Arg &arg;
+    constexpr ContractionFT(const Arg &arg) : arg(arg) {}
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline reduce_t operator()(reduce_t &value, int s, int, int k)
+    {
+      using real = typename Arg::real;
+      const int m = k / arg.X[3];
+      const int t = k % arg.X[3];
+
+      int x[4] = {s % arg.X[0], (s / arg.X[0]) % arg.X[1], s / (arg.X[0] * arg.X[1]), t};
+      int parity = (x[0] + x[1] + x[2] + x[3]) & 1;
+      int x_cb = (t * arg.spatial_volume + s) >> 1;
+
+      complex<real> A[16];
+      contractSite<Arg::type>(A, arg, x_cb, parity);
+
+      double theta = 0.0;
+#pragma unroll
+      for (int dir = 0; dir < 3; dir++) theta += arg.mom[m][dir] * (x[dir] + arg.offset[dir]) * arg.phase[dir];
+      double sin_theta, cos_theta;
+      sincos(-theta, &sin_theta, &cos_theta);
+
+      reduce_t sum;
+#pragma unroll
+      for (int g = 0; g < 16; g++) {
+        sum[2 * g + 0] = A[g].real() * cos_theta - A[g].imag() * sin_theta;
+        sum[2 * g + 1] = A[g].real() * sin_theta + A[g].imag() * cos_theta;
+      }
+      return plus<reduce_t>::operator()(sum, value);
+    }
+  };
+
+  /**
+     Contraction into a lexicographically ordered buffer, one local
+     volume per spin projection, which is the input layout of the FFT
+     used for dense momentum sets.
+   */
+  template <typename Float, int nColor_, QudaContractType type_> struct ContractionLexArg : kernel_param<> {
+    using real = typename mapper<Float>::type;
+    static constexpr int nSpin = 4;
+    static constexpr int nColor = nColor_;
+    static constexpr QudaContractType type = type_;
+    static constexpr bool spin_project = true;
+    static constexpr bool spinor_direct_load = false; // false means texture load
+    using F = typename colorspinor_mapper<Float, nSpin, nColor, spin_project, spinor_direct_load>::type;
+
+    F x;
+    F y;
+    complex<real> *out;
+    int X[4]; // grid dimensions
+    int volume;
+
+    ContractionLexArg(const ColorSpinorField &x, const ColorSpinorField &y, complex<real> *out) :
+      kernel_param(dim3(x.VolumeCB(), 2, 1)), x(x), y(y), out(out), volume(x.Volume())
+    {
+      for (int dir = 0; dir < 4; dir++) X[dir] = x.X()[dir];
+    }
+  };
+
+  template <typename Arg> struct ContractionLex {
+    const Arg &arg;
+    constexpr ContractionLex(const Arg &arg) : arg(arg) {}
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline void operator()(int x_cb, int parity)
+    {
+      int x[4];
+      getCoords(x, x_cb, arg.X, parity);
+      int idx = ((x[3] * arg.X[2] + x[2]) * arg.X[1] + x[1]) * arg.X[0] + x[0];
+
+      complex<typename Arg::real> A[16];
+      contractSite<Arg::type>(A, arg, x_cb, parity);
+#pragma unroll
+      for (int g = 0; g < 16; g++) arg.out[g * arg.volume + idx] = A[g];
+    }
+  };
+
+  /**
+     Pick the requested momenta out of the spatially transformed
+     contraction.  A process only writes the momenta whose spatial
+     coordinate it holds, so the sum over processes gives the result.
+   */
+  template <typename real> struct MomentumGatherArg : kernel_param<> {
+    const complex<real> *in;
+    complex<double> *out;
+    const int *mom;
+    int X[4];          // local grid dimensions
+    int coord[3];      // process coordinate in the spatial dimensions
+    int L[3];          // global spatial dimensions
+    int source[3];     // source position
+    double phase[3];   // 2 pi / L for each spatial dimension
+    int volume;
+    int t_offset;      // global coordinate of the local t = 0 slice
+    int T;             // global temporal extent
+
+    MomentumGatherArg(const ColorSpinorField &x, const complex<real> *in, complex<double> *out, const int *mom,
+                      int n_mom, const int *source_position) :
+      kernel_param(dim3(n_mom, x.X()[3], 16)),
+      in(in),
+      out(out),
+      mom(mom),
+      volume(x.Volume()),
+      t_offset(comm_coord(3) * x.X()[3]),
+      T(comm_dim(3) * x.X()[3])
+    {
+      for (int dir = 0; dir < 4; dir++) X[dir] = x.X()[dir];
+      for (int dir = 0; dir < 3; dir++) {
+        coord[dir] = comm_coord(dir);
+        L[dir] = comm_dim(dir) * X[dir];
+        source[dir] = source_position[dir];
+        phase[dir] = 2.0 * M_PI / (comm_dim(dir) * X[dir]);
+      }
+    }
+  };
+
+  template <typename Arg> struct MomentumGather {
+    const Arg &arg;
+    constexpr MomentumGather(const Arg &arg) : arg(arg) {}
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline void operator()(int m, int t, int g)
+    {
+      int k[3];
+      double theta = 0.0;
+#pragma unroll
+      for (int dir = 0; dir < 3; dir++) {
+        const int p = arg.mom[3 * m + dir];
+        k[dir] = ((p % arg.L[dir]) + arg.L[dir]) % arg.L[dir] - arg.coord[dir] * arg.X[dir];
+        if (k[dir] < 0 || k[dir] >= arg.X[dir]) return;
+        theta += p * arg.source[dir] * arg.phase[dir];
+      }
+
+      // shift the origin to the source, exp(i p.x_0)
+      double sin_theta, cos_theta;
+      sincos(theta, &sin_theta, &cos_theta);
+      int idx = ((t * arg.X[2] + k[2]) * arg.X[1] + k[1]) * arg.X[0] + k[0];
+      complex<double> v(arg.in[g * arg.volume + idx].real(), arg.in[g * arg.volume + idx].imag());
+      arg.out[(m * 16 + g) * arg.T + arg.t_offset + t] = v * complex<double>(cos_theta, sin_theta);
     }
   };
 } // namespace quda
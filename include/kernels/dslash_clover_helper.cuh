@@ -2,6 +2,7 @@
 
 #include <color_spinor_field_order.h>
 #include <clover_field_order.h>
+#include <kernels/clover_on_the_fly.cuh>
 #include "color_spinor.h"
 #include <linalg.cuh>
 #include "kernel.h"
@@ -14,8 +15,11 @@ namespace quda {
      @tparam nSpin Number of spin components
      @tparam nColor Number of colors
      @tparam dynamic_clover Whether we are inverting the clover field on the fly
+     @tparam on_the_fly Whether the clover term is recomputed from the gauge field
+     @tparam recon Reconstruction of the gauge field (on-the-fly clover only)
   */
-  template <typename Float, int nColor_, bool inverse_ = true>
+  template <typename Float, int nColor_, bool inverse_ = true, bool on_the_fly_ = false,
+            QudaReconstructType recon = QUDA_RECONSTRUCT_NO>
   struct CloverArg : kernel_param<> {
     using store_t = Float;
     using real = typename mapper<Float>::type;
@@ -24,9 +28,11 @@ namespace quda {
     static constexpr int length = (nSpin / (nSpin/2)) * 2 * nColor * nColor * (nSpin/2) * (nSpin/2) / 2;
     static constexpr bool inverse = inverse_;
     static constexpr bool dynamic_clover = clover::dynamic_inverse();
+    static constexpr bool on_the_fly = on_the_fly_;
+    static_assert(!on_the_fly || dynamic_clover, "On-the-fly clover requires dynamic clover inversion");
 
     typedef typename colorspinor_mapper<Float,nSpin,nColor>::type F;
-    typedef typename clover_mapper<Float,length>::type C;
+    using C = std::conditional_t<on_the_fly, CloverOnTheFly<Float, recon>, typename clover_mapper<Float, length>::type>;
 
     F out;                // output vector field
     const F in;           // input vector field
@@ -100,16 +106,19 @@ namespace quda {
 
       in.toRel(); // change to chiral basis here
 
+      HMatrix<real, N> A[2];
+      if constexpr (Arg::on_the_fly) arg.clover(A, x_cb, clover_parity);
+
 #pragma unroll
       for (int chirality=0; chirality<2; chirality++) {
-        HMatrix<real, N> A = arg.clover(x_cb, clover_parity, chirality);
+        if constexpr (!Arg::on_the_fly) A[chirality] = arg.clover(x_cb, clover_parity, chirality);
         half_fermion chi = in.chiral_project(chirality);
 
         if (arg.dynamic_clover && arg.inverse) {
-          Cholesky<HMatrix, clover::cholesky_t<store_t>, N> cholesky(A);
+          Cholesky<HMatrix, clover::cholesky_t<store_t>, N> cholesky(A[chirality]);
           chi = static_cast<real>(0.25) * cholesky.solve(chi);
         } else {
-          chi = A * chi;
+          chi = A[chirality] * chi;
         }
 
         out += chi.chiral_reconstruct(chirality);
@@ -10,11 +10,12 @@ namespace quda
 {
   int *getPackComms();
 
-  template <typename Float_, int nColor_, int nSpin_, bool spin_project_ = true,
-            bool dagger_ = false, int twist_ = 0, QudaPCType pc_type_ = QUDA_4D_PC>
+  template <typename Float_, int nColor_, int nSpin_, bool spin_project_ = true, bool dagger_ = false, int twist_ = 0,
+            QudaPCType pc_type_ = QUDA_4D_PC, typename ghostFloat_ = Float_>
   struct PackArg : kernel_param<> {
 
     typedef Float_ Float;
+    typedef ghostFloat_ ghostFloat; // storage type of the (possibly compressed) halo
     typedef typename mapper<Float>::type real;
 
     static constexpr int nColor = nColor_;
@@ -27,7 +28,7 @@ namespace quda
     static constexpr bool spinor_direct_load = false; // false means texture load
 
     static constexpr bool packkernel = true;
-    typedef typename colorspinor_mapper<Float, nSpin, nColor, spin_project, spinor_direct_load>::type F;
+    typedef typename colorspinor_mapper<Float, nSpin, nColor, spin_project, spinor_direct_load, ghostFloat>::type F;
 
     const F in_pack; // field we are packing
 
@@ -78,7 +79,7 @@ namespace quda
             int) :
 #endif
       kernel_param(dim3(block * grid, in.getDslashConstant().Ls, in.SiteSubset())),
-      in_pack(in, nFace, nullptr, reinterpret_cast<Float **>(ghost)),
+      in_pack(in, nFace, nullptr, reinterpret_cast<ghostFloat **>(ghost)),
       nFace(nFace),
       parity(parity),
       nParity(in.SiteSubset()),
@@ -13,14 +13,16 @@ namespace quda
 
   /**
      @brief Parameter structure for driving the Wilson operator
+     @tparam ghostFloat Storage type of the halo (compressed if lower
+     precision than Float)
    */
-  template <typename Float, int nColor_, int nDim, QudaReconstructType reconstruct_>
-  struct WilsonArg : DslashArg<Float, nDim> {
+  template <typename Float, int nColor_, int nDim, QudaReconstructType reconstruct_, typename ghostFloat = Float>
+  struct WilsonArg : DslashArg<Float, nDim, ghostFloat> {
     static constexpr int nColor = nColor_;
     static constexpr int nSpin = 4;
     static constexpr bool spin_project = true;
     static constexpr bool spinor_direct_load = false; // false means texture load
-    typedef typename colorspinor_mapper<Float, nSpin, nColor, spin_project, spinor_direct_load>::type F;
+    typedef typename colorspinor_mapper<Float, nSpin, nColor, spin_project, spinor_direct_load, ghostFloat>::type F;
 
     static constexpr QudaReconstructType reconstruct = reconstruct_;
     static constexpr bool gauge_direct_load = false; // false means texture load
@@ -38,7 +40,7 @@ namespace quda
 
     WilsonArg(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U, double a,
               const ColorSpinorField &x, int parity, bool dagger, const int *comm_override) :
-      DslashArg<Float, nDim>(in, U, parity, dagger, a != 0.0 ? true : false, 1, spin_project, comm_override),
+      DslashArg<Float, nDim, ghostFloat>(in, U, parity, dagger, a != 0.0 ? true : false, 1, spin_project, comm_override),
       out(out),
       in(in),
       in_pack(in),
@@ -2,18 +2,25 @@
 
 #include <kernels/dslash_wilson.cuh>
 #include <clover_field_order.h>
+#include <kernels/clover_on_the_fly.cuh>
 #include <linalg.cuh>
 
 namespace quda
 {
 
-  template <typename Float, int nColor, int nDim, QudaReconstructType reconstruct_>
+  template <typename Float, int nColor, int nDim, QudaReconstructType reconstruct_, bool on_the_fly_ = false,
+            QudaReconstructType clover_recon_ = QUDA_RECONSTRUCT_NO>
   struct WilsonCloverArg : WilsonArg<Float, nColor, nDim, reconstruct_> {
     using WilsonArg<Float, nColor, nDim, reconstruct_>::nSpin;
     static constexpr int length = (nSpin / (nSpin / 2)) * 2 * nColor * nColor * (nSpin / 2) * (nSpin / 2) / 2;
     static constexpr bool dynamic_clover = clover::dynamic_inverse();
+    static constexpr bool on_the_fly = on_the_fly_;
+    static constexpr QudaReconstructType clover_recon = clover_recon_;
+    static_assert(!on_the_fly || dynamic_clover, "On-the-fly clover requires dynamic clover inversion");
 
-    typedef typename clover_mapper<Float, length>::type C;
+    // if on the fly, the clover term is recomputed from the clover field's own copy of the gauge field
+    using C = std::conditional_t<on_the_fly, CloverOnTheFly<Float, clover_recon>,
+                                 typename clover_mapper<Float, length>::type>;
     typedef typename mapper<Float>::type real;
 
     const C A;    /** the clover field */
@@ -73,17 +80,21 @@ namespace quda
 
         Vector tmp;
 
+        HMatrix<real, Arg::nColor * Arg::nSpin / 2> A[2];
+        if constexpr (Arg::on_the_fly) arg.A(A, coord.x_cb, parity); // both chiral blocks from one set of leaves
+
 #pragma unroll
         for (int chirality = 0; chirality < 2; chirality++) {
 
-          HMatrix<real, Arg::nColor * Arg::nSpin / 2> A = arg.A(coord.x_cb, parity, chirality);
+          if constexpr (!Arg::on_the_fly) A[chirality] = arg.A(coord.x_cb, parity, chirality);
           HalfVector chi = out.chiral_project(chirality);
 
           if (arg.dynamic_clover) {
-            Cholesky<HMatrix, clover::cholesky_t<typename Arg::Float>, Arg::nColor * Arg::nSpin / 2> cholesky(A);
+            Cholesky<HMatrix, clover::cholesky_t<typename Arg::Float>, Arg::nColor * Arg::nSpin / 2> cholesky(
+              A[chirality]);
             chi = static_cast<real>(0.25) * cholesky.solve(chi);
           } else {
-            chi = A * chi;
+            chi = A[chirality] * chi;
           }
 
           tmp += chi.chiral_reconstruct(chirality);
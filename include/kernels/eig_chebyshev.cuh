@@ -0,0 +1,51 @@
+#pragma once
+
+#include <kernel.h>
+
+namespace quda
+{
+
+  /**
+     @brief Argument struct for the fused Chebyshev three-term
+     recurrence over a block of vectors.  The vectors are treated as
+     flat arrays of real numbers, since the recurrence has real
+     coefficients and is purely element wise.
+   */
+  template <typename Float_> struct ChebyRecurrenceArg : kernel_param<> {
+    using Float = Float_;
+    static constexpr int max_block = 16; /** maximum block size per launch */
+    Float *y[max_block];                 /** C_{m-1}, overwritten with C_{m+1} */
+    const Float *x[max_block];           /** C_{m} */
+    const Float *Ax[max_block];          /** A C_{m} */
+    Float a;
+    Float b;
+    Float c;
+
+    ChebyRecurrenceArg(Float *const *y, const Float *const *x, const Float *const *Ax, double a, double b, double c,
+                       unsigned int length, unsigned int n_vec) :
+      kernel_param(dim3(length, n_vec, 1)), a(a), b(b), c(c)
+    {
+      if (n_vec > max_block) errorQuda("Block size %u exceeds maximum %d", n_vec, max_block);
+      for (auto i = 0u; i < n_vec; i++) {
+        this->y[i] = y[i];
+        this->x[i] = x[i];
+        this->Ax[i] = Ax[i];
+      }
+    }
+  };
+
+  /**
+     @brief y_i = a * Ax_i + b * x_i + c * y_i
+   */
+  template <typename Arg> struct ChebyRecurrence {
+    const Arg &arg;
+    constexpr ChebyRecurrence(const Arg &arg) : arg(arg) { }
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline void operator()(int s, int i)
+    {
+      arg.y[i][s] = arg.a * arg.Ax[i][s] + arg.b * arg.x[i][s] + arg.c * arg.y[i][s];
+    }
+  };
+
+} // namespace quda
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <kernel.h>
+
+namespace quda
+{
+
+  /**
+     @brief Argument struct for moving a tile of a set of vectors
+     between the vectors themselves and a dense column-major workspace.
+     The tile is indexed in units of real numbers, so complex vectors
+     are simply tiles of twice the length.
+   */
+  template <typename Float_> struct RotateTileArg : kernel_param<> {
+    using Float = Float_;
+    Float **v;       /** device array of vector pointers */
+    Float *tile;     /** dense tile workspace, column major */
+    size_t offset;   /** offset of this tile into each vector */
+    unsigned int ld; /** leading dimension of the tile workspace */
+
+    RotateTileArg(Float **v, Float *tile, size_t offset, unsigned int length, unsigned int ld, unsigned int n_vec) :
+      kernel_param(dim3(length, n_vec, 1)), v(v), tile(tile), offset(offset), ld(ld)
+    {
+    }
+  };
+
+  /**
+     @brief Copy a tile of each vector into the workspace: tile(x, i) = v_i[offset + x]
+   */
+  template <typename Arg> struct RotateTileGather {
+    const Arg &arg;
+    constexpr RotateTileGather(const Arg &arg) : arg(arg) { }
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline void operator()(int x, int i) { arg.tile[i * arg.ld + x] = arg.v[i][arg.offset + x]; }
+  };
+
+  /**
+     @brief Copy the workspace back into a tile of each vector: v_i[offset + x] = tile(x, i)
+   */
+  template <typename Arg> struct RotateTileScatter {
+    const Arg &arg;
+    constexpr RotateTileScatter(const Arg &arg) : arg(arg) { }
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline void operator()(int x, int i) { arg.v[i][arg.offset + x] = arg.tile[i * arg.ld + x]; }
+  };
+
+} // namespace quda
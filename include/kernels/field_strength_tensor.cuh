@@ -1,3 +1,5 @@
+#pragma once
+
 #include <gauge_field_order.h>
 #include <index_helper.cuh>
 #include <quda_matrix.h>
@@ -34,20 +36,22 @@ namespace quda
     }
   };
 
+  /**
+     @brief Compute the clover-leaf field strength F_{mu,nu} at a site
+     @param[in] arg Kernel argument, with gauge field accessor u
+     @param[in] x Extended coordinates of the site
+     @param[in] X Extended dimensions
+     @param[in] parity Site parity
+     @param[out] plaq Real trace of the plaquette U_{mu,nu}(x), which
+     is the first of the four leaves
+     @return The anti-hermitian field strength
+   */
   template <int mu, int nu, typename Arg>
-  __device__ __host__ __forceinline__ void computeFmunuCore(const Arg &arg, int idx, int parity)
+  __device__ __host__ __forceinline__ auto computeFmunu(const Arg &arg, const int *x, const int *X, int parity,
+                                                        typename Arg::Float &plaq)
   {
     using Link = Matrix<complex<typename Arg::Float>, 3>;
 
-    int x[4];
-    int X[4];
-
-    getCoords(x, idx, arg.X, parity);
-    for (int dir = 0; dir < 4; ++dir) {
-      x[dir] += arg.border[dir];
-      X[dir] = arg.X[dir] + 2 * arg.border[dir];
-    }
-
     Link F;
     { // U(x,mu) U(x+mu,nu) U[dagger](x+nu,mu) U[dagger](x,nu)
 
@@ -70,6 +74,7 @@ namespace quda
 
       // compute plaquette
       F = U1 * U2 * conj(U3) * conj(U4);
+      plaq = getTrace(F).real();
     }
 
     { // U(x,nu) U[dagger](x+nu-mu,mu) U[dagger](x-mu,nu) U(x-mu, mu)
@@ -168,7 +173,25 @@ namespace quda
       F *= static_cast<typename Arg::Float>(0.125); // 18 real multiplications
       // 36 floating point operations here
     }
-    
+
+    return F;
+  }
+
+  template <int mu, int nu, typename Arg>
+  __device__ __host__ __forceinline__ void computeFmunuCore(const Arg &arg, int idx, int parity)
+  {
+    int x[4];
+    int X[4];
+
+    getCoords(x, idx, arg.X, parity);
+    for (int dir = 0; dir < 4; ++dir) {
+      x[dir] += arg.border[dir];
+      X[dir] = arg.X[dir] + 2 * arg.border[dir];
+    }
+
+    typename Arg::Float plaq;
+    auto F = computeFmunu<mu, nu>(arg, x, X, parity, plaq);
+
     constexpr int munu_idx = (mu * (mu - 1)) / 2 + nu; // lower-triangular indexing
     arg.f(munu_idx, idx, parity) = F;
   }
@@ -5,105 +5,52 @@
 #include <array.h>
 #include <kernel.h>
 #include <reduction_kernel.h>
-#include <fast_intdiv.h>
 
 namespace quda {
 
-//UNCOMMENT THIS IF YOU WAN'T TO USE LESS MEMORY
-#define GAUGEFIXING_DONT_USE_GX
-//Without using the precalculation of g(x),
-//we loose some performance, because Delta(x) is written in normal lattice coordinates need for the FFTs
-//and the gauge array in even/odd format
-
-#ifdef HOST_DEBUG
-#ifdef GAUGEFIXING_DONT_USE_GX
-#warning Not using precalculated g(x)
-#else
-#warning Using precalculated g(x)
-#endif
-#endif
-
-  template <typename Float, int dir_>
-  struct GaugeFixFFTRotateArg : kernel_param<> {
-    static constexpr int dir = dir_;
-    int_fastdiv X[4];     // grid dimensions
-    complex<Float> *tmp0;
-    complex<Float> *tmp1;
-    GaugeFixFFTRotateArg(const GaugeField &data, complex<Float> *tmp0, complex<Float> *tmp1) :
-      kernel_param(dim3(data.Volume(), 1, 1)),
-      tmp0(tmp0),
-      tmp1(tmp1)
-    {
-      for (int d = 0; d < 4; d++) X[d] = data.X()[d];
-    }
-  };
-
-  template <typename Arg> struct FFTrotate
-  {
-    const Arg &arg;
-    constexpr FFTrotate(const Arg &arg) : arg(arg) {}
-    static constexpr const char* filename() { return KERNEL_FILE; }
-
-    __device__ __host__ inline void operator()(int id)
-    {
-      if (arg.dir == 0) {
-        int x3 = id / (arg.X[0] * arg.X[1] * arg.X[2]);
-        int x2 = (id / (arg.X[0] * arg.X[1])) % arg.X[2];
-        int x1 = (id / arg.X[0]) % arg.X[1];
-        int x0 = id % arg.X[0];
-
-        int id  =  x0 + (x1 + (x2 + x3 * arg.X[2]) * arg.X[1]) * arg.X[0];
-        int id_out =  x2 + (x3 +  (x0 + x1 * arg.X[0]) * arg.X[3]) * arg.X[2];
-        arg.tmp1[id_out] = arg.tmp0[id];
-      }
-
-      if (arg.dir == 1) {
-        int x1 = id / (arg.X[2] * arg.X[3] * arg.X[0]);
-        int x0 = (id / (arg.X[2] * arg.X[3])) % arg.X[0];
-        int x3 = (id / arg.X[2]) % arg.X[3];
-        int x2 = id % arg.X[2];
-
-        int id  =  x2 + (x3 +  (x0 + x1 * arg.X[0]) * arg.X[3]) * arg.X[2];
-        int id_out =  x0 + (x1 + (x2 + x3 * arg.X[2]) * arg.X[1]) * arg.X[0];
-        arg.tmp1[id_out] = arg.tmp0[id];
-      }
-    }
-  };
-
+  /**
+     The Fourier-accelerated update works on the interior of the
+     (possibly extended) gauge field.  Delta(x) is stored in local
+     lexicographic order (x fastest) for the FFTs, one array per
+     independent element, while the momenta used for the Fourier
+     acceleration are global, so the transforms along partitioned
+     dimensions span all processes.
+   */
   template <typename store_t, QudaReconstructType recon>
   struct GaugeFixArg : kernel_param<> {
     using Float = typename mapper<store_t>::type;
     using Gauge = typename gauge_mapper<store_t, recon>::type;
-    static constexpr int elems = recon / 2;
+    using Transform = typename gauge_mapper<Float, QUDA_RECONSTRUCT_NO>::type;
     Gauge data;
-    int_fastdiv X[4];     // grid dimensions
+    Transform g;
+    int X[4];        // true grid dimensions
+    int E[4];        // extended grid dimensions
+    int border[4];   // size of the border in each dimension
+    int X_global[4]; // global grid dimensions
+    int offset[4];   // global coordinates of the local origin
     Float *invpsq;
     complex<Float> *delta;
-    complex<Float> *gx;
     Float alpha;
     int volume;
+    double volume_global;
 
-    GaugeFixArg(GaugeField &data, double alpha) :
-      kernel_param(dim3(data.VolumeCB(), 2, 1)),
+    GaugeFixArg(GaugeField &data, GaugeField &g, Float *invpsq, complex<Float> *delta, double alpha) :
+      kernel_param(dim3(data.LocalVolumeCB(), 2, 1)),
       data(data),
+      g(g),
+      invpsq(invpsq),
+      delta(delta),
       alpha(static_cast<Float>(alpha)),
-      volume(data.Volume())
-    {
-      for (int dir = 0; dir < 4; ++dir ) X[dir] = data.X()[dir];
-      invpsq = (Float*)device_malloc(sizeof(Float) * volume);
-      delta = (complex<Float>*)device_malloc(sizeof(complex<Float>) * volume * 6);
-#ifdef GAUGEFIXING_DONT_USE_GX
-      gx = (complex<Float>*)device_malloc(sizeof(complex<Float>) * volume);
-#else
-      gx = (complex<Float>*)device_malloc(sizeof(complex<Float>) * volume * elems);
-#endif
-    }
-
-    void free()
+      volume(data.LocalVolume()),
+      volume_global(static_cast<double>(data.LocalVolume()) * comm_size())
     {
-      device_free(invpsq);
-      device_free(delta);
-      device_free(gx);
+      for (int dir = 0; dir < 4; ++dir) {
+        border[dir] = data.R()[dir];
+        E[dir] = data.X()[dir];
+        X[dir] = data.X()[dir] - border[dir] * 2;
+        X_global[dir] = X[dir] * comm_dim(dir);
+        offset[dir] = X[dir] * comm_coord(dir);
+      }
     }
   };
 
@@ -116,33 +63,36 @@ namespace quda {
     __device__ __host__ inline void operator()(int x_cb, int parity)
     {
       using Float = typename Arg::Float;
-      int id = parity * arg.threads.x + x_cb;
-      int x1 = id / (arg.X[2] * arg.X[3] * arg.X[0]);
-      int x0 = (id / (arg.X[2] * arg.X[3])) % arg.X[0];
-      int x3 = (id / arg.X[2]) % arg.X[3];
-      int x2 = id % arg.X[2];
-      //id  =  x2 + (x3 +  (x0 + x1 * arg.X[0]) * arg.X[3]) * arg.X[2];
-      Float sx = sin( (Float)x0 * M_PI / (Float)arg.X[0]);
-      Float sy = sin( (Float)x1 * M_PI / (Float)arg.X[1]);
-      Float sz = sin( (Float)x2 * M_PI / (Float)arg.X[2]);
-      Float st = sin( (Float)x3 * M_PI / (Float)arg.X[3]);
-      Float sinsq = sx * sx + sy * sy + sz * sz + st * st;
+      int x[4];
+      getCoords(x, x_cb, arg.X, parity);
+      int idx = ((x[3] * arg.X[2] + x[2]) * arg.X[1] + x[1]) * arg.X[0] + x[0];
+
+      Float sinsq = 0.0;
+#pragma unroll
+      for (int dr = 0; dr < 4; dr++) {
+        Float s = sin(static_cast<Float>(x[dr] + arg.offset[dr]) * static_cast<Float>(M_PI) / static_cast<Float>(arg.X_global[dr]));
+        sinsq += s * s;
+      }
       Float prcfact = 0.0;
       //The FFT normalization is done here
-      if (sinsq > 0.00001) prcfact = 4.0 / (sinsq * (Float)(arg.volume));
-      arg.invpsq[id] = prcfact;
+      if (sinsq > 0.00001) prcfact = 4.0 / (sinsq * static_cast<Float>(arg.volume_global));
+      arg.invpsq[idx] = prcfact;
     }
   };
 
-  template <typename Arg> struct mult_norm_2d
+  template <typename Arg> struct mult_norm
   {
     const Arg &arg;
-    constexpr mult_norm_2d(const Arg &arg) : arg(arg) {}
+    constexpr mult_norm(const Arg &arg) : arg(arg) {}
     static constexpr const char* filename() { return KERNEL_FILE; }
     __device__ __host__ inline void operator()(int x_cb, int parity)
     {
-      int id = parity * arg.threads.x + x_cb;
-      arg.gx[id] = arg.gx[id] * arg.invpsq[id];
+      int x[4];
+      getCoords(x, x_cb, arg.X, parity);
+      int idx = ((x[3] * arg.X[2] + x[2]) * arg.X[1] + x[1]) * arg.X[0] + x[0];
+      auto invpsq = arg.invpsq[idx];
+#pragma unroll
+      for (int k = 0; k < 6; k++) arg.delta[idx + k * arg.volume] = arg.delta[idx + k * arg.volume] * invpsq;
     }
   };
 
@@ -157,20 +107,26 @@ namespace quda {
     using Gauge = typename gauge_mapper<store_t, recon>::type;
     static constexpr int gauge_dir = gauge_dir_;
 
-    int_fastdiv X[4];     // grid dimensions
+    int X[4]; // true grid dimensions
+    int E[4]; // extended grid dimensions
+    int border[4];
     Gauge data;
     complex<real> *delta;
     reduce_t result;
     int volume;
 
     GaugeFixQualityFFTArg(const GaugeField &data, complex<real> *delta) :
-      ReduceArg<reduce_t>(dim3(data.VolumeCB(), 2, 1), 1, true), // reset = true
+      ReduceArg<reduce_t>(dim3(data.LocalVolumeCB(), 2, 1), 1, true), // reset = true
       data(data),
       delta(delta),
       result{0, 0},
-      volume(data.Volume())
+      volume(data.LocalVolume())
     {
-      for (int dir = 0; dir < 4; dir++) X[dir] = data.X()[dir];
+      for (int dir = 0; dir < 4; dir++) {
+        border[dir] = data.R()[dir];
+        E[dir] = data.X()[dir];
+        X[dir] = data.X()[dir] - border[dir] * 2;
+      }
     }
 
     __device__ __host__ reduce_t init() const { return reduce_t{0, 0}; }
@@ -194,18 +150,23 @@ namespace quda {
       using matrix = Matrix<complex<typename Arg::real>, 3>;
       int x[4];
       getCoords(x, x_cb, arg.X, parity);
+      int idx = ((x[3] * arg.X[2] + x[2]) * arg.X[1] + x[1]) * arg.X[0] + x[0];
+#pragma unroll
+      for (int dr = 0; dr < 4; dr++) x[dr] += arg.border[dr];
+      int e_cb = linkIndex(x, arg.E);
+
       matrix delta;
       setZero(&delta);
 
       for (int mu = 0; mu < Arg::gauge_dir; mu++) {
-        matrix U = arg.data(mu, x_cb, parity);
+        matrix U = arg.data(mu, e_cb, parity);
         delta -= U;
       }
       //18*gauge_dir
       data[0] = -delta(0, 0).real() - delta(1, 1).real() - delta(2, 2).real();
       //2
       for (int mu = 0; mu < Arg::gauge_dir; mu++) {
-        matrix U = arg.data(mu, linkIndexM1(x, arg.X, mu), 1 - parity);
+        matrix U = arg.data(mu, linkIndexM1(x, arg.E, mu), 1 - parity);
         delta += U;
       }
       //18*gauge_dir
@@ -213,7 +174,6 @@ namespace quda {
       //18
       //SAVE DELTA!!!!!
       SubTraceUnit(delta);
-      int idx = getIndexFull(x_cb, arg.X, parity);
 
       //Saving Delta
       arg.delta[idx + 0 * arg.volume] = delta(0,0);
@@ -272,72 +232,12 @@ namespace quda {
     //T=130
   }
 
-  template <typename Arg> struct U_EO_NEW {
-    const Arg &arg;
-    constexpr U_EO_NEW(const Arg &arg) : arg(arg) {}
-    static constexpr const char* filename() { return KERNEL_FILE; }
-
-    __device__ __host__ void operator()(int x_cb, int parity)
-    {
-      using Float = typename Arg::Float;
-      using complex = complex<Float>;
-      using matrix = Matrix<complex, 3>;
-
-      int x[4];
-      getCoords(x, x_cb, arg.X, parity);
-      int idx = ((x[3] * arg.X[2] + x[2]) * arg.X[1] + x[1]) * arg.X[0] + x[0];
-      matrix de;
-      //Read Delta
-      de(0,0) = arg.delta[idx + 0 * arg.volume];
-      de(0,1) = arg.delta[idx + 1 * arg.volume];
-      de(0,2) = arg.delta[idx + 2 * arg.volume];
-      de(1,1) = arg.delta[idx + 3 * arg.volume];
-      de(1,2) = arg.delta[idx + 4 * arg.volume];
-      de(2,2) = arg.delta[idx + 5 * arg.volume];
-
-      de(1,0) = complex(-de(0,1).real(), de(0,1).imag());
-      de(2,0) = complex(-de(0,2).real(), de(0,2).imag());
-      de(2,1) = complex(-de(1,2).real(), de(1,2).imag());
-
-      matrix g;
-      setIdentity(&g);
-      g += de * (arg.alpha * static_cast<Float>(0.5));
-      //36
-      reunit_link<Float>(g);
-      //130
-
-      for ( int mu = 0; mu < 4; mu++ ) {
-        matrix U = arg.data(mu, x_cb, parity);
-
-        matrix g0;
-        U = g * U;
-        //198
-        idx = linkNormalIndexP1(x, arg.X, mu);
-        //Read Delta
-        de(0,0) = arg.delta[idx + 0 * arg.volume];
-        de(0,1) = arg.delta[idx + 1 * arg.volume];
-        de(0,2) = arg.delta[idx + 2 * arg.volume];
-        de(1,1) = arg.delta[idx + 3 * arg.volume];
-        de(1,2) = arg.delta[idx + 4 * arg.volume];
-        de(2,2) = arg.delta[idx + 5 * arg.volume];
-
-        de(1,0) = complex(-de(0,1).real(), de(0,1).imag());
-        de(2,0) = complex(-de(0,2).real(), de(0,2).imag());
-        de(2,1) = complex(-de(1,2).real(), de(1,2).imag());
-
-        setIdentity(&g0);
-        g0 += de * (arg.alpha * static_cast<Float>(0.5));
-        //36
-        reunit_link<Float>(g0);
-        //130
-
-        U = U * conj(g0);
-        //198
-        arg.data(mu, x_cb, parity) = U;
-      }
-    }
-  };
-
+  /**
+     @brief Compute the gauge transformation g(x) from the
+     Fourier-accelerated Delta(x), and store it in the extended
+     gauge transformation field so that g(x + mu) can be read from
+     the neighboring process
+   */
   template <typename Arg> struct GX {
     const Arg &arg;
     constexpr GX(const Arg &arg) : arg(arg) {}
@@ -361,23 +261,21 @@ namespace quda {
       de(1,2) = arg.delta[idx + 4 * arg.volume];
       de(2,2) = arg.delta[idx + 5 * arg.volume];
 
-      de(1,0) = complex(-de(0,1).x, de(0,1).y);
-      de(2,0) = complex(-de(0,2).x, de(0,2).y);
-      de(2,1) = complex(-de(1,2).x, de(1,2).y);
+      de(1,0) = complex(-de(0,1).real(), de(0,1).imag());
+      de(2,0) = complex(-de(0,2).real(), de(0,2).imag());
+      de(2,1) = complex(-de(1,2).real(), de(1,2).imag());
 
       matrix g;
       setIdentity(&g);
       g += de * (arg.alpha * static_cast<typename Arg::Float>(0.5));
-
       //36
       reunit_link<typename Arg::Float>(g);
-
       //130
-      //gx is represented in even/odd order
-      for (int i = 0; i < Arg::elems; i++) arg.gx[parity*arg.threads.x + x_cb + i * arg.volume] = g.data[i];
 
-      //T=166 for Elems 9
-      //T=208 for Elems 6
+#pragma unroll
+      for (int dr = 0; dr < 4; dr++) x[dr] += arg.border[dr];
+      arg.g(0, linkIndex(x, arg.E), parity) = g;
+      //T=166
     }
   };
 
@@ -393,37 +291,21 @@ namespace quda {
 
       int x[4];
       getCoords(x, x_cb, arg.X, parity);
+#pragma unroll
+      for (int dr = 0; dr < 4; dr++) x[dr] += arg.border[dr];
+      int e_cb = linkIndex(x, arg.E);
 
-      matrix g;
-      for (int i = 0; i < Arg::elems; i++) g.data[i] = arg.gx[parity * arg.threads.x + x_cb + i * arg.volume];
-
-      if (Arg::elems == 6) {
-        g(2,0) = conj(g(0,1) * g(1,2) - g(0,2) * g(1,1));
-        g(2,1) = conj(g(0,2) * g(1,0) - g(0,0) * g(1,2));
-        g(2,2) = conj(g(0,0) * g(1,1) - g(0,1) * g(1,0));
-        //42
-      }
+      matrix g = arg.g(0, e_cb, parity);
       for (int mu = 0; mu < 4; mu++) {
-        matrix U = arg.data(mu, x_cb, parity);
-        matrix g0;
+        matrix U = arg.data(mu, e_cb, parity);
         U = g * U;
         //198
-        int idm1 = linkIndexP1(x, arg.X, mu);
-        idm1 += (1 - parity) * arg.volume / 2;
-        for (int i = 0; i < Arg::elems; i++) g0.data[i] = arg.gx[idm1 + i * arg.volume];
-
-        if (Arg::elems == 6) {
-          g0(2,0) = conj(g0(0,1) * g0(1,2) - g0(0,2) * g0(1,1));
-          g0(2,1) = conj(g0(0,2) * g0(1,0) - g0(0,0) * g0(1,2));
-          g0(2,2) = conj(g0(0,0) * g0(1,1) - g0(0,1) * g0(1,0));
-          //42
-        }
+        matrix g0 = arg.g(0, linkIndexP1(x, arg.E, mu), 1 - parity);
         U = U * conj(g0);
         //198
-        arg.data(mu, x_cb, parity) = U;
+        arg.data(mu, e_cb, parity) = U;
       }
-      //T=42+4*(198*2+42) Elems=6
-      //T=4*(198*2) Elems=9
+      //T=4*(198*2)
       //Not accounting here the reconstruction of the gauge if 12 or 8!!!!!!
     }
   };
@@ -4,68 +4,69 @@
 #include <quda_matrix.h>
 #include <index_helper.cuh>
 #include <kernel.h>
-#include <shared_memory_cache_helper.cuh>
 
 namespace quda {
 
+  /**
+     Operations of the compiled path program.  The program is a
+     postorder traversal of the shared sub-product tree of all paths
+     in a given direction, and is evaluated per site on a small stack
+     of link matrices:
+     - PATH_LOAD: push coeff * U
+     - PATH_LMUL: top = U * top
+     - PATH_RMUL: top = top * U
+     - PATH_ADD: pop the top and add it to the new top
+     - PATH_IDENTITY: push coeff * 1
+   */
+  enum path_op_type : int8_t { PATH_LOAD, PATH_LMUL, PATH_RMUL, PATH_ADD, PATH_IDENTITY };
+
+  struct path_op {
+    int8_t type;   // path_op_type
+    int8_t dir;    // link direction
+    int8_t dagger; // whether the link is traversed backwards
+    int8_t pad;
+    int8_t dx[4];  // link position relative to the site
+    double coeff;  // path coefficient (PATH_LOAD and PATH_IDENTITY only)
+  };
+
+  /**
+     Path table compiled into a program that shares the common
+     prefixes and suffixes between paths, e.g., the rectangles and
+     chairs of the improved gauge actions.  Paths are factored
+     recursively on their common first or last link, so each shared
+     partial product is only formed once per site.
+   */
   struct paths {
     const int num_paths;
     const int max_length;
-    int *input_path[4];
-    const int *length;
-    const double *path_coeff;
-    int *buffer;
-    int count;
-
-    paths(int ***input_path, int *length_h, double *path_coeff_h, int num_paths, int max_length) :
-      num_paths(num_paths),
-      max_length(max_length),
-      count(0)
-    {
-      // create path struct in a single allocation
-      size_t bytes = 4 * num_paths * max_length * sizeof(int) + num_paths * sizeof(int);
-      int pad = ((sizeof(double) - bytes % sizeof(double)) % sizeof(double))/sizeof(int);
-      bytes += pad*sizeof(int) + num_paths*sizeof(double);
-
-      buffer = static_cast<int*>(pool_device_malloc(bytes));
-      int *path_h = static_cast<int*>(safe_malloc(bytes));
-      memset(path_h, 0, bytes);
-
-      for (int dir=0; dir<4; dir++) {
-        // flatten the input_path array for copying to the device
-        for (int i=0; i < num_paths; i++) {
-          for (int j=0; j < length_h[i]; j++) {
-            path_h[dir*num_paths*max_length + i*max_length + j] = input_path[dir][i][j];
-            if (dir==0) count++;
-          }
-        }
-      }
+    int count;            // number of links summed over the input paths of a single direction
+    const path_op *op;    // the compiled program, in the same location as the fields
+    int offset[4];        // offset of each direction's program
+    int length[4];        // number of operations in each direction's program
+    int n_mult[4];        // number of matrix multiplications in each direction's program
+    int n_load[4];        // number of link loads in each direction's program
+    int depth;            // stack depth required to evaluate the programs
+    QudaFieldLocation location;
+    path_op *buffer;
+
+    paths(int ***input_path, int *length_h, double *path_coeff_h, int num_paths, int max_length,
+          QudaFieldLocation location);
 
-      // length array
-      memcpy(path_h + 4 * num_paths * max_length, length_h, num_paths*sizeof(int));
-
-      // path_coeff array
-      memcpy(path_h + 4 * num_paths * max_length + num_paths + pad, path_coeff_h, num_paths*sizeof(double));
-
-      qudaMemcpy(buffer, path_h, bytes, qudaMemcpyHostToDevice);
-      host_free(path_h);
-
-      // finally set the pointers to the correct offsets in the buffer
-      for (int d=0; d < 4; d++) this->input_path[d] = buffer + d*num_paths*max_length;
-      length = buffer + 4*num_paths*max_length;
-      path_coeff = reinterpret_cast<double*>(buffer + 4 * num_paths * max_length + num_paths + pad);
-    }
     void free() {
-      pool_device_free(buffer);
+      if (location == QUDA_CPU_FIELD_LOCATION)
+        host_free(buffer);
+      else
+        pool_device_free(buffer);
     }
   };
 
-
-  template <typename Float_, int nColor_, QudaReconstructType recon_u, QudaReconstructType recon_m, bool force_>
+  template <typename Float_, int nColor_, QudaReconstructType recon_u, QudaReconstructType recon_m, bool force_,
+            int max_depth_>
   struct GaugeForceArg : kernel_param<> {
     using Float = Float_;
     static constexpr int nColor = nColor_;
     static constexpr bool compute_force = force_;
+    static constexpr int max_depth = max_depth_;
     static_assert(nColor == 3, "Only nColor=3 enabled at this time");
     typedef typename gauge_mapper<Float,recon_u>::type Gauge;
     typedef typename gauge_mapper<Float,recon_m>::type Mom;
@@ -108,58 +109,53 @@ namespace quda {
     getCoords(x, idx, arg.X, parity);
     for (int dr=0; dr<4; ++dr) x[dr] += arg.border[dr]; // extended grid coordinates
 
-    //linkA: current matrix
-    //linkB: the loaded matrix in this round
-    Link linkA, linkB, staple;
-    thread_array<int, 4> dx{0};
-
-    for (int i=0; i<arg.p.num_paths; i++) {
-      real coeff = arg.p.path_coeff[i];
-      if (coeff == 0) continue;
-
-      const int* path = arg.p.input_path[dir] + i*arg.p.max_length;
-
-      // start from end of link in direction dir
-      int nbr_oddbit = (parity^1);
-      dx[dir]++;
-
-      int path0 = path[0];
-      int lnkdir = isForwards(path0) ? path0 : flipDir(path0);
+    // evaluate the compiled path program: the stack holds the
+    // partial products still waiting to be summed.  The program is
+    // uniform across threads, so the stack slot is selected with a
+    // warp-uniform branch over compile-time indices and the stack is
+    // kept in registers rather than spilling to local memory.
+    Link stack[Arg::max_depth];
+    int top = -1;
+
+    const path_op *op = arg.p.op + arg.p.offset[dir];
+    for (int i = 0; i < arg.p.length[dir]; i++) {
+      const path_op o = op[i];
+
+      if (o.type == PATH_ADD) {
+#pragma unroll
+        for (int k = 1; k < Arg::max_depth; k++)
+          if (k == top) stack[k - 1] = stack[k - 1] + stack[k];
+        top--;
+        continue;
+      }
 
-      if (isForwards(path0)) {
-        linkB = arg.u(lnkdir, linkIndexShift(x,dx,arg.E), nbr_oddbit);
-        linkA = linkB;
-        dx[lnkdir]++; // now have to update location
-	nbr_oddbit = nbr_oddbit^1;
+      Link U;
+      if (o.type == PATH_IDENTITY) {
+        setIdentity(&U);
       } else {
-        dx[lnkdir]--; // if we are going backwards the link is on the adjacent site
-        nbr_oddbit = nbr_oddbit^1;
-	linkB = arg.u(lnkdir, linkIndexShift(x,dx,arg.E), nbr_oddbit);
-        linkA = conj(linkB);
+        int nbr_oddbit = parity ^ ((o.dx[0] + o.dx[1] + o.dx[2] + o.dx[3]) & 1);
+        U = arg.u(o.dir, linkIndexShift(x, o.dx, arg.E), nbr_oddbit);
+        if (o.dagger) U = conj(U);
       }
 
-      for (int j=1; j<arg.p.length[i]; j++) {
-
-        int pathj = path[j];
-        int lnkdir = isForwards(pathj) ? pathj : flipDir(pathj);
-
-        if (isForwards(pathj)) {
-          linkB = arg.u(lnkdir, linkIndexShift(x,dx,arg.E), nbr_oddbit);
-          linkA = linkA * linkB;
-          dx[lnkdir]++; // now have to update to new location
-          nbr_oddbit = nbr_oddbit^1;
-        } else {
-          dx[lnkdir]--; // if we are going backwards the link is on the adjacent site
-	  nbr_oddbit = nbr_oddbit^1;
-          linkB = arg.u(lnkdir, linkIndexShift(x,dx,arg.E), nbr_oddbit);
-          linkA = linkA * conj(linkB);
+      if (o.type == PATH_LOAD || o.type == PATH_IDENTITY) top++;
+#pragma unroll
+      for (int k = 0; k < Arg::max_depth; k++) {
+        if (k != top) continue;
+        switch (o.type) {
+        case PATH_LOAD:
+        case PATH_IDENTITY: stack[k] = static_cast<real>(o.coeff) * U; break;
+        case PATH_LMUL: stack[k] = U * stack[k]; break;
+        case PATH_RMUL: stack[k] = stack[k] * U; break;
         }
-      } //j
-      staple = staple + coeff*linkA;
-    } //i
+      }
+    }
+
+    // an empty program (all coefficients vanish) leaves a zero staple
+    Link staple = top == 0 ? stack[0] : Link();
 
     // multiply by U(x)
-    linkA = arg.u(dir, linkIndex(x,arg.E), parity);
+    Link linkA = arg.u(dir, linkIndex(x,arg.E), parity);
     linkA = linkA * staple;
 
     // update mom(x)
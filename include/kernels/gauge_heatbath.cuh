@@ -70,7 +70,7 @@ namespace quda {
     @brief Generate full SU(2) matrix (four real numbers instead of 2x2 complex matrix) and update link matrix.
     Get from MILC code.
     @param al weight
-    @param localstate CURAND rng state
+    @param localstate RNG state
  */
   template <class T>
   __device__ static inline Matrix<T,2> generate_su2_matrix_milc(T al, RNGState& localState){
@@ -279,7 +279,7 @@ namespace quda {
     @brief Link update by pseudo-heatbath
     @param U link to be updated
     @param F staple
-    @param localstate CURAND rng state
+    @param localstate RNG state
   */
   template <class Float, int nColor>
   __device__ inline void heatBathSUN( Matrix<complex<Float>,nColor>& U, Matrix<complex<Float>,nColor> F,
@@ -561,10 +561,10 @@ namespace quda {
     int border[4];
     Gauge dataOr;
     Float BetaOverNc;
-    RNGState *rng;
+    RNGKey rng;
     int mu;
     int parity;
-    MonteArg(GaugeField &data, Float Beta, RNGState *rng, int mu, int parity) :
+    MonteArg(GaugeField &data, Float Beta, const RNGKey &rng, int mu, int parity) :
       kernel_param(dim3(data.LocalVolumeCB(), 1, 1)),
       dataOr(data),
       rng(rng),
@@ -631,9 +631,8 @@ namespace quda {
         }
       U = arg.dataOr(mu, e_cb, parity);
       if (Arg::heatbath) {
-        RNGState localState = arg.rng[x_cb];
+        RNGState localState = arg.rng.state(x_cb, parity, mu);
         heatBathSUN( U, conj(staple), localState, arg.BetaOverNc );
-        arg.rng[x_cb] = localState;
       } else {
         overrelaxationSUN( U, conj(staple) );
       }
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <gauge_field_order.h>
+#include <index_helper.cuh>
+#include <quda_matrix.h>
+#include <array.h>
+#include <kernel.h>
+#include <reduction_kernel.h>
+
+namespace quda
+{
+
+  /**
+     Large loops are built from open line products that are extended
+     by one link per step, where each step only reads the previous
+     product at a nearest neighbor.  All line fields are extended
+     fields with the same border as the gauge field, and are exchanged
+     between steps, so arbitrarily long lines work on any process
+     grid.
+   */
+  template <typename Float_, int nColor_, QudaReconstructType recon_> struct GaugeLineArg : kernel_param<> {
+    using Float = Float_;
+    static constexpr int nColor = nColor_;
+    static_assert(nColor == 3, "Only nColor=3 enabled at this time");
+    static constexpr QudaReconstructType recon = recon_;
+    typedef typename gauge_mapper<Float, recon>::type Gauge;
+    typedef typename gauge_mapper<Float, QUDA_RECONSTRUCT_NO>::type Line;
+
+    const Gauge u;
+    Line out;
+    const Line in;
+    Line out2;
+    const Line in2;
+
+    int X[4]; // true grid dimensions
+    int E[4]; // extended grid dimensions
+    int border[4];
+    const bool first; // first step, where the input lines are the identity
+
+    GaugeLineArg(const GaugeField &u, GaugeField &out, const GaugeField &in, GaugeField &out2, const GaugeField &in2,
+                 int n_dir, bool first) :
+      kernel_param(dim3(u.LocalVolumeCB(), 2, n_dir)),
+      u(u),
+      out(out),
+      in(in),
+      out2(out2),
+      in2(in2),
+      first(first)
+    {
+      for (int dir = 0; dir < 4; ++dir) {
+        border[dir] = u.R()[dir];
+        E[dir] = u.X()[dir];
+        X[dir] = u.X()[dir] - border[dir] * 2;
+      }
+    }
+  };
+
+  /**
+     Temporal line ending at x, Q_T(x) = Q_{T-1}(x - t) U_t(x - t).
+     After the global temporal extent this is the Polyakov loop.
+   */
+  template <typename Arg> struct PolyakovStep {
+    const Arg &arg;
+    constexpr PolyakovStep(const Arg &arg) : arg(arg) {}
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline void operator()(int x_cb, int parity, int)
+    {
+      using Link = Matrix<complex<typename Arg::Float>, Arg::nColor>;
+
+      int x[4];
+      getCoords(x, x_cb, arg.X, parity);
+      for (int dr = 0; dr < 4; ++dr) x[dr] += arg.border[dr];
+
+      int dx[4] = {0, 0, 0, -1};
+      int y_cb = linkIndexShift(x, dx, arg.E);
+      Link U = arg.u(3, y_cb, 1 - parity);
+      Link Q = arg.first ? U : static_cast<Link>(arg.in(0, y_cb, 1 - parity)) * U;
+      arg.out(0, linkIndex(x, arg.E), parity) = Q;
+    }
+  };
+
+  /**
+     Spatial line S_R(x) = U_i(x) S_{R-1}(x + i), and the temporal
+     link displaced along it, V_R(x) = U_t(x + R i) = V_{R-1}(x + i),
+     for each spatial direction i.  S is stored in out and V in out2.
+   */
+  template <typename Arg> struct SpatialLineStep {
+    const Arg &arg;
+    constexpr SpatialLineStep(const Arg &arg) : arg(arg) {}
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline void operator()(int x_cb, int parity, int i)
+    {
+      using Link = Matrix<complex<typename Arg::Float>, Arg::nColor>;
+
+      int x[4];
+      getCoords(x, x_cb, arg.X, parity);
+      for (int dr = 0; dr < 4; ++dr) x[dr] += arg.border[dr];
+      int e_cb = linkIndex(x, arg.E);
+
+      int dx[4] = {0, 0, 0, 0};
+      dx[i]++;
+      int y_cb = linkIndexShift(x, dx, arg.E);
+
+      Link U = arg.u(i, e_cb, parity);
+      Link S = arg.first ? U : U * static_cast<Link>(arg.in(i, y_cb, 1 - parity));
+      Link V = arg.first ? static_cast<Link>(arg.u(3, y_cb, 1 - parity)) : static_cast<Link>(arg.in2(i, y_cb, 1 - parity));
+      arg.out(i, e_cb, parity) = S;
+      arg.out2(i, e_cb, parity) = V;
+    }
+  };
+
+  template <typename Float_, int nColor_, QudaReconstructType recon_>
+  struct WilsonLoopArg : GaugeLineArg<Float_, nColor_, recon_> {
+    double *loops; // per-site loop traces for this temporal extent, always in double
+
+    WilsonLoopArg(const GaugeField &u, GaugeField &d_out, const GaugeField &d_in, const GaugeField &s,
+                  const GaugeField &v, bool first, double *loops) :
+      GaugeLineArg<Float_, nColor_, recon_>(u, d_out, d_in, const_cast<GaugeField &>(v), s, 1, first),
+      loops(loops)
+    {
+    }
+  };
+
+  /**
+     Open loop from x, down to x - T t, across to x - T t + R i and up
+     to x + R i, D_T(x) = U_t(x - t)^dag D_{T-1}(x - t) V_R(x - t),
+     with D_0 = S_R.  Closing it with S_R(x)^dag gives the R x T
+     Wilson loop, whose real trace summed over i is stored per site.
+     The line fields are D (in/out), S (in2) and V (out2, read only).
+   */
+  template <typename Arg> struct WilsonLoopStep {
+    const Arg &arg;
+    constexpr WilsonLoopStep(const Arg &arg) : arg(arg) {}
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline void operator()(int x_cb, int parity, int)
+    {
+      using Link = Matrix<complex<typename Arg::Float>, Arg::nColor>;
+
+      int x[4];
+      getCoords(x, x_cb, arg.X, parity);
+      for (int dr = 0; dr < 4; ++dr) x[dr] += arg.border[dr];
+      int e_cb = linkIndex(x, arg.E);
+
+      int dx[4] = {0, 0, 0, -1};
+      int y_cb = linkIndexShift(x, dx, arg.E);
+      Link U = arg.u(3, y_cb, 1 - parity);
+
+      double w = 0.0;
+#pragma unroll
+      for (int i = 0; i < 3; i++) {
+        Link D = arg.first ? static_cast<Link>(arg.in2(i, y_cb, 1 - parity)) : static_cast<Link>(arg.in(i, y_cb, 1 - parity));
+        Link V = arg.out2(i, y_cb, 1 - parity);
+        D = conj(U) * D * V;
+        arg.out(i, e_cb, parity) = D;
+
+        Link S = arg.in2(i, e_cb, parity);
+        w += getTrace(D * conj(S)).real();
+      }
+      arg.loops[x_cb + parity * arg.threads.x] = w;
+    }
+  };
+
+  template <typename Float_, int nColor_, QudaReconstructType recon_>
+  struct PolyakovTraceArg : ReduceArg<array<double, 2>> {
+    using reduce_t = array<double, 2>;
+    using Float = Float_;
+    static constexpr int nColor = nColor_;
+    typedef typename gauge_mapper<Float, QUDA_RECONSTRUCT_NO>::type Line;
+
+    const Line q;
+    complex<double> *density; // per spatial site, written from the local t = 0 slice
+    const double sign;        // -1 for an anti-periodic temporal boundary
+
+    int X[4]; // true grid dimensions
+    int E[4]; // extended grid dimensions
+    int border[4];
+
+    PolyakovTraceArg(const GaugeField &q, complex<double> *density, double sign) :
+      ReduceArg<reduce_t>(dim3(q.LocalVolumeCB(), 2, 1)),
+      q(q),
+      density(density),
+      sign(sign)
+    {
+      for (int dir = 0; dir < 4; ++dir) {
+        border[dir] = q.R()[dir];
+        E[dir] = q.X()[dir];
+        X[dir] = q.X()[dir] - border[dir] * 2;
+      }
+    }
+
+    __device__ __host__ reduce_t init() const { return reduce_t {0, 0}; }
+  };
+
+  template <typename Arg> struct PolyakovTrace : plus<array<double, 2>> {
+    using reduce_t = array<double, 2>;
+    using plus<reduce_t>::operator();
+    const Arg &arg;
+    constexpr PolyakovTrace(const Arg &arg) : arg(arg) {}
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline reduce_t operator()(reduce_t &value, int x_cb, int parity)
+    {
+      using Link = Matrix<complex<typename Arg::Float>, Arg::nColor>;
+
+      int x[4];
+      getCoords(x, x_cb, arg.X, parity);
+      int e[4];
+      for (int dr = 0; dr < 4; ++dr) e[dr] = x[dr] + arg.border[dr];
+
+      Link Q = arg.q(0, linkIndex(e, arg.E), parity);
+      auto tr = getTrace(Q);
+      complex<double> p(arg.sign * tr.real(), arg.sign * tr.imag());
+      if (arg.density && x[3] == 0) arg.density[(x[2] * arg.X[1] + x[1]) * arg.X[0] + x[0]] = p;
+
+      return plus::operator()(reduce_t {p.real(), p.imag()}, value);
+    }
+  };
+
+  struct LoopSumArg : ReduceArg<double> {
+    using reduce_t = double;
+    const double *loops;
+    const unsigned int stride;
+
+    LoopSumArg(const double *loops, unsigned int volume, unsigned int n_loop) :
+      ReduceArg<reduce_t>(dim3(volume, 1, n_loop), n_loop),
+      loops(loops),
+      stride(volume)
+    {
+    }
+
+    __device__ __host__ reduce_t init() const { return 0.0; }
+  };
+
+  /**
+     Batched sum over sites of the per-site loop traces
+   */
+  template <typename Arg> struct LoopSum : plus<double> {
+    using reduce_t = double;
+    using plus<reduce_t>::operator();
+    const Arg &arg;
+    constexpr LoopSum(const Arg &arg) : arg(arg) {}
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline reduce_t operator()(reduce_t &value, int i, int, int j)
+    {
+      return plus::operator()(arg.loops[j * arg.stride + i], value);
+    }
+  };
+
+} // namespace quda
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <gauge_field_order.h>
+#include <index_helper.cuh>
+#include <quda_matrix.h>
+#include <array.h>
+#include <reduction_kernel.h>
+#include <kernels/field_strength_tensor.cuh>
+#include <kernels/gauge_qcharge.cuh>
+
+namespace quda
+{
+
+  /**
+     Components of the fused observable reduction
+   */
+  enum GaugeObservableIndex {
+    OBS_PLAQ_SPATIAL,
+    OBS_PLAQ_TEMPORAL,
+    OBS_ENERGY_SPATIAL,
+    OBS_ENERGY_TEMPORAL,
+    OBS_QCHARGE,
+    OBS_RECT_SPATIAL,
+    OBS_RECT_TEMPORAL,
+    OBS_N
+  };
+
+  template <typename Float_, int nColor_, QudaReconstructType recon_, bool density_, bool rectangle_>
+  struct GaugeObservableArg : public ReduceArg<array<double, OBS_N>> {
+    using reduce_t = array<double, OBS_N>;
+    using Float = Float_;
+    static constexpr int nColor = nColor_;
+    static_assert(nColor == 3, "Only nColor=3 enabled at this time");
+    static constexpr QudaReconstructType recon = recon_;
+    static constexpr bool density = density_;
+    static constexpr bool rectangle = rectangle_;
+    typedef typename gauge_mapper<Float, recon>::type Gauge;
+
+    Gauge u;
+    Float *qDensity;
+
+    int X[4]; // true grid dimensions
+    int E[4]; // extended grid dimensions
+    int border[4];
+
+    GaugeObservableArg(const GaugeField &u, Float *qDensity) :
+      ReduceArg<reduce_t>(dim3(u.LocalVolumeCB(), 2, 1)),
+      u(u),
+      qDensity(qDensity)
+    {
+      for (int dir = 0; dir < 4; ++dir) {
+        border[dir] = u.R()[dir];
+        E[dir] = u.X()[dir];
+        X[dir] = u.X()[dir] - border[dir] * 2;
+      }
+    }
+
+    __device__ __host__ reduce_t init() const { return reduce_t {}; }
+  };
+
+  /**
+     @brief Real trace of the 2x1 rectangle extending twice in the mu
+     direction and once in the nu direction from x
+   */
+  template <typename Arg>
+  __device__ __host__ inline double rectangle(const Arg &arg, const int *x, int parity, int mu, int nu)
+  {
+    using Link = Matrix<complex<typename Arg::Float>, Arg::nColor>;
+
+    int dx[4] = {0, 0, 0, 0};
+    Link U = arg.u(mu, linkIndexShift(x, dx, arg.E), parity);
+    dx[mu]++;
+    U = U * arg.u(mu, linkIndexShift(x, dx, arg.E), 1 - parity);
+    dx[mu]++;
+    U = U * arg.u(nu, linkIndexShift(x, dx, arg.E), parity);
+    dx[mu]--;
+    dx[nu]++;
+    U = U * conj(arg.u(mu, linkIndexShift(x, dx, arg.E), parity));
+    dx[mu]--;
+    U = U * conj(arg.u(mu, linkIndexShift(x, dx, arg.E), 1 - parity));
+    dx[nu]--;
+    U = U * conj(arg.u(nu, linkIndexShift(x, dx, arg.E), parity));
+
+    return getTrace(U).real();
+  }
+
+  /**
+     Compute the plaquette, clover-leaf field energy, topological
+     charge, and optionally the rectangle, in a single pass over the
+     gauge field.  The plaquette is the first leaf of each clover, so
+     comes for free, and the field strength is never stored unless
+     the charge density is requested.
+   */
+  template <typename Arg> struct GaugeObservableFused : plus<array<double, OBS_N>> {
+    using reduce_t = array<double, OBS_N>;
+    using plus<reduce_t>::operator();
+    const Arg &arg;
+    constexpr GaugeObservableFused(const Arg &arg) : arg(arg) {}
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline reduce_t operator()(reduce_t &value, int x_cb, int parity)
+    {
+      using real = typename Arg::Float;
+      using Link = Matrix<complex<real>, Arg::nColor>;
+
+      int x[4];
+      getCoords(x, x_cb, arg.X, parity);
+#pragma unroll
+      for (int dr = 0; dr < 4; ++dr) x[dr] += arg.border[dr]; // extended grid coordinates
+
+      // F0 = F[Y,X], F1 = F[Z,X], F2 = F[Z,Y],
+      // F3 = F[T,X], F4 = F[T,Y], F5 = F[T,Z]
+      real plaq[6];
+      Link F[6];
+      F[0] = computeFmunu<1, 0>(arg, x, arg.E, parity, plaq[0]);
+      F[1] = computeFmunu<2, 0>(arg, x, arg.E, parity, plaq[1]);
+      F[2] = computeFmunu<2, 1>(arg, x, arg.E, parity, plaq[2]);
+      F[3] = computeFmunu<3, 0>(arg, x, arg.E, parity, plaq[3]);
+      F[4] = computeFmunu<3, 1>(arg, x, arg.E, parity, plaq[4]);
+      F[5] = computeFmunu<3, 2>(arg, x, arg.E, parity, plaq[5]);
+
+      reduce_t obs {};
+      obs[OBS_PLAQ_SPATIAL] = plaq[0] + plaq[1] + plaq[2];
+      obs[OBS_PLAQ_TEMPORAL] = plaq[3] + plaq[4] + plaq[5];
+
+      auto eq = energyQCharge<real, Arg::nColor>(F);
+      obs[OBS_ENERGY_SPATIAL] = eq[0];
+      obs[OBS_ENERGY_TEMPORAL] = eq[1];
+      obs[OBS_QCHARGE] = eq[2];
+      if (Arg::density) arg.qDensity[x_cb + parity * arg.threads.x] = eq[2];
+
+      if (Arg::rectangle) {
+#pragma unroll
+        for (int mu = 0; mu < 4; mu++) {
+#pragma unroll
+          for (int nu = 0; nu < 4; nu++) {
+            if (mu == nu) continue;
+            int i = (mu == 3 || nu == 3) ? OBS_RECT_TEMPORAL : OBS_RECT_SPATIAL;
+            obs[i] += rectangle(arg, x, parity, mu, nu);
+          }
+        }
+      }
+
+      return plus::operator()(obs, value);
+    }
+  };
+
+} // namespace quda
@@ -1,5 +1,8 @@
+#pragma once
+
 #include <gauge_field_order.h>
 #include <index_helper.cuh>
+#include <quda_matrix.h>
 #include <array.h>
 #include <reduction_kernel.h>
 
@@ -28,6 +31,49 @@ namespace quda
     __device__ __host__ auto init() const { return reduce_t{0, 0, 0}; }
   };
 
+  /**
+     @brief Compute the spatial and temporal field energy and the
+     topological charge density from the field-strength tensor at a site
+     @param[in] F The six components F[Y,X], F[Z,X], F[Z,Y], F[T,X], F[T,Y], F[T,Z]
+     @return {spatial energy, temporal energy, charge density}
+   */
+  template <typename real, int nColor>
+  __device__ __host__ inline array<double, 3> energyQCharge(const Matrix<complex<real>, nColor> F[6])
+  {
+    using Link = Matrix<complex<real>, nColor>;
+    constexpr real q_norm = static_cast<real>(-1.0 / (4*M_PI*M_PI));
+    constexpr real n_inv = static_cast<real>(1.0 / nColor);
+
+    array<double, 3> E_local{0, 0, 0};
+
+    // first compute the field energy
+    Link iden;
+    setIdentity(&iden);
+#pragma unroll
+    for (int i=0; i<6; i++) {
+      // Make traceless
+      auto tmp = F[i] - n_inv * getTrace(F[i]) * iden;
+
+      // Sum trace of square, normalise in .cu
+      if (i<3) E_local[0] -= getTrace(tmp * tmp).real(); //spatial
+      else     E_local[1] -= getTrace(tmp * tmp).real(); //temporal
+    }
+
+    // now compute topological charge
+    double Q_idx = 0.0;
+    double Qi[3] = {0.0,0.0,0.0};
+    // unroll computation
+#pragma unroll
+    for (int i=0; i<3; i++) {
+      Qi[i] = getTrace(F[i] * F[5 - i]).real();
+    }
+
+    // apply correct levi-civita symbol
+    for (int i=0; i<3; i++) i % 2 == 0 ? Q_idx += Qi[i]: Q_idx -= Qi[i];
+    E_local[2] = Q_idx * q_norm;
+    return E_local;
+  }
+
   // Core routine for computing the topological charge from the field strength
   template <typename Arg> struct qCharge : plus<array<double, 3>> {
     using reduce_t = array<double, 3>;
@@ -41,11 +87,6 @@ namespace quda
     {
       using real = typename Arg::Float;
       using Link = Matrix<complex<real>, Arg::nColor>;
-      constexpr real q_norm = static_cast<real>(-1.0 / (4*M_PI*M_PI));
-      constexpr real n_inv = static_cast<real>(1.0 / Arg::nColor);
-
-      reduce_t E_local{0, 0, 0};
-      double &Q = E_local[2];
 
       // Load the field-strength tensor from global memory
       //F0 = F[Y,X], F1 = F[Z,X], F2 = F[Z,Y],
@@ -53,32 +94,8 @@ namespace quda
       Link F[] = {arg.f(0, x_cb, parity), arg.f(1, x_cb, parity), arg.f(2, x_cb, parity),
                   arg.f(3, x_cb, parity), arg.f(4, x_cb, parity), arg.f(5, x_cb, parity)};
 
-      // first compute the field energy
-      Link iden;
-      setIdentity(&iden);
-#pragma unroll
-      for (int i=0; i<6; i++) {
-        // Make traceless
-        auto tmp = F[i] - n_inv * getTrace(F[i]) * iden;
-
-        // Sum trace of square, normalise in .cu
-        if (i<3) E_local[0] -= getTrace(tmp * tmp).real(); //spatial
-        else     E_local[1] -= getTrace(tmp * tmp).real(); //temporal
-      }
-
-      // now compute topological charge
-      double Q_idx = 0.0;
-      double Qi[3] = {0.0,0.0,0.0};
-      // unroll computation
-#pragma unroll
-      for (int i=0; i<3; i++) {
-        Qi[i] = getTrace(F[i] * F[5 - i]).real();
-      }
-
-      // apply correct levi-civita symbol
-      for (int i=0; i<3; i++) i % 2 == 0 ? Q_idx += Qi[i]: Q_idx -= Qi[i];
-      Q = Q_idx * q_norm;
-      if (Arg::density) arg.qDensity[x_cb + parity * arg.threads.x] = Q;
+      reduce_t E_local = energyQCharge<real, Arg::nColor>(F);
+      if (Arg::density) arg.qDensity[x_cb + parity * arg.threads.x] = E_local[2];
 
       return plus::operator()(E, E_local);
     }
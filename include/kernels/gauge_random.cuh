@@ -20,10 +20,10 @@ namespace quda {
     int X[4]; // true grid dimensions
     int border[4];
     Gauge U;
-    RNGState *rng;
+    RNGKey rng;
     real sigma; // where U = exp(sigma * H)
 
-    GaugeGaussArg(const GaugeField &U, RNGState *rng, double sigma) :
+    GaugeGaussArg(const GaugeField &U, const RNGKey &rng, double sigma) :
       kernel_param(dim3(U.LocalVolumeCB(), 2, 1)),
       U(U),
       rng(rng),
@@ -92,7 +92,7 @@ namespace quda {
         for (int mu = 0; mu < 4; mu++) arg.U(mu, linkIndex(x, arg.E), parity) = I;
       } else {
         for (int mu = 0; mu < 4; mu++) {
-          RNGState localState = arg.rng[parity * arg.threads.x + x_cb];
+          RNGState localState = arg.rng.state(x_cb, parity, mu);
 
           // generate Gaussian distributed su(n) fiueld
           Link u = gauss_su3<real, Link>(localState);
@@ -101,8 +101,6 @@ namespace quda {
             expsu3<real>(u);
           }
           arg.U(mu, linkIndex(x, arg.E), parity) = u;
-
-          arg.rng[parity * arg.threads.x + x_cb] = localState;
         }
       }
     }
@@ -72,5 +72,104 @@ namespace quda {
       arg.out(dir, x, parity) = result;
     }
   };
-  
+
+  /**
+     Use of the per-link exponential parameters of the momentum: not
+     used, computed and stored, or loaded
+   */
+  enum class ExpCache { none, write, read };
+
+  template <typename Float, int nColor_, QudaReconstructType recon_u, QudaReconstructType recon_m, bool conj_mom_,
+            bool use_force_, ExpCache cache_>
+  struct UpdateGaugeExpArg : kernel_param<> {
+    using real = typename mapper<Float>::type;
+    static constexpr int nColor = nColor_;
+    static_assert(nColor == 3, "Only nColor=3 enabled at this time");
+    static constexpr bool conj_mom = conj_mom_;
+    static constexpr bool use_force = use_force_;
+    static constexpr ExpCache cache = cache_;
+    typedef typename gauge_mapper<Float,recon_u>::type Gauge;
+    typedef typename gauge_mapper<Float,recon_m>::type Mom;
+    Gauge out;
+    const Gauge in;
+    const Mom mom;
+    const Mom force;
+    real a;
+    real b;
+    real *exp_param; // (u, w) of the exponential of each momentum link at unit step
+
+    UpdateGaugeExpArg(GaugeField &out, const GaugeField &in, const GaugeField &mom, const GaugeField &force, real a,
+                      real b, real *exp_param) :
+      kernel_param(dim3(in.VolumeCB(), 2, in.Geometry())),
+      out(out),
+      in(in),
+      mom(mom),
+      force(force),
+      a(a),
+      b(b),
+      exp_param(exp_param)
+    {
+    }
+  };
+
+  /**
+     Update U = exp(a P + b F) U, with the exponential formed by the
+     Cayley-Hamilton method.  The parameters of the exponential scale
+     linearly with the exponent, so with b = 0 those of P can be stored
+     once and reused for any a.
+   */
+  template <typename Arg> struct UpdateGaugeExp {
+    const Arg &arg;
+    constexpr UpdateGaugeExp(const Arg &arg) : arg(arg) {}
+    static constexpr const char* filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline void operator()(int x, int parity, int dir)
+    {
+      using real = typename Arg::real;
+      using Complex = complex<real>;
+      using Link = Matrix<Complex, Arg::nColor>;
+
+      Link p;
+      if (Arg::use_force) {
+        Link f = arg.force(dir, x, parity);
+        p = arg.b * f;
+        if (arg.a != static_cast<real>(0.0)) {
+          Link m = arg.mom(dir, x, parity);
+          p += arg.a * m;
+        }
+      } else {
+        p = arg.mom(dir, x, parity);
+        if (Arg::cache == ExpCache::none) p = arg.a * p;
+      }
+      if (Arg::conj_mom) p = conj(p);
+
+      Complex trace = getTrace(p);
+      for (int c = 0; c < Arg::nColor; c++) p(c, c) -= trace / static_cast<real>(Arg::nColor);
+
+      // exp(p) = exp(iQ) with hermitian Q = -i p
+      Link Q = Complex(0.0, -1.0) * p;
+
+      real u, w;
+      const int idx = 2 * ((dir * 2 + parity) * arg.threads.x + x);
+      if (Arg::cache == ExpCache::read) {
+        u = arg.a * arg.exp_param[idx + 0];
+        w = arg.a * arg.exp_param[idx + 1];
+        Q = arg.a * Q;
+      } else {
+        exponentiate_iQ_params(Q, u, w);
+        if (Arg::cache == ExpCache::write) {
+          // stored at unit step, and then scaled to the step size
+          arg.exp_param[idx + 0] = u;
+          arg.exp_param[idx + 1] = w;
+          u *= arg.a;
+          w *= arg.a;
+          Q = arg.a * Q;
+        }
+      }
+
+      Link link = arg.in(dir, x, parity);
+      arg.out(dir, x, parity) = exponentiate_iQ(Q, u, w) * link;
+    }
+  };
+
 }
@@ -4,6 +4,7 @@
 #include <kernels/gauge_utils.cuh>
 #include <su3_project.cuh>
 #include <kernel.h>
+#include <reduction_kernel.h>
 
 namespace quda
 {
@@ -29,6 +30,7 @@ namespace quda
 
     Gauge out;
     Matrix temp;
+    Matrix err; // exponent of the embedded second-order step
     const Gauge in;
 
     int_fastdiv X[4];    // grid dimensions
@@ -37,15 +39,18 @@ namespace quda
     const real epsilon;
     const real coeff1x1;
     const real coeff2x1;
+    const bool estimate_error;
 
-    GaugeWFlowArg(GaugeField &out, GaugeField &temp, const GaugeField &in, const real epsilon) :
+    GaugeWFlowArg(GaugeField &out, GaugeField &temp, const GaugeField &in, const real epsilon, GaugeField *err) :
       kernel_param(dim3(in.LocalVolumeCB(), 2, wflow_dim)),
       out(out),
       temp(temp),
+      err(err ? *err : temp),
       in(in),
       epsilon(epsilon),
       coeff1x1(5.0/3.0),
-      coeff2x1(-1.0/12.0)
+      coeff2x1(-1.0/12.0),
+      estimate_error(err != nullptr)
     {
       for (int dir = 0; dir < 4; ++dir) {
         border[dir] = in.R()[dir];
@@ -94,15 +99,22 @@ namespace quda
   template <typename Link, typename Arg>
   __host__ __device__ inline auto computeW2Step(const Arg &arg, Link &U, const int *x, const int parity, const int x_cb, const int dir)
   {
+    using real = typename Arg::real;
     // Compute staples and Z1
-    Link Z1 = static_cast<typename Arg::real>(8.0 / 9.0) * computeStaple(arg, x, parity, dir);
+    Link Z1 = computeStaple(arg, x, parity, dir);
     U = arg.in(dir, linkIndex(x, arg.E), parity);
     Z1 *= conj(U);
 
-    // Retrieve Z0, (8/9 Z1 - 17/36 Z0) stored in temp
+    // Retrieve Z0
     Link Z0 = arg.temp(dir, x_cb, parity);
-    Z0 *= static_cast<typename Arg::real>(17.0 / 36.0);
-    Z1 = Z1 - Z0;
+
+    // The embedded second-order step exp(2 Z1 - Z0) W0 is, to the
+    // order required, exp(10/9 Z1 - 7/9 Z0) W2 (Fritzsch and Ramos,
+    // https://arxiv.org/abs/1301.4388)
+    if (arg.estimate_error) arg.err(dir, x_cb, parity) = static_cast<real>(10.0 / 9.0) * Z1 - static_cast<real>(7.0 / 9.0) * Z0;
+
+    // (8/9 Z1 - 17/36 Z0) stored in temp
+    Z1 = static_cast<real>(8.0 / 9.0) * Z1 - static_cast<real>(17.0 / 36.0) * Z0;
     arg.temp(dir, x_cb, parity) = Z1;
     Z1 *= arg.epsilon;
     return Z1;
@@ -156,4 +168,79 @@ namespace quda
     }
   };
 
+  template <typename Float, int nColor_, QudaReconstructType recon_>
+  struct WFlowErrorArg : ReduceArg<double> {
+    using reduce_t = double;
+    using real = typename mapper<Float>::type;
+    static constexpr int nColor = nColor_;
+    static constexpr QudaReconstructType recon = recon_;
+    typedef typename gauge_mapper<Float,recon>::type Gauge;
+    typedef typename gauge_mapper<Float,QUDA_RECONSTRUCT_NO>::type Matrix;
+
+    const Gauge out;
+    const Gauge in;
+    const Matrix err;
+
+    int X[4];    // grid dimensions
+    int border[4];
+    int E[4];
+    const real epsilon;
+
+    WFlowErrorArg(const GaugeField &out, const GaugeField &in, const GaugeField &err, const real epsilon) :
+      ReduceArg<reduce_t>(dim3(in.LocalVolumeCB(), 2, 1)),
+      out(out),
+      in(in),
+      err(err),
+      epsilon(epsilon)
+    {
+      for (int dir = 0; dir < 4; ++dir) {
+        border[dir] = in.R()[dir];
+        X[dir] = in.X()[dir] - border[dir] * 2;
+        E[dir] = in.X()[dir];
+      }
+    }
+
+    __device__ __host__ reduce_t init() const { return 0.0; }
+  };
+
+  /**
+     Maximum over links of the distance between the third-order step
+     W3 and the embedded second-order step, (1/Nc) || W3 - exp(Z) W2 ||
+     where Z is the exponent stored by the W2 step.
+   */
+  template <typename Arg> struct WFlowError : maximum<double> {
+    using reduce_t = double;
+    using maximum<reduce_t>::operator();
+    const Arg &arg;
+    constexpr WFlowError(const Arg &arg) : arg(arg) {}
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline reduce_t operator()(reduce_t &value, int x_cb, int parity)
+    {
+      using real = typename Arg::real;
+      using Link = Matrix<complex<real>, Arg::nColor>;
+      complex<real> im(0.0,-1.0);
+
+      int x[4];
+      getCoords(x, x_cb, arg.X, parity);
+      for (int dr = 0; dr < 4; ++dr) x[dr] += arg.border[dr];
+      int e_cb = linkIndex(x, arg.E);
+
+      reduce_t dist = 0.0;
+#pragma unroll
+      for (int dir = 0; dir < 4; dir++) {
+        Link Z = arg.err(dir, x_cb, parity);
+        Z *= arg.epsilon;
+        makeAntiHerm(Z);
+        Z = im * Z;
+        Link U = arg.in(dir, e_cb, parity);
+        U = exponentiate_iQ(Z) * U;
+        Link W = arg.out(dir, e_cb, parity);
+        U = U - W;
+        dist = operator()(static_cast<reduce_t>(U.L2()) / Arg::nColor, dist);
+      }
+      return operator()(dist, value);
+    }
+  };
+
 } // namespace quda
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <vector>
 #include <index_helper.cuh>
 #include <gauge_field_order.h>
 #include <fast_intdiv.h>
@@ -7,16 +8,22 @@
 
 namespace quda {
 
+  constexpr int ks_link_max_set = 2; // maximum number of path-coefficient sets computed in a single pass
+
   template <typename Float_, int nColor_, QudaReconstructType recon>
   struct LinkArg : kernel_param<> {
     using Float = Float_;
     static constexpr int nColor = nColor_;
     typedef typename gauge_mapper<Float, QUDA_RECONSTRUCT_NO>::type Link;
     typedef typename gauge_mapper<Float, recon, 18, QUDA_STAGGERED_PHASE_MILC>::type Gauge;
+    static_assert(ks_link_max_set == 2, "Output accessors assume two coefficient sets");
 
-    Link link;
+    Link link[ks_link_max_set]; /** output of each coefficient set */
+    Link lng[ks_link_max_set];  /** long-link output of each set when fused with the one-link term */
     Gauge u;
-    Float coeff;
+    Float coeff[ks_link_max_set];
+    Float naik[ks_link_max_set];
+    int n_set;
 
     int_fastdiv X[4];
     int_fastdiv E[4];
@@ -28,16 +35,31 @@ namespace quda {
     partitioned then we have to correct for this when computing the local index */
     int odd_bit;
 
-    LinkArg(GaugeField &link, const GaugeField &u, Float coeff) :
-      kernel_param(dim3(link.VolumeCB(), 2, 4)),
-      link(link),
+    /**
+       @param[out] link Output field of each coefficient set
+       @param[out] lng Long-link output of each set, or empty if the long links are not fused
+       @param[in] u Extended input gauge field
+       @param[in] coeff Coefficient of each set
+       @param[in] naik Long-link coefficient of each set
+     */
+    LinkArg(const std::vector<GaugeField *> &link, const std::vector<GaugeField *> &lng, const GaugeField &u,
+            const std::vector<double> &coeff, const std::vector<double> &naik = {}) :
+      kernel_param(dim3(link[0]->VolumeCB(), 2, 4)),
+      link {*link[0], *link.back()},
+      lng {lng.size() ? *lng[0] : *link[0], lng.size() ? *lng.back() : *link.back()},
       u(u),
-      coeff(coeff)
+      n_set(link.size())
     {
       if (u.StaggeredPhase() != QUDA_STAGGERED_PHASE_MILC && u.Reconstruct() != QUDA_RECONSTRUCT_NO)
         errorQuda("Staggered phase type %d not supported", u.StaggeredPhase());
+      if (n_set > ks_link_max_set)
+        errorQuda("Number of coefficient sets %d exceeds maximum %d", n_set, ks_link_max_set);
+      for (int i = 0; i < n_set; i++) {
+        this->coeff[i] = coeff[i];
+        this->naik[i] = naik.size() ? naik[i] : 0.0;
+      }
       for (int d=0; d<4; d++) {
-        X[d] = link.X()[d];
+        X[d] = link[0]->X()[d];
         E[d] = u.X()[d];
         border[d] = (E[d] - X[d]) / 2;
       }
@@ -63,7 +85,8 @@ namespace quda {
     Link c = arg.u(dir, linkIndexShift(x, dx, arg.E), parity);
     dx[dir]-=2;
 
-    arg.link(dir, idx, parity) = arg.coeff * a * b * c;
+    Link abc = a * b * c;
+    for (int s = 0; s < arg.n_set; s++) arg.link[s](dir, idx, parity) = arg.coeff[s] * abc;
   }
 
   template <typename Arg> struct ComputeLongLink
@@ -98,7 +121,53 @@ namespace quda {
       using Link = Matrix<complex<typename Arg::Float>, Arg::nColor>;
 
       Link a = arg.u(dir, linkIndex(x,arg.E), parity);
-      arg.link(dir, x_cb, parity) = arg.coeff*a;
+      for (int s = 0; s < arg.n_set; s++) arg.link[s](dir, x_cb, parity) = arg.coeff[s] * a;
+    }
+  };
+
+  /**
+     The one-link and long-link terms read the same first link, so
+     they are computed together in a single pass
+   */
+  template <int dir, typename Arg>
+  __device__ void oneLongLinkDir(const Arg &arg, int idx, int parity) {
+    int x[4];
+    int dx[4] = {0, 0, 0, 0};
+
+    getCoords(x, idx, arg.X, parity);
+    for (int d=0; d<4; d++) x[d] += arg.border[d];
+
+    using Link = Matrix<complex<typename Arg::Float>, Arg::nColor>;
+
+    Link a = arg.u(dir, linkIndex(x, arg.E), parity);
+
+    dx[dir]++;
+    Link b = arg.u(dir, linkIndexShift(x, dx, arg.E), 1-parity);
+
+    dx[dir]++;
+    Link c = arg.u(dir, linkIndexShift(x, dx, arg.E), parity);
+
+    Link abc = a * b * c;
+    for (int s = 0; s < arg.n_set; s++) {
+      arg.link[s](dir, idx, parity) = arg.coeff[s] * a;
+      arg.lng[s](dir, idx, parity) = arg.naik[s] * abc;
+    }
+  }
+
+  template <typename Arg> struct ComputeOneLongLink
+  {
+    const Arg &arg;
+    constexpr ComputeOneLongLink(const Arg &arg) : arg(arg) {}
+    static constexpr const char* filename() { return KERNEL_FILE; }
+
+    __device__ __host__ void operator()(int x_cb, int parity, int dir)
+    {
+      switch(dir) {
+      case 0: oneLongLinkDir<0>(arg, x_cb, parity); break;
+      case 1: oneLongLinkDir<1>(arg, x_cb, parity); break;
+      case 2: oneLongLinkDir<2>(arg, x_cb, parity); break;
+      case 3: oneLongLinkDir<3>(arg, x_cb, parity); break;
+      }
     }
   };
 
@@ -118,11 +187,12 @@ namespace quda {
     int_fastdiv inner_X[4];
     int inner_border[4];
 
-    Link fat;
+    Link fat[ks_link_max_set]; /** fat link of each coefficient set */
     Link staple;
     MuLink mulink;
     Gauge u;
-    Float coeff;
+    Float coeff[ks_link_max_set];
+    int n_set;
 
     int nu;
     int mu_map[4];
@@ -133,25 +203,26 @@ namespace quda {
     partitioned then we have to correct for this when computing the local index */
     int odd_bit;
 
-    StapleArg(GaugeField &fat, GaugeField &staple, const GaugeField &mulink, const GaugeField &u,
-              Float coeff, int nu, int mu_map[4]) :
+    StapleArg(const std::vector<GaugeField *> &fat, GaugeField &staple, const GaugeField &mulink, const GaugeField &u,
+              const std::vector<double> &coeff, int nu, int mu_map[4]) :
       kernel_param(dim3(1, 2, 1)),
-      fat(fat),
+      fat {*fat[0], *fat.back()},
       staple(staple),
       mulink(mulink),
       u(u),
-      coeff(coeff),
+      n_set(fat.size()),
       nu(nu),
       odd_bit( (commDimPartitioned(0)+commDimPartitioned(1) +
                 commDimPartitioned(2)+commDimPartitioned(3))%2 )
     {
+      for (int i = 0; i < n_set; i++) this->coeff[i] = coeff[i];
       for (int d=0; d<4; d++) {
-        X[d] = (fat.X()[d] + u.X()[d]) / 2;
+        X[d] = (fat[0]->X()[d] + u.X()[d]) / 2;
         E[d] = u.X()[d];
         border[d] = (E[d] - X[d]) / 2;
         this->threads.x *= X[d];
 
-        inner_X[d] = fat.X()[d];
+        inner_X[d] = fat[0]->X()[d];
         inner_border[d] = (E[d] - inner_X[d]) / 2;
 
         this->mu_map[d] = mu_map[d];
@@ -270,9 +341,12 @@ namespace quda {
              x[3] < arg.inner_border[3] || x[3] >= arg.inner_X[3] + arg.inner_border[3]) ) {
         // convert to inner coords
         int inner_x[] = {x[0]-arg.inner_border[0], x[1]-arg.inner_border[1], x[2]-arg.inner_border[2], x[3]-arg.inner_border[3]};
-        Link fat = arg.fat(mu, linkIndex(inner_x, arg.inner_X), parity);
-        fat += arg.coeff * staple;
-        arg.fat(mu, linkIndex(inner_x, arg.inner_X), parity) = fat;
+        // the staple is shared by every coefficient set
+        for (int s = 0; s < arg.n_set; s++) {
+          Link fat = arg.fat[s](mu, linkIndex(inner_x, arg.inner_X), parity);
+          fat += arg.coeff[s] * staple;
+          arg.fat[s](mu, linkIndex(inner_x, arg.inner_X), parity) = fat;
+        }
       }
 
       if (arg.save_staple) arg.staple(mu, linkIndex(x, arg.E), parity) = staple;
@@ -56,24 +56,69 @@ namespace quda {
     }
   };
 
-  template<typename Float_, int nColor_, QudaReconstructType recon_>
+  template <typename Float_, int nColor_, QudaReconstructType recon_, bool max_>
+  struct ForceNormArg : ReduceArg<double> {
+    using Float = Float_;
+    static constexpr int nColor = nColor_;
+    using reducer = std::conditional_t<max_, maximum<double>, plus<double>>;
+    const typename gauge_mapper<Float, recon_>::type force;
+
+    ForceNormArg(const GaugeField &force) :
+      ReduceArg<double>(dim3(force.VolumeCB(), 2, 1)),
+      force(force) { }
+
+    __device__ __host__ double init() const { return 0.0; }
+  };
+
+  /**
+     Sum or maximum over the links of the norm of the projected force
+   */
+  template <typename Arg> struct ForceNorm : Arg::reducer {
+    using reduce_t = double;
+    using Arg::reducer::operator();
+    const Arg &arg;
+    constexpr ForceNorm(const Arg &arg) : arg(arg) {}
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline reduce_t operator()(reduce_t &norm, int x_cb, int parity)
+    {
+#pragma unroll
+      for (int d = 0; d < 4; d++) {
+        Matrix<complex<typename Arg::Float>, Arg::nColor> f = arg.force(d, x_cb, parity);
+        makeAntiHerm(f);
+        norm = operator()(static_cast<reduce_t>(f.L2()), norm);
+      }
+      return norm;
+    }
+  };
+
+  /**
+     When apply_u is set the force is left multiplied by the gauge
+     field (which shares the geometry of the force) before the
+     projection, fusing applyU into the momentum update.
+   */
+  template <typename Float_, int nColor_, QudaReconstructType recon_,
+            QudaReconstructType recon_u = QUDA_RECONSTRUCT_NO, bool apply_u_ = false>
   struct UpdateMomArg : ReduceArg<array<double, 2>>
   {
     using reduce_t = array<double, 2>;
     using Float = Float_;
     static constexpr int nColor = nColor_;
     static constexpr QudaReconstructType recon = recon_;
+    static constexpr bool apply_u = apply_u_;
     typename gauge_mapper<Float, QUDA_RECONSTRUCT_10>::type mom;
     typename gauge_mapper<Float, recon>::type force;
+    const typename gauge_mapper<Float, recon_u>::type U;
     Float coeff;
     int X[4]; // grid dimensions on mom
     int E[4]; // grid dimensions on force (possibly extended)
     int border[4]; //
 
-    UpdateMomArg(GaugeField &mom, const Float &coeff, const GaugeField &force) :
+    UpdateMomArg(GaugeField &mom, const Float &coeff, const GaugeField &force, const GaugeField &U) :
       ReduceArg<reduce_t>(dim3(mom.VolumeCB(), 2, 1)),
       mom(mom),
       force(force),
+      U(apply_u ? U : force),
       coeff(coeff)
     {
       for (int dir=0; dir<4; ++dir) {
@@ -107,6 +152,7 @@ namespace quda {
       for (int d=0; d<4; d++) {
         Matrix<complex<typename Arg::Float>, Arg::nColor> m = arg.mom(d, x_cb, parity);
         Matrix<complex<typename Arg::Float>, Arg::nColor> f = arg.force(d, e_cb, parity);
+        if (Arg::apply_u) f = arg.U(d, e_cb, parity) * f;
 
         // project to traceless anti-hermitian prior to taking norm
         makeAntiHerm(f);
@@ -50,11 +50,9 @@ namespace quda {
     using Gauge = typename gauge_mapper<real, recon>::type;
     int X[4]; // grid dimensions
     Gauge U;
-    RNGState *rng;
+    RNGKey rng;
     int border[4];
-    InitGaugeHotArg(const GaugeField &U, RNGState *rng) :
-      //the optimal number of RNG states in rngstate array must be equal to half the lattice volume
-      //this number is the same used in heatbath...
+    InitGaugeHotArg(const GaugeField &U, const RNGKey &rng) :
       kernel_param(dim3(U.LocalVolumeCB(), 1, 1)),
       U(U),
       rng(rng)
@@ -108,7 +106,7 @@ namespace quda {
 
   /**
      @brief Generate the four random real elements of the SU(2) matrix
-     @param localstate CURAND rng state
+     @param localstate RNG state
      @return four real numbers of the SU(2) matrix
   */
   template <class T>
@@ -174,7 +172,7 @@ namespace quda {
 
   /**
      @brief Generate a SU(Nc) random matrix
-     @param localstate CURAND rng state
+     @param localstate RNG state
      @return SU(Nc) matrix
   */
   template <class Float, int nColor>
@@ -208,8 +206,8 @@ namespace quda {
       int X[4], x[4];
       for ( int dr = 0; dr < 4; ++dr ) X[dr] = arg.X[dr];
       for ( int dr = 0; dr < 4; ++dr ) X[dr] += 2 * arg.border[dr];
-      RNGState localState = arg.rng[x_cb];
       for (int parity = 0; parity < 2; parity++) {
+        RNGState localState = arg.rng.state(x_cb, parity);
         getCoords(x, x_cb, arg.X, parity);
         for (int dr = 0; dr < 4; dr++) x[dr] += arg.border[dr];
         int e_cb = linkIndex(x, X);
@@ -219,7 +217,6 @@ namespace quda {
           arg.U(d, e_cb, parity) = U;
         }
       }
-      arg.rng[x_cb] = localState;
     }
   };
 
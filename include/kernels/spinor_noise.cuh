@@ -15,8 +15,8 @@ namespace quda {
     static constexpr QudaNoiseType noise = noise_;
     using V = typename colorspinor::FieldOrderCB<real, nSpin, nColor, 1, order>;
     V v;
-    RNGState *rng;
-    SpinorNoiseArg(ColorSpinorField &v, RNGState *rng) :
+    RNGKey rng;
+    SpinorNoiseArg(ColorSpinorField &v, const RNGKey &rng) :
       kernel_param(dim3(v.VolumeCB(), v.SiteSubset(), 1)),
       v(v),
       rng(rng) { }
@@ -46,14 +46,13 @@ namespace quda {
 
     __device__ __host__ void operator()(int x_cb, int parity)
     {
-      RNGState localState = arg.rng[parity * arg.threads.x + x_cb];
+      RNGState localState = arg.rng.state(x_cb, parity);
       for (int s=0; s<Arg::nSpin; s++) {
         for (int c=0; c<Arg::nColor; c++) {
           if (Arg::noise == QUDA_NOISE_GAUSS) genGauss<typename Arg::real>(arg, localState, parity, x_cb, s, c);
           else if (Arg::noise == QUDA_NOISE_UNIFORM) genUniform<typename Arg::real>(arg, localState, parity, x_cb, s, c);
         }
       }
-      arg.rng[parity * arg.threads.x + x_cb] = localState;
     }
   };
 
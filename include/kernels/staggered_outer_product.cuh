@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <gauge_field_order.h>
 #include <color_spinor_field_order.h>
 #include <quda_matrix.h>
@@ -8,6 +9,14 @@
 
 namespace quda {
 
+  constexpr int staggered_oprod_max_vector = 16; // maximum number of quark fields per interior launch
+
+  /**
+     The quark fields of a batch share their geometry, so a single
+     accessor per input is kept and only the field pointers are
+     swapped when loading a given field.  The exterior kernels read
+     the ghost zone of the first field of the batch only.
+   */
   template <typename Float, int nColor_, int dim_ = -1>
   struct StaggeredOprodArg : kernel_param<> {
     typedef typename mapper<Float>::type real;
@@ -17,34 +26,67 @@ namespace quda {
     using F = typename colorspinor_mapper<Float, nSpin, nColor>::type;
     using GU = typename gauge_mapper<Float, QUDA_RECONSTRUCT_NO, 18>::type;
     using GL = typename gauge_mapper<Float, QUDA_RECONSTRUCT_NO, 18>::type;
+    using vector = ColorSpinor<real, nColor, nSpin>;
 
     GU U;        /** output one-hop field */
     GL L;        /** output three-hop field */
     const F inA; /** input vector field */
     const F inB; /** input vector field */
+    Float *a[staggered_oprod_max_vector]; /** field pointer of each inA in the batch */
+    Float *b[staggered_oprod_max_vector]; /** field pointer of each inB in the batch */
+    size_t norm_offset;
 
+    const int n_vector;
     const int parity;
     int displacement;
     const int nFace;
-    real coeff[2];
+    real coeff[staggered_oprod_max_vector][2];
     int X[4];
     bool partitioned[4];
 
-    StaggeredOprodArg(GaugeField &U, GaugeField &L, const ColorSpinorField &inA, const ColorSpinorField &inB,
-                      int parity, int displacement, int nFace, const real coeff[2]) :
-      kernel_param(dim3(dim == -1 ? inB.VolumeCB() : displacement * inB.GhostFaceCB()[dim])),
+    StaggeredOprodArg(GaugeField &U, GaugeField &L, const std::vector<ColorSpinorField *> &inA,
+                      const std::vector<ColorSpinorField *> &inB, int first, int n_vector, int parity,
+                      int displacement, int nFace, const std::vector<std::array<double, 2>> &coeff) :
+      kernel_param(dim3(dim == -1 ? inB[first]->VolumeCB() : displacement * inB[first]->GhostFaceCB()[dim])),
       U(U),
       L(L),
-      inA(inA),
-      inB(inB, nFace),
+      inA(*inA[first]),
+      inB(*inB[first], nFace),
+      norm_offset(inA[first]->NormOffset()),
+      n_vector(n_vector),
       parity(parity),
       displacement(displacement),
-      nFace(nFace),
-      coeff{coeff[0], coeff[1]}
+      nFace(nFace)
     {
+      if (n_vector > staggered_oprod_max_vector)
+        errorQuda("Batch size %d exceeds maximum %d", n_vector, staggered_oprod_max_vector);
+      for (int i = 0; i < n_vector; i++) {
+        a[i] = static_cast<Float *>(inA[first + i]->V());
+        b[i] = static_cast<Float *>(inB[first + i]->V());
+        coeff[i][0] = coeff[first + i][0];
+        coeff[i][1] = coeff[first + i][1];
+      }
       for (int i = 0; i < 4; ++i) this->X[i] = U.X()[i];
       for (int i = 0; i < 4; ++i) this->partitioned[i] = commDimPartitioned(i) ? true : false;
     }
+
+    __device__ __host__ inline vector load(const F &f, Float *v, int x_cb) const
+    {
+      F g = f;
+      g.field = v;
+      g.norm = reinterpret_cast<typename F::norm_type *>(reinterpret_cast<char *>(v) + norm_offset);
+      return g(x_cb, 0);
+    }
+
+    /**
+       @brief Load inA of field i of the batch
+     */
+    __device__ __host__ inline vector A(int i, int x_cb) const { return load(inA, a[i], x_cb); }
+
+    /**
+       @brief Load inB of field i of the batch
+     */
+    __device__ __host__ inline vector B(int i, int x_cb) const { return load(inB, b[i], x_cb); }
   };
 
   template <typename Arg> struct Interior
@@ -56,10 +98,7 @@ namespace quda {
     __device__ __host__ inline void operator()(int x_cb)
     {
       using matrix = Matrix<complex<typename Arg::real>, Arg::nColor>;
-      using vector = ColorSpinor<typename Arg::real, Arg::nColor, 1>;
-
-      matrix result;
-      const vector x = arg.inA(x_cb, 0);
+      using vector = typename Arg::vector;
 
 #pragma unroll
       for (int dim=0; dim<4; ++dim) {
@@ -67,23 +106,25 @@ namespace quda {
         shift[dim] = 1;
         const int first_nbr_idx = neighborIndex(x_cb, shift, arg.partitioned, arg.parity, arg.X);
         if (first_nbr_idx >= 0) {
-          const vector y = arg.inB(first_nbr_idx, 0);
-          result = outerProduct(y, x);
+          shift[dim] = 3;
+          const int third_nbr_idx
+            = arg.nFace == 3 ? neighborIndex(x_cb, shift, arg.partitioned, arg.parity, arg.X) : -1;
+
+          // accumulate the weighted outer products of the whole batch before updating the output
+          matrix one_hop;
+          matrix three_hop;
+          for (int i = 0; i < arg.n_vector; i++) {
+            const vector x = arg.A(i, x_cb);
+            one_hop += arg.coeff[i][0] * outerProduct(arg.B(i, first_nbr_idx), x);
+            if (third_nbr_idx >= 0) three_hop += arg.coeff[i][1] * outerProduct(arg.B(i, third_nbr_idx), x);
+          }
+
           matrix tempA = arg.U(dim, x_cb, arg.parity);
-          result = tempA + result*arg.coeff[0];
-
-          arg.U(dim, x_cb, arg.parity) = result;
-
-          if (arg.nFace == 3) {
-            shift[dim] = 3;
-            const int third_nbr_idx = neighborIndex(x_cb, shift, arg.partitioned, arg.parity, arg.X);
-            if (third_nbr_idx >= 0) {
-              const vector z = arg.inB(third_nbr_idx, 0);
-              result = outerProduct(z, x);
-              matrix tempB = arg.L(dim, x_cb, arg.parity);
-              result = tempB + result*arg.coeff[1];
-              arg.L(dim, x_cb, arg.parity) = result;
-            }
+          arg.U(dim, x_cb, arg.parity) = tempA + one_hop;
+
+          if (third_nbr_idx >= 0) {
+            matrix tempB = arg.L(dim, x_cb, arg.parity);
+            arg.L(dim, x_cb, arg.parity) = tempB + three_hop;
           }
         }
       }
@@ -98,12 +139,12 @@ namespace quda {
     __device__ __host__ inline void operator()(int x_cb)
     {
       using matrix = Matrix<complex<typename Arg::real>, Arg::nColor>;
-      using vector = ColorSpinor<typename Arg::real, Arg::nColor, 1>;
+      using vector = typename Arg::vector;
 
       matrix result;
 
       auto &out = (arg.displacement == 1) ? arg.U : arg.L;
-      auto coeff = (arg.displacement == 1) ? arg.coeff[0] : arg.coeff[1];
+      auto coeff = (arg.displacement == 1) ? arg.coeff[0][0] : arg.coeff[0][1];
 
       int x[4];
       coordsFromIndexExterior(x, x_cb, arg.X, Arg::dim, arg.displacement, arg.parity);
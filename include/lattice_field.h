@@ -415,6 +415,9 @@ namespace quda {
     mutable char *backup_norm_h;
     mutable bool backed_up;
 
+    void *spill_h; // host copy of the field data while spilled
+    bool spilled;  // whether the field data is presently spilled to the host
+
   public:
 
     /**
@@ -719,6 +722,37 @@ namespace quda {
     /** @brief Restores the LatticeField */
     virtual void restore() const { errorQuda("Not implemented"); }
 
+    /**
+       @brief Spill the field data to host memory and release its
+       device allocation.  The field must not be accessed until it is
+       refilled.  This should only be called by the residency manager
+       (see field_residency.h).
+       @param[in] spill_precision Precision at which to store the
+       spilled data: if lower than the field precision the spill is
+       lossy (only supported for color-spinor fields)
+       @return Number of bytes transferred to the host
+    */
+    virtual size_t spill(QudaPrecision = QUDA_INVALID_PRECISION)
+    {
+      errorQuda("Not implemented");
+      return 0;
+    }
+
+    /**
+       @brief Reallocate the device storage of a spilled field and
+       copy its data back from host memory.  This should only be
+       called by the residency manager (see field_residency.h).
+       @return Number of bytes transferred to the device
+    */
+    virtual size_t refill()
+    {
+      errorQuda("Not implemented");
+      return 0;
+    }
+
+    /** @return Whether the field data is presently spilled to host memory */
+    bool Spilled() const { return spilled; }
+
     /**
       @brief If managed memory and prefetch is enabled, prefetch
       all relevant memory fields to the current device or to the CPU.
@@ -854,6 +888,37 @@ namespace quda {
   */
   void reorder_location_set(QudaFieldLocation reorder_location_);
 
+  /**
+     @brief Running totals of the compressed halo exchanges, used to
+     monitor the bandwidth saved.  The accuracy given up is reported
+     as the worst-case rounding bound of the ghost formats used, not
+     as a measured error.
+   */
+  struct HaloCompressionStats {
+    long long exchanges = 0; /** Number of compressed halo exchanges */
+    double bytes = 0.0;      /** Bytes sent in compressed halos */
+    double bytes_full = 0.0; /** Bytes these halos would have taken at the field precision */
+    double rounding_bound = 0.0; /** Worst-case relative rounding of a compressed halo element */
+  };
+
+  /**
+     @brief Return the compressed halo exchange counters
+   */
+  const HaloCompressionStats &getHaloCompressionStats();
+
+  /**
+     @brief Record a compressed halo exchange
+     @param[in] bytes Number of bytes sent in the compressed halo
+     @param[in] bytes_full Number of bytes the halo would take at the field precision
+     @param[in] ghost_precision Precision of the compressed halo
+   */
+  void recordHaloCompression(size_t bytes, size_t bytes_full, QudaPrecision ghost_precision);
+
+  /**
+     @brief Print the compressed halo exchange counters (if any exchanges were compressed)
+   */
+  void printHaloCompressionStats();
+
   /**
      @brief Helper function for setting auxilary string
      @param[in] meta LatticeField used for querying field location
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <vector>
 #include "quda.h"
 #include "quda_internal.h"
 
@@ -21,4 +22,20 @@ namespace quda {
   */
   void longKSLink(GaugeField *lng, const GaugeField &u, const double *coeff);
 
+  /**
+     @brief Compute the fat links, and optionally the long links, of
+     improved staggered (Kogut-Susskind) fermions for up to two sets
+     of path coefficients in a single pass.  The one-link and long-link
+     terms are computed together, and each 3-, 5- and 7-link staple
+     is computed once and accumulated into the fat link of every set.
+     @param fat[out] The computed fat link of each coefficient set
+     @param lng[out] The computed long link of each coefficient set, or empty
+     @param u[in] The extended input gauge field
+     @param coeff[in] Array of path coefficients of each set
+     @param staple[out] Staple temporary with the geometry of u
+     @param staple1[out] Staple temporary with the geometry of u
+  */
+  void fatLongKSLink(const std::vector<GaugeField *> &fat, const std::vector<GaugeField *> &lng, const GaugeField &u,
+                     const std::vector<const double *> &coeff, GaugeField &staple, GaugeField &staple1);
+
 } // namespace quda
@@ -1,4 +1,5 @@
 #pragma once
+#include <array>
 #include <gauge_field.h>
 
 namespace quda {
@@ -10,10 +11,19 @@ namespace quda {
    */
   double computeMomAction(const GaugeField &mom);
 
+  /**
+     @brief Compute the mean and maximum over the links of the
+     Frobenius norm of the traceless anti-hermitian projection of a
+     force field
+     @param force Force field
+     @return The mean and maximum link norm
+   */
+  std::array<double, 2> computeForceNorm(const GaugeField &force);
+
   /**
      Update the momentum field from the force field
 
-     mom = mom - coeff * [force]_TA
+     mom = mom + coeff * [force]_TA
 
      where [A]_TA means the traceless anti-hermitian projection of A
 
@@ -24,6 +34,20 @@ namespace quda {
    */
   void updateMomentum(GaugeField &mom, double coeff, GaugeField &force, const char *fname);
 
+  /**
+     Update the momentum field from the force field left multiplied
+     by the gauge field, fusing applyU into the update
+
+     mom = mom + coeff * [U * force]_TA
+
+     @param mom Momentum field
+     @param coeff Integration stepsize
+     @param force Force field
+     @param U Gauge field, with the same (possibly extended) dimensions as the force
+     @param func The function calling this (fname will be printed if force monitoring is enabled)
+   */
+  void updateMomentum(GaugeField &mom, double coeff, GaugeField &force, const GaugeField &U, const char *fname);
+
   /**
      Left multiply the force field by the gauge field
 
@@ -92,6 +92,25 @@ extern "C" {
     size_t site_size; /**< Size of MILC site struct (only if gauge_order=MILC_SITE_GAUGE_ORDER) */
   } QudaGaugeParam;
 
+  /**
+   * Per-iteration solver convergence record, see
+   * QudaInvertParam::solver_telemetry.  Times are those elapsed since
+   * the previous record of the same solve.
+   */
+  typedef struct QudaSolverTelemetry_s {
+    int solve;                 /**< Index of the solve this record belongs to */
+    QudaInverterType inv_type; /**< The solver that produced this record */
+    int iter;                  /**< Iteration count */
+    double r2;                 /**< Iterated residual norm squared */
+    double b2;                 /**< Source norm squared */
+    double hq_res;             /**< Heavy-quark residual (zero if not computed) */
+    int reliable_update;       /**< Number of reliable updates since the previous record */
+    QudaPrecision precision;   /**< Precision the iterations are being performed in */
+    double op_secs;            /**< Time spent applying the operator */
+    double blas_secs;          /**< Time spent in BLAS (excluding reductions) */
+    double reduce_secs;        /**< Time spent in reductions */
+    double secs;               /**< Total time */
+  } QudaSolverTelemetry;
 
   /**
    * Parameters relating to the solver and the choice of Dirac operator.
@@ -269,6 +288,7 @@ extern "C" {
     int compute_clover_inverse;            /**< Whether to compute the clover inverse field */
     int return_clover;                     /**< Whether to copy back the clover matrix field */
     int return_clover_inverse;             /**< Whether to copy back the inverted clover matrix field */
+    QudaBoolean clover_on_the_fly;         /**< Whether to recompute the clover term from the gauge field in the dslash instead of storing it */
 
     QudaVerbosity verbosity;               /**< The verbosity setting to use in the solver */
 
@@ -391,7 +411,11 @@ extern "C" {
     /** The index to indicate which chrono history we are augmenting */
     int chrono_index;
 
-    /** Precision to store the chronological basis in */
+    /** Precision to store the chronological basis in, which may be
+        any precision up to the outer precision (including half or
+        quarter).  A p is reused across solves at any precision; half
+        and quarter precision bases are promoted to single precision
+        for the extrapolation */
     QudaPrecision chrono_precision;
 
     /** Which external library to use in the linear solvers (MAGMA or Eigen) */
@@ -403,6 +427,52 @@ extern "C" {
     /** Whether to use fused kernels for mobius */
     QudaBoolean use_mobius_fused_kernel;
 
+    /** Whether to collect per-iteration solver telemetry.  Records
+        are kept in memory until flushSolverTelemetryQuda is called */
+    QudaBoolean solver_telemetry;
+
+    /** If non-empty, the file to which the telemetry of each solve is
+        appended, with one column per record member */
+    char solver_telemetry_file[256];
+
+    /** If set, called at the end of each solve with that solve's telemetry records */
+    void (*solver_telemetry_callback)(const QudaSolverTelemetry *records, int n_records, void *data);
+
+    /** User data passed through to solver_telemetry_callback */
+    void *solver_telemetry_data;
+
+    /** Whether CG and BiCGstab adapt the reliable-update delta during
+        the solve, from the gap between the true and iterated residual
+        observed at each reliable update.  The adapted delta is
+        returned in reliable_delta, so subsequent solves start from it */
+    QudaBoolean adaptive_reliable;
+
+    /** Whether to adapt the sloppy precision across solves.  When
+        enabled, invertQuda overwrites cuda_prec_sloppy with the
+        cheapest precision that has converged cleanly in previous
+        solves, bounded below by cuda_prec_sloppy_min and above by
+        cuda_prec.  The history is kept separately for each operator
+        and solver type, so interleaved solves do not share state */
+    QudaBoolean adaptive_precision;
+
+    /** Lowest sloppy precision the adaptive precision controller may select */
+    QudaPrecision cuda_prec_sloppy_min;
+
+    /** The number of reliable updates performed by the solver */
+    int reliable_updates;
+
+    /** The largest ratio of the true to iterated residual norm seen at a reliable update */
+    double max_reliable_gap;
+
+    /** Precision of the halo exchange of the sloppy and preconditioner
+        operators.  If below the operator precision, the halo is
+        compressed to this precision (fixed-point halos carry a
+        per-site norm) and expanded when consumed.  At present this
+        applies to the Wilson dslash only, and is independent of the
+        multigrid smoother halo precision.  QUDA_INVALID_PRECISION
+        exchanges at the operator precision */
+    QudaPrecision halo_precision_sloppy;
+
   } QudaInvertParam;
 
   // Parameter set for solving eigenvalue problems.
@@ -488,6 +558,10 @@ extern "C" {
     int max_restarts;
     /** For the Ritz rotation, the maximal number of extra vectors the solver may allocate **/
     int batched_rotate;
+    /** For the Ritz rotation, whether to rotate in place with a tiled GEMM (double and single precision only) **/
+    QudaBoolean use_gemm_rotate;
+    /** For the tiled GEMM Ritz rotation, the size of the tile workspace in units of Krylov vectors **/
+    int gemm_rotate_workspace;
     /** For block method solvers, the block size **/
     int block_size;
 
@@ -541,6 +615,13 @@ extern "C" {
     /**< The time taken by the eigensolver setup */
     double secs;
 
+    /** The number of restarts performed by the eigensolver */
+    int n_restarts;
+
+    /** The time spent rotating the Krylov space at restarts, including
+        any autotuning of the rotation kernels on their first call */
+    double rotate_secs;
+
     /** Which external library to use in the deflation operations (MAGMA or Eigen) */
     QudaExtLibType extlib_type;
     //-------------------------------------------------
@@ -755,8 +836,125 @@ extern "C" {
     double energy[3];                    /**< Total, spatial and temporal field energies, respectively */
     QudaBoolean compute_qcharge_density; /**< Whether to compute the topological charge density */
     void *qcharge_density; /**< Pointer to host array of length volume where the q-charge density will be copied */
+    QudaBoolean compute_rectangle; /**< Whether to compute the 2x1 rectangle */
+    double rectangle[3];           /**< Total, spatial and temporal rectangles, respectively */
   } QudaGaugeObservableParam;
 
+  typedef struct QudaGaugeFlowParam_s {
+    size_t struct_size; /**< Size of this struct in bytes.  Used to ensure that the host application and QUDA see the same struct*/
+    QudaWFlowType wflow_type; /**< 1x1 Wilson or 2x1 Symanzik flow type */
+    double step_size;         /**< Step size, or the initial step size if adaptive */
+    QudaBoolean adaptive;     /**< Whether to adapt the step size using an embedded error estimate */
+    double tol;               /**< Maximum local integration error per step, if adaptive */
+    double step_size_max;     /**< Maximum step size if adaptive (zero for no limit) */
+    int n_meas;               /**< Number of flow times at which to measure observables */
+    double *meas_time;        /**< Host array of n_meas ascending flow times at which to measure */
+    QudaGaugeObservableParam *obs_param; /**< Host array of n_meas structs that define the observables to measure at
+                                            each flow time, and into which the results are written */
+    int n_steps;    /**< Number of accepted steps (output) */
+    int n_rejected; /**< Number of rejected steps (output) */
+  } QudaGaugeFlowParam;
+
+  typedef struct QudaGaugeLoopParam_s {
+    size_t struct_size; /**< Size of this struct in bytes.  Used to ensure that the host application and QUDA see the same struct*/
+    QudaBoolean compute_polyakov_loop; /**< Whether to compute the Polyakov loop */
+    double polyakov_loop[2];           /**< Real and imaginary parts of the volume-averaged Polyakov loop */
+    void *polyakov_loop_density; /**< Optional pointer to host array of length spatial volume of complex doubles into
+                                    which the Polyakov loop at each local spatial site will be copied */
+    int r_max;    /**< Maximum spatial extent of the Wilson loops (zero for none) */
+    int t_max;    /**< Maximum temporal extent of the Wilson loops (zero for none) */
+    double *wilson_loop; /**< Host array of length r_max * t_max into which the R x T Wilson loop is written at
+                            index (R - 1) * t_max + T - 1 */
+    int n_ape; /**< Number of spatial APE smearing steps applied to the spatial links before measuring Wilson
+                  loops (HYP smearing is not implemented) */
+    double ape_alpha; /**< APE smearing parameter */
+  } QudaGaugeLoopParam;
+
+  /**
+   * HMC telemetry record, see QudaHMCParam::telemetry.  A record
+   * describes either a single force evaluation of an action term or,
+   * with term set to -1, a completed integration step on a level, in
+   * which case the time includes that of the nested levels.  The
+   * gauge terms on a level are evaluated together and are reported
+   * under the first of them.
+   */
+  typedef struct QudaHMCTelemetry_s {
+    int trajectory;     /**< Index of the trajectory this record belongs to */
+    int level;          /**< Integration level */
+    int step;           /**< Index of the step on the level within the enclosing step */
+    int term;           /**< Index of the action term, or -1 for a step record */
+    int force_gradient; /**< 1 for the force evaluation that sets a force-gradient displacement, 2 for the
+                           evaluation on the displaced field, else 0 */
+    double dt;          /**< Step size the force is applied with, or the length of the step */
+    double force_mean;  /**< Mean over links of the norm of the force per unit step */
+    double force_max;   /**< Maximum over links of the norm of the force per unit step */
+    int solver_iter;    /**< Solver iterations reported during the force evaluation */
+    double solver_secs; /**< Solver time reported during the force evaluation */
+    double secs;        /**< Time of the force evaluation or step */
+  } QudaHMCTelemetry;
+
+  typedef struct QudaHMCTerm_s {
+    QudaHMCTermType type; /**< Whether the term is the internal gauge action or supplied through callbacks */
+    int level;            /**< Integration level on which the term's force is applied (0 being the outermost) */
+    const char *name;     /**< Name under which the force is recorded by the force monitor (may be null) */
+    double beta;          /**< Gauge coupling (gauge terms only) */
+    double c1; /**< Rectangle coefficient, with plaquette coefficient c0 = 1 - 8 c1: zero for Wilson, -1/12 for
+                  tree-level Symanzik, -0.331 for Iwasaki and -1.4069 for DBW2 (gauge terms only) */
+    void (*refresh)(void *gauge, void *context); /**< Optional refresh at the start of the trajectory, e.g., the
+                                                    pseudofermion heat-bath (external terms only) */
+    double (*action)(void *gauge, void *context); /**< Return the term's action (external terms only) */
+    void (*force)(void *mom, void *gauge, double dt,
+                  void *context); /**< Add dt times the term's force to the momentum (external terms only) */
+    void *context;                /**< User data passed to the callbacks */
+    double action_init;           /**< Action at the start of the trajectory (output) */
+    double action_final;          /**< Action at the end of the trajectory (output) */
+    int n_force;        /**< Number of force evaluations in the trajectory (output, with telemetry) */
+    double force_mean;  /**< Mean link force norm averaged over the force evaluations (output, with telemetry) */
+    double force_max;   /**< Maximum link force norm over the force evaluations (output, with telemetry) */
+    int solver_iter;    /**< Solver iterations of the force evaluations (output, with telemetry) */
+    double solver_secs; /**< Solver time of the force evaluations (output, with telemetry) */
+    double force_secs;  /**< Total time of the force evaluations (output, with telemetry) */
+  } QudaHMCTerm;
+
+  typedef struct QudaHMCParam_s {
+    size_t struct_size; /**< Size of this struct in bytes.  Used to ensure that the host application and QUDA see the same struct*/
+    double tau;         /**< Trajectory length */
+    int n_level;        /**< Number of integration levels (timescales) */
+    QudaHMCIntegratorType integrator[QUDA_MAX_HMC_LEVEL]; /**< Integration scheme on each level */
+    int n_step[QUDA_MAX_HMC_LEVEL]; /**< Number of steps on each level per step of the enclosing level (per
+                                       trajectory on level 0) */
+    double lambda[QUDA_MAX_HMC_LEVEL]; /**< Parameter of the Omelyan scheme on each level */
+    int n_term;                        /**< Number of action terms */
+    QudaHMCTerm *term;                 /**< Host array of n_term action terms */
+    QudaBoolean refresh_mom; /**< Whether to draw Gaussian momenta, else the resident momentum is used */
+    unsigned long long seed; /**< Seed for the momentum heat-bath */
+    int trajectory; /**< Trajectory number.  The momenta are drawn from a stream derived from both seed and
+                       trajectory, so seed can be held fixed over a run as long as trajectory is advanced */
+    QudaBoolean accept_reject; /**< Whether to perform the Metropolis test, restoring the initial gauge field if
+                                  the trajectory is rejected */
+    double uniform; /**< Uniform random number in [0, 1) for the Metropolis test, identical on all processes */
+    double mom_action_init;  /**< Momentum action at the start of the trajectory (output) */
+    double mom_action_final; /**< Momentum action at the end of the trajectory (output) */
+    double delta_h;          /**< Change in the Hamiltonian over the trajectory (output) */
+    QudaBoolean accepted;    /**< Whether the trajectory was accepted (output) */
+    int n_force;             /**< Number of force evaluations summed over terms (output) */
+
+    /** Whether to collect per-force-evaluation and per-step
+        telemetry, which synchronizes after every force evaluation
+        and step.  Records are of type QudaHMCTelemetry, and the
+        per-term summaries are written to the terms. */
+    QudaBoolean telemetry;
+
+    /** If non-empty, the file to which the telemetry of each trajectory is appended */
+    char telemetry_file[256];
+
+    /** If set, called at the end of each trajectory with that trajectory's telemetry records */
+    void (*telemetry_callback)(const QudaHMCTelemetry *records, int n_records, void *data);
+
+    /** User data passed through to telemetry_callback */
+    void *telemetry_data;
+  } QudaHMCParam;
+
   typedef struct QudaBLASParam_s {
     size_t struct_size; /**< Size of this struct in bytes.  Used to ensure that the host application and QUDA see the same struct*/
 
@@ -951,6 +1149,33 @@ extern "C" {
    */
   QudaGaugeObservableParam newQudaGaugeObservableParam(void);
 
+  /**
+   * A new QudaGaugeFlowParam should always be initialized
+   * immediately after it's defined (and prior to explicitly setting
+   * its members) using this function.  Typical usage is as follows:
+   *
+   *   QudaGaugeFlowParam flow_param = newQudaGaugeFlowParam();
+   */
+  QudaGaugeFlowParam newQudaGaugeFlowParam(void);
+
+  /**
+   * A new QudaGaugeLoopParam should always be initialized
+   * immediately after it's defined (and prior to explicitly setting
+   * its members) using this function.  Typical usage is as follows:
+   *
+   *   QudaGaugeLoopParam loop_param = newQudaGaugeLoopParam();
+   */
+  QudaGaugeLoopParam newQudaGaugeLoopParam(void);
+
+  /**
+   * A new QudaHMCParam should always be initialized immediately
+   * after it's defined (and prior to explicitly setting its members)
+   * using this function.  Typical usage is as follows:
+   *
+   *   QudaHMCParam hmc_param = newQudaHMCParam();
+   */
+  QudaHMCParam newQudaHMCParam(void);
+
   /**
    * A new QudaBLASParam should always be initialized immediately
    * after it's defined (and prior to explicitly setting its members)
@@ -990,6 +1215,24 @@ extern "C" {
    */
   void printQudaGaugeObservableParam(QudaGaugeObservableParam *param);
 
+  /**
+   * Print the members of QudaGaugeFlowParam.
+   * @param param The QudaGaugeFlowParam whose elements we are to print.
+   */
+  void printQudaGaugeFlowParam(QudaGaugeFlowParam *param);
+
+  /**
+   * Print the members of QudaGaugeLoopParam.
+   * @param param The QudaGaugeLoopParam whose elements we are to print.
+   */
+  void printQudaGaugeLoopParam(QudaGaugeLoopParam *param);
+
+  /**
+   * Print the members of QudaHMCParam.
+   * @param param The QudaHMCParam whose elements we are to print.
+   */
+  void printQudaHMCParam(QudaHMCParam *param);
+
   /**
    * Print the members of QudaBLASParam.
    * @param param The QudaBLASParam whose elements we are to print.
@@ -1248,6 +1491,30 @@ extern "C" {
   void computeKSLinkQuda(void* fatlink, void* longlink, void* ulink, void* inlink,
                          double *path_coeff, QudaGaugeParam *param);
 
+  /**
+   * Compute both levels of HISQ link smearing in a single call.  The
+   * first level V = fat7(U) is unitarized to W, and the second level
+   * computes the fat (X) and long links of W.  The 3-, 5- and 7-link
+   * staples of the second level are computed once and shared between
+   * the regular and Naik-epsilon links, and the intermediate fields
+   * are kept on the device, in a memory arena that persists between
+   * calls and is released by endQuda.
+   *
+   * @param fatlink Host fat-link field, computed with path_coeff[1]
+   * @param longlink Host long-link field, computed with path_coeff[1] (optional)
+   * @param fatlink_eps Host fat-link field with the Naik correction,
+   *        computed with path_coeff[1] + naik_epsilon * path_coeff[2] (optional)
+   * @param longlink_eps Host long-link field with the Naik correction (optional)
+   * @param wlink Host unitarized first-level field W (optional)
+   * @param inlink Host input gauge field U
+   * @param path_coeff Three arrays of six path coefficients: the
+   *        first level, the second level, and the Naik correction
+   * @param naik_epsilon Naik epsilon of the corrected links
+   * @param param Contains all metadata regarding host and device storage
+   */
+  void computeHISQLinksQuda(void *fatlink, void *longlink, void *fatlink_eps, void *longlink_eps, void *wlink,
+                            void *inlink, double **path_coeff, double naik_epsilon, QudaGaugeParam *param);
+
   /**
    * Either downloads and sets the resident momentum field, or uploads
    * and returns the resident momentum field
@@ -1303,6 +1570,23 @@ extern "C" {
   void updateGaugeFieldQuda(void* gauge, void* momentum, double dt,
       int conj_mom, int exact, QudaGaugeParam* param);
 
+  /**
+   * Run a complete HMC trajectory on the resident gauge field using a
+   * nested multi-timescale integrator.  The forces of the terms on
+   * level l are applied with the scheme integrator[l], and each of
+   * its position updates is an integration of level l + 1 (the gauge
+   * field update itself on the innermost level).  The momentum and
+   * gauge field stay resident throughout, so only the Hamiltonian
+   * pieces are returned.  External terms are called with opaque
+   * pointers to the resident momentum and gauge fields, which are
+   * also the fields seen by API calls with use_resident_gauge and
+   * use_resident_mom set.
+   *
+   * @param param Integrator parameters and action terms, into which
+   * the actions and the Metropolis inputs are written
+   */
+  void hmcTrajectoryQuda(QudaHMCParam *param);
+
   /**
    * Apply the staggered phase factors to the gauge field.  If the
    * imaginary chemical potential is non-zero then the phase factor
@@ -1502,6 +1786,19 @@ extern "C" {
    */
   void performWFlownStep(unsigned int n_steps, double step_size, int meas_interval, QudaWFlowType wflow_type);
 
+  /**
+   * Performs Wilson Flow on gaugePrecise and stores it in gaugeSmeared,
+   * flowing to each of the requested flow times in turn and measuring
+   * the requested observables there.  If adaptive, the step size is
+   * controlled using the embedded second-order error estimate of
+   * Fritzsch and Ramos (https://arxiv.org/abs/1301.4388), so that the
+   * local error of each step is below the tolerance.  The flow ends
+   * at the last measurement time.
+   * @param[in,out] param Parameter struct that defines the flow and the
+   * measurements, and that returns the observables and step counts.
+   */
+  void performWFlowQuda(QudaGaugeFlowParam *param);
+
   /**
    * @brief Calculates a variety of gauge-field observables.  If a
    * smeared gauge field is presently loaded (in gaugeSmeared) the
@@ -1512,6 +1809,19 @@ extern "C" {
    */
   void gaugeObservablesQuda(QudaGaugeObservableParam *param);
 
+  /**
+   * @brief Measure the Polyakov loop and all R x T Wilson loops up to
+   * the requested extents.  As with gaugeObservablesQuda, the smeared
+   * gauge field is used if present, else the resident gauge field.
+   * The spatial links may optionally be APE smeared in space only
+   * before measuring the Wilson loops, which leaves the loaded fields
+   * unchanged; HYP smearing is not implemented.  Fixed-point gauge
+   * fields are not supported.
+   * @param[in,out] param Parameter struct that defines which loops
+   * we are measuring and the resulting loops.
+   */
+  void computeGaugeLoopsQuda(QudaGaugeLoopParam *param);
+
   /**
    * Public function to perform color contractions of the host spinors x and y.
    * @param[in] x pointer to host data
@@ -1524,6 +1834,46 @@ extern "C" {
   void contractQuda(const void *x, const void *y, void *result, const QudaContractType cType, QudaInvertParam *param,
                     const int *X);
 
+  /**
+   * Public function to perform color contractions of the host spinors x and y,
+   * projected onto spatial momenta and summed over each timeslice.  Only the
+   * correlators are returned, summed over all processes.
+   * @param[in] x pointer to host data
+   * @param[in] y pointer to host data
+   * @param[out] result pointer to the correlators, n_mom * 16 * T complex numbers indexed
+   * as ((m * 16 + g) * T + t), with T the global temporal extent
+   * @param[in] cType Which type of contraction (open, degrand-rossi, etc)
+   * @param[in] param meta data for construction of ColorSpinorFields.
+   * @param[in] X spacetime data for construction of ColorSpinorFields.
+   * @param[in] source_position global coordinates of the source, the origin of the phase exp(-i p.(x - x_0))
+   * @param[in] mom spatial momenta in units of 2 pi / L, three integers per momentum
+   * @param[in] n_mom number of momenta
+   */
+  void contractFTQuda(const void *x, const void *y, double *result, const QudaContractType cType,
+                      QudaInvertParam *param, const int *X, const int *source_position, const int *mom, int n_mom);
+
+  /**
+   * Public function to compute meson and baryon two-point functions from a set of host
+   * propagators.  Each flavor is transferred once, and for each pair of flavors all gamma
+   * insertions are evaluated in a single pass.  Results are summed over each timeslice.
+   * @param[in] props pointers to host data, 12 per flavor, where props[12 * f + 3 * spin + color]
+   * is the solution for that source spin and color
+   * @param[in] n_flavor number of flavors
+   * @param[in] flavors pairs of flavors (f_1, f_2) to contract
+   * @param[in] n_pair number of flavor pairs
+   * @param[in] gamma sink and source gamma structures of each meson insertion, in the
+   * Degrand-Rossi ordering of QUDA_CONTRACT_TYPE_DR
+   * @param[in] n_gamma number of meson insertions
+   * @param[out] meson meson correlators C(t) = sum_x Tr[G_snk S_1 G_src g5 S_2^dag g5], indexed as
+   * ((p * n_gamma + k) * T + t), complex, or nullptr to skip
+   * @param[out] baryon nucleon-like correlators with f_1 doubly represented, indexed as (p * T + t),
+   * complex, or nullptr to skip
+   * @param[in] param meta data for construction of ColorSpinorFields.
+   * @param[in] X spacetime data for construction of ColorSpinorFields.
+   */
+  void contractPropagatorsQuda(void **props, int n_flavor, const int *flavors, int n_pair, const int *gamma,
+                               int n_gamma, double *meson, double *baryon, QudaInvertParam *param, const int *X);
+
   /**
    * @brief Gauge fixing with overrelaxation with support for single and multi GPU.
    * @param[in,out] gauge, gauge field to be fixed
@@ -1543,7 +1893,7 @@ extern "C" {
                                 const unsigned int reunit_interval, const unsigned int stopWtheta,
                                 QudaGaugeParam *param, double *timeinfo);
   /**
-   * @brief Gauge fixing with Steepest descent method with FFTs with support for single GPU only.
+   * @brief Gauge fixing with Steepest descent method with FFTs, with multi-GPU support.
    * @param[in,out] gauge, gauge field to be fixed
    * @param[in] gauge_dir, 3 for Coulomb gauge fixing, other for Landau gauge fixing
    * @param[in] Nsteps, maximum number of steps to perform gauge fixing
@@ -1577,6 +1927,34 @@ extern "C" {
    */
   void flushChronoQuda(int index);
 
+  /**
+   * @brief Copy out the solver telemetry collected since the last
+   * flush (see QudaInvertParam::solver_telemetry)
+   * @param[out] records Array the records are copied into
+   * @param[in] max_records Length of the records array
+   * @return The total number of records available, which may exceed max_records
+   */
+  int getSolverTelemetryQuda(QudaSolverTelemetry *records, int max_records);
+
+  /**
+   * @brief Discard the collected solver telemetry
+   */
+  void flushSolverTelemetryQuda(void);
+
+  /**
+   * @brief Copy out the HMC telemetry collected since the last flush
+   * (see QudaHMCParam::telemetry)
+   * @param[out] records Array the records are copied into
+   * @param[in] max_records Length of the records array
+   * @return The total number of records available, which may exceed max_records
+   */
+  int getHMCTelemetryQuda(QudaHMCTelemetry *records, int max_records);
+
+  /**
+   * @brief Discard the collected HMC telemetry
+   */
+  void flushHMCTelemetryQuda(void);
+
   /**
   * Open/Close MAGMA library
   *
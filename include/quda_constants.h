@@ -54,3 +54,10 @@
  * increased if needed.
  */
 #define QUDA_MAX_MG_LEVEL 5
+
+/**
+ * @def QUDA_MAX_HMC_LEVEL
+ * @brief Maximum number of timescales in the resident HMC
+ * integrator.  This number may be increased if needed.
+ */
+#define QUDA_MAX_HMC_LEVEL 4
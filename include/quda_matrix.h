@@ -1052,6 +1052,109 @@ namespace quda {
       return exp_iQ;
     }
 
+    /**
+       @brief Compute the parameters u and w of the Cayley-Hamilton
+       exponential exp(iQ) of a traceless hermitian matrix Q, whose
+       eigenvalues are 2u and -u +/- w (hep-lat/0311018).  The
+       parameters are signed, so they scale linearly with Q: those of
+       t Q are t u and t w for any real t, which lets exp(i t Q) be
+       formed for many t from a single evaluation.
+       @param[in] Q Traceless hermitian matrix
+       @param[out] u_p Parameter u
+       @param[out] w_p Parameter w
+    */
+    template <class T>
+    __device__ __host__ inline void exponentiate_iQ_params(const Matrix<T, 3> &Q, typename T::value_type &u_p,
+                                                           typename T::value_type &w_p)
+    {
+      using real = typename T::value_type;
+      real inv3 = 1.0 / 3.0;
+
+      //[14] c0 = det(Q), [15] c1 = 1/2Tr(Q^2)
+      real c0 = getDeterminant(Q).real();
+      real c1 = static_cast<real>(0.5) * getTrace(Q * Q).real();
+      if (c1 == static_cast<real>(0.0)) {
+        u_p = 0.0;
+        w_p = 0.0;
+        return;
+      }
+
+      // the parameters of -Q are minus those of Q, so compute them for c0 >= 0
+      real sign = c0 < 0 ? -1.0 : 1.0;
+      c0 *= sign;
+
+      //[17], [25]
+      real sqrt_c1_inv3 = sqrt(c1 * inv3);
+      real c0_max = 2 * (c1 * inv3 * sqrt_c1_inv3);
+      real ratio = c0 / c0_max;
+      real theta = acos(ratio < static_cast<real>(1.0) ? ratio : static_cast<real>(1.0));
+
+      //[23], [24]
+      real sin_theta, cos_theta;
+      quda::sincos(theta * inv3, &sin_theta, &cos_theta);
+      u_p = sign * sqrt_c1_inv3 * cos_theta;
+      w_p = sign * sqrt(c1) * sin_theta;
+    }
+
+    /**
+       @brief Compute exp(iQ) for a traceless hermitian matrix Q, given
+       its signed parameters from exponentiate_iQ_params
+       @param[in] Q Traceless hermitian matrix
+       @param[in] u_p Parameter u of Q
+       @param[in] w_p Parameter w of Q
+       @return exp(iQ)
+    */
+    template <class T>
+    __device__ __host__ inline auto exponentiate_iQ(const Matrix<T, 3> &Q, typename T::value_type u_p,
+                                                    typename T::value_type w_p)
+    {
+      using real = typename T::value_type;
+
+      Matrix<T, 3> exp_iQ;
+      setIdentity(&exp_iQ);
+      if (u_p == static_cast<real>(0.0) && w_p == static_cast<real>(0.0)) return exp_iQ;
+
+      //[29] fj = hj/(9u^2 - w^2)
+      real u_sq = u_p * u_p;
+      real w_sq = w_p * w_p;
+      real denom_inv = static_cast<real>(1.0) / (9 * u_sq - w_sq);
+      real exp_iu_re, exp_iu_im;
+      quda::sincos(u_p, &exp_iu_im, &exp_iu_re);
+      real exp_2iu_re = exp_iu_re * exp_iu_re - exp_iu_im * exp_iu_im;
+      real exp_2iu_im = 2 * exp_iu_re * exp_iu_im;
+      real cos_w = cos(w_p);
+      real sinc_w;
+
+      //[33] with one more term of the series, as in exponentiate_iQ above
+      if (w_p < 0.05 && w_p > -0.05) {
+        sinc_w = 1.0 - (w_sq / 6.0) * (1 - (w_sq * 0.05) * (1 - (w_sq / 42.0) * (1 - (w_sq / 72.0))));
+      } else
+        sinc_w = sin(w_p) / w_p;
+
+      //[30] f0
+      real hj_re
+        = (u_sq - w_sq) * exp_2iu_re + 8 * u_sq * cos_w * exp_iu_re + 2 * u_p * (3 * u_sq + w_sq) * sinc_w * exp_iu_im;
+      real hj_im
+        = (u_sq - w_sq) * exp_2iu_im - 8 * u_sq * cos_w * exp_iu_im + 2 * u_p * (3 * u_sq + w_sq) * sinc_w * exp_iu_re;
+      T f0 {hj_re * denom_inv, hj_im * denom_inv};
+
+      //[31] f1
+      hj_re = 2 * u_p * exp_2iu_re - 2 * u_p * cos_w * exp_iu_re + (3 * u_sq - w_sq) * sinc_w * exp_iu_im;
+      hj_im = 2 * u_p * exp_2iu_im + 2 * u_p * cos_w * exp_iu_im + (3 * u_sq - w_sq) * sinc_w * exp_iu_re;
+      T f1 {hj_re * denom_inv, hj_im * denom_inv};
+
+      //[32] f2
+      hj_re = exp_2iu_re - cos_w * exp_iu_re - 3 * u_p * sinc_w * exp_iu_im;
+      hj_im = exp_2iu_im + cos_w * exp_iu_im - 3 * u_p * sinc_w * exp_iu_re;
+      T f2 {hj_re * denom_inv, hj_im * denom_inv};
+
+      //[19] exp(iQ) = f0*I + f1*Q + f2*Q^2
+      exp_iQ = f0 * exp_iQ;
+      exp_iQ += f1 * Q;
+      exp_iQ += f2 * (Q * Q);
+      return exp_iQ;
+    }
+
     /**
        Direct port of the TIFR expsu3 algorithm
     */
@@ -1,29 +1,32 @@
 #pragma once
 
-#include <memory>
 #include <quda_define.h>
 #include <lattice_field.h>
 
 namespace quda {
 
-  // The nature of the state is defined in the target-specific implementation
-  struct RNGState;
+  // Kernel-side handle to the generator, defined in random_helper.h
+  struct RNGKey;
 
   /**
-     @brief Class declaration to initialize and hold RNG states
+     @brief Counter-based (Philox4x32-10) random number generator.  No
+     per-site state is stored: random numbers are a function of the
+     seed, the global site index and a launch counter that is
+     advanced on each use, so the generated fields are independent
+     of the process grid and of the target.
   */
   class RNG
   {
 
-    size_t size;                     /*! @brief number of curand states */
-    std::shared_ptr<RNGState> state; /*! array with current curand rng state */
-    RNGState *backup_state;          /*! array for backup of current curand rng state */
-    unsigned long long seed;         /*! initial rng seed */
+    unsigned long long seed;     /*! initial rng seed */
+    unsigned int counter;        /*! launch counter */
+    unsigned int backup_counter; /*! backup of the launch counter */
 
   public:
     /**
-       @brief Allocate and initialize RNG states.  Constructor that
-       takes its metadata from pre-existing field
+       @brief Initialize the RNG.  Constructor that takes its metadata
+       from pre-existing field; since the generator is stateless the
+       field is only used for logging.
        @param[in] meta The field whose data we use
        @param[in] seed Seed to initialize the RNG
     */
@@ -31,13 +34,19 @@ namespace quda {
 
     unsigned long long Seed() { return seed; };
 
-    /*! @brief Restore rng array states initialization */
+    /*! @brief Restore the launch counter */
     void restore();
 
-    /*! @brief Backup rng array states initialization */
+    /*! @brief Backup the launch counter */
     void backup();
 
-    /*! @brief Get pointer to RNGState */
-    RNGState *State() { return state.get(); };
+    /**
+       @brief Return the kernel-side key for filling a field, and
+       advance the launch counter so that subsequent calls give
+       independent random numbers.
+       @param[in] field The field that is to be filled
+       @return The key
+    */
+    RNGKey Key(const LatticeField &field);
   };
 }
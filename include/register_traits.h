@@ -343,6 +343,30 @@ namespace quda {
     static const bool value = true;
   };
 
+  /* Traits used to map a precision to its storage type */
+  template <QudaPrecision precision> struct precision_storage {
+  };
+  template <> struct precision_storage<QUDA_DOUBLE_PRECISION> {
+    using type = double;
+  };
+  template <> struct precision_storage<QUDA_SINGLE_PRECISION> {
+    using type = float;
+  };
+  template <> struct precision_storage<QUDA_HALF_PRECISION> {
+    using type = short;
+  };
+  template <> struct precision_storage<QUDA_QUARTER_PRECISION> {
+    using type = int8_t;
+  };
+
+  /* Traits used to determine the storage type of a halo requested at
+     a given precision: the storage type of that precision if it is
+     below that of Float, otherwise Float itself (no compression) */
+  template <typename Float, QudaPrecision precision> struct halo_storage {
+    using requested = typename precision_storage<precision>::type;
+    using type = typename std::conditional<(sizeof(requested) < sizeof(Float)), requested, Float>::type;
+  };
+
   template <typename Float, int number> struct VectorType;
 
   // double precision
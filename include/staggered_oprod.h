@@ -1,4 +1,6 @@
 #pragma once
+#include <array>
+#include <vector>
 #include <gauge_field.h>
 #include <color_spinor_field.h>
 
@@ -22,4 +24,23 @@ namespace quda {
   */
   void computeStaggeredOprod(GaugeField *out[], ColorSpinorField& in, const double coeff[], int nFace);
 
+  /**
+     @brief Accumulate the outer-product fields of a set of staggered
+     quark fields, e.g., the multi-shift solutions of a rational
+     approximation, weighted by their coefficients.  E.g.,
+
+     out[0][d](x) = sum_i coeff[i][0] (in_i(x+1_d) x conj(in_i(x)))
+     out[1][d](x) = sum_i coeff[i][1] (in_i(x+3_d) x conj(in_i(x)))
+
+     The interior sum is formed in a single pass over the output
+     fields rather than one pass per quark field.
+
+     @param[out] out Array of nFace outer-product matrix fields
+     @param[in] in Input quark fields
+     @param[in] coeff One and three-hop coefficients of each quark field
+     @param[in] nFace Number of faces (1 or 3)
+  */
+  void computeStaggeredOprod(GaugeField *out[], const std::vector<ColorSpinorField *> &in,
+                             const std::vector<std::array<double, 2>> &coeff, int nFace);
+
 } // namespace quda
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <math_helper.cuh>
+#include <index_helper.cuh>
+
+/**
+   @file random_helper.h
+
+   @brief Counter-based random number generation using Philox4x32-10
+   (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3",
+   SC11).  Each random number is a pure function of the seed, the
+   global lattice site, a stream index and a launch counter, so no
+   generator state needs to be stored between kernels, and the
+   generated fields are identical for any process grid and on any
+   target, including host kernels.
+ */
+
+namespace quda
+{
+
+  namespace philox
+  {
+
+    constexpr unsigned int M0 = 0xD2511F53;
+    constexpr unsigned int M1 = 0xCD9E8D57;
+    constexpr unsigned int W0 = 0x9E3779B9;
+    constexpr unsigned int W1 = 0xBB67AE85;
+
+    /**
+       @brief Return the low word of a * b, and set hi to the high word
+     */
+    __device__ __host__ inline unsigned int mulhilo(unsigned int a, unsigned int b, unsigned int &hi)
+    {
+      unsigned long long product = static_cast<unsigned long long>(a) * b;
+      hi = static_cast<unsigned int>(product >> 32);
+      return static_cast<unsigned int>(product);
+    }
+
+    __device__ __host__ inline void round(unsigned int ctr[4], const unsigned int key[2])
+    {
+      unsigned int hi0, hi1;
+      unsigned int lo0 = mulhilo(M0, ctr[0], hi0);
+      unsigned int lo1 = mulhilo(M1, ctr[2], hi1);
+      unsigned int c0 = hi1 ^ ctr[1] ^ key[0];
+      unsigned int c2 = hi0 ^ ctr[3] ^ key[1];
+      ctr[0] = c0;
+      ctr[1] = lo1;
+      ctr[2] = c2;
+      ctr[3] = lo0;
+    }
+
+    /**
+       @brief Apply the ten-round Philox4x32 bijection
+       @param[out] out Four random words
+       @param[in] ctr The counter
+       @param[in] key_ The key
+     */
+    __device__ __host__ inline void philox4x32_10(unsigned int out[4], const unsigned int ctr[4], const unsigned int key_[2])
+    {
+      unsigned int key[2] = {key_[0], key_[1]};
+#pragma unroll
+      for (int i = 0; i < 4; i++) out[i] = ctr[i];
+#pragma unroll
+      for (int r = 0; r < 10; r++) {
+        if (r > 0) {
+          key[0] += W0;
+          key[1] += W1;
+        }
+        round(out, key);
+      }
+    }
+
+  } // namespace philox
+
+  /**
+     @brief Per-thread generator.  The 64-bit seed forms the key, and
+     the 128-bit counter is composed of the draw index, the launch
+     counter, the 48-bit global site index and a 16-bit stream index.
+     Each evaluation of Philox yields four 32-bit words, so this is
+     cheap to create and need never be written back to memory.
+   */
+  class RNGState
+  {
+    unsigned int key[2];
+    unsigned int ctr[4];
+    unsigned int buf[4];
+    int idx;
+
+  public:
+    /**
+       @param[in] seed The RNG seed
+       @param[in] sequence The global site index
+       @param[in] stream Stream index, to give independent sequences at the same site
+       @param[in] counter Launch counter
+     */
+    __device__ __host__ RNGState(unsigned long long seed, unsigned long long sequence, unsigned int stream,
+                                 unsigned int counter) :
+      key {static_cast<unsigned int>(seed), static_cast<unsigned int>(seed >> 32)},
+      ctr {0, counter, static_cast<unsigned int>(sequence),
+           (static_cast<unsigned int>(sequence >> 32) & 0xffff) | (stream << 16)},
+      buf {},
+      idx(4)
+    {
+    }
+
+    /**
+       @brief Return the next random 32-bit word
+     */
+    __device__ __host__ inline unsigned int operator()()
+    {
+      if (idx == 4) {
+        philox::philox4x32_10(buf, ctr, key);
+        ctr[0]++;
+        idx = 0;
+      }
+      return buf[idx++];
+    }
+  };
+
+  template <class Real> struct uniform {
+  };
+  template <> struct uniform<float> {
+
+    /**
+     * \brief Return a uniform deviate in (0, 1]
+     * @param [in,out] the RNG State
+     */
+    __device__ __host__ static inline float rand(RNGState &state)
+    {
+      return (static_cast<float>(state() >> 8) + 1.0f) * 5.9604644775390625e-8f; // 2^-24
+    }
+
+    /**
+     * \brief return a uniform deviate between a and b
+     * @param [in,out] the RNG state
+     * @param [in] a (the lower end of the range)
+     * @param [in] b (the upper end of the range)
+     */
+    __device__ __host__ static inline float rand(RNGState &state, float a, float b)
+    {
+      return a + (b - a) * rand(state);
+    }
+  };
+
+  template <> struct uniform<double> {
+    /**
+     * \brief Return a uniform deviate in (0, 1]
+     * @param [in,out] the RNG State
+     */
+    __device__ __host__ static inline double rand(RNGState &state)
+    {
+      unsigned long long hi = state() >> 5; // 27 bits
+      unsigned long long lo = state() >> 6; // 26 bits
+      return (static_cast<double>((hi << 26) | lo) + 1.0) * 1.1102230246251565e-16; // 2^-53
+    }
+
+    /**
+     * \brief Return a uniform deviate between a and b
+     * @param [in,out] the RNG State
+     * @param [in] a -- the lower end of the range
+     * @param [in] b -- the high end of the range
+     */
+    __device__ __host__ static inline double rand(RNGState &state, double a, double b)
+    {
+      return a + (b - a) * rand(state);
+    }
+  };
+
+  template <class Real> struct normal {
+    /**
+     * \brief return a gaussian (normal) deviate with a mean of 0,
+     * using the Box-Muller transform
+     * @param [in,out] state
+     */
+    __device__ __host__ static inline Real rand(RNGState &state)
+    {
+      Real radius = sqrt(static_cast<Real>(-2.0) * log(uniform<Real>::rand(state)));
+      Real s, c;
+      quda::sincos(static_cast<Real>(2.0 * M_PI) * uniform<Real>::rand(state), &s, &c);
+      return radius * c;
+    }
+  };
+
+  /**
+     @brief Kernel-side handle to the counter-based generator: the
+     seed and launch counter, together with the metadata needed to
+     map a local checkerboard index to a global site index.  This is
+     obtained from RNG::Key() once per kernel launch.
+   */
+  struct RNGKey {
+    unsigned long long seed; /** RNG seed */
+    unsigned int counter;    /** launch counter */
+    int X[4];                /** local full-field dimensions */
+    int X_global[4];         /** global dimensions */
+    int offset[4];           /** global coordinates of the local origin */
+    int volume_cb;           /** local four-dimensional checkerboard volume */
+
+    /**
+       @brief Return the generator for a given site
+       @param[in] x_cb Checkerboard index, which may include a fifth dimension
+       @param[in] parity Site parity
+       @param[in] stream Stream index, to give independent generators at the same site
+     */
+    __device__ __host__ inline RNGState state(int x_cb, int parity, unsigned int stream = 0) const
+    {
+      int s = x_cb / volume_cb;
+      int x[4];
+      getCoords(x, x_cb - s * volume_cb, X, parity);
+
+      unsigned long long idx = s;
+#pragma unroll
+      for (int d = 3; d >= 0; d--) idx = idx * X_global[d] + x[d] + offset[d];
+      return RNGState(seed, idx, stream, counter);
+    }
+  };
+
+} // namespace quda
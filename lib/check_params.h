@@ -185,6 +185,8 @@ void printQudaEigParam(QudaEigParam *param) {
   P(n_conv, 0);
   P(n_ev_deflate, -1);
   P(batched_rotate, 0);
+  P(use_gemm_rotate, QUDA_BOOLEAN_FALSE);
+  P(gemm_rotate_workspace, 4);
   P(tol, 0.0);
   P(qr_tol, 0.0);
   P(check_interval, 0);
@@ -212,6 +214,8 @@ void printQudaEigParam(QudaEigParam *param) {
   P(n_conv, INVALID_INT);
   P(n_ev_deflate, INVALID_INT);
   P(batched_rotate, INVALID_INT);
+  P(use_gemm_rotate, QUDA_BOOLEAN_INVALID);
+  P(gemm_rotate_workspace, INVALID_INT);
   P(tol, INVALID_DOUBLE);
   P(qr_tol, INVALID_DOUBLE);
   P(check_interval, INVALID_INT);
@@ -308,6 +312,7 @@ void printQudaCloverParam(QudaInvertParam *param)
     P(compute_clover_inverse, 0);
     P(return_clover, 0);
     P(return_clover_inverse, 0);
+    P(clover_on_the_fly, QUDA_BOOLEAN_FALSE);
     P(clover_rho, 0.0);
     P(clover_coeff, 0.0);
     P(clover_csw, 0.0);
@@ -317,6 +322,7 @@ void printQudaCloverParam(QudaInvertParam *param)
   P(compute_clover_inverse, QUDA_INVALID_PRECISION);
   P(return_clover, QUDA_INVALID_PRECISION);
   P(return_clover_inverse, QUDA_INVALID_PRECISION);
+  P(clover_on_the_fly, QUDA_BOOLEAN_INVALID);
   P(clover_rho, INVALID_DOUBLE);
   P(clover_coeff, INVALID_DOUBLE);
   P(clover_csw, INVALID_DOUBLE);
@@ -686,6 +692,36 @@ void printQudaInvertParam(QudaInvertParam *param) {
   P(use_mobius_fused_kernel, QUDA_BOOLEAN_INVALID);
 #endif
 
+#if defined INIT_PARAM
+  P(solver_telemetry, QUDA_BOOLEAN_FALSE);
+  P(solver_telemetry_file[0], '\0');
+  P(solver_telemetry_callback, nullptr);
+  P(solver_telemetry_data, nullptr);
+#else
+  P(solver_telemetry, QUDA_BOOLEAN_INVALID);
+#endif
+
+#if defined INIT_PARAM
+  P(adaptive_reliable, QUDA_BOOLEAN_FALSE);
+  P(adaptive_precision, QUDA_BOOLEAN_FALSE);
+  P(reliable_updates, 0);
+  P(max_reliable_gap, 0.0);
+#else
+  P(adaptive_reliable, QUDA_BOOLEAN_INVALID);
+  P(adaptive_precision, QUDA_BOOLEAN_INVALID);
+#endif
+
+#if !defined CHECK_PARAM
+  P(cuda_prec_sloppy_min, QUDA_INVALID_PRECISION);
+#else
+  // default to only ever raising the sloppy precision
+  if (param->cuda_prec_sloppy_min == QUDA_INVALID_PRECISION) param->cuda_prec_sloppy_min = param->cuda_prec_sloppy;
+#endif
+
+#ifndef CHECK_PARAM
+  P(halo_precision_sloppy, QUDA_INVALID_PRECISION);
+#endif
+
 #ifdef INIT_PARAM
   return ret;
 #endif
@@ -984,11 +1020,203 @@ void printQudaGaugeObservableParam(QudaGaugeObservableParam *param)
   P(compute_qcharge, QUDA_BOOLEAN_FALSE);
   P(compute_qcharge_density, QUDA_BOOLEAN_FALSE);
   P(qcharge_density, nullptr);
+  P(compute_rectangle, QUDA_BOOLEAN_FALSE);
 #else
   P(su_project, QUDA_BOOLEAN_INVALID);
   P(compute_plaquette, QUDA_BOOLEAN_INVALID);
   P(compute_qcharge, QUDA_BOOLEAN_INVALID);
   P(compute_qcharge_density, QUDA_BOOLEAN_INVALID);
+  P(compute_rectangle, QUDA_BOOLEAN_INVALID);
+#endif
+
+#ifdef INIT_PARAM
+  return ret;
+#endif
+}
+
+#if defined INIT_PARAM
+QudaGaugeFlowParam newQudaGaugeFlowParam(void)
+{
+  QudaGaugeFlowParam ret;
+#elif defined CHECK_PARAM
+static void checkGaugeFlowParam(QudaGaugeFlowParam *param)
+{
+#else
+void printQudaGaugeFlowParam(QudaGaugeFlowParam *param)
+{
+  printfQuda("QUDA Gauge-Flow Parameters:\n");
+#endif
+
+#if defined CHECK_PARAM
+  if (param->struct_size != (size_t)INVALID_INT && param->struct_size != sizeof(*param))
+    errorQuda("Unexpected QudaGaugeFlowParam struct size %lu, expected %lu", param->struct_size, sizeof(*param));
+#else
+  P(struct_size, (size_t)INVALID_INT);
+#endif
+
+#ifdef INIT_PARAM
+  P(wflow_type, QUDA_WFLOW_TYPE_WILSON);
+  P(step_size, 0.01);
+  P(adaptive, QUDA_BOOLEAN_FALSE);
+  P(tol, 1e-4);
+  P(step_size_max, 0.0);
+  P(n_meas, 0);
+  P(meas_time, nullptr);
+  P(obs_param, nullptr);
+  P(n_steps, 0);
+  P(n_rejected, 0);
+#else
+  P(wflow_type, QUDA_WFLOW_TYPE_INVALID);
+  P(step_size, INVALID_DOUBLE);
+  P(adaptive, QUDA_BOOLEAN_INVALID);
+  P(tol, INVALID_DOUBLE);
+  P(step_size_max, INVALID_DOUBLE);
+  P(n_meas, INVALID_INT);
+#endif
+
+#if defined CHECK_PARAM
+  if (param->step_size <= 0.0) errorQuda("Invalid step size %e", param->step_size);
+  if (param->adaptive && param->tol <= 0.0) errorQuda("Invalid tolerance %e", param->tol);
+  if (param->n_meas <= 0) errorQuda("At least one measurement time is required");
+  if (!param->meas_time || !param->obs_param) errorQuda("Measurement times and observable structs must be set");
+  for (int i = 0; i < param->n_meas; i++) {
+    if (param->meas_time[i] < (i > 0 ? param->meas_time[i - 1] : 0.0))
+      errorQuda("Measurement times must be non-negative and ascending (meas_time[%d] = %e)", i, param->meas_time[i]);
+  }
+#endif
+
+#ifdef INIT_PARAM
+  return ret;
+#endif
+}
+
+#if defined INIT_PARAM
+QudaGaugeLoopParam newQudaGaugeLoopParam(void)
+{
+  QudaGaugeLoopParam ret;
+#elif defined CHECK_PARAM
+static void checkGaugeLoopParam(QudaGaugeLoopParam *param)
+{
+#else
+void printQudaGaugeLoopParam(QudaGaugeLoopParam *param)
+{
+  printfQuda("QUDA Gauge-Loop Parameters:\n");
+#endif
+
+#if defined CHECK_PARAM
+  if (param->struct_size != (size_t)INVALID_INT && param->struct_size != sizeof(*param))
+    errorQuda("Unexpected QudaGaugeLoopParam struct size %lu, expected %lu", param->struct_size, sizeof(*param));
+#else
+  P(struct_size, (size_t)INVALID_INT);
+#endif
+
+#ifdef INIT_PARAM
+  P(compute_polyakov_loop, QUDA_BOOLEAN_FALSE);
+  P(polyakov_loop_density, nullptr);
+  P(r_max, 0);
+  P(t_max, 0);
+  P(wilson_loop, nullptr);
+  P(n_ape, 0);
+  P(ape_alpha, 0.0);
+#else
+  P(compute_polyakov_loop, QUDA_BOOLEAN_INVALID);
+  P(r_max, INVALID_INT);
+  P(t_max, INVALID_INT);
+  P(n_ape, INVALID_INT);
+  P(ape_alpha, INVALID_DOUBLE);
+#endif
+
+#if defined CHECK_PARAM
+  if (param->r_max < 0 || param->t_max < 0) errorQuda("Invalid Wilson loop extents %d x %d", param->r_max, param->t_max);
+  if (param->r_max * param->t_max > 0 && !param->wilson_loop) errorQuda("Wilson loops requested, but no destination given");
+  if (param->n_ape < 0) errorQuda("Invalid number of APE steps %d", param->n_ape);
+#endif
+
+#ifdef INIT_PARAM
+  return ret;
+#endif
+}
+
+#if defined INIT_PARAM
+QudaHMCParam newQudaHMCParam(void)
+{
+  QudaHMCParam ret;
+#elif defined CHECK_PARAM
+static void checkHMCParam(QudaHMCParam *param)
+{
+#else
+void printQudaHMCParam(QudaHMCParam *param)
+{
+  printfQuda("QUDA HMC Parameters:\n");
+#endif
+
+#if defined CHECK_PARAM
+  if (param->struct_size != (size_t)INVALID_INT && param->struct_size != sizeof(*param))
+    errorQuda("Unexpected QudaHMCParam struct size %lu, expected %lu", param->struct_size, sizeof(*param));
+#else
+  P(struct_size, (size_t)INVALID_INT);
+#endif
+
+#ifdef INIT_PARAM
+  P(tau, 1.0);
+  P(n_level, 1);
+  for (int i = 0; i < QUDA_MAX_HMC_LEVEL; i++) {
+    P(integrator[i], QUDA_HMC_OMELYAN);
+    P(n_step[i], 1);
+    P(lambda[i], 0.1931833275037836);
+  }
+  P(n_term, 0);
+  P(term, nullptr);
+  P(refresh_mom, QUDA_BOOLEAN_TRUE);
+  P(seed, 1234);
+  P(trajectory, 0);
+  P(accept_reject, QUDA_BOOLEAN_FALSE);
+  P(uniform, 0.0);
+  P(mom_action_init, 0.0);
+  P(mom_action_final, 0.0);
+  P(delta_h, 0.0);
+  P(accepted, QUDA_BOOLEAN_FALSE);
+  P(n_force, 0);
+  P(telemetry, QUDA_BOOLEAN_FALSE);
+  P(telemetry_file[0], '\0');
+  P(telemetry_callback, nullptr);
+  P(telemetry_data, nullptr);
+#else
+  P(tau, INVALID_DOUBLE);
+  P(n_level, INVALID_INT);
+  for (int i = 0; i < param->n_level && i < QUDA_MAX_HMC_LEVEL; i++) {
+    P(integrator[i], QUDA_HMC_INTEGRATOR_INVALID);
+    P(n_step[i], INVALID_INT);
+  }
+  P(n_term, INVALID_INT);
+  P(refresh_mom, QUDA_BOOLEAN_INVALID);
+  P(trajectory, INVALID_INT);
+  P(accept_reject, QUDA_BOOLEAN_INVALID);
+  P(telemetry, QUDA_BOOLEAN_INVALID);
+#endif
+
+#if defined CHECK_PARAM
+  if (param->tau <= 0.0) errorQuda("Invalid trajectory length %e", param->tau);
+  if (param->n_level < 1 || param->n_level > QUDA_MAX_HMC_LEVEL)
+    errorQuda("Invalid number of levels %d (maximum %d)", param->n_level, QUDA_MAX_HMC_LEVEL);
+  for (int i = 0; i < param->n_level; i++) {
+    if (param->n_step[i] < 1) errorQuda("Invalid number of steps %d on level %d", param->n_step[i], i);
+    if (param->integrator[i] == QUDA_HMC_OMELYAN && (param->lambda[i] <= 0.0 || param->lambda[i] >= 0.5))
+      errorQuda("Invalid Omelyan parameter %e on level %d", param->lambda[i], i);
+  }
+  if (param->n_term < 1 || !param->term) errorQuda("At least one action term is required");
+  for (int i = 0; i < param->n_term; i++) {
+    const QudaHMCTerm &t = param->term[i];
+    if (t.level < 0 || t.level >= param->n_level) errorQuda("Term %d has invalid level %d", i, t.level);
+    if (t.type == QUDA_HMC_EXTERNAL_TERM) {
+      if (!t.action || !t.force) errorQuda("External term %d requires action and force callbacks", i);
+    } else if (t.type != QUDA_HMC_GAUGE_TERM) {
+      errorQuda("Term %d has invalid type %d", i, t.type);
+    }
+  }
+  if (param->trajectory < 0) errorQuda("Invalid trajectory number %d", param->trajectory);
+  if (param->accept_reject && (param->uniform < 0.0 || param->uniform >= 1.0))
+    errorQuda("Invalid Metropolis random number %e", param->uniform);
 #endif
 
 #ifdef INIT_PARAM
@@ -4,7 +4,7 @@
 
 namespace quda {
 
-  template <typename Float, QudaReconstructType recon>
+  template <typename Float, QudaReconstructType recon, QudaReconstructType recon_f>
   class DerivativeClover : TunableKernel3D {
     GaugeField &force;
     GaugeField &gauge;
@@ -22,12 +22,13 @@ namespace quda {
       coeff(coeff),
       parity(parity)
     {
+      if (recon_f == QUDA_RECONSTRUCT_10) strcat(aux, ",compressed_force");
       apply(device::get_default_stream());
     }
 
     void apply(const qudaStream_t &stream){
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      launch<CloverDerivative>(tp, stream, CloverDerivArg<Float, recon>(force, gauge, oprod, coeff, parity));
+      launch<CloverDerivative>(tp, stream, CloverDerivArg<Float, recon, recon_f>(force, gauge, oprod, coeff, parity));
     }
 
     // The force field is updated so we must preserve its initial state
@@ -46,12 +47,17 @@ namespace quda {
   {
     if (oprod.Reconstruct() != QUDA_RECONSTRUCT_NO) errorQuda("Force field does not support reconstruction");
     if (force.Order() != oprod.Order()) errorQuda("Force and Oprod orders must match");
-    if (force.Reconstruct() != QUDA_RECONSTRUCT_NO) errorQuda("Force field does not support reconstruction");
+    if (force.Reconstruct() != QUDA_RECONSTRUCT_NO && force.Reconstruct() != QUDA_RECONSTRUCT_10)
+      errorQuda("Force field reconstruct %d not supported", force.Reconstruct());
 
     if (force.Order() == QUDA_FLOAT2_GAUGE_ORDER) {
       if (gauge.isNative()) {
 	if (gauge.Reconstruct() == QUDA_RECONSTRUCT_NO) {
-	  DerivativeClover<Float, QUDA_RECONSTRUCT_NO> deriv(force, gauge, oprod, coeff, parity);
+          if (force.Reconstruct() == QUDA_RECONSTRUCT_NO) {
+            DerivativeClover<Float, QUDA_RECONSTRUCT_NO, QUDA_RECONSTRUCT_NO> deriv(force, gauge, oprod, coeff, parity);
+          } else {
+            DerivativeClover<Float, QUDA_RECONSTRUCT_NO, QUDA_RECONSTRUCT_10> deriv(force, gauge, oprod, coeff, parity);
+          }
 	} else {
 	  errorQuda("Reconstruction type %d not supported",gauge.Reconstruct());
 	}
@@ -24,6 +24,7 @@ namespace quda {
     mu2(a.Mu2()),
     epsilon2(a.Epsilon2()),
     rho(a.Rho()),
+    gauge(a.OnTheFly() ? &a.Gauge() : nullptr),
     order(a.Order()),
     create(QUDA_NULL_FIELD_CREATE),
     location(a.Location())
@@ -49,6 +50,7 @@ namespace quda {
     twist_flavor(param.twist_flavor),
     mu2(param.mu2),
     rho(param.rho),
+    gauge(nullptr),
     order(param.order),
     create(param.create),
     location(param.location),
@@ -71,6 +73,25 @@ namespace quda {
     bytes = length * precision;
     if (isNative()) bytes = 2*ALIGNMENT_ADJUST(bytes/2);
 
+    if (param.gauge) {
+      // the clover term is recomputed from a copy of the gauge field, so nothing is stored
+      if (!clover::on_the_fly()) errorQuda("On-the-fly clover has not been built");
+      if (!clover::dynamic_inverse()) errorQuda("On-the-fly clover requires dynamic clover inversion");
+      if (location != QUDA_CUDA_FIELD_LOCATION) errorQuda("On-the-fly clover requires a device field");
+      if (param.twist_flavor != QUDA_TWIST_NO) errorQuda("On-the-fly clover not supported for twisted clover");
+      if (param.rho != 0.0) errorQuda("On-the-fly clover not supported with rho = %e", param.rho);
+      bytes = 0;
+
+      GaugeFieldParam gauge_param(*param.gauge);
+      // the on-the-fly kernels are only instantiated for no and 12 reconstruct
+      if (gauge_param.reconstruct != QUDA_RECONSTRUCT_NO) gauge_param.reconstruct = QUDA_RECONSTRUCT_12;
+      gauge_param.setPrecision(precision, true);
+      gauge_param.create = QUDA_NULL_FIELD_CREATE;
+      gauge = GaugeField::Create(gauge_param);
+      gauge->copy(*param.gauge);
+      total_bytes += gauge->Bytes();
+    }
+
     // for twisted mass only:
     twist_flavor = param.twist_flavor;
     mu2 = param.mu2;
@@ -120,6 +141,7 @@ namespace quda {
 
   CloverField::~CloverField()
   {
+    if (gauge) delete gauge;
     if (create != QUDA_REFERENCE_FIELD_CREATE) {
       if (location == QUDA_CUDA_FIELD_LOCATION) {
         if (clover) pool_device_free(clover);
@@ -135,7 +157,8 @@ namespace quda {
   {
     LatticeField::setTuningString();
     int aux_string_n = TuneKey::aux_n / 2;
-    int check = snprintf(aux_string, aux_string_n, "vol=%lu,precision=%d,Nc=%d", volume, precision, nColor);
+    int check = snprintf(aux_string, aux_string_n, "vol=%lu,precision=%d,Nc=%d%s", volume, precision, nColor,
+                         gauge ? ",on_the_fly" : "");
     if (check < 0 || check >= aux_string_n) errorQuda("Error writing aux string");
   }
 
@@ -179,11 +202,19 @@ namespace quda {
 
   void CloverField::setRho(double rho_)
   {
+    if (OnTheFly() && rho_ != 0.0) errorQuda("On-the-fly clover not supported with rho = %e", rho_);
     rho = rho_;
   }
 
   void CloverField::copy(const CloverField &src, bool is_inverse)
   {
+    if (OnTheFly() || src.OnTheFly()) {
+      if (!OnTheFly() || !src.OnTheFly()) errorQuda("Cannot copy between on-the-fly and stored clover fields");
+      // an on-the-fly field has no inverse, and its direct field is given by the gauge field
+      if (!is_inverse) gauge->copy(*src.gauge);
+      return;
+    }
+
     // special case where we wish to make a copy of the inverse field when dynamic_inverse is enabled
     static bool dynamic_inverse_copy = false;
     if (is_inverse && clover::dynamic_inverse() && V(true) && !src.V(true) && !dynamic_inverse_copy) {
@@ -345,6 +376,7 @@ namespace quda {
     output << "mu2 = " << param.mu2 << std::endl;
     output << "epsilon2 = " << param.epsilon2 << std::endl;
     output << "rho = " << param.rho << std::endl;
+    output << "gauge = " << param.gauge << std::endl;
     output << "order = " << param.order << std::endl;
     output << "create = " << param.create << std::endl;
     return output;  // for multiple << operators.
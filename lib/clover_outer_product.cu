@@ -7,25 +7,72 @@ namespace quda {
 
   enum OprodKernelType { INTERIOR, EXTERIOR };
 
+  void exchangeGhost(ColorSpinorField &a, int parity, int dag) {
+    // this sets the communications pattern for the packing kernel
+    int comms[QUDA_MAX_DIM] = { commDimPartitioned(0), commDimPartitioned(1),
+                                commDimPartitioned(2), commDimPartitioned(3) };
+    setPackComms(comms);
+
+    // first transfer src1
+    qudaDeviceSynchronize();
+
+    MemoryLocation location[2*QUDA_MAX_DIM] = {Device, Device, Device, Device, Device, Device, Device, Device};
+    a.pack(1, 1-parity, dag, device::get_default_stream(), location, Device);
+
+    qudaDeviceSynchronize();
+
+    for (int i=3; i>=0; i--) {
+      if (commDimPartitioned(i)) {
+	// Initialize the host transfer from the source spinor
+	a.gather(2*i, device::get_stream(2*i));
+      } // commDim(i)
+    } // i=3,..,0
+
+    qudaDeviceSynchronize(); comm_barrier();
+
+    for (int i=3; i>=0; i--) {
+      if (commDimPartitioned(i)) {
+	a.commsStart(2*i, device::get_stream(2 * i));
+      }
+    }
+
+    for (int i=3; i>=0; i--) {
+      if (commDimPartitioned(i)) {
+	a.commsWait(2*i, device::get_stream(2*i));
+	a.scatter(2*i, device::get_stream(2*i));
+      }
+    }
+
+    qudaDeviceSynchronize();
+
+    a.bufferIndex = (1 - a.bufferIndex);
+    comm_barrier();
+  }
+
   template <typename Float, int nColor, QudaReconstructType recon> class CloverForce : public TunableKernel1D {
-    using real = typename mapper<Float>::type;
-    template <int dim = -1> using Arg = CloverForceArg<Float, nColor, recon, dim>;
+    template <QudaReconstructType recon_f, int dim = -1>
+    using Arg = CloverForceArg<Float, nColor, recon, recon_f, dim>;
     GaugeField &force;
     const GaugeField &U;
-    const ColorSpinorField &inA;
-    const ColorSpinorField &inB;
-    const ColorSpinorField &inC;
-    const ColorSpinorField &inD;
+    const std::vector<ColorSpinorField *> &inA;
+    const std::vector<ColorSpinorField *> &inB;
+    const std::vector<ColorSpinorField *> &inC;
+    const std::vector<ColorSpinorField *> &inD;
     const int parity;
-    const real coeff;
+    const std::vector<double> &coeff;
     OprodKernelType kernel;
     int dir;
-    unsigned int minThreads() const { return kernel == INTERIOR ? inB.VolumeCB() : inB.GhostFaceCB()[dir]; }
+    int first;    // first quark field of the current launch
+    int n_vector; // number of quark fields of the current launch
+    unsigned int minThreads() const
+    {
+      return kernel == INTERIOR ? inB[first]->VolumeCB() : inB[first]->GhostFaceCB()[dir];
+    }
 
   public:
-    CloverForce(const GaugeField &U, GaugeField &force, const ColorSpinorField& inA,
-                const ColorSpinorField& inB, const ColorSpinorField& inC, const ColorSpinorField& inD,
-                int parity, double coeff) :
+    CloverForce(const GaugeField &U, GaugeField &force, const std::vector<ColorSpinorField *> &inA,
+                const std::vector<ColorSpinorField *> &inB, const std::vector<ColorSpinorField *> &inC,
+                const std::vector<ColorSpinorField *> &inD, int parity, const std::vector<double> &coeff) :
       TunableKernel1D(force),
       force(force),
       U(U),
@@ -34,55 +81,98 @@ namespace quda {
       inC(inC),
       inD(inD),
       parity(parity),
-      coeff(static_cast<real>(coeff))
+      coeff(coeff)
     {
+      if (force.Reconstruct() == QUDA_RECONSTRUCT_10) strcat(aux, ",compressed_force");
       char aux2[TuneKey::aux_n];
       strcpy(aux2, aux);
-      strcat(aux, ",interior");
-      kernel = INTERIOR;
-      apply(device::get_default_stream());
 
-      for (int i=3; i>=0; i--) {
-        if (!commDimPartitioned(i)) continue;
+      // the interior contributions of a batch of fields are summed before the output is updated
+      kernel = INTERIOR;
+      const int size = inA.size();
+      for (first = 0; first < size; first += n_vector) {
+        n_vector = std::min(size - first, clover_oprod_max_vector);
         strcpy(aux, aux2);
-        strcat(aux, ",exterior");
-        if (dir==0) strcat(aux, ",dir=0");
-        else if (dir==1) strcat(aux, ",dir=1");
-        else if (dir==2) strcat(aux, ",dir=2");
-        else if (dir==3) strcat(aux, ",dir=3");
-        kernel = EXTERIOR;
-        dir = i;
+        strcat(aux, ",interior,nvector=");
+        char tmp[16];
+        u32toa(tmp, n_vector);
+        strcat(aux, tmp);
         apply(device::get_default_stream());
       }
+
+      if (!comm_partitioned()) return;
+
+      // all fields share the ghost buffers, so the exterior contributions are applied one field at a time
+      kernel = EXTERIOR;
+      n_vector = 1;
+      const int dag = 1;
+      for (first = 0; first < size; first++) {
+        exchangeGhost(*inB[first], parity, dag);
+        exchangeGhost(*inD[first], parity, 1 - dag);
+
+        for (int i=3; i>=0; i--) {
+          if (!commDimPartitioned(i)) continue;
+          dir = i;
+          strcpy(aux, aux2);
+          strcat(aux, ",exterior");
+          if (dir==0) strcat(aux, ",dir=0");
+          else if (dir==1) strcat(aux, ",dir=1");
+          else if (dir==2) strcat(aux, ",dir=2");
+          else if (dir==3) strcat(aux, ",dir=3");
+          apply(device::get_default_stream());
+        }
+      }
     }
 
-    void apply(const qudaStream_t &stream)
+    template <QudaReconstructType recon_f> void launchForce(const TuneParam &tp, const qudaStream_t &stream)
     {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-
       if (kernel == INTERIOR) {
-        launch<Interior>(tp, stream, Arg<>(force, U, inA, inB, inC, inD, parity, coeff));
+        launch<Interior>(tp, stream, Arg<recon_f>(force, U, inA, inB, inC, inD, first, n_vector, parity, coeff));
       } else if (kernel == EXTERIOR) {
         switch (dir) {
-        case 0: launch<Exterior>(tp, stream, Arg<0>(force, U, inA, inB, inC, inD, parity, coeff)); break;
-        case 1: launch<Exterior>(tp, stream, Arg<1>(force, U, inA, inB, inC, inD, parity, coeff)); break;
-        case 2: launch<Exterior>(tp, stream, Arg<2>(force, U, inA, inB, inC, inD, parity, coeff)); break;
-        case 3: launch<Exterior>(tp, stream, Arg<3>(force, U, inA, inB, inC, inD, parity, coeff)); break;
+        case 0:
+          launch<Exterior>(tp, stream, Arg<recon_f, 0>(force, U, inA, inB, inC, inD, first, n_vector, parity, coeff));
+          break;
+        case 1:
+          launch<Exterior>(tp, stream, Arg<recon_f, 1>(force, U, inA, inB, inC, inD, first, n_vector, parity, coeff));
+          break;
+        case 2:
+          launch<Exterior>(tp, stream, Arg<recon_f, 2>(force, U, inA, inB, inC, inD, first, n_vector, parity, coeff));
+          break;
+        case 3:
+          launch<Exterior>(tp, stream, Arg<recon_f, 3>(force, U, inA, inB, inC, inD, first, n_vector, parity, coeff));
+          break;
         default: errorQuda("Unexpected direction %d", dir);
         }
       }
     }
 
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      if (force.Reconstruct() == QUDA_RECONSTRUCT_NO) {
+        launchForce<QUDA_RECONSTRUCT_NO>(tp, stream);
+      } else if (force.Reconstruct() == QUDA_RECONSTRUCT_10) {
+        launchForce<QUDA_RECONSTRUCT_10>(tp, stream);
+      } else {
+        errorQuda("Force reconstruct %d not supported", force.Reconstruct());
+      }
+    }
+
     void preTune() { force.backup(); }
     void postTune() { force.restore(); }
 
     // spin trace + multiply-add (ignore spin-project)
-    long long flops() const { return minThreads() * (144 + 234) * (kernel == INTERIOR ? 4 : 1); }
+    long long flops() const
+    {
+      return kernel == INTERIOR ? minThreads() * (144 * n_vector + 234) * 4 : minThreads() * (144 + 234);
+    }
 
     long long bytes() const
     {
       if (kernel == INTERIOR) {
-	return inA.Bytes() + inC.Bytes() + 4*(inB.Bytes() + inD.Bytes()) + force.Bytes() + U.Bytes() / 2;
+        return n_vector * (inA[first]->Bytes() + inC[first]->Bytes() + 4 * (inB[first]->Bytes() + inD[first]->Bytes()))
+          + force.Bytes() + U.Bytes() / 2;
       } else {
 	return minThreads() * (nColor * (4 * 2 + 2 * 2) + 2 * force.Reconstruct() + U.Reconstruct())
           * sizeof(Float);
@@ -90,48 +180,6 @@ namespace quda {
     }
   }; // CloverForce
 
-  void exchangeGhost(ColorSpinorField &a, int parity, int dag) {
-    // this sets the communications pattern for the packing kernel
-    int comms[QUDA_MAX_DIM] = { commDimPartitioned(0), commDimPartitioned(1),
-                                commDimPartitioned(2), commDimPartitioned(3) };
-    setPackComms(comms);
-
-    // first transfer src1
-    qudaDeviceSynchronize();
-
-    MemoryLocation location[2*QUDA_MAX_DIM] = {Device, Device, Device, Device, Device, Device, Device, Device};
-    a.pack(1, 1-parity, dag, device::get_default_stream(), location, Device);
-
-    qudaDeviceSynchronize();
-
-    for (int i=3; i>=0; i--) {
-      if (commDimPartitioned(i)) {
-	// Initialize the host transfer from the source spinor
-	a.gather(2*i, device::get_stream(2*i));
-      } // commDim(i)
-    } // i=3,..,0
-
-    qudaDeviceSynchronize(); comm_barrier();
-
-    for (int i=3; i>=0; i--) {
-      if (commDimPartitioned(i)) {
-	a.commsStart(2*i, device::get_stream(2 * i));
-      }
-    }
-
-    for (int i=3; i>=0; i--) {
-      if (commDimPartitioned(i)) {
-	a.commsWait(2*i, device::get_stream(2*i));
-	a.scatter(2*i, device::get_stream(2*i));
-      }
-    }
-
-    qudaDeviceSynchronize();
-
-    a.bufferIndex = (1 - a.bufferIndex);
-    comm_barrier();
-  }
-
 #ifdef GPU_CLOVER_DIRAC
   void computeCloverForce(GaugeField &force, const GaugeField &U, std::vector<ColorSpinorField *> &x,
                           std::vector<ColorSpinorField *> &p, std::vector<double> &coeff)
@@ -139,25 +187,23 @@ namespace quda {
     checkNative(*x[0], *p[0], force, U);
     checkPrecision(*x[0], *p[0], force, U);
 
-    int dag = 1;
-
-    for (unsigned int i=0; i<x.size(); i++) {
+    std::vector<ColorSpinorField *> inA(x.size()), inB(x.size()), inC(x.size()), inD(x.size());
+    for (auto i = 0u; i < x.size(); i++) {
       x[i]->Even().allocateGhostBuffer(1);
       x[i]->Odd().allocateGhostBuffer(1);
       p[i]->Even().allocateGhostBuffer(1);
       p[i]->Odd().allocateGhostBuffer(1);
+    }
 
-      for (int parity=0; parity<2; parity++) {
-	ColorSpinorField& inA = (parity&1) ? p[i]->Odd() : p[i]->Even();
-	ColorSpinorField& inB = (parity&1) ? x[i]->Even(): x[i]->Odd();
-	ColorSpinorField& inC = (parity&1) ? x[i]->Odd() : x[i]->Even();
-	ColorSpinorField& inD = (parity&1) ? p[i]->Even(): p[i]->Odd();
-
-        exchangeGhost(inB, parity, dag);
-        exchangeGhost(inD, parity, 1-dag);
-
-        instantiate<CloverForce, ReconstructNo12>(U, force, inA, inB, inC, inD, parity, coeff[i]);
+    for (int parity=0; parity<2; parity++) {
+      for (auto i = 0u; i < x.size(); i++) {
+        inA[i] = (parity & 1) ? &p[i]->Odd() : &p[i]->Even();
+        inB[i] = (parity & 1) ? &x[i]->Even() : &x[i]->Odd();
+        inC[i] = (parity & 1) ? &x[i]->Odd() : &x[i]->Even();
+        inD[i] = (parity & 1) ? &p[i]->Even() : &p[i]->Odd();
       }
+
+      instantiate<CloverForce, ReconstructNo12>(U, force, inA, inB, inC, inD, parity, coeff);
     }
   }
 #else // GPU_CLOVER_DIRAC not defined
@@ -3,7 +3,9 @@
 #include <gauge_field.h>
 #include <instantiate.h>
 #include <tunable_nd.h>
+#include <tunable_reduction.h>
 #include <kernels/clover_compute.cuh>
+#include <kernels/clover_compute_invert.cuh>
 
 namespace quda {
 
@@ -48,5 +50,90 @@ namespace quda {
   }
 #endif
 
+  template <typename store_t> class ComputeCloverInvert : TunableReduction2D<>
+  {
+    CloverField &clover;
+    const GaugeField &u;
+    double coeff;
+    bool compute_inverse;
+    bool compute_tr_log;
+    bool twist;
+
+    template <QudaReconstructType recon> void launchRecon(const TuneParam &tp, const qudaStream_t &stream)
+    {
+      if (twist) {
+        CloverComputeInvertArg<store_t, recon, true> arg(clover, u, coeff, compute_inverse, compute_tr_log);
+        launch<CloverComputeInvert>(clover.TrLog(), tp, stream, arg);
+      } else {
+        CloverComputeInvertArg<store_t, recon, false> arg(clover, u, coeff, compute_inverse, compute_tr_log);
+        launch<CloverComputeInvert>(clover.TrLog(), tp, stream, arg);
+      }
+    }
+
+  public:
+    ComputeCloverInvert(CloverField &clover, const GaugeField &u, double coeff, bool compute_inverse,
+                        bool compute_tr_log) :
+      TunableReduction2D(clover),
+      clover(clover),
+      u(u),
+      coeff(coeff),
+      compute_inverse(compute_inverse),
+      compute_tr_log(compute_tr_log),
+      twist(clover.TwistFlavor() == QUDA_TWIST_SINGLET || clover.TwistFlavor() == QUDA_TWIST_NONDEG_DOUBLET)
+    {
+      checkNative(clover, u);
+      strcat(aux, compute_inverse ? ",inverse=true" : ",inverse=false");
+      strcat(aux, compute_tr_log ? ",trlog=true" : ",trlog=false");
+      strcat(aux, twist ? ",twist=true" : ",twist=false");
+      char recon[8];
+      i32toa(recon, u.Reconstruct());
+      strcat(aux, ",recon=");
+      strcat(aux, recon);
+      strcat(aux, comm_dim_partitioned_string());
+      apply(device::get_default_stream());
+
+      if (compute_tr_log && (std::isnan(clover.TrLog()[0]) || std::isnan(clover.TrLog()[1]))) {
+        printfQuda("clover.TrLog()[0]=%e, clover.TrLog()[1]=%e\n", clover.TrLog()[0], clover.TrLog()[1]);
+        errorQuda("Clover trlog has returned -nan, likey due to the clover matrix being singular.");
+      }
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      switch (u.Reconstruct()) {
+      case QUDA_RECONSTRUCT_NO: launchRecon<QUDA_RECONSTRUCT_NO>(tp, stream); break;
+      case QUDA_RECONSTRUCT_12: launchRecon<QUDA_RECONSTRUCT_12>(tp, stream); break;
+      case QUDA_RECONSTRUCT_8: launchRecon<QUDA_RECONSTRUCT_8>(tp, stream); break;
+      default: errorQuda("Unsupported reconstruct %d", u.Reconstruct());
+      }
+    }
+
+    // field strength and clover assembly, as for computeFmunu and computeClover, plus the Cholesky inversion
+    long long flops() const { return (6 * (2430 + 36) + 480ll) * clover.Volume(); }
+    long long bytes() const
+    {
+      return 16 * 6 * u.Reconstruct() * u.Precision() * clover.Volume() + clover.Bytes()
+        + (compute_inverse ? clover.Bytes() : 0);
+    }
+  };
+
+#ifdef GPU_CLOVER_DIRAC
+  void computeCloverInvert(CloverField &clover, const GaugeField &u, double coeff, bool invert, bool computeTraceLog)
+  {
+    if (clover.Precision() < QUDA_SINGLE_PRECISION) errorQuda("Cannot use fixed-point precision here");
+    if (invert && clover.Reconstruct()) errorQuda("Cannot store the inverse with a reconstruct field");
+    if (invert && clover::dynamic_inverse()) errorQuda("Cannot store the inverse with a dynamic inverse");
+    checkPrecision(clover, u);
+    clover.Diagonal(0.5); // 0.5 comes from scaling used on native fields
+    instantiate<ComputeCloverInvert>(clover, u, coeff, invert, computeTraceLog);
+  }
+#else
+  void computeCloverInvert(CloverField &, const GaugeField &, double, bool, bool)
+  {
+    errorQuda("Clover has not been built");
+  }
+#endif
+
 } // namespace quda
 
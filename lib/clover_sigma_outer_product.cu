@@ -12,7 +12,7 @@ namespace quda {
 
   template <typename Float, int nColor> class CloverSigmaOprod : public TunableKernel3D
   {
-    template <int nvector> using Arg = CloverSigmaOprodArg<Float, nColor, nvector>;
+    using Arg = CloverSigmaOprodArg<Float, nColor>;
     GaugeField &oprod;
     const std::vector<ColorSpinorField*> &inA;
     const std::vector<ColorSpinorField*> &inB;
@@ -38,10 +38,7 @@ namespace quda {
     void apply(const qudaStream_t &stream)
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      switch (inA.size()) {
-      case 1: launch<SigmaOprod>(tp, stream, Arg<1>(oprod, inA, inB, coeff)); break;
-      default: errorQuda("Unsupported nvector = %lu\n", inA.size());
-      }
+      launch<SigmaOprod>(tp, stream, Arg(oprod, inA, inB, coeff));
     } // apply
 
     void preTune() { oprod.backup(); }
@@ -29,6 +29,7 @@ namespace quda
     location(param.location),
     even(nullptr),
     odd(nullptr),
+    spill_field(nullptr),
     composite_descr(param.is_composite, param.composite_dim, param.is_component, param.component_id),
     components(0)
   {
@@ -72,6 +73,7 @@ namespace quda
     location(field.Location()),
     even(nullptr),
     odd(nullptr),
+    spill_field(nullptr),
     composite_descr(field.composite_descr),
     components(0)
   {
@@ -240,6 +242,15 @@ namespace quda
 
   void ColorSpinorField::destroy()
   {
+    if (spilled) { // the device allocation has already been released, so just free the host copy
+      if (spill_field) delete spill_field;
+      if (spill_h) host_free(spill_h);
+      spill_field = nullptr;
+      spill_h = nullptr;
+      spilled = false;
+      alloc = false;
+    }
+
     if (alloc) {
       if (location == QUDA_CPU_FIELD_LOCATION) {
         host_free(v);
@@ -1328,6 +1339,17 @@ namespace quda
   int ColorSpinorField::initGhostFaceBuffer = 0;
   size_t ColorSpinorField::ghostFaceBytes[QUDA_MAX_DIM] = {};
 
+  void ColorSpinorField::setGhostPrecision(QudaPrecision ghost_precision_) const
+  {
+    if (ghost_precision_ == QUDA_INVALID_PRECISION) ghost_precision_ = precision;
+    if (ghost_precision_ > precision)
+      errorQuda("Ghost precision %d cannot exceed field precision %d", ghost_precision_, precision);
+    if (ghost_precision != ghost_precision_) {
+      ghost_precision_reset = true;
+      ghost_precision = ghost_precision_;
+    }
+  }
+
   void ColorSpinorField::exchangeGhost(QudaParity parity, int nFace, int dagger,
                                        const MemoryLocation *pack_destination_, const MemoryLocation *halo_location_,
                                        bool gdr_send, bool gdr_recv, QudaPrecision ghost_precision_) const
@@ -1552,6 +1574,64 @@ namespace quda
     backed_up = false;
   }
 
+  size_t ColorSpinorField::spill(QudaPrecision spill_precision)
+  {
+    if (spilled) return 0;
+    if (location != QUDA_CUDA_FIELD_LOCATION || mem_type != QUDA_MEMORY_DEVICE || !alloc)
+      errorQuda("Only allocated device fields can be spilled (location = %d, mem_type = %d)", location, mem_type);
+    if (composite_descr.is_composite || composite_descr.is_component)
+      errorQuda("Composite fields cannot be spilled");
+
+    size_t spill_bytes = bytes;
+    if (spill_precision != QUDA_INVALID_PRECISION && spill_precision < precision) {
+      ColorSpinorParam param(*this);
+      param.create = QUDA_NULL_FIELD_CREATE;
+      param.mem_type = QUDA_MEMORY_MAPPED;
+      param.setPrecision(spill_precision, spill_precision, true);
+      spill_field = new ColorSpinorField(param);
+      spill_field->copy(*this);
+      spill_bytes = spill_field->Bytes();
+    } else {
+      spill_h = pinned_malloc(bytes);
+      qudaMemcpyAsync(spill_h, v, bytes, qudaMemcpyDeviceToHost, device::get_default_stream());
+    }
+
+    // the device allocation is only reused by work ordered after the copy above
+    pool_device_free(v);
+    v = nullptr;
+    if (even) even->v = nullptr;
+    if (odd) odd->v = nullptr;
+    spilled = true;
+
+    return spill_bytes;
+  }
+
+  size_t ColorSpinorField::refill()
+  {
+    if (!spilled) return 0;
+
+    v = pool_device_malloc(bytes);
+    if (even) even->v = v;
+    if (odd) odd->v = static_cast<char *>(v) + bytes / 2;
+    spilled = false;
+
+    size_t refill_bytes = bytes;
+    if (spill_field) {
+      copy(*spill_field);
+      if (isNative()) zeroPad();
+      refill_bytes = spill_field->Bytes();
+      qudaStreamSynchronize(device::get_default_stream());
+      delete spill_field;
+      spill_field = nullptr;
+    } else {
+      qudaMemcpy(v, spill_h, bytes, qudaMemcpyHostToDevice);
+      host_free(spill_h);
+      spill_h = nullptr;
+    }
+
+    return refill_bytes;
+  }
+
   void ColorSpinorField::copy_to_buffer(void *buffer) const
   {
     if (Location() == QUDA_CUDA_FIELD_LOCATION) {
@@ -1,7 +1,9 @@
 #include <color_spinor_field.h>
 #include <contract_quda.h>
 #include <tunable_nd.h>
+#include <tunable_reduction.h>
 #include <instantiate.h>
+#include <fft_quda.h>
 #include <kernels/contraction.cuh>
 
 namespace quda {
@@ -55,6 +57,232 @@ public:
     }
   };
 
+  template <typename Float, int nColor> class ContractionSummed : TunableMultiReduction<1>
+  {
+    using reduce_t = array<double, 32>;
+    const ColorSpinorField &x;
+    const ColorSpinorField &y;
+    std::vector<reduce_t> &result;
+    const QudaContractType cType;
+    const int *source_position;
+    const int *mom;
+    const int n_mom;
+
+    bool tuneSharedBytes() const { return false; }
+
+  public:
+    ContractionSummed(const ColorSpinorField &x, const ColorSpinorField &y, std::vector<reduce_t> &result,
+                      const QudaContractType cType, const int *source_position, const int *mom, int n_mom) :
+      TunableMultiReduction(x, n_mom * x.X()[3]),
+      x(x),
+      y(y),
+      result(result),
+      cType(cType),
+      source_position(source_position),
+      mom(mom),
+      n_mom(n_mom)
+    {
+      switch (cType) {
+      case QUDA_CONTRACT_TYPE_OPEN: strcat(aux, ",open"); break;
+      case QUDA_CONTRACT_TYPE_DR: strcat(aux, ",degrand-rossi"); break;
+      default: errorQuda("Unexpected contraction type %d", cType);
+      }
+      char aux2[TuneKey::aux_n];
+      strcpy(aux2, ",n_mom=");
+      u32toa(aux2 + 7, n_mom);
+      strcat(aux, aux2);
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      // the timeslices are local, so the inter-process sum is done by the caller
+      switch (cType) {
+      case QUDA_CONTRACT_TYPE_OPEN: {
+        ContractionFTArg<Float, nColor, QUDA_CONTRACT_TYPE_OPEN> arg(x, y, source_position, mom, n_mom);
+        launch<ContractionFT, reduce_t, comm_reduce_null<reduce_t>>(result, tp, stream, arg);
+      } break;
+      case QUDA_CONTRACT_TYPE_DR: {
+        ContractionFTArg<Float, nColor, QUDA_CONTRACT_TYPE_DR> arg(x, y, source_position, mom, n_mom);
+        launch<ContractionFT, reduce_t, comm_reduce_null<reduce_t>>(result, tp, stream, arg);
+      } break;
+      default: errorQuda("Unexpected contraction type %d", cType);
+      }
+    }
+
+    long long flops() const
+    {
+      long long site = 16 * 3 * 6ll + 16 * 6ll + (cType == QUDA_CONTRACT_TYPE_DR ? 16 * (4 + 12) : 0);
+      return n_mom * site * x.Volume();
+    }
+
+    long long bytes() const { return n_mom * (x.Bytes() + y.Bytes()); }
+  };
+
+  template <typename Float, int nColor> class ContractionLexicographic : TunableKernel2D
+  {
+    using real = typename mapper<Float>::type;
+    complex<real> *result;
+    const ColorSpinorField &x;
+    const ColorSpinorField &y;
+    const QudaContractType cType;
+    unsigned int minThreads() const { return x.VolumeCB(); }
+
+  public:
+    ContractionLexicographic(const ColorSpinorField &x, const ColorSpinorField &y, complex<real> *result,
+                             const QudaContractType cType) :
+      TunableKernel2D(x, 2), result(result), x(x), y(y), cType(cType)
+    {
+      switch (cType) {
+      case QUDA_CONTRACT_TYPE_OPEN: strcat(aux, "open,lex,"); break;
+      case QUDA_CONTRACT_TYPE_DR: strcat(aux, "degrand-rossi,lex,"); break;
+      default: errorQuda("Unexpected contraction type %d", cType);
+      }
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      switch (cType) {
+      case QUDA_CONTRACT_TYPE_OPEN: {
+        ContractionLexArg<Float, nColor, QUDA_CONTRACT_TYPE_OPEN> arg(x, y, result);
+        launch<ContractionLex>(tp, stream, arg);
+      } break;
+      case QUDA_CONTRACT_TYPE_DR: {
+        ContractionLexArg<Float, nColor, QUDA_CONTRACT_TYPE_DR> arg(x, y, result);
+        launch<ContractionLex>(tp, stream, arg);
+      } break;
+      default: errorQuda("Unexpected contraction type %d", cType);
+      }
+    }
+
+    long long flops() const
+    {
+      return ((16 * 3 * 6ll) + (cType == QUDA_CONTRACT_TYPE_DR ? 16 * (4 + 12) : 0)) * x.Volume();
+    }
+
+    long long bytes() const { return x.Bytes() + y.Bytes() + 16 * x.Volume() * sizeof(complex<real>); }
+  };
+
+  template <typename real> class MomentumGatherer : TunableKernel3D
+  {
+    const ColorSpinorField &x;
+    const complex<real> *in;
+    complex<double> *out;
+    const int *mom;
+    const int n_mom;
+    const int *source_position;
+    unsigned int minThreads() const { return n_mom; }
+
+  public:
+    MomentumGatherer(const ColorSpinorField &x, const complex<real> *in, complex<double> *out, const int *mom,
+                     int n_mom, const int *source_position) :
+      TunableKernel3D(n_mom, x.X()[3], 16, x.Location()),
+      x(x),
+      in(in),
+      out(out),
+      mom(mom),
+      n_mom(n_mom),
+      source_position(source_position)
+    {
+      strcat(aux, x.VolString());
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      MomentumGatherArg<real> arg(x, in, out, mom, n_mom, source_position);
+      launch<MomentumGather>(tp, stream, arg);
+    }
+
+    long long flops() const { return 0; }
+    long long bytes() const { return n_mom * x.X()[3] * 16 * (sizeof(complex<real>) + sizeof(complex<double>)); }
+  };
+
+  /**
+     @brief Whether to project onto the momenta with a spatial FFT
+     rather than with phase factors.  The phase-factor projection
+     recomputes the contraction for every momentum, while the FFT
+     costs O(log V_s) per site, so the FFT wins for dense momentum
+     sets.
+   */
+  static bool useFFT(const ColorSpinorField &x, int n_mom)
+  {
+    if (x.Precision() < QUDA_SINGLE_PRECISION) return false;
+    double spatial_volume = 1.0;
+    for (int d = 0; d < 3; d++) spatial_volume *= comm_dim(d) * x.X()[d];
+    return n_mom > 2 * log2(spatial_volume);
+  }
+
+  template <typename Float, int nColor> struct ContractFT {
+    ContractFT(const ColorSpinorField &x, const ColorSpinorField &y, std::vector<Complex> &result,
+               const QudaContractType cType, const int *source_position, const int *mom, int n_mom)
+    {
+      const int T = x.X()[3];
+      const int t_offset = comm_coord(3) * T;
+      const int T_global = comm_dim(3) * T;
+      std::fill(result.begin(), result.end(), Complex(0.0, 0.0));
+
+      if (useFFT(x, n_mom)) {
+        using real = typename mapper<Float>::type;
+        // the scratch buffers live alongside the fields so the host path never touches the device
+        const bool host = x.Location() == QUDA_CPU_FIELD_LOCATION;
+        auto alloc = [host](size_t bytes) { return host ? safe_malloc(bytes) : pool_device_malloc(bytes); };
+        auto release = [host](void *ptr) {
+          if (host)
+            host_free(ptr);
+          else
+            pool_device_free(ptr);
+        };
+
+        auto lex = static_cast<complex<real> *>(alloc(16 * x.Volume() * sizeof(complex<real>)));
+        ContractionLexicographic<Float, nColor>(x, y, lex, cType);
+
+        bool dims[4] = {true, true, true, false};
+        fft::Plan plan(x.X(), dims, 16, x.Precision(), x.Location());
+        plan.apply(lex, fft::forward);
+
+        auto mom_field = static_cast<int *>(alloc(3 * n_mom * sizeof(int)));
+        size_t out_bytes = result.size() * sizeof(Complex);
+        auto out = static_cast<complex<double> *>(alloc(out_bytes));
+        if (host) {
+          memcpy(mom_field, mom, 3 * n_mom * sizeof(int));
+          memset(out, 0, out_bytes);
+        } else {
+          qudaMemcpy(mom_field, mom, 3 * n_mom * sizeof(int), qudaMemcpyHostToDevice);
+          qudaMemset(out, 0, out_bytes);
+        }
+
+        MomentumGatherer<real>(x, lex, out, mom_field, n_mom, source_position);
+        if (host)
+          memcpy(result.data(), out, out_bytes);
+        else
+          qudaMemcpy(result.data(), out, out_bytes, qudaMemcpyDeviceToHost);
+
+        release(out);
+        release(mom_field);
+        release(lex);
+      } else {
+        for (int m0 = 0; m0 < n_mom; m0 += contract_max_mom) {
+          int n = std::min(contract_max_mom, n_mom - m0);
+          std::vector<array<double, 32>> sum(n * T);
+          ContractionSummed<Float, nColor>(x, y, sum, cType, source_position, mom + 3 * m0, n);
+          for (int m = 0; m < n; m++)
+            for (int g = 0; g < 16; g++)
+              for (int t = 0; t < T; t++)
+                result[((m0 + m) * 16 + g) * T_global + t_offset + t]
+                  = Complex(sum[m * T + t][2 * g], sum[m * T + t][2 * g + 1]);
+        }
+      }
+
+      // sum over the spatial slices held by other processes
+      comm_allreduce_array(reinterpret_cast<double *>(result.data()), 2 * result.size());
+    }
+  };
+
 #ifdef GPU_CONTRACT
   void contractQuda(const ColorSpinorField &x, const ColorSpinorField &y, void *result, const QudaContractType cType)
   {
@@ -65,11 +293,32 @@ public:
 
     instantiate<Contraction>(x, y, result, cType);
   }
+
+  void contractSummedQuda(const ColorSpinorField &x, const ColorSpinorField &y, std::vector<Complex> &result,
+                          const QudaContractType cType, const int *source_position, const int *mom, int n_mom)
+  {
+    checkPrecision(x, y);
+    if (x.GammaBasis() != QUDA_DEGRAND_ROSSI_GAMMA_BASIS || y.GammaBasis() != QUDA_DEGRAND_ROSSI_GAMMA_BASIS)
+      errorQuda("Unexpected gamma basis x=%d y=%d", x.GammaBasis(), y.GammaBasis());
+    if (x.Nspin() != 4 || y.Nspin() != 4) errorQuda("Unexpected number of spins x=%d y=%d", x.Nspin(), y.Nspin());
+    if (x.SiteSubset() != QUDA_FULL_SITE_SUBSET) errorQuda("Full-site fields are required");
+    if (n_mom < 1) errorQuda("Invalid number of momenta %d", n_mom);
+    if (result.size() != static_cast<size_t>(n_mom * 16 * comm_dim(3) * x.X()[3]))
+      errorQuda("Result size %lu does not match n_mom * 16 * T = %d", result.size(), n_mom * 16 * comm_dim(3) * x.X()[3]);
+
+    instantiate<ContractFT>(x, y, result, cType, source_position, mom, n_mom);
+  }
 #else
   void contractQuda(const ColorSpinorField &, const ColorSpinorField &, void *, const QudaContractType)
   {
     errorQuda("Contraction code has not been built");
   }
+
+  void contractSummedQuda(const ColorSpinorField &, const ColorSpinorField &, std::vector<Complex> &,
+                          const QudaContractType, const int *, const int *, int)
+  {
+    errorQuda("Contraction code has not been built");
+  }
 #endif
 
 } // namespace quda
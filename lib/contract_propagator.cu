@@ -0,0 +1,183 @@
+#include <color_spinor_field.h>
+#include <contract_quda.h>
+#include <tunable_reduction.h>
+#include <instantiate.h>
+#include <kernels/contract_propagator.cuh>
+
+namespace quda
+{
+
+  template <typename Float, int nColor> class MesonContraction : TunableMultiReduction<1>
+  {
+    using reduce_t = array<double, 2 * contract_max_gamma>;
+    const std::vector<ColorSpinorField *> &S1;
+    const std::vector<ColorSpinorField *> &S2;
+    std::vector<reduce_t> &result;
+    const int *gamma;
+    const int n_gamma;
+
+    bool tuneSharedBytes() const { return false; }
+
+  public:
+    MesonContraction(const ColorSpinorField &x, const std::vector<ColorSpinorField *> &S1,
+                     const std::vector<ColorSpinorField *> &S2, std::vector<reduce_t> &result, const int *gamma,
+                     int n_gamma) :
+      TunableMultiReduction(x, x.X()[3]), S1(S1), S2(S2), result(result), gamma(gamma), n_gamma(n_gamma)
+    {
+      char aux2[TuneKey::aux_n];
+      strcpy(aux2, ",meson,n_gamma=");
+      u32toa(aux2 + 15, n_gamma);
+      strcat(aux, aux2);
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      MesonContractArg<Float, nColor> arg(S1, S2, gamma, n_gamma);
+      // the timeslices are local, so the inter-process sum is done by the caller
+      launch<MesonContract, reduce_t, comm_reduce_null<reduce_t>>(result, tp, stream, arg);
+    }
+
+    long long flops() const
+    {
+      // 16 source spin pairs of 3 color inner products over 16 sink spin pairs, plus the insertions
+      return (16 * 3 * 16 * 6ll * 4 + n_gamma * 4 * 4 * 14ll) * S1[0]->Volume();
+    }
+
+    long long bytes() const { return 5 * propagator_n_column * S1[0]->Bytes(); }
+  };
+
+  template <typename Float, int nColor> class BaryonContraction : TunableMultiReduction<1>
+  {
+    using reduce_t = array<double, 2>;
+    const std::vector<ColorSpinorField *> &S1;
+    const std::vector<ColorSpinorField *> &S2;
+    std::vector<reduce_t> &result;
+
+    bool tuneSharedBytes() const { return false; }
+
+  public:
+    BaryonContraction(const ColorSpinorField &x, const std::vector<ColorSpinorField *> &S1,
+                      const std::vector<ColorSpinorField *> &S2, std::vector<reduce_t> &result) :
+      TunableMultiReduction(x, x.X()[3]), S1(S1), S2(S2), result(result)
+    {
+      strcat(aux, ",baryon");
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      BaryonContractArg<Float, nColor> arg(S1, S2);
+      launch<BaryonContract, reduce_t, comm_reduce_null<reduce_t>>(result, tp, stream, arg);
+    }
+
+    long long flops() const
+    {
+      // 36 color permutations, each with four 4x4 complex matrix products
+      return 36 * 4 * 64 * 8ll * S1[0]->Volume();
+    }
+
+    long long bytes() const { return 6 * 3 * 4 * S1[0]->Bytes(); }
+  };
+
+  /**
+     @brief Place the local timeslices of a multi-reduction into the
+     global correlator and sum over processes
+   */
+  template <typename T>
+  static void gatherTimeslices(const std::vector<T> &sum, std::vector<Complex> &result, int n, int offset, int T_local)
+  {
+    const int T_global = comm_dim(3) * T_local;
+    const int t_offset = comm_coord(3) * T_local;
+    for (int t = 0; t < T_local; t++)
+      for (int k = 0; k < n; k++)
+        result[(offset + k) * T_global + t_offset + t] = Complex(sum[t][2 * k], sum[t][2 * k + 1]);
+  }
+
+  static void checkPropagators(const std::vector<ColorSpinorField *> &S1, const std::vector<ColorSpinorField *> &S2)
+  {
+    if (S1.size() != propagator_n_column || S2.size() != propagator_n_column)
+      errorQuda("Propagators require %d columns (%lu, %lu given)", propagator_n_column, S1.size(), S2.size());
+    for (int i = 0; i < propagator_n_column; i++) {
+      for (auto &S : {S1[i], S2[i]}) {
+        checkPrecision(*S1[0], *S);
+        checkLocation(*S1[0], *S);
+        if (S->GammaBasis() != QUDA_DEGRAND_ROSSI_GAMMA_BASIS) errorQuda("Unexpected gamma basis %d", S->GammaBasis());
+        if (S->Nspin() != 4 || S->Ncolor() != 3) errorQuda("Unexpected spin %d / color %d", S->Nspin(), S->Ncolor());
+        if (S->SiteSubset() != QUDA_FULL_SITE_SUBSET) errorQuda("Full-site fields are required");
+        if (S->FieldOrder() != S1[0]->FieldOrder() || S->Volume() != S1[0]->Volume()
+            || S->NormOffset() != S1[0]->NormOffset())
+          errorQuda("Propagator columns must share their geometry");
+      }
+    }
+  }
+
+  template <typename Float, int nColor> struct MesonContract_ {
+    MesonContract_(const ColorSpinorField &x, const std::vector<ColorSpinorField *> &S1,
+                   const std::vector<ColorSpinorField *> &S2, std::vector<Complex> &result, const int *gamma,
+                   int n_gamma)
+    {
+      const int T = x.X()[3];
+      for (int k0 = 0; k0 < n_gamma; k0 += contract_max_gamma) {
+        int n = std::min(contract_max_gamma, n_gamma - k0);
+        std::vector<array<double, 2 * contract_max_gamma>> sum(T);
+        MesonContraction<Float, nColor>(x, S1, S2, sum, gamma + 2 * k0, n);
+        gatherTimeslices(sum, result, n, k0, T);
+      }
+    }
+  };
+
+  template <typename Float, int nColor> struct BaryonContract_ {
+    BaryonContract_(const ColorSpinorField &x, const std::vector<ColorSpinorField *> &S1,
+                    const std::vector<ColorSpinorField *> &S2, std::vector<Complex> &result)
+    {
+      std::vector<array<double, 2>> sum(x.X()[3]);
+      BaryonContraction<Float, nColor>(x, S1, S2, sum);
+      gatherTimeslices(sum, result, 1, 0, x.X()[3]);
+    }
+  };
+
+#ifdef GPU_CONTRACT
+  void contractMesonQuda(const std::vector<ColorSpinorField *> &S1, const std::vector<ColorSpinorField *> &S2,
+                         std::vector<Complex> &result, const int *gamma, int n_gamma)
+  {
+    checkPropagators(S1, S2);
+    if (n_gamma < 1) errorQuda("Invalid number of gamma insertions %d", n_gamma);
+    for (int k = 0; k < 2 * n_gamma; k++)
+      if (gamma[k] < 0 || gamma[k] > 15) errorQuda("Invalid gamma structure %d", gamma[k]);
+    if (result.size() != static_cast<size_t>(n_gamma * comm_dim(3) * S1[0]->X()[3]))
+      errorQuda("Result size %lu does not match n_gamma * T = %d", result.size(), n_gamma * comm_dim(3) * S1[0]->X()[3]);
+
+    std::fill(result.begin(), result.end(), Complex(0.0, 0.0));
+    instantiate<MesonContract_>(*S1[0], S1, S2, result, gamma, n_gamma);
+    comm_allreduce_array(reinterpret_cast<double *>(result.data()), 2 * result.size());
+  }
+
+  void contractBaryonQuda(const std::vector<ColorSpinorField *> &S1, const std::vector<ColorSpinorField *> &S2,
+                          std::vector<Complex> &result)
+  {
+    checkPropagators(S1, S2);
+    if (result.size() != static_cast<size_t>(comm_dim(3) * S1[0]->X()[3]))
+      errorQuda("Result size %lu does not match T = %d", result.size(), comm_dim(3) * S1[0]->X()[3]);
+
+    std::fill(result.begin(), result.end(), Complex(0.0, 0.0));
+    instantiate<BaryonContract_>(*S1[0], S1, S2, result);
+    comm_allreduce_array(reinterpret_cast<double *>(result.data()), 2 * result.size());
+  }
+#else
+  void contractMesonQuda(const std::vector<ColorSpinorField *> &, const std::vector<ColorSpinorField *> &,
+                         std::vector<Complex> &, const int *, int)
+  {
+    errorQuda("Contraction code has not been built");
+  }
+
+  void contractBaryonQuda(const std::vector<ColorSpinorField *> &, const std::vector<ColorSpinorField *> &,
+                          std::vector<Complex> &)
+  {
+    errorQuda("Contraction code has not been built");
+  }
+#endif
+
+} // namespace quda
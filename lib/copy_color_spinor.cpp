@@ -48,6 +48,13 @@ namespace quda
     if (dst.Ncolor() != src.Ncolor())
       errorQuda("Destination %d and source %d colors not equal", dst.Ncolor(), src.Ncolor());
 
+    // use the dedicated host reordering engine where possible
+    if (location == QUDA_CPU_FIELD_LOCATION && (Dst || dst.Location() == QUDA_CPU_FIELD_LOCATION)
+        && (Src || src.Location() == QUDA_CPU_FIELD_LOCATION) && reorderHostSupported(dst, src)) {
+      reorderHost(dst, src, Dst, Src);
+      return;
+    }
+
     copy_pack pack(dst, src, location, Dst, Src);
     if (dst.Ncolor() == 3) {
       if (dst.Precision() == QUDA_DOUBLE_PRECISION) {
@@ -53,6 +53,14 @@ namespace quda {
     if (out.Geometry() != in.Geometry())
       errorQuda("Field geometries %d %d do not match", out.Geometry(), in.Geometry());
 
+    // the body is copied with the dedicated host reordering engine where possible, leaving only the ghost
+    if (location == QUDA_CPU_FIELD_LOCATION && (type == 0 || type == 2) && (Out || out.Location() == QUDA_CPU_FIELD_LOCATION)
+        && (In || in.Location() == QUDA_CPU_FIELD_LOCATION) && reorderHostSupported(out, in)) {
+      reorderHost(out, in, Out, In);
+      if (type == 2) return;
+      type = 1;
+    }
+
     if (in.Ncolor() != 3) {
       copyGenericGaugeMG(out, in, location, Out, In, ghostOut, ghostIn, type);
     } else if (in.Precision() == QUDA_DOUBLE_PRECISION) {
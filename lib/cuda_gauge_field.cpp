@@ -88,6 +88,8 @@ namespace quda {
   {
     destroyComms();
 
+    if (spilled) host_free(spill_h); // the device allocation has already been released
+
     if (create != QUDA_REFERENCE_FIELD_CREATE) {
       switch(mem_type) {
       case QUDA_MEMORY_DEVICE:
@@ -745,6 +747,40 @@ namespace quda {
     backed_up = false;
   }
 
+  size_t cudaGaugeField::spill(QudaPrecision)
+  {
+    if (spilled) return 0;
+    if (create == QUDA_REFERENCE_FIELD_CREATE || mem_type != QUDA_MEMORY_DEVICE || !gauge)
+      errorQuda("Only allocated device fields can be spilled (create = %d, mem_type = %d)", create, mem_type);
+
+    spill_h = pinned_malloc(bytes);
+    qudaMemcpyAsync(spill_h, gauge, bytes, qudaMemcpyDeviceToHost, device::get_default_stream());
+
+    // the device allocation is only reused by work ordered after the copy above
+    pool_device_free(gauge);
+    gauge = nullptr;
+    even = nullptr;
+    odd = nullptr;
+    spilled = true;
+
+    return bytes;
+  }
+
+  size_t cudaGaugeField::refill()
+  {
+    if (!spilled) return 0;
+
+    gauge = pool_device_malloc(bytes);
+    even = gauge;
+    odd = static_cast<char *>(gauge) + bytes / 2;
+    qudaMemcpy(gauge, spill_h, bytes, qudaMemcpyHostToDevice);
+    host_free(spill_h);
+    spill_h = nullptr;
+    spilled = false;
+
+    return bytes;
+  }
+
   void cudaGaugeField::prefetch(QudaFieldLocation mem_space, qudaStream_t stream) const
   {
     if (is_prefetch_enabled() && mem_type == QUDA_MEMORY_DEVICE) {
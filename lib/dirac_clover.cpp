@@ -91,6 +91,7 @@ namespace quda {
   {
     if (T.getTransferType() != QUDA_TRANSFER_AGGREGATE)
       errorQuda("Wilson-type operators only support aggregation coarsening");
+    if (clover->OnTheFly()) errorQuda("Coarsening not supported with an on-the-fly clover field");
 
     double a = 2.0 * kappa * mu * T.Vectors().TwistFlavor();
     CoarseOp(Y, X, T, *gauge, clover, kappa, mass, a, mu_factor, QUDA_CLOVER_DIRAC, QUDA_MATPC_INVALID);
@@ -110,6 +111,9 @@ namespace quda {
   {
     // For the preconditioned operator, we need to check that the inverse of the clover term is present
     if (!clover->cloverInv && !clover::dynamic_inverse()) errorQuda("Clover inverse required for DiracCloverPC");
+    // an on-the-fly clover term can only be applied fused into the dslash or by CloverInv
+    if (clover->OnTheFly() && matpcType != QUDA_MATPC_EVEN_EVEN && matpcType != QUDA_MATPC_ODD_ODD)
+      errorQuda("On-the-fly clover requires symmetric preconditioning, not matpc_type %d", matpcType);
   }
 
   DiracCloverPC::DiracCloverPC(const DiracCloverPC &dirac) : DiracClover(dirac) { }
@@ -300,6 +304,7 @@ namespace quda {
   {
     if (T.getTransferType() != QUDA_TRANSFER_AGGREGATE)
       errorQuda("Wilson-type operators only support aggregation coarsening");
+    if (clover->OnTheFly()) errorQuda("Coarsening not supported with an on-the-fly clover field");
 
     double a = - 2.0 * kappa * mu * T.Vectors().TwistFlavor();
     CoarseOp(Y, X, T, *gauge, clover, kappa, mass, a, -mu_factor, QUDA_CLOVERPC_DIRAC, matpcType);
@@ -5,12 +5,20 @@
 
 namespace quda {
 
-  DiracWilson::DiracWilson(const DiracParam &param) : Dirac(param) { }
+  DiracWilson::DiracWilson(const DiracParam &param) :
+    Dirac(param), wilson_halo_precision(param.wilson_halo_precision)
+  {
+  }
 
-  DiracWilson::DiracWilson(const DiracWilson &dirac) : Dirac(dirac) { }
+  DiracWilson::DiracWilson(const DiracWilson &dirac) : Dirac(dirac), wilson_halo_precision(dirac.wilson_halo_precision)
+  {
+  }
 
   // hack (for DW and TM operators)
-  DiracWilson::DiracWilson(const DiracParam &param, const int) : Dirac(param) { }
+  DiracWilson::DiracWilson(const DiracParam &param, const int) :
+    Dirac(param), wilson_halo_precision(param.wilson_halo_precision)
+  {
+  }
 
   DiracWilson::~DiracWilson() { }
 
@@ -18,6 +26,7 @@ namespace quda {
   {
     if (&dirac != this) {
       Dirac::operator=(dirac);
+      wilson_halo_precision = dirac.wilson_halo_precision;
     }
     return *this;
   }
@@ -28,7 +37,7 @@ namespace quda {
     checkParitySpinor(in, out);
     checkSpinorAlias(in, out);
 
-    ApplyWilson(out, in, *gauge, 0.0, in, parity, dagger, commDim, profile);
+    ApplyWilson(out, in, *gauge, 0.0, in, parity, dagger, commDim, profile, wilson_halo_precision);
     flops += 1320ll*in.Volume();
   }
 
@@ -39,7 +48,7 @@ namespace quda {
     checkParitySpinor(in, out);
     checkSpinorAlias(in, out);
 
-    ApplyWilson(out, in, *gauge, k, x, parity, dagger, commDim, profile);
+    ApplyWilson(out, in, *gauge, k, x, parity, dagger, commDim, profile, wilson_halo_precision);
     flops += 1368ll*in.Volume();
   }
 
@@ -47,7 +56,7 @@ namespace quda {
   {
     checkFullSpinor(out, in);
 
-    ApplyWilson(out, in, *gauge, -kappa, in, QUDA_INVALID_PARITY, dagger, commDim, profile);
+    ApplyWilson(out, in, *gauge, -kappa, in, QUDA_INVALID_PARITY, dagger, commDim, profile, wilson_halo_precision);
     flops += 1368ll * in.Volume();
   }
 
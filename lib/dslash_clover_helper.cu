@@ -26,19 +26,42 @@ namespace quda {
     {
       if (in.Nspin() != 4 || out.Nspin() != 4) errorQuda("Unsupported nSpin=%d %d", out.Nspin(), in.Nspin());
       if (!inverse) errorQuda("Unsupported direct application");
+      if (clover.OnTheFly())
+        strcat(aux, clover.Gauge().Reconstruct() == QUDA_RECONSTRUCT_NO ? ",on_the_fly=18" : ",on_the_fly=12");
       apply(device::get_default_stream());
     }
 
+    template <QudaReconstructType recon> void launchOnTheFly(const TuneParam &tp, const qudaStream_t &stream)
+    {
+      if constexpr (clover::on_the_fly()) {
+        launch<CloverApply>(tp, stream, CloverArg<Float, nColor, true, true, recon>(out, in, clover, parity));
+      } else {
+        errorQuda("On-the-fly clover has not been built");
+      }
+    }
+
     void apply(const qudaStream_t &stream)
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      launch<CloverApply>(tp, stream, CloverArg<Float, nColor>(out, in, clover, parity));
+      if (clover.OnTheFly()) {
+        switch (clover.Gauge().Reconstruct()) {
+        case QUDA_RECONSTRUCT_NO: launchOnTheFly<QUDA_RECONSTRUCT_NO>(tp, stream); break;
+        case QUDA_RECONSTRUCT_12: launchOnTheFly<QUDA_RECONSTRUCT_12>(tp, stream); break;
+        default: errorQuda("Unsupported on-the-fly clover reconstruct %d", clover.Gauge().Reconstruct());
+        }
+      } else {
+        launch<CloverApply>(tp, stream, CloverArg<Float, nColor>(out, in, clover, parity));
+      }
     }
 
     void preTune() { if (out.V() == in.V()) out.backup(); }  // Backup if in and out fields alias
     void postTune() { if (out.V() == in.V()) out.restore(); } // Restore if the in and out fields alias
-    long long flops() const { return in.Volume()*504ll; }
-    long long bytes() const { return out.Bytes() + in.Bytes() + clover.Bytes() / (3 - in.SiteSubset()); }
+    long long flops() const { return in.Volume() * (504ll + (clover.OnTheFly() ? 6 * (2430 + 36) + 480 : 0)); }
+    long long bytes() const
+    {
+      auto clover_bytes = clover.OnTheFly() ? clover.Gauge().Bytes() : clover.Bytes();
+      return out.Bytes() + in.Bytes() + clover_bytes / (3 - in.SiteSubset());
+    }
   };
 
 #ifdef GPU_CLOVER_DIRAC
@@ -51,7 +51,7 @@ namespace quda
 
   // FIXME - add CPU variant
 
-  template <typename Float, int nColor, bool spin_project> class Pack : TunableKernel3D
+  template <typename Float, int nColor, bool spin_project, typename ghostFloat = Float> class Pack : TunableKernel3D
   {
 
 protected:
@@ -156,6 +156,13 @@ protected:
       if (twist && a == 0.0) errorQuda("Twisted packing requires non-zero scale factor a");
       if (twist) strcat(aux, twist == 2 ? ",twist-doublet" : ",twist-singlet");
 
+      if (sizeof(ghostFloat) != sizeof(Float)) {
+        char halo_prec[4];
+        u32toa(halo_prec, sizeof(ghostFloat));
+        strcat(aux, ",halo_prec=");
+        strcat(aux, halo_prec);
+      }
+
       // label the locations we are packing to
       // location label is nonp2p-p2p
       switch ((int)location) {
@@ -204,7 +211,7 @@ public:
   }
 
   template <int nSpin, bool dagger = false, int twist = 0, QudaPCType pc_type = QUDA_4D_PC> using Arg =
-    PackArg<Float, nColor, nSpin, spin_project, dagger, twist, pc_type>;
+    PackArg<Float, nColor, nSpin, spin_project, dagger, twist, pc_type, ghostFloat>;
 
   void apply(const qudaStream_t &stream)
   {
@@ -363,24 +370,47 @@ public:
 
     long long bytes() const
     {
-      size_t precision = sizeof(Float);
-      size_t faceBytes = 2 * ((in.Nspin() == 4 ? in.Nspin() / 2 : in.Nspin()) + in.Nspin()) * nColor * precision;
-      if (precision == QUDA_HALF_PRECISION || precision == QUDA_QUARTER_PRECISION)
-        faceBytes += 2 * sizeof(float); // 2 is from input and output
-      return faceBytes * nParity * in.getDslashConstant().Ls * work_items;
+      // the input is read at the field precision, the face is written at the halo precision
+      size_t inBytes = 2 * in.Nspin() * nColor * sizeof(Float) + (isFixed<Float>::value ? sizeof(float) : 0);
+      size_t outBytes = 2 * (in.Nspin() == 4 ? in.Nspin() / 2 : in.Nspin()) * nColor * sizeof(ghostFloat)
+        + (isFixed<ghostFloat>::value ? sizeof(float) : 0);
+      return (inBytes + outBytes) * nParity * in.getDslashConstant().Ls * work_items;
     }
   };
 
+  template <typename Float, typename ghostFloat, int nColor>
+  void packGhost(const ColorSpinorField &in, void *ghost[], MemoryLocation location, int nFace, bool dagger, int parity,
+                 bool spin_project, double a, double b, double c, int shmem, const qudaStream_t &stream)
+  {
+    if (spin_project) {
+      Pack<Float, nColor, true, ghostFloat> pack(ghost, in, location, nFace, dagger, parity, a, b, c, shmem);
+      pack.apply(stream);
+    } else {
+      Pack<Float, nColor, false, ghostFloat> pack(ghost, in, location, nFace, dagger, parity, a, b, c, shmem);
+      pack.apply(stream);
+    }
+  }
+
   template <typename Float, int nColor> struct GhostPack {
     GhostPack(const ColorSpinorField &in, void *ghost[], MemoryLocation location, int nFace, bool dagger, int parity,
               bool spin_project, double a, double b, double c, int shmem, const qudaStream_t &stream)
     {
-      if (spin_project) {
-        Pack<Float, nColor, true> pack(ghost, in, location, nFace, dagger, parity, a, b, c, shmem);
-        pack.apply(stream);
+      // the halo precision is set by the dslash that owns this exchange
+      if (in.GhostPrecision() == in.Precision()) {
+        packGhost<Float, Float, nColor>(in, ghost, location, nFace, dagger, parity, spin_project, a, b, c, shmem, stream);
+#ifdef COMPRESSED_HALO
+      } else if (in.GhostPrecision() < in.Precision() && in.GhostPrecision() == QUDA_SINGLE_PRECISION) {
+        packGhost<Float, typename halo_storage<Float, QUDA_SINGLE_PRECISION>::type, nColor>(
+          in, ghost, location, nFace, dagger, parity, spin_project, a, b, c, shmem, stream);
+      } else if (in.GhostPrecision() < in.Precision() && in.GhostPrecision() == QUDA_HALF_PRECISION) {
+        packGhost<Float, typename halo_storage<Float, QUDA_HALF_PRECISION>::type, nColor>(
+          in, ghost, location, nFace, dagger, parity, spin_project, a, b, c, shmem, stream);
+      } else if (in.GhostPrecision() < in.Precision() && in.GhostPrecision() == QUDA_QUARTER_PRECISION) {
+        packGhost<Float, typename halo_storage<Float, QUDA_QUARTER_PRECISION>::type, nColor>(
+          in, ghost, location, nFace, dagger, parity, spin_project, a, b, c, shmem, stream);
+#endif
       } else {
-        Pack<Float, nColor, false> pack(ghost, in, location, nFace, dagger, parity, a, b, c, shmem);
-        pack.apply(stream);
+        errorQuda("Halo precision %d not supported for field precision %d", in.GhostPrecision(), in.Precision());
       }
     }
   };
@@ -37,14 +37,57 @@ namespace quda
 
   template <typename Float, int nColor, QudaReconstructType recon> struct WilsonApply {
 
-    inline WilsonApply(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U, double a,
-                       const ColorSpinorField &x, int parity, bool dagger, const int *comm_override, TimeProfile &profile)
+    template <typename ghostFloat>
+    inline void apply(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U, double a,
+                      const ColorSpinorField &x, int parity, bool dagger, const int *comm_override, TimeProfile &profile)
     {
       constexpr int nDim = 4;
-      WilsonArg<Float, nColor, nDim, recon> arg(out, in, U, a, x, parity, dagger, comm_override);
+      WilsonArg<Float, nColor, nDim, recon, ghostFloat> arg(out, in, U, a, x, parity, dagger, comm_override);
       Wilson<decltype(arg)> wilson(arg, out, in);
 
       dslash::DslashPolicyTune<decltype(wilson)> policy(wilson, in, in.VolumeCB(), in.GhostFaceCB(), profile);
+
+      if (sizeof(ghostFloat) != sizeof(Float)) {
+        // spin-projected halo site size at a given precision, including the per-site norm for fixed point
+        auto site_bytes = [](size_t precision) {
+          return 2 * nColor * 2 * precision + (precision <= QUDA_HALF_PRECISION ? sizeof(float) : 0);
+        };
+        size_t bytes = 0;
+        for (int d = 0; d < nDim; d++)
+          if (arg.commDim[d]) bytes += 2 * in.GhostFaceBytes(d);
+        size_t bytes_full = (bytes / site_bytes(sizeof(ghostFloat))) * site_bytes(sizeof(Float));
+        if (bytes) recordHaloCompression(bytes, bytes_full, in.GhostPrecision());
+      }
+    }
+
+    inline WilsonApply(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U, double a,
+                       const ColorSpinorField &x, int parity, bool dagger, const int *comm_override,
+                       QudaPrecision halo_precision, TimeProfile &profile)
+    {
+      // a halo precision below the field precision selects a halo compressed to that precision
+      if (halo_precision == QUDA_INVALID_PRECISION || halo_precision >= in.Precision()) {
+        apply<Float>(out, in, U, a, x, parity, dagger, comm_override, profile);
+      } else {
+#ifdef COMPRESSED_HALO
+        switch (halo_precision) {
+        case QUDA_SINGLE_PRECISION:
+          apply<typename halo_storage<Float, QUDA_SINGLE_PRECISION>::type>(out, in, U, a, x, parity, dagger,
+                                                                          comm_override, profile);
+          break;
+        case QUDA_HALF_PRECISION:
+          apply<typename halo_storage<Float, QUDA_HALF_PRECISION>::type>(out, in, U, a, x, parity, dagger,
+                                                                        comm_override, profile);
+          break;
+        case QUDA_QUARTER_PRECISION:
+          apply<typename halo_storage<Float, QUDA_QUARTER_PRECISION>::type>(out, in, U, a, x, parity, dagger,
+                                                                           comm_override, profile);
+          break;
+        default: errorQuda("Unsupported halo precision %d", halo_precision);
+        }
+#else
+        errorQuda("Compressed halo exchange has not been built");
+#endif
+      }
     }
   };
 
@@ -53,13 +96,15 @@ namespace quda
   // Uses the a normalization for the Wilson operator.
 #ifdef GPU_WILSON_DIRAC
   void ApplyWilson(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U, double a,
-                   const ColorSpinorField &x, int parity, bool dagger, const int *comm_override, TimeProfile &profile)
+                   const ColorSpinorField &x, int parity, bool dagger, const int *comm_override, TimeProfile &profile,
+                   QudaPrecision halo_precision)
   {
-    instantiate<WilsonApply, WilsonReconstruct>(out, in, U, a, x, parity, dagger, comm_override, profile);
+    instantiate<WilsonApply, WilsonReconstruct>(out, in, U, a, x, parity, dagger, comm_override, halo_precision,
+                                                profile);
   }
 #else
   void ApplyWilson(ColorSpinorField &, const ColorSpinorField &, const GaugeField &, double,
-                   const ColorSpinorField &, int, bool, const int *, TimeProfile &)
+                   const ColorSpinorField &, int, bool, const int *, TimeProfile &, QudaPrecision)
   {
     errorQuda("Wilson dslash has not been built");
   }
@@ -96,6 +96,7 @@ namespace quda
   void ApplyWilsonClover(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U, const CloverField &A,
       double a, const ColorSpinorField &x, int parity, bool dagger, const int *comm_override, TimeProfile &profile)
   {
+    if (A.OnTheFly()) errorQuda("On-the-fly clover only supported by the symmetric preconditioned operator");
     instantiate<WilsonCloverApply>(out, in, U, A, a, x, parity, dagger, comm_override, profile);
   }
 #else
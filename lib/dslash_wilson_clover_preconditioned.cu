@@ -20,8 +20,18 @@ namespace quda
     using Dslash::arg;
     using Dslash::in;
 
+    /**
+       @brief Tune key suffix that distinguishes recomputing the clover term from reading it
+    */
+    static constexpr const char *clover_aux()
+    {
+      if (!Arg::on_the_fly) return "";
+      return Arg::clover_recon == QUDA_RECONSTRUCT_NO ? ",clover_on_the_fly=18" : ",clover_on_the_fly=12";
+    }
+
   public:
-    WilsonCloverPreconditioned(Arg &arg, const ColorSpinorField &out, const ColorSpinorField &in) : Dslash(arg, out, in)
+    WilsonCloverPreconditioned(Arg &arg, const ColorSpinorField &out, const ColorSpinorField &in) :
+      Dslash(arg, out, in, clover_aux())
     {
     }
 
@@ -47,7 +57,8 @@ namespace quda
 
     long long flops() const
     {
-      int clover_flops = 504;
+      // when on the fly, the clover term is also recomputed from the six field-strength components
+      int clover_flops = 504 + (Arg::on_the_fly ? 6 * (2430 + 36) + 480 : 0);
       long long flops = Dslash::flops();
       switch (arg.kernel_type) {
       case EXTERIOR_KERNEL_X:
@@ -76,7 +87,10 @@ namespace quda
 
     long long bytes() const
     {
-      int clover_bytes = 72 * in.Precision() + (isFixed<typename Arg::Float>::value ? 2 * sizeof(float) : 0);
+      // when on the fly, count the site's links, assuming the other links of the leaves are reused from cache
+      int clover_bytes = Arg::on_the_fly ?
+        4 * Arg::clover_recon * in.Precision() :
+        72 * in.Precision() + (isFixed<typename Arg::Float>::value ? 2 * sizeof(float) : 0);
 
       long long bytes = Dslash::bytes();
       switch (arg.kernel_type) {
@@ -112,9 +126,33 @@ namespace quda
     inline WilsonCloverPreconditionedApply(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U,
         const CloverField &A, double a, const ColorSpinorField &x, int parity, bool dagger, const int *comm_override,
         TimeProfile &profile)
+    {
+      if (A.OnTheFly()) {
+        if constexpr (clover::on_the_fly()) {
+          switch (A.Gauge().Reconstruct()) {
+          case QUDA_RECONSTRUCT_NO:
+            apply<true, QUDA_RECONSTRUCT_NO>(out, in, U, A, a, x, parity, dagger, comm_override, profile);
+            break;
+          case QUDA_RECONSTRUCT_12:
+            apply<true, QUDA_RECONSTRUCT_12>(out, in, U, A, a, x, parity, dagger, comm_override, profile);
+            break;
+          default: errorQuda("Unsupported on-the-fly clover reconstruct %d", A.Gauge().Reconstruct());
+          }
+        } else {
+          errorQuda("On-the-fly clover has not been built");
+        }
+      } else {
+        apply<false>(out, in, U, A, a, x, parity, dagger, comm_override, profile);
+      }
+    }
+
+    template <bool on_the_fly, QudaReconstructType clover_recon = QUDA_RECONSTRUCT_NO>
+    void apply(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U, const CloverField &A, double a,
+               const ColorSpinorField &x, int parity, bool dagger, const int *comm_override, TimeProfile &profile)
     {
       constexpr int nDim = 4;
-      WilsonCloverArg<Float, nColor, nDim, recon> arg(out, in, U, A, a, x, parity, dagger, comm_override);
+      WilsonCloverArg<Float, nColor, nDim, recon, on_the_fly, clover_recon> arg(out, in, U, A, a, x, parity, dagger,
+                                                                                 comm_override);
       WilsonCloverPreconditioned<decltype(arg)> wilson(arg, out, in);
 
       dslash::DslashPolicyTune<decltype(wilson)> policy(wilson, in, in.VolumeCB(), in.GhostFaceCB(), profile);
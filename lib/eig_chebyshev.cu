@@ -0,0 +1,116 @@
+#include <color_spinor_field.h>
+#include <blas_quda.h>
+#include <tunable_nd.h>
+#include <eigensolve_quda.h>
+#include <kernels/eig_chebyshev.cuh>
+
+namespace quda
+{
+
+  template <typename Float> class ChebyRecurrenceBlock : TunableKernel2D
+  {
+    using Arg = ChebyRecurrenceArg<Float>;
+    const std::vector<ColorSpinorField *> &y_field;
+    Float *const *y;
+    const Float *const *x;
+    const Float *const *Ax;
+    const double a, b, c;
+    const unsigned int length;
+    const unsigned int n_vec;
+    unsigned int minThreads() const { return length; }
+
+  public:
+    ChebyRecurrenceBlock(const std::vector<ColorSpinorField *> &y_field, Float *const *y, const Float *const *x,
+                         const Float *const *Ax, double a, double b, double c, unsigned int n_vec) :
+      TunableKernel2D(y_field[0]->Length(), n_vec, QUDA_CUDA_FIELD_LOCATION),
+      y_field(y_field),
+      y(y),
+      x(x),
+      Ax(Ax),
+      a(a),
+      b(b),
+      c(c),
+      length(y_field[0]->Length()),
+      n_vec(n_vec)
+    {
+      char n[16];
+      strcat(aux, y_field[0]->AuxString());
+      strcat(aux, ",n_vec=");
+      u32toa(n, n_vec);
+      strcat(aux, n);
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      auto tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      launch<ChebyRecurrence>(tp, stream, Arg(y, x, Ax, a, b, c, length, n_vec));
+    }
+
+    void preTune()
+    {
+      for (auto &f : y_field) f->backup();
+    }
+
+    void postTune()
+    {
+      for (auto &f : y_field) f->restore();
+    }
+
+    long long flops() const { return 5ll * length * n_vec; }
+    long long bytes() const { return 4ll * length * n_vec * sizeof(Float); }
+  };
+
+  static bool chebyRecurrenceSupported(const std::vector<ColorSpinorField *> &y, const std::vector<ColorSpinorField *> &x,
+                                       const std::vector<ColorSpinorField *> &Ax)
+  {
+    auto supported = [&](const ColorSpinorField &f) {
+      return f.Location() == QUDA_CUDA_FIELD_LOCATION && f.Precision() == y[0]->Precision()
+        && f.Precision() >= QUDA_SINGLE_PRECISION && f.Length() == y[0]->Length() && !f.IsComposite();
+    };
+    for (auto i = 0u; i < y.size(); i++)
+      if (!supported(*y[i]) || !supported(*x[i]) || !supported(*Ax[i])) return false;
+    return true;
+  }
+
+  template <typename Float>
+  void chebyRecurrence(std::vector<ColorSpinorField *> &y, const std::vector<ColorSpinorField *> &x,
+                       const std::vector<ColorSpinorField *> &Ax, double a, double b, double c)
+  {
+    constexpr int max_block = ChebyRecurrenceArg<Float>::max_block;
+    for (auto i = 0u; i < y.size(); i += max_block) {
+      const unsigned int n_vec = std::min(y.size() - i, static_cast<size_t>(max_block));
+      std::vector<ColorSpinorField *> y_field(y.begin() + i, y.begin() + i + n_vec);
+      Float *y_p[max_block];
+      const Float *x_p[max_block];
+      const Float *Ax_p[max_block];
+      for (auto j = 0u; j < n_vec; j++) {
+        y_p[j] = static_cast<Float *>(y[i + j]->V());
+        x_p[j] = static_cast<const Float *>(x[i + j]->V());
+        Ax_p[j] = static_cast<const Float *>(Ax[i + j]->V());
+      }
+      ChebyRecurrenceBlock<Float>(y_field, y_p, x_p, Ax_p, a, b, c, n_vec);
+    }
+  }
+
+  void chebyRecurrence(std::vector<ColorSpinorField *> &y, const std::vector<ColorSpinorField *> &x,
+                       const std::vector<ColorSpinorField *> &Ax, double a, double b, double c)
+  {
+    if (x.size() != y.size() || Ax.size() != y.size())
+      errorQuda("Mismatched block sizes y=%lu x=%lu Ax=%lu", y.size(), x.size(), Ax.size());
+    if (y.size() == 0) return;
+
+    if (!chebyRecurrenceSupported(y, x, Ax)) {
+      // fall back to the generic blas, one vector at a time
+      for (auto i = 0u; i < y.size(); i++) blas::caxpbypczw(c, *y[i], b, *x[i], a, *Ax[i], *y[i]);
+      return;
+    }
+
+    switch (y[0]->Precision()) {
+    case QUDA_DOUBLE_PRECISION: chebyRecurrence<double>(y, x, Ax, a, b, c); break;
+    case QUDA_SINGLE_PRECISION: chebyRecurrence<float>(y, x, Ax, a, b, c); break;
+    default: errorQuda("Unsupported precision %d", y[0]->Precision());
+    }
+  }
+
+} // namespace quda
@@ -0,0 +1,252 @@
+#include <color_spinor_field.h>
+#include <blas_lapack.h>
+#include <blas_quda.h>
+#include <tunable_nd.h>
+#include <eigensolve_quda.h>
+#include <kernels/eig_rotate_gemm.cuh>
+
+namespace quda
+{
+
+  template <typename Float, template <typename> class Functor> class RotateTile : TunableKernel2D
+  {
+    Float **v;
+    Float *tile;
+    size_t offset;
+    unsigned int length;
+    unsigned int ld;
+    unsigned int n_vec;
+    unsigned int minThreads() const { return length; }
+
+  public:
+    RotateTile(Float **v, Float *tile, size_t offset, unsigned int length, unsigned int ld, unsigned int n_vec) :
+      TunableKernel2D(length, n_vec, QUDA_CUDA_FIELD_LOCATION),
+      v(v),
+      tile(tile),
+      offset(offset),
+      length(length),
+      ld(ld),
+      n_vec(n_vec)
+    {
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      // intentionally do not autotune, since this is called inside the tile-size tuning region
+      auto tp = tuneLaunch(*this, QUDA_TUNE_NO, getVerbosity());
+      launch<Functor>(tp, stream, RotateTileArg<Float>(v, tile, offset, length, ld, n_vec));
+    }
+
+    void defaultTuneParam(TuneParam &param) const
+    {
+      TunableKernel2D::defaultTuneParam(param);
+      param.block.x = std::min(256u, device::max_threads_per_block_dim(0));
+      param.grid.x = (length + param.block.x - 1) / param.block.x;
+    }
+
+    long long bytes() const { return 2ll * length * n_vec * sizeof(Float); }
+  };
+
+  /**
+     @brief In-place rotation of a vector space, v_j = sum_i v_i
+     rot(i, j), for j < keep, expressed as a sequence of dense GEMMs
+     over tiles of the vectors.  Each tile of the input space is
+     gathered into a dense workspace, rotated with the native (or
+     generic) BLAS GEMM, and then scattered back in place.  Since
+     each tile only touches its own slice of the vectors, no
+     additional full vectors are required.  The tile length is
+     autotuned, bounded from above by the workspace size.
+   */
+  template <typename Float> class RotateGEMM : public Tunable
+  {
+    std::vector<ColorSpinorField *> &v;
+    const int dim;
+    const int keep;
+    const bool is_complex;
+    const size_t length; // vector length in real numbers
+    const int workspace;
+    size_t tile_max;     // maximum tile length in real numbers
+    Float **v_d;
+    Float *rot_d;
+    Float *tile_a;
+    Float *tile_c;
+
+    static constexpr int max_tile_shift = 4;
+    static constexpr size_t tile_align = 256;
+    static constexpr size_t min_tile = 1024;
+
+    unsigned int sharedBytesPerThread() const { return 0; }
+    unsigned int sharedBytesPerBlock(const TuneParam &) const { return 0; }
+
+    size_t tileLength(int shift) const
+    {
+      if (shift == 0) return tile_max;
+      size_t tile = ((tile_max >> shift) / tile_align) * tile_align;
+      return tile < min_tile ? min_tile : tile;
+    }
+
+    QudaBLASParam gemmParam(size_t m) const
+    {
+      QudaBLASParam param = newQudaBLASParam();
+      const int rows = is_complex ? m / 2 : m;
+      param.trans_a = QUDA_BLAS_OP_N;
+      param.trans_b = QUDA_BLAS_OP_T; // rot is stored row major
+      param.m = rows;
+      param.n = keep;
+      param.k = dim;
+      param.lda = rows;
+      param.ldb = keep;
+      param.ldc = rows;
+      param.a_offset = 0;
+      param.b_offset = 0;
+      param.c_offset = 0;
+      param.a_stride = 0;
+      param.b_stride = 0;
+      param.c_stride = 0;
+      Complex alpha(1.0, 0.0);
+      Complex beta(0.0, 0.0);
+      memcpy(&param.alpha, &alpha, sizeof(Complex));
+      memcpy(&param.beta, &beta, sizeof(Complex));
+      param.batch_count = 1;
+      if (is_complex)
+        param.data_type = sizeof(Float) == sizeof(double) ? QUDA_BLAS_DATATYPE_Z : QUDA_BLAS_DATATYPE_C;
+      else
+        param.data_type = sizeof(Float) == sizeof(double) ? QUDA_BLAS_DATATYPE_D : QUDA_BLAS_DATATYPE_S;
+      param.data_order = QUDA_BLAS_DATAORDER_COL;
+      return param;
+    }
+
+  public:
+    RotateGEMM(std::vector<ColorSpinorField *> &v, const void *rot, bool is_complex, int dim, int keep, int workspace) :
+      v(v),
+      dim(dim),
+      keep(keep),
+      is_complex(is_complex),
+      length(v[0]->Length()),
+      workspace(workspace)
+    {
+      for (int i = 1; i < dim; i++)
+        if (v[i]->Length() != length) errorQuda("Length %lu of vector %d does not match %lu", v[i]->Length(), i, length);
+
+      // each tile of length m requires m * (dim + keep) workspace elements
+      tile_max = (static_cast<size_t>(workspace) * length) / (dim + keep);
+      tile_max = (tile_max / tile_align) * tile_align;
+      if (tile_max < min_tile) tile_max = min_tile;
+      if (tile_max > length) tile_max = length;
+
+      std::vector<Float *> v_h(dim);
+      for (int i = 0; i < dim; i++) v_h[i] = static_cast<Float *>(v[i]->V());
+      v_d = static_cast<Float **>(pool_device_malloc(dim * sizeof(Float *)));
+      qudaMemcpy(v_d, v_h.data(), dim * sizeof(Float *), qudaMemcpyHostToDevice);
+
+      const size_t rot_length = (is_complex ? 2 : 1) * dim * keep;
+      std::vector<Float> rot_h(rot_length);
+      for (size_t i = 0; i < rot_length; i++) rot_h[i] = static_cast<const double *>(rot)[i];
+      rot_d = static_cast<Float *>(pool_device_malloc(rot_length * sizeof(Float)));
+      qudaMemcpy(rot_d, rot_h.data(), rot_length * sizeof(Float), qudaMemcpyHostToDevice);
+
+      tile_a = static_cast<Float *>(pool_device_malloc(tile_max * dim * sizeof(Float)));
+      tile_c = static_cast<Float *>(pool_device_malloc(tile_max * keep * sizeof(Float)));
+
+      apply(device::get_default_stream());
+    }
+
+    virtual ~RotateGEMM()
+    {
+      pool_device_free(tile_c);
+      pool_device_free(tile_a);
+      pool_device_free(rot_d);
+      pool_device_free(v_d);
+    }
+
+    void apply(const qudaStream_t &)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      const size_t tile = tileLength(tp.aux.x);
+      auto gemm = blas_lapack::use_native() ? blas_lapack::native::stridedBatchGEMM :
+                                              blas_lapack::generic::stridedBatchGEMM;
+
+      for (size_t offset = 0; offset < length; offset += tile) {
+        const unsigned int m = std::min(tile, length - offset);
+        RotateTile<Float, RotateTileGather>(v_d, tile_a, offset, m, m, dim);
+        gemm(tile_a, rot_d, tile_c, gemmParam(m), QUDA_CUDA_FIELD_LOCATION);
+        // the scatter overwrites the input space, so is skipped while tuning
+        if (!activeTuning()) RotateTile<Float, RotateTileScatter>(v_d, tile_c, offset, m, m, keep);
+      }
+    }
+
+    bool advanceAux(TuneParam &param) const
+    {
+      if (param.aux.x < max_tile_shift && (tile_max >> (param.aux.x + 1)) >= min_tile) {
+        param.aux.x++;
+        return true;
+      } else {
+        param.aux.x = 0;
+        return false;
+      }
+    }
+
+    bool advanceTuneParam(TuneParam &param) const { return advanceAux(param); }
+
+    void initTuneParam(TuneParam &param) const
+    {
+      Tunable::initTuneParam(param);
+      param.aux = make_int4(0, 0, 0, 0);
+    }
+
+    void defaultTuneParam(TuneParam &param) const
+    {
+      Tunable::defaultTuneParam(param);
+      param.aux = make_int4(0, 0, 0, 0);
+    }
+
+    std::string paramString(const TuneParam &param) const
+    {
+      std::stringstream ps;
+      ps << "tile=" << tileLength(param.aux.x);
+      return ps.str();
+    }
+
+    TuneKey tuneKey() const
+    {
+      char aux[TuneKey::aux_n];
+      strcpy(aux, v[0]->AuxString());
+      strcat(aux, is_complex ? ",complex" : ",real");
+      strcat(aux, ",workspace=");
+      char ws[16];
+      u32toa(ws, workspace);
+      strcat(aux, ws);
+      strcat(aux, ",dim=");
+      u32toa(ws, dim);
+      strcat(aux, ws);
+      strcat(aux, ",keep=");
+      u32toa(ws, keep);
+      strcat(aux, ws);
+      return TuneKey(v[0]->VolString(), typeid(*this).name(), aux);
+    }
+
+    long long flops() const { return (is_complex ? 4ll : 2ll) * length * dim * keep; }
+    long long bytes() const { return 3ll * (dim + keep) * length * sizeof(Float); }
+  };
+
+  bool rotateGEMMSupported(const ColorSpinorField &v)
+  {
+    return v.Location() == QUDA_CUDA_FIELD_LOCATION && v.Precision() >= QUDA_SINGLE_PRECISION && !v.IsComposite();
+  }
+
+  void rotateGEMM(std::vector<ColorSpinorField *> &v, const void *rot, bool is_complex, int dim, int keep, int workspace)
+  {
+    if (static_cast<int>(v.size()) < dim) errorQuda("Vector space size %lu less than rotation rank %d", v.size(), dim);
+    if (keep > dim) errorQuda("Cannot rotate to %d vectors from a space of %d", keep, dim);
+    if (workspace <= 0) errorQuda("Invalid workspace size %d", workspace);
+    if (!rotateGEMMSupported(*v[0])) errorQuda("GEMM rotation not supported for this field");
+
+    switch (v[0]->Precision()) {
+    case QUDA_DOUBLE_PRECISION: RotateGEMM<double>(v, rot, is_complex, dim, keep, workspace); break;
+    case QUDA_SINGLE_PRECISION: RotateGEMM<float>(v, rot, is_complex, dim, keep, workspace); break;
+    default: errorQuda("Unsupported precision %d", v[0]->Precision());
+    }
+  }
+
+} // namespace quda
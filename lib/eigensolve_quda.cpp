@@ -48,6 +48,8 @@ namespace quda
     max_restarts = eig_param->max_restarts;
     check_interval = eig_param->check_interval;
     batched_rotate = eig_param->batched_rotate;
+    gemm_rotate = eig_param->use_gemm_rotate == QUDA_BOOLEAN_TRUE;
+    gemm_rotate_workspace = eig_param->gemm_rotate_workspace;
     block_size = eig_param->block_size;
     iter = 0;
     iter_converged = 0;
@@ -172,6 +174,11 @@ namespace quda
   {
     if (eig_param->use_poly_acc && eig_param->a_max <= 0.0) {
       // Use part of the kSpace as temps
+      if (static_cast<int>(kSpace.size()) < block_size + 3) {
+        warningQuda("Krylov space of size %lu too small to estimate the Chebyshev maximum", kSpace.size());
+        return;
+      }
+      // a single power iteration bounds the spectrum for the whole block
       eig_param->a_max = estimateChebyOpMax(mat, *kSpace[block_size + 2], *kSpace[block_size + 1]);
       if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Chebyshev maximum estimate: %e.\n", eig_param->a_max);
     }
@@ -286,6 +293,12 @@ namespace quda
 
     mat.flops();
 
+    eig_param->n_restarts = restart_iter;
+    eig_param->rotate_secs = rotate_timer.time;
+    if (getVerbosity() >= QUDA_VERBOSE && restart_iter > 0)
+      printfQuda("Krylov space rotation took %e secs per restart (%s)\n", rotate_timer.time / restart_iter,
+                 gemm_rotate ? "tiled GEMM" : "multi-BLAS");
+
     if (getVerbosity() >= QUDA_SUMMARIZE) {
       printfQuda("********************************\n");
       printfQuda("***** END QUDA EIGENSOLVER *****\n");
@@ -306,7 +319,29 @@ namespace quda
     saveTuneCache();
   }
 
+  void EigenSolver::matVec(const DiracMatrix &mat, std::vector<ColorSpinorField *> &out,
+                           const std::vector<ColorSpinorField *> &in)
+  {
+    if (!tmp1 || !tmp2) {
+      ColorSpinorParam param(*in[0]);
+      if (!tmp1) tmp1 = new ColorSpinorField(param);
+      if (!tmp2) tmp2 = new ColorSpinorField(param);
+    }
+    mat.apply(out, in, *tmp1, *tmp2);
+
+    // Save matrix * vector tuning
+    saveTuneCache();
+  }
+
   void EigenSolver::chebyOp(const DiracMatrix &mat, ColorSpinorField &out, const ColorSpinorField &in)
+  {
+    std::vector<ColorSpinorField *> out_ {&out};
+    std::vector<ColorSpinorField *> in_ {const_cast<ColorSpinorField *>(&in)};
+    chebyOp(mat, out_, in_);
+  }
+
+  void EigenSolver::chebyOp(const DiracMatrix &mat, std::vector<ColorSpinorField *> &out,
+                            const std::vector<ColorSpinorField *> &in)
   {
     // Just do a simple matVec if no poly acc is requested
     if (!eig_param->use_poly_acc) {
@@ -330,15 +365,22 @@ namespace quda
     // out = d2 * in + d1 * out
     // C_1(x) = x
     matVec(mat, out, in);
-    blas::caxpby(d2, const_cast<ColorSpinorField &>(in), d1, out);
+    chebyRecurrence(out, in, out, d1, d2, 0.0);
     if (eig_param->poly_deg == 1) return;
 
-    // C_0 is the current 'in'  vector.
-    // C_1 is the current 'out' vector.
-
-    // Clone 'in' to two temporary vectors.
-    auto tmp1 = std::make_unique<ColorSpinorField>(in);
-    auto tmp2 = std::make_unique<ColorSpinorField>(out);
+    // C_0 is the current 'in'  block.
+    // C_1 is the current 'out' block.
+
+    // Clone 'in' and 'out' to two temporary blocks.
+    const auto n = in.size();
+    std::vector<std::unique_ptr<ColorSpinorField>> c_0, c_1;
+    std::vector<ColorSpinorField *> tmp1_, tmp2_;
+    for (auto i = 0u; i < n; i++) {
+      c_0.push_back(std::make_unique<ColorSpinorField>(*in[i]));
+      c_1.push_back(std::make_unique<ColorSpinorField>(*out[i]));
+      tmp1_.push_back(c_0.back().get());
+      tmp2_.push_back(c_1.back().get());
+    }
 
     // Using Chebyshev polynomial recursion relation,
     // C_{m+1}(x) = 2*x*C_{m} - C_{m-1}
@@ -353,19 +395,16 @@ namespace quda
       d2 = -d1 * theta;
       d3 = -sigma * sigma_old;
 
-      // FIXME - we could introduce a fused matVec + blas kernel here, eliminating one temporary
       // mat*C_{m}(x)
-      matVec(mat, out, *tmp2);
+      matVec(mat, out, tmp2_);
 
-      Complex d1c(d1, 0.0);
-      Complex d2c(d2, 0.0);
-      Complex d3c(d3, 0.0);
-      blas::caxpbypczw(d3c, *tmp1, d2c, *tmp2, d1c, out, *tmp1);
-      std::swap(tmp1, tmp2);
+      // C_{m+1} = d1 * mat*C_{m} + d2 * C_{m} + d3 * C_{m-1}, in place of C_{m-1}
+      chebyRecurrence(tmp1_, tmp2_, out, d1, d2, d3);
+      std::swap(tmp1_, tmp2_);
 
       sigma_old = sigma;
     }
-    blas::copy(out, *tmp2);
+    for (auto i = 0u; i < n; i++) blas::copy(*out[i], *tmp2_[i]);
 
     // Save Chebyshev tuning
     saveTuneCache();
@@ -911,8 +950,19 @@ namespace quda
   void EigenSolver::rotateVecsComplex(std::vector<ColorSpinorField *> &kSpace, const Complex *rot_array, const int offset,
                                       const int dim, const int keep, const int locked, TimeProfile &profile)
   {
-    // If we have memory availible, do the entire rotation
-    if (batched_rotate <= 0 || batched_rotate >= keep) {
+    // the rotation is asynchronous, so synchronize to time the device work itself
+    qudaDeviceSynchronize();
+    rotate_timer.start();
+
+    if (gemm_rotate && rotateGEMMSupported(*kSpace[locked])) {
+      // In-place tiled GEMM, requires no extra vectors
+      std::vector<ColorSpinorField *> vecs_ptr(kSpace.begin() + locked, kSpace.begin() + locked + dim);
+      profile.TPSTART(QUDA_PROFILE_COMPUTE);
+      rotateGEMM(vecs_ptr, rot_array, true, dim, keep, gemm_rotate_workspace);
+      profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+
+    } else if (batched_rotate <= 0 || batched_rotate >= keep) {
+      // If we have memory availible, do the entire rotation
       if ((int)kSpace.size() < offset + keep) {
         ColorSpinorParam csParamClone(*kSpace[0]);
         csParamClone.create = QUDA_ZERO_FIELD_CREATE;
@@ -1048,13 +1098,26 @@ namespace quda
       permuteVecs(kSpace, matQ.data(), keep);
       profile.TPSTOP(QUDA_PROFILE_COMPUTE);
     }
+
+    qudaDeviceSynchronize();
+    rotate_timer.stop();
   }
 
   void EigenSolver::rotateVecs(std::vector<ColorSpinorField *> &kSpace, const double *rot_array, const int offset,
                                const int dim, const int keep, const int locked, TimeProfile &profile)
   {
-    // If we have memory availible, do the entire rotation
-    if (batched_rotate <= 0 || batched_rotate >= keep) {
+    qudaDeviceSynchronize();
+    rotate_timer.start();
+
+    if (gemm_rotate && rotateGEMMSupported(*kSpace[locked])) {
+      // In-place tiled GEMM, requires no extra vectors
+      std::vector<ColorSpinorField *> vecs_ptr(kSpace.begin() + locked, kSpace.begin() + locked + dim);
+      profile.TPSTART(QUDA_PROFILE_COMPUTE);
+      rotateGEMM(vecs_ptr, rot_array, false, dim, keep, gemm_rotate_workspace);
+      profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+
+    } else if (batched_rotate <= 0 || batched_rotate >= keep) {
+      // If we have memory availible, do the entire rotation
       if ((int)kSpace.size() < offset + keep) {
         ColorSpinorParam csParamClone(*kSpace[0]);
         csParamClone.create = QUDA_ZERO_FIELD_CREATE;
@@ -1187,6 +1250,9 @@ namespace quda
       permuteVecs(kSpace, matQ.data(), keep);
       profile.TPSTOP(QUDA_PROFILE_COMPUTE);
     }
+
+    qudaDeviceSynchronize();
+    rotate_timer.stop();
   }
 
   EigenSolver::~EigenSolver()
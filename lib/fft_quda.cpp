@@ -0,0 +1,437 @@
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <comm_quda.h>
+#include <fft_quda.h>
+
+namespace quda
+{
+
+  namespace fft
+  {
+
+    namespace generic
+    {
+
+      /**
+         @brief Mixed-radix decimation-in-time FFT of a single line of
+         length n, following the structure of KISS FFT.  The length is
+         factored into radix 4, 2 and 3 stages, with any remaining odd
+         prime factors done with a generic butterfly, so any extent is
+         supported.
+       */
+      template <typename Float> class LineFFT
+      {
+        using cpx = std::complex<Float>;
+
+        const int n;
+        const bool inverse;
+        std::vector<int> factors; // pairs of (radix, remaining length)
+        std::vector<cpx> twiddles;
+
+        void bfly2(cpx *out, size_t fstride, int m) const
+        {
+          const cpx *tw = twiddles.data();
+          for (int k = 0; k < m; k++) {
+            cpx t = out[k + m] * *tw;
+            tw += fstride;
+            out[k + m] = out[k] - t;
+            out[k] += t;
+          }
+        }
+
+        void bfly3(cpx *out, size_t fstride, int m) const
+        {
+          const Float epi3 = twiddles[fstride * m].imag();
+          const cpx *tw1 = twiddles.data();
+          const cpx *tw2 = twiddles.data();
+          for (int k = 0; k < m; k++) {
+            cpx s1 = out[k + m] * *tw1;
+            cpx s2 = out[k + 2 * m] * *tw2;
+            cpx s3 = s1 + s2;
+            cpx s0 = (s1 - s2) * epi3;
+            tw1 += fstride;
+            tw2 += 2 * fstride;
+
+            out[k + m] = out[k] - static_cast<Float>(0.5) * s3;
+            out[k] += s3;
+            out[k + 2 * m] = cpx(out[k + m].real() + s0.imag(), out[k + m].imag() - s0.real());
+            out[k + m] += cpx(-s0.imag(), s0.real());
+          }
+        }
+
+        void bfly4(cpx *out, size_t fstride, int m) const
+        {
+          const cpx *tw1 = twiddles.data();
+          const cpx *tw2 = twiddles.data();
+          const cpx *tw3 = twiddles.data();
+          for (int k = 0; k < m; k++) {
+            cpx s0 = out[k + m] * *tw1;
+            cpx s1 = out[k + 2 * m] * *tw2;
+            cpx s2 = out[k + 3 * m] * *tw3;
+            cpx s5 = out[k] - s1;
+            out[k] += s1;
+            cpx s3 = s0 + s2;
+            cpx s4 = s0 - s2;
+            out[k + 2 * m] = out[k] - s3;
+            out[k] += s3;
+            tw1 += fstride;
+            tw2 += 2 * fstride;
+            tw3 += 3 * fstride;
+
+            if (inverse) {
+              out[k + m] = cpx(s5.real() - s4.imag(), s5.imag() + s4.real());
+              out[k + 3 * m] = cpx(s5.real() + s4.imag(), s5.imag() - s4.real());
+            } else {
+              out[k + m] = cpx(s5.real() + s4.imag(), s5.imag() - s4.real());
+              out[k + 3 * m] = cpx(s5.real() - s4.imag(), s5.imag() + s4.real());
+            }
+          }
+        }
+
+        void bfly_generic(cpx *out, size_t fstride, int m, int p) const
+        {
+          std::vector<cpx> scratch(p);
+          for (int u = 0; u < m; u++) {
+            for (int q = 0, k = u; q < p; q++, k += m) scratch[q] = out[k];
+
+            for (int q1 = 0, k = u; q1 < p; q1++, k += m) {
+              size_t tw_idx = 0;
+              out[k] = scratch[0];
+              for (int q = 1; q < p; q++) {
+                tw_idx += fstride * k;
+                if (tw_idx >= static_cast<size_t>(n)) tw_idx -= n;
+                out[k] += scratch[q] * twiddles[tw_idx];
+              }
+            }
+          }
+        }
+
+        void work(cpx *out, const cpx *in, size_t fstride, int stage) const
+        {
+          const int p = factors[2 * stage];
+          const int m = factors[2 * stage + 1];
+
+          if (m == 1) {
+            for (int q = 0; q < p; q++) out[q] = in[q * fstride];
+          } else {
+            for (int q = 0; q < p; q++) work(out + q * m, in + q * fstride, fstride * p, stage + 1);
+          }
+
+          switch (p) {
+          case 2: bfly2(out, fstride, m); break;
+          case 3: bfly3(out, fstride, m); break;
+          case 4: bfly4(out, fstride, m); break;
+          default: bfly_generic(out, fstride, m, p); break;
+          }
+        }
+
+      public:
+        LineFFT(int n, int direction) : n(n), inverse(direction == fft::inverse), twiddles(n)
+        {
+          // twiddles are computed in double precision to preserve the accuracy of long transforms
+          const double phase = (inverse ? 2.0 : -2.0) * M_PI / n;
+          for (int k = 0; k < n; k++) twiddles[k] = cpx(cos(phase * k), sin(phase * k));
+
+          int r = n;
+          int p = 4;
+          do {
+            while (r % p) {
+              switch (p) {
+              case 4: p = 2; break;
+              case 2: p = 3; break;
+              default: p += 2; break;
+              }
+              if (p * p > r) p = r; // no more factors
+            }
+            r /= p;
+            factors.push_back(p);
+            factors.push_back(r);
+          } while (r > 1);
+        }
+
+        /**
+           @brief Out-of-place transform of a contiguous line
+           @param[out] out Output line
+           @param[in] in Input line
+         */
+        void operator()(cpx *out, const cpx *in) const
+        {
+          if (n == 1)
+            out[0] = in[0];
+          else
+            work(out, in, 1, 0);
+        }
+      };
+
+      /**
+         @brief Geometry of the lines along a given dimension: element
+         j of line l is found at (l / inner) * n * inner + l % inner + j * inner
+       */
+      struct Lines {
+        size_t inner;
+        size_t outer;
+        int n;
+
+        Lines(const int X[4], int dim, int n_batch) : inner(1), outer(n_batch), n(X[dim])
+        {
+          for (int d = 0; d < dim; d++) inner *= X[d];
+          for (int d = dim + 1; d < 4; d++) outer *= X[d];
+        }
+
+        size_t count() const { return inner * outer; }
+        size_t base(size_t l) const { return (l / inner) * n * inner + l % inner; }
+      };
+
+      template <typename Float> void transform(std::complex<Float> *data, const int X[4], int dim, int n_batch, int direction)
+      {
+        using cpx = std::complex<Float>;
+        const Lines lines(X, dim, n_batch);
+        const LineFFT<Float> fft(lines.n, direction);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+          std::vector<cpx> in(lines.n);
+          std::vector<cpx> out(lines.n);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+          for (size_t l = 0; l < lines.count(); l++) {
+            cpx *line = data + lines.base(l);
+            for (int j = 0; j < lines.n; j++) in[j] = line[j * lines.inner];
+            fft(out.data(), in.data());
+            for (int j = 0; j < lines.n; j++) line[j * lines.inner] = out[j];
+          }
+        }
+      }
+
+      void transform(void *data, const int X[4], int dim, int n_batch, int direction, QudaPrecision precision)
+      {
+        switch (precision) {
+        case QUDA_DOUBLE_PRECISION:
+          transform(static_cast<std::complex<double> *>(data), X, dim, n_batch, direction);
+          break;
+        case QUDA_SINGLE_PRECISION:
+          transform(static_cast<std::complex<float> *>(data), X, dim, n_batch, direction);
+          break;
+        default: errorQuda("Unsupported precision %d", precision);
+        }
+      }
+
+      /**
+         @brief All-to-all exchange between the processes along a
+         dimension, where the block for process q starts at
+         send_offset[q] and has send_count[q] elements, and the block
+         from process q is received at recv_offset[q]
+       */
+      template <typename T>
+      static void all_to_all(int dim, T *send, const std::vector<size_t> &send_offset,
+                             const std::vector<size_t> &send_count, T *recv, const std::vector<size_t> &recv_offset,
+                             const std::vector<size_t> &recv_count)
+      {
+        const int P = comm_dim(dim);
+        const int me = comm_coord(dim);
+        std::vector<MsgHandle *> handles;
+
+        for (int q = 0; q < P; q++) {
+          if (q == me) continue;
+          int disp[4] = {0, 0, 0, 0};
+          disp[dim] = q - me;
+          int rank = comm_rank_displaced(comm_default_topology(), disp);
+          if (recv_count[q] > 0)
+            handles.push_back(comm_declare_recv_rank(recv + recv_offset[q], rank, dim, recv_count[q] * sizeof(T)));
+          if (send_count[q] > 0)
+            handles.push_back(comm_declare_send_rank(send + send_offset[q], rank, dim, send_count[q] * sizeof(T)));
+        }
+
+        for (auto &h : handles) comm_start(h);
+        std::copy(send + send_offset[me], send + send_offset[me] + send_count[me], recv + recv_offset[me]);
+        for (auto &h : handles) comm_wait(h);
+        for (auto &h : handles) comm_free(h);
+      }
+
+      template <typename Float>
+      void transform_distributed(std::complex<Float> *data, const int X[4], int dim, int n_batch, int direction)
+      {
+        using cpx = std::complex<Float>;
+        const Lines lines(X, dim, n_batch);
+        const int P = comm_dim(dim);
+        const int me = comm_coord(dim);
+        const int n = lines.n;
+        const int N = P * n; // global extent
+
+        // lines are distributed evenly, with process q transforming lines [start[q], start[q+1])
+        std::vector<size_t> start(P + 1);
+        for (int q = 0; q <= P; q++) start[q] = q * lines.count() / P;
+        const size_t my_lines = start[me + 1] - start[me];
+
+        // the block of my local segments for process q, and of the segments of my lines from process q
+        std::vector<size_t> local_offset(P), local_count(P), remote_offset(P), remote_count(P);
+        for (int q = 0; q < P; q++) {
+          local_offset[q] = start[q] * n;
+          local_count[q] = (start[q + 1] - start[q]) * n;
+          remote_offset[q] = q * my_lines * n;
+          remote_count[q] = my_lines * n;
+        }
+
+        std::vector<cpx> local(lines.count() * n);
+        std::vector<cpx> remote(my_lines * N);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (size_t l = 0; l < lines.count(); l++) {
+          const cpx *line = data + lines.base(l);
+          for (int j = 0; j < n; j++) local[l * n + j] = line[j * lines.inner];
+        }
+
+        all_to_all(dim, local.data(), local_offset, local_count, remote.data(), remote_offset, remote_count);
+
+        // each line is now held in P segments, ordered by process coordinate
+        const LineFFT<Float> fft(N, direction);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+          std::vector<cpx> in(N);
+          std::vector<cpx> out(N);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+          for (size_t c = 0; c < my_lines; c++) {
+            for (int q = 0; q < P; q++)
+              for (int j = 0; j < n; j++) in[q * n + j] = remote[(q * my_lines + c) * n + j];
+            fft(out.data(), in.data());
+            for (int q = 0; q < P; q++)
+              for (int j = 0; j < n; j++) remote[(q * my_lines + c) * n + j] = out[q * n + j];
+          }
+        }
+
+        all_to_all(dim, remote.data(), remote_offset, remote_count, local.data(), local_offset, local_count);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (size_t l = 0; l < lines.count(); l++) {
+          cpx *line = data + lines.base(l);
+          for (int j = 0; j < n; j++) line[j * lines.inner] = local[l * n + j];
+        }
+      }
+
+      void transform_distributed(void *data, const int X[4], int dim, int n_batch, int direction,
+                                 QudaPrecision precision)
+      {
+        if (comm_dim(dim) == 1) {
+          transform(data, X, dim, n_batch, direction, precision);
+          return;
+        }
+
+        switch (precision) {
+        case QUDA_DOUBLE_PRECISION:
+          transform_distributed(static_cast<std::complex<double> *>(data), X, dim, n_batch, direction);
+          break;
+        case QUDA_SINGLE_PRECISION:
+          transform_distributed(static_cast<std::complex<float> *>(data), X, dim, n_batch, direction);
+          break;
+        default: errorQuda("Unsupported precision %d", precision);
+        }
+      }
+
+    } // namespace generic
+
+    Plan::Plan(const int X[4], const bool dims[4], int n_batch, QudaPrecision precision, QudaFieldLocation location) :
+      n_batch(n_batch), precision(precision), location(location)
+    {
+      if (precision != QUDA_DOUBLE_PRECISION && precision != QUDA_SINGLE_PRECISION)
+        errorQuda("Unsupported precision %d", precision);
+
+      for (int d = 0; d < 4; d++) {
+        this->X[d] = X[d];
+        this->dims[d] = dims[d];
+      }
+
+      if (location != QUDA_CUDA_FIELD_LOCATION || !native::available()) return;
+
+      // group consecutive local dimensions into native transforms of rank at most 3
+      for (int a = 0; a < 4;) {
+        if (!dims[a] || comm_dim(a) > 1) {
+          a++;
+          continue;
+        }
+        int b = a;
+        while (b + 1 < 4 && b - a < 2 && dims[b + 1] && comm_dim(b + 1) == 1) b++;
+
+        int rank = b - a + 1;
+        int n[3];
+        int inner = 1, size = 1, outer = n_batch;
+        for (int d = 0; d < a; d++) inner *= X[d];
+        for (int d = a; d <= b; d++) {
+          n[b - d] = X[d]; // slowest varying first
+          size *= X[d];
+        }
+        for (int d = b + 1; d < 4; d++) outer *= X[d];
+
+        if (inner == 1) {
+          plans.push_back({native::create(rank, n, 1, size, outer, precision), 0, 1});
+        } else {
+          // interleaved transforms, executed once per outer block
+          plans.push_back({native::create(rank, n, inner, 1, inner, precision),
+                           static_cast<size_t>(inner) * size, outer});
+        }
+        a = b + 1;
+      }
+    }
+
+    Plan::~Plan()
+    {
+      for (auto &plan : plans) native::destroy(plan.handle);
+    }
+
+    void Plan::apply(void *data, int direction)
+    {
+      if (location == QUDA_CPU_FIELD_LOCATION) {
+        for (int d = 0; d < 4; d++)
+          if (dims[d]) generic::transform_distributed(data, X, d, n_batch, direction, precision);
+        return;
+      }
+
+      // transforms along local dimensions using the native library
+      const size_t site_bytes = 2 * precision;
+      for (auto &plan : plans)
+        for (int i = 0; i < plan.count; i++)
+          native::execute(plan.handle, static_cast<char *>(data) + i * plan.offset * site_bytes, direction, precision);
+
+      // remaining dimensions are staged through the host
+      bool staged = false;
+      for (int d = 0; d < 4; d++) staged = staged || (dims[d] && (comm_dim(d) > 1 || !native::available()));
+      if (!staged) return;
+
+      const size_t bytes = static_cast<size_t>(X[0]) * X[1] * X[2] * X[3] * n_batch * site_bytes;
+      void *buffer = pool_pinned_malloc(bytes);
+      qudaMemcpy(buffer, data, bytes, qudaMemcpyDeviceToHost);
+      for (int d = 0; d < 4; d++)
+        if (dims[d] && (comm_dim(d) > 1 || !native::available()))
+          generic::transform_distributed(buffer, X, d, n_batch, direction, precision);
+      qudaMemcpy(data, buffer, bytes, qudaMemcpyHostToDevice);
+      pool_pinned_free(buffer);
+    }
+
+    double Plan::flops() const
+    {
+      double flops = 0.0;
+      const double volume = static_cast<double>(X[0]) * X[1] * X[2] * X[3] * n_batch;
+      for (int d = 0; d < 4; d++)
+        if (dims[d]) flops += 5.0 * volume * log2(static_cast<double>(X[d] * comm_dim(d)));
+      return flops;
+    }
+
+  } // namespace fft
+
+} // namespace quda
@@ -0,0 +1,160 @@
+#include <cstdlib>
+#include <list>
+#include <unordered_map>
+#include <quda_internal.h>
+#include <field_residency.h>
+
+namespace quda
+{
+
+  namespace residency
+  {
+
+    struct Entry {
+      LatticeField *field;
+      int locks; // number of outstanding acquires
+    };
+
+    /** Registered fields, ordered from most to least recently used */
+    static std::list<Entry> lru;
+
+    /** Lookup from field to its position in the LRU list */
+    static std::unordered_map<const LatticeField *, std::list<Entry>::iterator> entries;
+
+    static Stats stats = {};
+
+    static size_t budget = 0;
+
+    static QudaPrecision spill_precision = QUDA_INVALID_PRECISION;
+
+    static bool init = false;
+
+    /** Guard against recursion, since spilling may itself allocate */
+    static bool evicting = false;
+
+    static void init_env()
+    {
+      if (init) return;
+
+      char *budget_env = getenv("QUDA_DEVICE_MEMORY_BUDGET");
+      if (budget_env) {
+        budget = static_cast<size_t>(atol(budget_env)) << 20;
+        if (getVerbosity() > QUDA_SILENT) printfQuda("Device memory budget set to %lu MiB\n", budget >> 20);
+      }
+
+      char *precision_env = getenv("QUDA_SPILL_PRECISION");
+      if (precision_env) {
+        spill_precision = static_cast<QudaPrecision>(atoi(precision_env));
+        switch (spill_precision) {
+        case QUDA_QUARTER_PRECISION:
+        case QUDA_HALF_PRECISION:
+        case QUDA_SINGLE_PRECISION:
+        case QUDA_DOUBLE_PRECISION: break;
+        default: errorQuda("Invalid QUDA_SPILL_PRECISION %s", precision_env);
+        }
+      }
+
+      init = true;
+    }
+
+    void add(LatticeField &field)
+    {
+      init_env();
+      // only device-memory allocations can be spilled
+      if (field.Location() != QUDA_CUDA_FIELD_LOCATION || field.MemType() != QUDA_MEMORY_DEVICE) return;
+      if (entries.count(&field)) return;
+      lru.push_front({&field, 0});
+      entries[&field] = lru.begin();
+    }
+
+    void remove(const LatticeField &field)
+    {
+      auto it = entries.find(&field);
+      if (it == entries.end()) return;
+      lru.erase(it->second);
+      entries.erase(it);
+    }
+
+    void acquire(LatticeField &field)
+    {
+      auto it = entries.find(&field);
+      if (it == entries.end()) return;
+
+      auto entry = it->second;
+      entry->locks++;
+      lru.splice(lru.begin(), lru, entry); // now the most recently used
+
+      if (field.Spilled()) {
+        stats.refill_bytes += field.refill();
+        stats.refills++;
+      }
+    }
+
+    void release(LatticeField &field)
+    {
+      auto it = entries.find(&field);
+      if (it == entries.end()) return;
+      if (it->second->locks > 0) it->second->locks--;
+    }
+
+    size_t evict(size_t bytes)
+    {
+      if (evicting) return 0;
+      evicting = true;
+
+      size_t freed = 0;
+      for (auto entry = lru.rbegin(); entry != lru.rend() && freed < bytes; entry++) {
+        if (entry->locks > 0 || entry->field->Spilled()) continue;
+        freed += entry->field->Bytes();
+        stats.spill_bytes += entry->field->spill(spill_precision);
+        stats.spills++;
+      }
+      stats.freed_bytes += freed;
+
+      // spilled allocations are returned to the pool, so release them
+      // to the device for the pending allocation; the release
+      // synchronizes the device, so spills are not asynchronous
+      if (freed > 0) pool::flush_device();
+
+      evicting = false;
+      return freed;
+    }
+
+    void reserve(size_t bytes)
+    {
+      if (evicting) return;
+      init_env();
+      if (budget == 0 || device_allocated() + bytes <= budget) return;
+
+      // cached allocations are free to release, so try these first
+      pool::flush_device();
+      size_t allocated = device_allocated();
+      if (allocated + bytes > budget) evict(allocated + bytes - budget);
+    }
+
+    void set_budget(size_t bytes)
+    {
+      init_env();
+      budget = bytes;
+    }
+
+    void set_spill_precision(QudaPrecision precision)
+    {
+      init_env();
+      spill_precision = precision;
+    }
+
+    const Stats &get_stats() { return stats; }
+
+    void print_stats()
+    {
+      if (stats.spills == 0) return;
+      printfQuda("Field residency: %lld spills (%.3f GiB freed, %.3f GiB transferred), %lld refills (%.3f GiB)\n",
+                 stats.spills, stats.freed_bytes / static_cast<double>(1 << 30),
+                 stats.spill_bytes / static_cast<double>(1 << 30), stats.refills,
+                 stats.refill_bytes / static_cast<double>(1 << 30));
+    }
+
+  } // namespace residency
+
+} // namespace quda
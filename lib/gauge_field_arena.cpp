@@ -0,0 +1,66 @@
+#include <algorithm>
+#include <gauge_field_arena.h>
+
+namespace quda
+{
+
+  GaugeFieldArena::~GaugeFieldArena() { free(); }
+
+  size_t GaugeFieldArena::Bytes(const GaugeFieldParam &param)
+  {
+    if (param.ghostExchange == QUDA_GHOST_EXCHANGE_PAD)
+      errorQuda("Arena fields cannot use ghostExchange=%d", param.ghostExchange);
+
+    // a reference field with no storage carries the size without allocating
+    GaugeFieldParam p(param);
+    p.create = QUDA_REFERENCE_FIELD_CREATE;
+    p.gauge = nullptr;
+    p.location = QUDA_CUDA_FIELD_LOCATION;
+    cudaGaugeField field(p);
+    return field.Bytes();
+  }
+
+  void GaugeFieldArena::reserve(const std::vector<std::vector<GaugeFieldParam>> &slot)
+  {
+    constexpr size_t alignment = 256;
+    slot_offset.resize(slot.size());
+    slot_bytes.resize(slot.size());
+
+    size_t total = 0;
+    for (auto i = 0u; i < slot.size(); i++) {
+      slot_bytes[i] = 0;
+      for (auto &param : slot[i]) slot_bytes[i] = std::max(slot_bytes[i], Bytes(param));
+      slot_offset[i] = total;
+      total += (slot_bytes[i] + alignment - 1) / alignment * alignment;
+    }
+
+    if (total > bytes) {
+      free();
+      buffer = device_malloc(total);
+      bytes = total;
+      if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
+        printfQuda("Allocated %.2f MiB gauge-field arena with %lu slots\n", bytes / (1024.0 * 1024.0), slot.size());
+    }
+  }
+
+  std::unique_ptr<cudaGaugeField> GaugeFieldArena::create(int slot, const GaugeFieldParam &param)
+  {
+    if (slot < 0 || slot >= static_cast<int>(slot_offset.size())) errorQuda("Invalid slot %d", slot);
+    if (Bytes(param) > slot_bytes[slot])
+      errorQuda("Field of %lu bytes does not fit in slot %d of %lu bytes", Bytes(param), slot, slot_bytes[slot]);
+
+    GaugeFieldParam p(param);
+    p.create = QUDA_REFERENCE_FIELD_CREATE;
+    p.gauge = static_cast<char *>(buffer) + slot_offset[slot];
+    p.location = QUDA_CUDA_FIELD_LOCATION;
+    return std::make_unique<cudaGaugeField>(p);
+  }
+
+  void GaugeFieldArena::free()
+  {
+    if (buffer) device_free(buffer);
+    buffer = nullptr;
+    bytes = 0;
+  }
+
+} // namespace quda
@@ -1,3 +1,4 @@
+#include <memory>
 #include <quda_internal.h>
 #include <quda_matrix.h>
 #include <tune_quda.h>
@@ -6,7 +7,7 @@
 #include <unitarization_links.h>
 #include <gauge_tools.h>
 
-#include <FFT_Plans.h>
+#include <fft_quda.h>
 #include <instantiate.h>
 
 #include <tunable_nd.h>
@@ -15,42 +16,6 @@
 
 namespace quda {
 
-  template <typename Float>
-  class GaugeFixFFTRotate : TunableKernel1D {
-    template <int dir> using Arg = GaugeFixFFTRotateArg<Float, dir>;
-    GaugeField &data;
-    complex<Float> *tmp0;
-    complex<Float> *tmp1;
-    int dir;
-    unsigned int minThreads() const { return data.Volume(); }
-
-  public:
-    GaugeFixFFTRotate(GaugeField &data) :
-      TunableKernel1D(data),
-      data(data),
-      dir(0) {}
-
-    void setDirection(int dir_, complex<Float> *data_in, complex<Float> *data_out)
-    {
-      dir = dir_;
-      tmp0 = data_in;
-      tmp1 = data_out;
-    }
-
-    void apply(const qudaStream_t &stream)
-    {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      switch (dir) {
-      case 0: launch<FFTrotate>(tp, stream, Arg<0>(data, tmp0, tmp1)); break;
-      case 1: launch<FFTrotate>(tp, stream, Arg<1>(data, tmp0, tmp1)); break;
-      default: errorQuda("Error in GaugeFixFFTRotate option");
-      }
-    }
-
-    long long flops() const { return 0; }
-    long long bytes() const { return 4 * sizeof(Float) * data.Volume(); }
-  };
-
   template <typename Arg>
   class GaugeFixQuality : TunableReduction2D<> {
     Arg &arg;
@@ -65,15 +30,22 @@ namespace quda {
     void apply(const qudaStream_t &stream)
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      launch<FixQualityFFT>(arg.result, tp, stream, arg);
-
-      arg.result[0] /= static_cast<double>(3 * Arg::gauge_dir * meta.Volume());
-      arg.result[1] /= static_cast<double>(3 * meta.Volume());
+      using reduce_t = typename Arg::reduce_t;
+      std::vector<reduce_t> result(1);
+      launch<FixQualityFFT, reduce_t, comm_reduce_sum<reduce_t>, true>(result, tp, stream, arg);
+      arg.result = result[0];
+
+      const double volume = static_cast<double>(meta.LocalVolume()) * comm_size();
+      arg.result[0] /= 3 * Arg::gauge_dir * volume;
+      arg.result[1] /= 3 * volume;
     }
 
-    long long flops() const { return (36 * Arg::gauge_dir + 65) * meta.Volume(); }
+    long long flops() const { return (36 * Arg::gauge_dir + 65) * meta.LocalVolume(); }
     long long bytes() const
-    { return (Arg::gauge_dir * meta.Bytes() / 4) + 12 * meta.Volume() * meta.Precision(); }
+    {
+      return 2 * Arg::gauge_dir * meta.Reconstruct() * meta.Precision() * meta.LocalVolume()
+        + 12 * meta.LocalVolume() * meta.Precision();
+    }
   };
 
   enum GaugeFixFFTKernel {
@@ -88,14 +60,18 @@ namespace quda {
     const GaugeField &field;
     GaugeFixFFTKernel type;
     char aux_tmp[TuneKey::aux_n];
+    void *delta_backup;
     unsigned int minThreads() const { return arg.threads.x; }
+    size_t delta_bytes() const { return 6 * arg.volume * sizeof(complex<typename Arg::Float>); }
 
   public:
     GaugeFixerFFT(Arg &arg, const GaugeField &field) :
       TunableKernel2D(field, 2),
       arg(arg),
-      field(field)
+      field(field),
+      delta_backup(nullptr)
     {
+      strcat(aux, comm_dim_partitioned_string());
       strcpy(aux_tmp, aux);
     }
 
@@ -106,12 +82,7 @@ namespace quda {
       case KERNEL_SET_INVPSQ: strcat(aux, ",set_invpsq"); break;
       case KERNEL_NORMALIZE: strcat(aux, ",normalize"); break;
       case KERNEL_GX: strcat(aux, ",gx"); break;
-      case KERNEL_UEO:
-        strcat(aux, ",ueo");
-#ifdef GAUGEFIXING_DONT_USE_GX
-        strcat(aux, "_new");
-#endif
-        break;
+      case KERNEL_UEO: strcat(aux, ",ueo"); break;
       default: errorQuda("Unknown kernel type %d", type);
       }
     }
@@ -120,14 +91,10 @@ namespace quda {
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
       switch (type) {
-      case KERNEL_SET_INVPSQ: launch<set_invpsq>(tp, stream, arg); break;
-      case KERNEL_NORMALIZE: launch<mult_norm_2d>(tp, stream, arg); break;
-      case KERNEL_GX: launch<GX>(tp, stream, arg); break;
-#ifdef GAUGEFIXING_DONT_USE_GX
-      case KERNEL_UEO: launch<U_EO_NEW>(tp, stream, arg); break;
-#else
-      case KERNEL_UEO: launch<U_EO>(tp, stream, arg); break;
-#endif //GAUGEFIXING_DONT_USE_GX
+      case KERNEL_SET_INVPSQ: launch<set_invpsq, true>(tp, stream, arg); break;
+      case KERNEL_NORMALIZE: launch<mult_norm, true>(tp, stream, arg); break;
+      case KERNEL_GX: launch<GX, true>(tp, stream, arg); break;
+      case KERNEL_UEO: launch<U_EO, true>(tp, stream, arg); break;
       default: errorQuda("Unexpected kernel type %d", type);
       }
     }
@@ -135,7 +102,11 @@ namespace quda {
     void preTune()
     {
       switch (type) {
-      case KERNEL_NORMALIZE: std::swap(arg.gx, arg.delta); break; // delta is irrelevant here, so use as backup
+      case KERNEL_NORMALIZE:
+        delta_backup = field.Location() == QUDA_CUDA_FIELD_LOCATION ? pool_device_malloc(delta_bytes()) :
+                                                                      safe_malloc(delta_bytes());
+        qudaMemcpy(delta_backup, arg.delta, delta_bytes(), qudaMemcpyDefault);
+        break;
       case KERNEL_UEO: field.backup(); break;
       default: break;
       }
@@ -144,7 +115,13 @@ namespace quda {
     void postTune()
     {
       switch (type) {
-      case KERNEL_NORMALIZE: std::swap(arg.gx, arg.delta); break;
+      case KERNEL_NORMALIZE:
+        qudaMemcpy(arg.delta, delta_backup, delta_bytes(), qudaMemcpyDefault);
+        if (field.Location() == QUDA_CUDA_FIELD_LOCATION)
+          pool_device_free(delta_backup);
+        else
+          host_free(delta_backup);
+        break;
       case KERNEL_UEO: field.restore(); break;
       default: break;
       }
@@ -153,29 +130,23 @@ namespace quda {
     long long flops() const
     {
       switch (type) {
-      case KERNEL_SET_INVPSQ: return 2 * field.Volume();
-      case KERNEL_NORMALIZE: return 2 * field.Volume();
-      case KERNEL_GX: return (arg.elems == 6 ? 208 : 166) * field.Volume();
-#ifdef GAUGEFIXING_DONT_USE_GX
-      case KERNEL_UEO: return 2414 * field.Volume();
-#else
-      case KERNEL_UEO: return (arg.elems == 6 ? 1794 : 1536) * field.Volume();
-#endif
+      case KERNEL_SET_INVPSQ: return 14 * field.LocalVolume();
+      case KERNEL_NORMALIZE: return 12 * field.LocalVolume();
+      case KERNEL_GX: return 166 * field.LocalVolume();
+      case KERNEL_UEO: return 1584 * field.LocalVolume();
       default: errorQuda("Unexpected kernel type %d", type); return 0;
       }
     }
 
     long long bytes() const
     {
+      auto link_bytes = field.Reconstruct() * field.Precision();
+      auto g_bytes = 18 * sizeof(typename Arg::Float);
       switch (type) {
-      case KERNEL_SET_INVPSQ: return sizeof(typename Arg::Float) * field.Volume();
-      case KERNEL_NORMALIZE: return 3 * sizeof(typename Arg::Float) * field.Volume();
-      case KERNEL_GX: return 4 * arg.elems * field.Precision() * field.Volume();
-#ifdef GAUGEFIXING_DONT_USE_GX
-      case KERNEL_UEO: return field.Bytes() + (5 * 12 * sizeof(typename Arg::Float)) * field.Volume();
-#else
-      case KERNEL_UEO: return 26 * arg.elems * field.Precision() * field.Volume();
-#endif
+      case KERNEL_SET_INVPSQ: return sizeof(typename Arg::Float) * field.LocalVolume();
+      case KERNEL_NORMALIZE: return (1 + 24) * sizeof(typename Arg::Float) * field.LocalVolume();
+      case KERNEL_GX: return (12 * sizeof(typename Arg::Float) + g_bytes) * field.LocalVolume();
+      case KERNEL_UEO: return (8 * link_bytes + 5 * g_bytes) * field.LocalVolume();
       default: errorQuda("Unexpected kernel type %d", type); return 0;
       }
     }
@@ -190,93 +161,77 @@ namespace quda {
     profileInternalGaugeFixFFT.TPSTART(QUDA_PROFILE_COMPUTE);
 
     if (getVerbosity() >= QUDA_SUMMARIZE) {
-      printfQuda("\tAuto tune active: %s\n", autotune ? "true" : "false");      
+      printfQuda("\tAuto tune active: %s\n", autotune ? "true" : "false");
       printfQuda("\tAlpha parameter of the Steepest Descent Method: %e\n", alpha0);
       printfQuda("\tTolerance: %lf\n", tolerance);
       printfQuda("\tStop criterion method: %s\n", stopWtheta ? "Theta" : "Delta");
       printfQuda("\tMaximum number of iterations: %d\n", Nsteps);
       printfQuda("\tPrint convergence results at every %d steps\n", verbose_interval);
     }
-    
-    unsigned int delta_pad = data.X()[0] * data.X()[1] * data.X()[2] * data.X()[3];
-    int4 size = make_int4(data.X()[0], data.X()[1], data.X()[2], data.X()[3]);
-    FFTPlanHandle plan_xy;
-    FFTPlanHandle plan_zt;
-
-    GaugeFixArg<Float, recon> arg(data, alpha0);
-    SetPlanFFT2DMany(plan_zt, size, 0, data.Precision());     //for space and time ZT
-    SetPlanFFT2DMany(plan_xy, size, 1, data.Precision());    //with space only XY
-
-    GaugeFixFFTRotate<Float> GFRotate(data);
 
+    const auto location = data.Location();
+    auto field_malloc = [location](size_t bytes) {
+      return location == QUDA_CUDA_FIELD_LOCATION ? pool_device_malloc(bytes) : safe_malloc(bytes);
+    };
+    auto field_free = [location](void *ptr) {
+      if (location == QUDA_CUDA_FIELD_LOCATION)
+        pool_device_free(ptr);
+      else
+        host_free(ptr);
+    };
+
+    // Delta(x) is Fourier transformed in all four dimensions, one array per independent element
+    const size_t volume = data.LocalVolume();
+    auto invpsq = static_cast<Float *>(field_malloc(volume * sizeof(Float)));
+    auto delta = static_cast<complex<Float> *>(field_malloc(6 * volume * sizeof(complex<Float>)));
+    const bool fft_dims[4] = {true, true, true, true};
+    fft::Plan plan(data.LocalX(), fft_dims, 6, data.Precision(), location);
+
+    // the gauge transformation is stored with the same border as the gauge field
+    GaugeFieldParam g_param(data);
+    g_param.reconstruct = QUDA_RECONSTRUCT_NO;
+    g_param.link_type = QUDA_GENERAL_LINKS;
+    g_param.geometry = QUDA_SCALAR_GEOMETRY;
+    g_param.create = QUDA_NULL_FIELD_CREATE;
+    g_param.setPrecision(data.Precision(), true);
+    std::unique_ptr<GaugeField> g(GaugeField::Create(g_param));
+
+    GaugeFixArg<Float, recon> arg(data, *g, invpsq, delta, alpha0);
     GaugeFixerFFT<decltype(arg)> gfix(arg, data);
     gfix.set_type(KERNEL_SET_INVPSQ);
     gfix.apply(device::get_default_stream());
 
-    GaugeFixQualityFFTArg<Float, recon, gauge_dir> argQ(data, arg.delta);
+    GaugeFixQualityFFTArg<Float, recon, gauge_dir> argQ(data, delta);
     GaugeFixQuality<decltype(argQ)> gfixquality(argQ, data);
     gfixquality.apply(device::get_default_stream());
     double action0 = argQ.getAction();
-    if(getVerbosity() >= QUDA_SUMMARIZE) printf("Step: %d\tAction: %.16e\ttheta: %.16e\n", 0, argQ.getAction(), argQ.getTheta());
+    if (getVerbosity() >= QUDA_SUMMARIZE)
+      printfQuda("Step: %d\tAction: %.16e\ttheta: %.16e\n", 0, argQ.getAction(), argQ.getTheta());
 
     double diff = 0.0;
     int iter = 0;
     for (iter = 0; iter < Nsteps; iter++) {
-      for (int k = 0; k < 6; k++) {
-        //------------------------------------------------------------------------
-        // Set a pointer do the element k in lattice volume
-        // each element is stored with stride lattice volume
-        // it uses gx as temporary array!!!!!!
-        //------------------------------------------------------------------------
-        complex<Float> *_array = arg.delta + k * delta_pad;
-        //////  2D FFT + 2D FFT
-        //------------------------------------------------------------------------
-        // Perform FFT on xy plane
-        //------------------------------------------------------------------------
-        ApplyFFT(plan_xy, _array, arg.gx, FFT_FORWARD);
-        //------------------------------------------------------------------------
-        // Rotate hypercube, xyzt -> ztxy
-        //------------------------------------------------------------------------
-        GFRotate.setDirection(0, arg.gx, _array);
-        GFRotate.apply(device::get_default_stream());
-        //------------------------------------------------------------------------
-        // Perform FFT on zt plane
-        //------------------------------------------------------------------------
-        ApplyFFT(plan_zt, _array, arg.gx, FFT_FORWARD);
-        //------------------------------------------------------------------------
-        // Normalize FFT and apply pmax^2/p^2
-        //------------------------------------------------------------------------
-        gfix.set_type(KERNEL_NORMALIZE);
-        gfix.apply(device::get_default_stream());
-        //------------------------------------------------------------------------
-        // Perform IFFT on zt plane
-        //------------------------------------------------------------------------
-        ApplyFFT(plan_zt, arg.gx, _array, FFT_INVERSE);
-        //------------------------------------------------------------------------
-        // Rotate hypercube, ztxy -> xyzt
-        //------------------------------------------------------------------------
-        GFRotate.setDirection(1, _array, arg.gx);
-        GFRotate.apply(device::get_default_stream());
-        //------------------------------------------------------------------------
-        // Perform IFFT on xy plane
-        //------------------------------------------------------------------------
-        ApplyFFT(plan_xy, arg.gx, _array, FFT_INVERSE);
-      }
+      //------------------------------------------------------------------------
+      // Fourier accelerate Delta(x): FFT, apply pmax^2/p^2 and normalize, IFFT
+      //------------------------------------------------------------------------
+      plan.apply(delta, fft::forward);
+      gfix.set_type(KERNEL_NORMALIZE);
+      gfix.apply(device::get_default_stream());
+      plan.apply(delta, fft::inverse);
 
-#ifndef GAUGEFIXING_DONT_USE_GX
       //------------------------------------------------------------------------
-      // Calculate g(x)
-      // ------------------------------------------------------------------------
-      // (using GX - else without using GX, gx will be created only
-      // for plane rotation but with less size)
+      // Calculate g(x), and make g(x + mu) available across process boundaries
+      //------------------------------------------------------------------------
       gfix.set_type(KERNEL_GX);
       gfix.apply(device::get_default_stream());
-#endif
+      if (comm_partitioned()) g->exchangeExtendedGhost(g->R(), false);
+
       //------------------------------------------------------------------------
       // Apply gauge fix to current gauge field
       //------------------------------------------------------------------------
       gfix.set_type(KERNEL_UEO);
       gfix.apply(device::get_default_stream());
+      if (comm_partitioned()) data.exchangeExtendedGhost(data.R(), false);
 
       //------------------------------------------------------------------------
       // Measure gauge quality and recalculate new Delta(x)
@@ -285,11 +240,12 @@ namespace quda {
       double action = argQ.getAction();
       diff = abs(action0 - action);
       if ((iter % verbose_interval) == (verbose_interval - 1) && getVerbosity() >= QUDA_SUMMARIZE)
-        printf("Step: %d\tAction: %.16e\ttheta: %.16e\tDelta: %.16e\n", iter + 1, argQ.getAction(), argQ.getTheta(), diff);
+        printfQuda("Step: %d\tAction: %.16e\ttheta: %.16e\tDelta: %.16e\n", iter + 1, argQ.getAction(),
+                   argQ.getTheta(), diff);
       if ( autotune && ((action - action0) < -1e-14) ) {
         if ( arg.alpha > 0.01 ) {
           arg.alpha = 0.95 * arg.alpha;
-          if(getVerbosity() >= QUDA_SUMMARIZE) printf(">>>>>>>>>>>>>> Warning: changing alpha down -> %.4e\n", arg.alpha);
+          if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda(">>>>>>>>>>>>>> Warning: changing alpha down -> %.4e\n", arg.alpha);
         }
       }
       //------------------------------------------------------------------------
@@ -301,49 +257,46 @@ namespace quda {
       action0 = action;
     }
     if ((iter % verbose_interval) != 0 && getVerbosity() >= QUDA_SUMMARIZE)
-      printf("Step: %d\tAction: %.16e\ttheta: %.16e\tDelta: %.16e\n", iter, argQ.getAction(), argQ.getTheta(), diff);
-    
-    // Reunitarize at end
-    const double unitarize_eps = 1e-14;
-    const double max_error = 1e-10;
-    const int reunit_allow_svd = 1;
-    const int reunit_svd_only  = 0;
-    const double svd_rel_error = 1e-6;
-    const double svd_abs_error = 1e-6;
-    setUnitarizeLinksConstants(unitarize_eps, max_error,
-                               reunit_allow_svd, reunit_svd_only,
-                               svd_rel_error, svd_abs_error);
-    int *num_failures_h = static_cast<int*>(mapped_malloc(sizeof(int)));
-    int *num_failures_d = static_cast<int*>(get_mapped_device_pointer(num_failures_h));
-
-    *num_failures_h = 0;
-    unitarizeLinks(data, data, num_failures_d);
-    if (*num_failures_h > 0) errorQuda("Error in the unitarization (%d errors)\n", *num_failures_h);
+      printfQuda("Step: %d\tAction: %.16e\ttheta: %.16e\tDelta: %.16e\n", iter, argQ.getAction(), argQ.getTheta(), diff);
+
+    // Reunitarize at end.  The gauge transformation is reunitarized
+    // at every step, so on the host, where unitarizeLinks is not
+    // available, the links are only subject to rounding.
+    if (location == QUDA_CUDA_FIELD_LOCATION) {
+      const double unitarize_eps = 1e-14;
+      const double max_error = 1e-10;
+      const int reunit_allow_svd = 1;
+      const int reunit_svd_only  = 0;
+      const double svd_rel_error = 1e-6;
+      const double svd_abs_error = 1e-6;
+      setUnitarizeLinksConstants(unitarize_eps, max_error,
+                                 reunit_allow_svd, reunit_svd_only,
+                                 svd_rel_error, svd_abs_error);
+      int *num_failures_h = static_cast<int*>(mapped_malloc(sizeof(int)));
+      int *num_failures_d = static_cast<int*>(get_mapped_device_pointer(num_failures_h));
+
+      *num_failures_h = 0;
+      unitarizeLinks(data, data, num_failures_d);
+      if (*num_failures_h > 0) errorQuda("Error in the unitarization (%d errors)\n", *num_failures_h);
+      host_free(num_failures_h);
+      qudaDeviceSynchronize();
+    }
     // end reunitarize
 
-    arg.free();
-    FFTDestroyPlan(plan_zt);
-    FFTDestroyPlan(plan_xy);
-    qudaDeviceSynchronize();
+    field_free(invpsq);
+    field_free(delta);
     profileInternalGaugeFixFFT.TPSTOP(QUDA_PROFILE_COMPUTE);
 
-
     double secs = profileInternalGaugeFixFFT.Last(QUDA_PROFILE_COMPUTE);
-    double fftflop = 5.0 * (log2((double)( data.X()[0] * data.X()[1]) ) + log2( (double)(data.X()[2] * data.X()[3] )));
-    fftflop *= (double)data.Volume();
     gfix.set_type(KERNEL_SET_INVPSQ);
     double gflops = gfix.flops() + gfixquality.flops();
     double gbytes = gfix.bytes() + gfixquality.bytes();
     gfix.set_type(KERNEL_NORMALIZE);
-    double flop = gfix.flops() * recon / 2;
-    double byte = gfix.bytes() * recon / 2;
-    flop += (GFRotate.flops() + fftflop) * (recon / 2) * 2;
-    byte += GFRotate.bytes() * (recon / 2) * 4;     //includes FFT reads, assuming 1 read and 1 write per site
-#ifndef GAUGEFIXING_DONT_USE_GX
+    double flop = gfix.flops() + 2 * plan.flops();
+    double byte = gfix.bytes() + 4 * 6 * volume * sizeof(complex<Float>); // assuming 1 read and 1 write per FFT
     gfix.set_type(KERNEL_GX);
     flop += gfix.flops();
     byte += gfix.bytes();
-#endif
     gfix.set_type(KERNEL_UEO);
     flop += gfix.flops();
     byte += gfix.bytes();
@@ -351,14 +304,14 @@ namespace quda {
     byte += gfixquality.bytes();
     gflops += flop * iter;
     gbytes += byte * iter;
-    gflops += 4588.0 * data.Volume(); //Reunitarize at end
-    gbytes += 2 * data.Bytes(); //Reunitarize at end
-    
+    if (location == QUDA_CUDA_FIELD_LOCATION) {
+      gflops += 4588.0 * volume;                                            // Reunitarize at end
+      gbytes += 8 * data.Reconstruct() * data.Precision() * (double)volume; // Reunitarize at end
+    }
+
     gflops = (gflops * 1e-9) / (secs);
     gbytes = gbytes / (secs * 1e9);
     if (getVerbosity() > QUDA_SUMMARIZE) printfQuda("Time: %6.6f s, Gflop/s = %6.1f, GB/s = %6.1f\n", secs, gflops, gbytes);
-
-    host_free(num_failures_h);
   }
 
   template<typename Float, int nColors, QudaReconstructType recon> struct GaugeFixingFFT {
@@ -376,7 +329,9 @@ namespace quda {
   };
 
   /**
-   * @brief Gauge fixing with Steepest descent method with FFTs with support for single GPU only.
+   * @brief Gauge fixing with Steepest descent method with FFTs.  Both
+   * device and (native-order) host fields are supported, and on
+   * partitioned lattices the field must be extended.
    * @param[in,out] data, quda gauge field
    * @param[in] gauge_dir, 3 for Coulomb gauge fixing, other for Landau gauge fixing
    * @param[in] Nsteps, maximum number of steps to perform gauge fixing
@@ -390,7 +345,11 @@ namespace quda {
   void gaugeFixingFFT(GaugeField& data, const int gauge_dir, const int Nsteps, const int verbose_interval, const double alpha,
                       const int autotune, const double tolerance, const int stopWtheta)
   {
-    if (comm_partitioned()) errorQuda("Gauge Fixing with FFTs in multi-GPU support NOT implemented yet!");
+    if (data.Location() == QUDA_CPU_FIELD_LOCATION && !data.isNative())
+      errorQuda("Host gauge fixing requires a native-order field (order = %d)", data.Order());
+    for (int d = 0; d < 4; d++)
+      if (comm_dim_partitioned(d) && data.R()[d] < 1)
+        errorQuda("Gauge fixing with FFTs requires an extended field in partitioned dimension %d", d);
     instantiate<GaugeFixingFFT, ReconstructNo12>(data, gauge_dir, Nsteps, verbose_interval, alpha, autotune, tolerance, stopWtheta);
   }
 #else
@@ -1,9 +1,169 @@
+#include <algorithm>
+#include <array>
+#include <vector>
 #include <tunable_nd.h>
 #include <instantiate.h>
 #include <kernels/gauge_force.cuh>
 
 namespace quda {
 
+  namespace {
+
+    // a link is identified by its offset from the site, its direction and whether it is daggered
+    using path_link = std::array<int, 6>;
+
+    struct path_term {
+      std::vector<path_link> link;
+      double coeff;
+    };
+
+    path_op make_op(path_op_type type, const path_link &l = path_link {}, double coeff = 0.0)
+    {
+      path_op o = {};
+      o.type = type;
+      o.dir = l[4];
+      o.dagger = l[5];
+      for (int d = 0; d < 4; d++) o.dx[d] = l[d];
+      o.coeff = coeff;
+      return o;
+    }
+
+    /**
+       @brief Emit the program for the sum of the given terms.  The
+       terms are grouped on their first link or on their last link,
+       whichever gives fewer groups, and each group is factored
+       recursively, so the shared part of the group's partial product
+       is only formed once.
+       @param[in] terms The weighted link sequences to sum
+       @param[in,out] prog The program the operations are appended to
+       @return The stack depth required to evaluate the emitted operations
+     */
+    int compile_terms(const std::vector<path_term> &terms, std::vector<path_op> &prog)
+    {
+      double identity = 0.0;
+      using group_t = std::vector<std::pair<path_link, std::vector<path_term>>>;
+      group_t prefix, suffix;
+      auto insert = [](group_t &group, const path_link &l, const path_term &t) {
+        auto it = std::find_if(group.begin(), group.end(), [&](const auto &g) { return g.first == l; });
+        if (it == group.end())
+          group.push_back({l, {t}});
+        else
+          it->second.push_back(t);
+      };
+
+      for (auto &t : terms) {
+        if (t.link.empty()) {
+          identity += t.coeff;
+        } else {
+          insert(prefix, t.link.front(), t);
+          insert(suffix, t.link.back(), t);
+        }
+      }
+
+      const bool left = prefix.size() <= suffix.size();
+      int depth = 0;
+      int n = 0;
+      for (auto &g : left ? prefix : suffix) {
+        std::vector<path_term> tail;
+        double coeff = 0.0;
+        bool leaf = true;
+        for (auto t : g.second) {
+          if (left)
+            t.link.erase(t.link.begin());
+          else
+            t.link.pop_back();
+          leaf = leaf && t.link.empty();
+          coeff += t.coeff;
+          tail.push_back(t);
+        }
+
+        int d = 1;
+        if (leaf) {
+          prog.push_back(make_op(PATH_LOAD, g.first, coeff));
+        } else {
+          d = compile_terms(tail, prog);
+          prog.push_back(make_op(left ? PATH_LMUL : PATH_RMUL, g.first));
+        }
+
+        depth = std::max(depth, d + (n > 0 ? 1 : 0));
+        if (n++ > 0) prog.push_back(make_op(PATH_ADD));
+      }
+
+      if (identity != 0.0) {
+        prog.push_back(make_op(PATH_IDENTITY, path_link {}, identity));
+        depth = std::max(depth, n > 0 ? 2 : 1);
+        if (n++ > 0) prog.push_back(make_op(PATH_ADD));
+      }
+
+      return depth;
+    }
+
+  } // namespace
+
+  paths::paths(int ***input_path, int *length_h, double *path_coeff_h, int num_paths, int max_length,
+               QudaFieldLocation location) :
+    num_paths(num_paths), max_length(max_length), count(0), depth(0), location(location)
+  {
+    for (int i = 0; i < num_paths; i++) count += length_h[i];
+
+    std::vector<path_op> prog;
+    for (int dir = 0; dir < 4; dir++) {
+      // translate each path into the links it traverses, starting from the end of the link in direction dir
+      std::vector<path_term> terms;
+      for (int i = 0; i < num_paths; i++) {
+        if (path_coeff_h[i] == 0.0 || length_h[i] == 0) continue;
+        if (length_h[i] > max_length) errorQuda("Path %d length %d exceeds maximum %d", i, length_h[i], max_length);
+
+        path_term t = {{}, path_coeff_h[i]};
+        path_link l = {0, 0, 0, 0, 0, 0};
+        l[dir]++;
+        for (int j = 0; j < length_h[i]; j++) {
+          int step = input_path[dir][i][j];
+          if (step < 0 || step > 7) errorQuda("Invalid step %d in path %d", step, i);
+          int lnkdir = isForwards(step) ? step : flipDir(step);
+          if (isForwards(step)) {
+            l[4] = lnkdir;
+            l[5] = 0;
+            t.link.push_back(l);
+            l[lnkdir]++;
+          } else {
+            l[lnkdir]--; // if we are going backwards the link is on the adjacent site
+            l[4] = lnkdir;
+            l[5] = 1;
+            t.link.push_back(l);
+          }
+          if (std::abs(l[lnkdir]) > 127) errorQuda("Path %d extends too far from its origin", i);
+        }
+        terms.push_back(t);
+      }
+
+      offset[dir] = prog.size();
+      depth = std::max(depth, compile_terms(terms, prog));
+      length[dir] = prog.size() - offset[dir];
+
+      n_mult[dir] = 0;
+      n_load[dir] = 0;
+      for (int k = offset[dir]; k < offset[dir] + length[dir]; k++) {
+        if (prog[k].type == PATH_LMUL || prog[k].type == PATH_RMUL) n_mult[dir]++;
+        if (prog[k].type == PATH_LMUL || prog[k].type == PATH_RMUL || prog[k].type == PATH_LOAD) n_load[dir]++;
+      }
+    }
+
+    size_t bytes = std::max(prog.size(), static_cast<size_t>(1)) * sizeof(path_op);
+    if (location == QUDA_CPU_FIELD_LOCATION) {
+      buffer = static_cast<path_op *>(safe_malloc(bytes));
+      if (prog.size() > 0) memcpy(buffer, prog.data(), prog.size() * sizeof(path_op));
+    } else {
+      buffer = static_cast<path_op *>(pool_device_malloc(bytes));
+      if (prog.size() > 0) qudaMemcpy(buffer, prog.data(), prog.size() * sizeof(path_op), qudaMemcpyHostToDevice);
+    }
+    op = buffer;
+
+    if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
+      printfQuda("Compiled %d paths into %d + %d + %d + %d operations with %d + %d + %d + %d multiplications\n",
+                 num_paths, length[0], length[1], length[2], length[3], n_mult[0], n_mult[1], n_mult[2], n_mult[3]);
+  }
+
   template <typename Float, int nColor, QudaReconstructType recon_u, bool compute_force=true> class ForceGauge : public TunableKernel3D
   {
     const GaugeField &u;
@@ -12,6 +172,9 @@ namespace quda {
     const paths &p;
     unsigned int minThreads() const { return mom.VolumeCB(); }
 
+    template <int max_depth> using Arg =
+      GaugeForceArg<Float, nColor, recon_u, compute_force ? QUDA_RECONSTRUCT_10 : recon_u, compute_force, max_depth>;
+
   public:
     ForceGauge(const GaugeField &u, GaugeField &mom, double epsilon, const paths &p) :
       TunableKernel3D(u, 2, 4),
@@ -22,6 +185,8 @@ namespace quda {
     {
       strcat(aux, ",num_paths=");
       strcat(aux, std::to_string(p.num_paths).c_str());
+      strcat(aux, ",depth=");
+      strcat(aux, std::to_string(p.depth).c_str());
       strcat(aux, comm_dim_partitioned_string());
       apply(device::get_default_stream());
     }
@@ -29,14 +194,29 @@ namespace quda {
     void apply(const qudaStream_t &stream)
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      launch<GaugeForce>(tp, stream, GaugeForceArg<Float, nColor, recon_u, compute_force ? QUDA_RECONSTRUCT_10 : recon_u, compute_force>(mom, u, epsilon, p));
+      // the plaquette action needs a stack of two, the rectangle actions (Symanzik, Iwasaki, DBW2) four
+      if (p.depth <= 2) launch<GaugeForce>(tp, stream, Arg<2>(mom, u, epsilon, p));
+      else if (p.depth <= 4) launch<GaugeForce>(tp, stream, Arg<4>(mom, u, epsilon, p));
+      else if (p.depth <= 8) launch<GaugeForce>(tp, stream, Arg<8>(mom, u, epsilon, p));
+      else errorQuda("Path program depth %d exceeds the maximum supported depth 8", p.depth);
     }
 
     void preTune() { mom.backup(); }
     void postTune() { mom.restore(); }
 
-    long long flops() const { return (p.count - p.num_paths + 1) * 198ll * mom.Volume() * 4; }
-    long long bytes() const { return (p.count + 1ll) * u.Bytes() + 2 * mom.Bytes(); }
+    long long flops() const
+    {
+      long long n_mult = 0;
+      for (int d = 0; d < 4; d++) n_mult += p.n_mult[d] + 1;
+      return n_mult * 198ll * mom.Volume();
+    }
+
+    long long bytes() const
+    {
+      long long n_load = 0;
+      for (int d = 0; d < 4; d++) n_load += p.n_load[d] + 1;
+      return n_load * u.Bytes() / 4 + 2 * mom.Bytes();
+    }
   };
 
   template<typename Float, int nColor, QudaReconstructType recon_u> using GaugeForce_ = ForceGauge<Float,nColor,recon_u,true>;
@@ -51,7 +231,7 @@ namespace quda {
     checkLocation(mom, u);
     if (mom.Reconstruct() != QUDA_RECONSTRUCT_10) errorQuda("Reconstruction type %d not supported", mom.Reconstruct());
 
-    paths p(input_path, length_h, path_coeff_h, num_paths, path_max_length);
+    paths p(input_path, length_h, path_coeff_h, num_paths, path_max_length, u.Location());
 
     // gauge field must be passed as first argument so we peel off its reconstruct type
     instantiate<GaugeForce_,ReconstructNo12>(u, mom, epsilon, p);
@@ -65,7 +245,7 @@ namespace quda {
     checkLocation(out, u);
     checkReconstruct(out, u);
 
-    paths p(input_path, length_h, path_coeff_h, num_paths, path_max_length);
+    paths p(input_path, length_h, path_coeff_h, num_paths, path_max_length, u.Location());
 
     // gauge field must be passed as first argument so we peel off its reconstruct type
     instantiate<GaugePath>(u, out, coeff, p);
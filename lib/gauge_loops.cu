@@ -0,0 +1,245 @@
+#include <memory>
+#include <gauge_field.h>
+#include <gauge_tools.h>
+#include <instantiate.h>
+#include <tunable_nd.h>
+#include <tunable_reduction.h>
+#include <kernels/gauge_loops.cuh>
+
+namespace quda
+{
+
+  enum class LineStep { polyakov, spatial, wilson };
+
+  template <typename Float, int nColor, QudaReconstructType recon> class GaugeLine : TunableKernel3D
+  {
+    const GaugeField &u;
+    GaugeField &out;
+    const GaugeField &in;
+    GaugeField &out2;
+    const GaugeField &in2;
+    const LineStep step;
+    const bool first;
+    void *loops;
+    unsigned int minThreads() const { return u.LocalVolumeCB(); }
+
+  public:
+    GaugeLine(const GaugeField &u, GaugeField &out, const GaugeField &in, GaugeField &out2, const GaugeField &in2,
+              LineStep step, bool first, void *loops) :
+      TunableKernel3D(u, 2, step == LineStep::spatial ? 3 : 1),
+      u(u),
+      out(out),
+      in(in),
+      out2(out2),
+      in2(in2),
+      step(step),
+      first(first),
+      loops(loops)
+    {
+      strcat(aux, comm_dim_partitioned_string());
+      strcat(aux, step == LineStep::polyakov ? ",polyakov" : step == LineStep::spatial ? ",spatial" : ",wilson");
+      if (first) strcat(aux, ",first");
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      switch (step) {
+      case LineStep::polyakov:
+        launch<PolyakovStep>(tp, stream, GaugeLineArg<Float, nColor, recon>(u, out, in, out2, in2, 1, first));
+        break;
+      case LineStep::spatial:
+        launch<SpatialLineStep>(tp, stream, GaugeLineArg<Float, nColor, recon>(u, out, in, out2, in2, 3, first));
+        break;
+      case LineStep::wilson:
+        launch<WilsonLoopStep>(
+          tp, stream, WilsonLoopArg<Float, nColor, recon>(u, out, in, in2, out2, first, static_cast<double *>(loops)));
+        break;
+      }
+    }
+
+    long long flops() const
+    {
+      auto mm_flops = 8ll * nColor * nColor * nColor - 2ll * nColor * nColor;
+      switch (step) {
+      case LineStep::polyakov: return (first ? 0 : mm_flops) * u.LocalVolume();
+      case LineStep::spatial: return 3 * (first ? 0 : mm_flops) * u.LocalVolume();
+      case LineStep::wilson: return 3 * (3 * mm_flops + 2 * nColor) * u.LocalVolume();
+      default: return 0;
+      }
+    }
+
+    long long bytes() const
+    {
+      auto link = u.Reconstruct() * u.Precision();
+      auto line = 2 * nColor * nColor * out.Precision();
+      switch (step) {
+      case LineStep::polyakov: return (link + (first ? 1 : 2) * line) * u.LocalVolume();
+      case LineStep::spatial: return 3 * (2 * link + (first ? 2 : 4) * line) * u.LocalVolume();
+      case LineStep::wilson: return (link + 3 * 4 * line + sizeof(double)) * u.LocalVolume();
+      default: return 0;
+      }
+    }
+  };
+
+  template <typename Float, int nColor, QudaReconstructType recon> class PolyakovTraceReduce : TunableReduction2D<>
+  {
+    const GaugeField &q;
+    std::vector<double> &ploop;
+    void *density;
+    const double sign;
+
+  public:
+    PolyakovTraceReduce(const GaugeField &q, std::vector<double> &ploop, void *density, double sign) :
+      TunableReduction2D(q),
+      q(q),
+      ploop(ploop),
+      density(density),
+      sign(sign)
+    {
+      strcat(aux, density ? ",density" : "");
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      PolyakovTraceArg<Float, nColor, recon> arg(q, static_cast<complex<double> *>(density), sign);
+      launch<PolyakovTrace>(ploop, tp, stream, arg);
+    }
+
+    long long flops() const { return 2 * nColor * q.LocalVolume(); }
+    long long bytes() const
+    {
+      return (2 * nColor * nColor * q.Precision()) * q.LocalVolume()
+        + (density ? 2 * sizeof(double) * q.LocalVolume() / q.LocalX()[3] : 0);
+    }
+  };
+
+  class LoopSumReduce : TunableMultiReduction<1>
+  {
+    using Arg = LoopSumArg;
+    std::vector<double> &result;
+    const double *loops;
+    unsigned int volume;
+
+    bool tuneSharedBytes() const { return false; }
+
+  public:
+    LoopSumReduce(const GaugeField &u, std::vector<double> &result, const double *loops) :
+      TunableMultiReduction(u.LocalVolume(), result.size(), Arg::max_n_batch_block, u.Location()),
+      result(result),
+      loops(loops),
+      volume(u.LocalVolume())
+    {
+      char aux2[TuneKey::aux_n];
+      strcpy(aux2, "batch_size=");
+      u32toa(aux2 + 11, result.size());
+      strcat(aux, aux2);
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      Arg arg(loops, volume, result.size());
+      launch<LoopSum, double, comm_reduce_sum<double>>(result, tp, stream, arg);
+    }
+
+    long long flops() const { return result.size() * volume; }
+    long long bytes() const { return result.size() * volume * sizeof(double); }
+  };
+
+  /**
+     Parameters for the extended line fields, which are stored
+     unreconstructed with the same border as the gauge field
+   */
+  static GaugeFieldParam lineParam(const GaugeField &u)
+  {
+    GaugeFieldParam param(u);
+    param.reconstruct = QUDA_RECONSTRUCT_NO;
+    param.link_type = QUDA_GENERAL_LINKS;
+    param.create = QUDA_NULL_FIELD_CREATE;
+    param.setPrecision(u.Precision(), true);
+    return param;
+  }
+
+  static void checkLoopField(const GaugeField &u)
+  {
+    if (u.Location() != QUDA_CUDA_FIELD_LOCATION) errorQuda("Only device fields are supported");
+    if (u.GhostExchange() != QUDA_GHOST_EXCHANGE_EXTENDED) errorQuda("Extended gauge field expected");
+    // the line products are formed in the storage type, so fixed point is not supported
+    if (u.Precision() < QUDA_SINGLE_PRECISION) errorQuda("Fixed-point precision %d not supported", u.Precision());
+    for (int d = 0; d < 4; d++)
+      if (comm_dim_partitioned(d) && u.R()[d] < 1) errorQuda("Border %d in partitioned dimension %d", u.R()[d], d);
+  }
+
+  void polyakovLoop(double ploop[2], void *density, const GaugeField &u)
+  {
+    checkLoopField(u);
+    auto param = lineParam(u);
+    std::unique_ptr<GaugeField> q[2] = {std::unique_ptr<GaugeField>(GaugeField::Create(param)),
+                                        std::unique_ptr<GaugeField>(GaugeField::Create(param))};
+
+    // extend the temporal line by one link per step until it wraps around the lattice
+    const int n_t = u.LocalX()[3] * comm_dim(3);
+    for (int t = 0; t < n_t; t++) {
+      auto &out = *q[(t + 1) % 2];
+      auto &in = *q[t % 2];
+      instantiate<GaugeLine>(u, out, in, out, in, LineStep::polyakov, t == 0, nullptr);
+      out.exchangeExtendedGhost(out.R(), false);
+    }
+
+    // an anti-periodic temporal boundary flips the sign of every loop that wraps in time
+    double sign = u.TBoundary() == QUDA_ANTI_PERIODIC_T ? -1.0 : 1.0;
+    std::vector<double> result {0.0, 0.0};
+    instantiate<PolyakovTraceReduce, ReconstructNone>(*q[n_t % 2], result, density, sign);
+
+    const double volume = static_cast<double>(u.LocalVolume()) * comm_size();
+    ploop[0] = result[0] / (u.Ncolor() * volume);
+    ploop[1] = result[1] / (u.Ncolor() * volume);
+  }
+
+  void wilsonLoops(std::vector<double> &loops, const GaugeField &u, int r_max, int t_max)
+  {
+    checkLoopField(u);
+    if (r_max < 1 || t_max < 1) errorQuda("Invalid loop extents r_max = %d, t_max = %d", r_max, t_max);
+    loops.resize(r_max * t_max);
+
+    auto param = lineParam(u);
+    auto create = [&]() { return std::unique_ptr<GaugeField>(GaugeField::Create(param)); };
+    std::unique_ptr<GaugeField> s[2] = {create(), create()}; // spatial lines
+    std::unique_ptr<GaugeField> v[2] = {create(), create()}; // temporal links at the end of the spatial lines
+    std::unique_ptr<GaugeField> d[2] = {create(), create()}; // open loops
+
+    // per-site traces for all temporal extents at a given spatial extent, accumulated in double
+    const size_t volume = u.LocalVolume();
+    auto *trace = static_cast<double *>(pool_device_malloc(t_max * volume * sizeof(double)));
+
+    for (int r = 0; r < r_max; r++) {
+      auto &s_out = *s[(r + 1) % 2];
+      auto &v_out = *v[(r + 1) % 2];
+      instantiate<GaugeLine>(u, s_out, *s[r % 2], v_out, *v[r % 2], LineStep::spatial, r == 0, nullptr);
+      s_out.exchangeExtendedGhost(s_out.R(), false);
+      v_out.exchangeExtendedGhost(v_out.R(), false);
+
+      for (int t = 0; t < t_max; t++) {
+        auto &d_out = *d[(t + 1) % 2];
+        auto *trace_t = trace + t * volume;
+        instantiate<GaugeLine>(u, d_out, *d[t % 2], v_out, s_out, LineStep::wilson, t == 0, trace_t);
+        if (t < t_max - 1) d_out.exchangeExtendedGhost(d_out.R(), false);
+      }
+
+      // sum all temporal extents in a single batched reduction
+      std::vector<double> sum(t_max);
+      LoopSumReduce(u, sum, trace);
+
+      // normalize by the number of spatial orientations, the number of colors and the global volume
+      for (int t = 0; t < t_max; t++) loops[r * t_max + t] = sum[t] / (3 * u.Ncolor() * volume * comm_size());
+    }
+
+    pool_device_free(trace);
+  }
+
+} // namespace quda
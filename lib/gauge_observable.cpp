@@ -17,7 +17,9 @@ namespace quda
       pool_pinned_free(num_failures_h);
     }
 
-    if (param.compute_plaquette) {
+    // the plaquette kernel alone is cheaper than the fused clover-leaf pass
+    if (param.compute_plaquette && !param.compute_qcharge && !param.compute_qcharge_density
+        && !param.compute_rectangle) {
       double3 plaq = plaquette(u);
       param.plaquette[0] = plaq.x;
       param.plaquette[1] = plaq.y;
@@ -25,53 +27,30 @@ namespace quda
     }
     profile.TPSTOP(QUDA_PROFILE_COMPUTE);
 
-    // no point constructing Fmunu unless we are going to use it
-    if (!param.compute_qcharge && !param.compute_qcharge_density) return;
+    if (!param.compute_qcharge && !param.compute_qcharge_density && !param.compute_rectangle) return;
 
-    // create the Fmunu field
     profile.TPSTART(QUDA_PROFILE_INIT);
-    // u is an extended field we need to shrink for the Fmunu field
-    int x[4];
-    for (int i = 0; i < 4; i++) x[i] = u.X()[i] - 2 * u.R()[i];
-    GaugeFieldParam tensorParam(x, u.Precision(), QUDA_RECONSTRUCT_NO, 0, QUDA_TENSOR_GEOMETRY);
-    tensorParam.siteSubset = QUDA_FULL_SITE_SUBSET;
-    tensorParam.order = QUDA_FLOAT2_GAUGE_ORDER;
-    tensorParam.ghostExchange = QUDA_GHOST_EXCHANGE_NO;
-    cudaGaugeField gaugeFmunu(tensorParam);
+    if (param.compute_qcharge_density && !param.qcharge_density)
+      errorQuda("Charge density requested, but destination field not defined");
+    // the density is written directly for host fields, else staged through device memory
+    const bool stage = param.compute_qcharge_density && u.Location() == QUDA_CUDA_FIELD_LOCATION;
+    size_t size = u.LocalVolume() * u.Precision();
+    void *qDensity = stage ? pool_device_malloc(size) : param.qcharge_density;
     profile.TPSTOP(QUDA_PROFILE_INIT);
 
+    // plaquette, energy, charge and optionally rectangle and density in one pass
     profile.TPSTART(QUDA_PROFILE_COMPUTE);
-    computeFmunu(gaugeFmunu, u);
+    gaugeObservablesFused(u, param, qDensity);
     profile.TPSTOP(QUDA_PROFILE_COMPUTE);
-    profile.TPSTOP(QUDA_PROFILE_TOTAL);
 
-    if (param.compute_qcharge || param.compute_qcharge_density) {
-      profile.TPSTART(QUDA_PROFILE_TOTAL);
-      profile.TPSTART(QUDA_PROFILE_INIT);
-      if (param.compute_qcharge_density && !param.qcharge_density)
-        errorQuda("Charge density requested, but destination field not defined");
-      size_t size = gaugeFmunu.Volume() * gaugeFmunu.Precision();
-      void *d_qDensity = param.compute_qcharge_density ? pool_device_malloc(size) : nullptr;
-      profile.TPSTOP(QUDA_PROFILE_INIT);
+    if (stage) {
+      profile.TPSTART(QUDA_PROFILE_D2H);
+      qudaMemcpy(param.qcharge_density, qDensity, size, qudaMemcpyDeviceToHost);
+      profile.TPSTOP(QUDA_PROFILE_D2H);
 
-      profile.TPSTART(QUDA_PROFILE_COMPUTE);
-
-      if (param.compute_qcharge_density)
-        computeQChargeDensity(param.energy, param.qcharge, d_qDensity, gaugeFmunu);
-      else
-        computeQCharge(param.energy, param.qcharge, gaugeFmunu);
-
-      profile.TPSTOP(QUDA_PROFILE_COMPUTE);
-
-      if (param.compute_qcharge_density) {
-        profile.TPSTART(QUDA_PROFILE_D2H);
-        qudaMemcpy(param.qcharge_density, d_qDensity, size, qudaMemcpyDeviceToHost);
-        profile.TPSTOP(QUDA_PROFILE_D2H);
-
-        profile.TPSTART(QUDA_PROFILE_FREE);
-        pool_device_free(d_qDensity);
-        profile.TPSTOP(QUDA_PROFILE_FREE);
-      }
+      profile.TPSTART(QUDA_PROFILE_FREE);
+      pool_device_free(qDensity);
+      profile.TPSTOP(QUDA_PROFILE_FREE);
     }
   }
 
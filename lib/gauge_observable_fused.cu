@@ -0,0 +1,97 @@
+#include <gauge_field.h>
+#include <gauge_tools.h>
+#include <instantiate.h>
+#include <tunable_reduction.h>
+#include <kernels/gauge_observable_fused.cuh>
+
+namespace quda
+{
+
+  template <typename Float, int nColor, QudaReconstructType recon>
+  class GaugeObservable : TunableReduction2D<> {
+    const GaugeField &u;
+    QudaGaugeObservableParam &param;
+    void *qdensity;
+    const bool density;
+    const bool rect;
+
+    template <bool density, bool rect> using Arg = GaugeObservableArg<Float, nColor, recon, density, rect>;
+
+  public:
+    GaugeObservable(const GaugeField &u, QudaGaugeObservableParam &param, void *qdensity) :
+      TunableReduction2D(u),
+      u(u),
+      param(param),
+      qdensity(qdensity),
+      density(param.compute_qcharge_density),
+      rect(param.compute_rectangle)
+    {
+      if (density) strcat(aux, ",density");
+      if (rect) strcat(aux, ",rectangle");
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+
+      std::vector<double> obs(OBS_N);
+      if (density && rect) {
+        Arg<true, true> arg(u, static_cast<Float *>(qdensity));
+        launch<GaugeObservableFused, double, comm_reduce_sum<double>, true>(obs, tp, stream, arg);
+      } else if (density) {
+        Arg<true, false> arg(u, static_cast<Float *>(qdensity));
+        launch<GaugeObservableFused, double, comm_reduce_sum<double>, true>(obs, tp, stream, arg);
+      } else if (rect) {
+        Arg<false, true> arg(u, nullptr);
+        launch<GaugeObservableFused, double, comm_reduce_sum<double>, true>(obs, tp, stream, arg);
+      } else {
+        Arg<false, false> arg(u, nullptr);
+        launch<GaugeObservableFused, double, comm_reduce_sum<double>, true>(obs, tp, stream, arg);
+      }
+
+      // normalize by the number of loops per site, the number of colors and the global volume
+      const double volume = static_cast<double>(u.LocalVolume()) * comm_size();
+      param.plaquette[1] = obs[OBS_PLAQ_SPATIAL] / (3 * nColor * volume);
+      param.plaquette[2] = obs[OBS_PLAQ_TEMPORAL] / (3 * nColor * volume);
+      param.plaquette[0] = 0.5 * (param.plaquette[1] + param.plaquette[2]);
+
+      param.energy[1] = obs[OBS_ENERGY_SPATIAL] / volume;
+      param.energy[2] = obs[OBS_ENERGY_TEMPORAL] / volume;
+      param.energy[0] = param.energy[1] + param.energy[2];
+      param.qcharge = obs[OBS_QCHARGE];
+
+      if (rect) {
+        param.rectangle[1] = obs[OBS_RECT_SPATIAL] / (6 * nColor * volume);
+        param.rectangle[2] = obs[OBS_RECT_TEMPORAL] / (6 * nColor * volume);
+        param.rectangle[0] = 0.5 * (param.rectangle[1] + param.rectangle[2]);
+      }
+    }
+
+    long long flops() const
+    {
+      auto Nc = u.Ncolor();
+      auto mm_flops = 8 * Nc * Nc * Nc - 2 * Nc * Nc;
+      auto fmunu_flops = 6 * (12 * mm_flops + 3 * 2 * Nc * Nc + 4 * Nc * Nc);
+      auto traceless_flops = (Nc * Nc + Nc + 1);
+      auto energy_flops = 6 * (mm_flops + traceless_flops + Nc);
+      auto q_flops = 3 * mm_flops + 2 * Nc + 2;
+      auto rect_flops = rect ? 12 * (5 * mm_flops + Nc) : 0;
+      return u.LocalVolume() * (fmunu_flops + energy_flops + q_flops + rect_flops);
+    }
+
+    long long bytes() const
+    {
+      // each link is read once per site, ignoring cache reuse across neighbors
+      auto links = 6 * 16 + (rect ? 12 * 6 : 0);
+      return u.LocalVolume() * (links * u.Bytes() / (4 * u.Volume()) + density * u.Precision());
+    }
+  };
+
+  void gaugeObservablesFused(const GaugeField &u, QudaGaugeObservableParam &param, void *qdensity)
+  {
+    if (param.compute_qcharge_density && !qdensity) errorQuda("Charge density requested, but no destination given");
+    instantiate<GaugeObservable>(u, param, qdensity);
+  }
+
+} // namespace quda
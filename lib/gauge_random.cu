@@ -36,9 +36,9 @@ namespace quda {
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
       if (group) {
-        launch<GaussGauge>(tp, stream, GaugeGaussArg<Float, nColor, recon, true>(U, rng.State(), sigma));
+        launch<GaussGauge>(tp, stream, GaugeGaussArg<Float, nColor, recon, true>(U, rng.Key(U), sigma));
       } else {
-        launch<GaussGauge>(tp, stream, GaugeGaussArg<Float, nColor, recon, false>(U, rng.State(), sigma));
+        launch<GaussGauge>(tp, stream, GaugeGaussArg<Float, nColor, recon, false>(U, rng.Key(U), sigma));
       }
     }
 
@@ -55,7 +55,11 @@ namespace quda {
     if (U.LinkType() != QUDA_SU3_LINKS && U.LinkType() != QUDA_MOMENTUM_LINKS)
       errorQuda("Unexpected link type %d", U.LinkType());
 
-    instantiate<GaugeGauss, ReconstructFull>(U, rng, sigma);
+    // momentum fields are usually stored in the compressed anti-Hermitian form
+    if (U.Reconstruct() == QUDA_RECONSTRUCT_10)
+      instantiate<GaugeGauss, Reconstruct10>(U, rng, sigma);
+    else
+      instantiate<GaugeGauss, ReconstructFull>(U, rng, sigma);
 
     // ensure multi-gpu consistency if required
     if (U.GhostExchange() == QUDA_GHOST_EXCHANGE_EXTENDED) {
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <gauge_field.h>
+#include <gauge_update_quda.h>
 #include <tunable_nd.h>
 #include <instantiate.h>
 #include <kernels/gauge_update.cuh>
@@ -57,6 +59,8 @@ namespace quda {
     }
 
     long long bytes() const { return in.Bytes() + out.Bytes() + mom.Bytes(); }
+    void preTune() { if (out.Gauge_p() == in.Gauge_p()) out.backup(); }
+    void postTune() { if (out.Gauge_p() == in.Gauge_p()) out.restore(); }
   };
 
 #ifdef GPU_GAUGE_TOOLS
@@ -75,4 +79,140 @@ namespace quda {
   }
 #endif
 
+  template <typename Float, int nColor, QudaReconstructType recon_u>
+  class UpdateGaugeFieldExp : public TunableKernel3D {
+    using real = typename mapper<Float>::type;
+    static constexpr QudaReconstructType recon_m = QUDA_RECONSTRUCT_10;
+    GaugeField &out;
+    const GaugeField &in;
+    const GaugeField &mom;
+    const GaugeField &force;
+    const real a;
+    const real b;
+    const bool conj_mom;
+    const ExpCache cache;
+    real *exp_param;
+    template <bool conj_mom, bool use_force, ExpCache cache> using Arg =
+      UpdateGaugeExpArg<Float, nColor, recon_u, recon_m, conj_mom, use_force, cache>;
+
+    unsigned int minThreads() const { return in.VolumeCB(); }
+
+    template <bool conj, bool use_force, ExpCache cache_mode>
+    void launchExp(const TuneParam &tp, const qudaStream_t &stream)
+    {
+      launch<UpdateGaugeExp>(tp, stream, Arg<conj, use_force, cache_mode>(out, in, mom, force, a, b, exp_param));
+    }
+
+    template <bool conj> void launchExp(const TuneParam &tp, const qudaStream_t &stream)
+    {
+      if (b != 0.0) {
+        launchExp<conj, true, ExpCache::none>(tp, stream);
+        return;
+      }
+      switch (cache) {
+      case ExpCache::none: launchExp<conj, false, ExpCache::none>(tp, stream); break;
+      case ExpCache::write: launchExp<conj, false, ExpCache::write>(tp, stream); break;
+      case ExpCache::read: launchExp<conj, false, ExpCache::read>(tp, stream); break;
+      }
+    }
+
+  public:
+    UpdateGaugeFieldExp(GaugeField &out, const GaugeField &in, const GaugeField &mom, const GaugeField &force,
+                        double a, double b, bool conj_mom, ExpCache cache, void *exp_param) :
+      TunableKernel3D(in, 2, in.Geometry()),
+      out(out),
+      in(in),
+      mom(mom),
+      force(force),
+      a(static_cast<real>(a)),
+      b(static_cast<real>(b)),
+      conj_mom(conj_mom),
+      cache(cache),
+      exp_param(static_cast<real *>(exp_param))
+    {
+      if (conj_mom) strcat(aux, ",conj_mom");
+      if (b != 0.0) strcat(aux, ",force");
+      if (cache == ExpCache::write) strcat(aux, ",cache=write");
+      if (cache == ExpCache::read) strcat(aux, ",cache=read");
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      if (conj_mom) launchExp<true>(tp, stream);
+      else          launchExp<false>(tp, stream);
+    }
+
+    long long flops() const
+    {
+      // exponent, its parameters, the exponential from the parameters, and the product with the link
+      const long long exponent = b != 0.0 ? 54 : 18;
+      const long long param = cache == ExpCache::read ? 0 : 246;
+      return in.Geometry() * in.Volume() * (exponent + param + 2 * 198 + 60 + 198);
+    }
+
+    long long bytes() const
+    {
+      long long param_bytes = cache == ExpCache::none ? 0 : 2 * in.Geometry() * in.Volume() * sizeof(real);
+      long long mom_bytes = b != 0.0 && a == 0.0 ? 0 : mom.Bytes();
+      return in.Bytes() + out.Bytes() + mom_bytes + (b != 0.0 ? force.Bytes() : 0) + param_bytes;
+    }
+
+    void preTune() { if (out.Gauge_p() == in.Gauge_p()) out.backup(); }
+    void postTune() { if (out.Gauge_p() == in.Gauge_p()) out.restore(); }
+  };
+
+  GaugeUpdateCache::~GaugeUpdateCache()
+  {
+    if (exp_param) pool_device_free(exp_param);
+  }
+
+#ifdef GPU_GAUGE_TOOLS
+  void updateGaugeField(GaugeField &out, double a, const GaugeField &in, const GaugeField &mom, double b,
+                        const GaugeField &force, bool conj_mom)
+  {
+    checkPrecision(out, in, mom, force);
+    checkLocation(out, in, mom, force);
+    checkReconstruct(out, in);
+    if (mom.Reconstruct() != QUDA_RECONSTRUCT_10 || force.Reconstruct() != QUDA_RECONSTRUCT_10)
+      errorQuda("Reconstruction types %d %d not supported", mom.Reconstruct(), force.Reconstruct());
+    instantiate<UpdateGaugeFieldExp, ReconstructNo12>(out, in, mom, force, a, b, conj_mom, ExpCache::none, nullptr);
+  }
+
+  void updateGaugeField(GaugeField &out, double dt, const GaugeField &in, const GaugeField &mom,
+                        GaugeUpdateCache &cache, bool conj_mom)
+  {
+    checkPrecision(out, in, mom);
+    checkLocation(out, in, mom);
+    checkReconstruct(out, in);
+    if (mom.Reconstruct() != QUDA_RECONSTRUCT_10) errorQuda("Reconstruction type %d not supported", mom.Reconstruct());
+    if (dt == 0.0) errorQuda("Step size must be non-zero");
+
+    // parameters are computed in at least single precision
+    size_t bytes = 2 * mom.Geometry() * mom.Volume() * std::max(mom.Precision(), QUDA_SINGLE_PRECISION);
+    bool valid = cache.mom == &mom && cache.conj_mom == conj_mom && cache.bytes >= bytes;
+    if (cache.bytes < bytes) {
+      if (cache.exp_param) pool_device_free(cache.exp_param);
+      cache.exp_param = pool_device_malloc(bytes);
+      cache.bytes = bytes;
+    }
+
+    instantiate<UpdateGaugeFieldExp, ReconstructNo12>(out, in, mom, mom, dt, 0.0, conj_mom,
+                                                      valid ? ExpCache::read : ExpCache::write, cache.exp_param);
+    cache.mom = &mom;
+    cache.conj_mom = conj_mom;
+  }
+#else
+  void updateGaugeField(GaugeField &, double, const GaugeField &, const GaugeField &, double, const GaugeField &, bool)
+  {
+    errorQuda("Gauge tools are not build");
+  }
+
+  void updateGaugeField(GaugeField &, double, const GaugeField &, const GaugeField &, GaugeUpdateCache &, bool)
+  {
+    errorQuda("Gauge tools are not build");
+  }
+#endif
+
 } // namespace quda
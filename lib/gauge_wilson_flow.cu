@@ -1,6 +1,7 @@
 #include <quda_internal.h>
 #include <gauge_field.h>
 #include <tunable_nd.h>
+#include <tunable_reduction.h>
 #include <kernels/gauge_wilson_flow.cuh>
 #include <instantiate.h>
 
@@ -13,6 +14,7 @@ namespace quda {
     GaugeField &out;
     GaugeField &temp;
     const GaugeField &in;
+    GaugeField *err;
     const real epsilon;
     const QudaWFlowType wflow_type;
     const WFlowStepType step_type;
@@ -24,11 +26,13 @@ namespace quda {
     int blockMin() const { return 8; }
 
   public:
-    GaugeWFlowStep(GaugeField &out, GaugeField &temp, const GaugeField &in, const double epsilon, const QudaWFlowType wflow_type, const WFlowStepType step_type) :
+    GaugeWFlowStep(GaugeField &out, GaugeField &temp, const GaugeField &in, const double epsilon,
+                   const QudaWFlowType wflow_type, const WFlowStepType step_type, GaugeField *err) :
       TunableKernel3D(in, 2, wflow_dim),
       out(out),
       temp(temp),
       in(in),
+      err(err),
       epsilon(epsilon),
       wflow_type(wflow_type),
       step_type(step_type)
@@ -45,6 +49,7 @@ namespace quda {
       case WFLOW_STEP_VT: strcat(aux, "_VT"); break;
       default : errorQuda("Unknown Wilson Flow step type %d", step_type);
       }
+      if (err && step_type == WFLOW_STEP_W2) strcat(aux, ",err");
 
       apply(device::get_default_stream());
     }
@@ -60,26 +65,26 @@ namespace quda {
       case QUDA_WFLOW_TYPE_WILSON:
         switch (step_type) {
         case WFLOW_STEP_W1:
-          launch<WFlow>(tp, stream, Arg<QUDA_WFLOW_TYPE_WILSON, WFLOW_STEP_W1>(out, temp, in, epsilon));
+          launch<WFlow>(tp, stream, Arg<QUDA_WFLOW_TYPE_WILSON, WFLOW_STEP_W1>(out, temp, in, epsilon, err));
           break;
         case WFLOW_STEP_W2:
-          launch<WFlow>(tp, stream, Arg<QUDA_WFLOW_TYPE_WILSON, WFLOW_STEP_W2>(out, temp, in, epsilon));
+          launch<WFlow>(tp, stream, Arg<QUDA_WFLOW_TYPE_WILSON, WFLOW_STEP_W2>(out, temp, in, epsilon, err));
           break;
         case WFLOW_STEP_VT:
-          launch<WFlow>(tp, stream, Arg<QUDA_WFLOW_TYPE_WILSON, WFLOW_STEP_VT>(out, temp, in, epsilon));
+          launch<WFlow>(tp, stream, Arg<QUDA_WFLOW_TYPE_WILSON, WFLOW_STEP_VT>(out, temp, in, epsilon, err));
           break;
         }
         break;
       case QUDA_WFLOW_TYPE_SYMANZIK:
         switch (step_type) {
         case WFLOW_STEP_W1:
-          launch<WFlow>(tp, stream, Arg<QUDA_WFLOW_TYPE_SYMANZIK, WFLOW_STEP_W1>(out, temp, in, epsilon));
+          launch<WFlow>(tp, stream, Arg<QUDA_WFLOW_TYPE_SYMANZIK, WFLOW_STEP_W1>(out, temp, in, epsilon, err));
           break;
         case WFLOW_STEP_W2:
-          launch<WFlow>(tp, stream, Arg<QUDA_WFLOW_TYPE_SYMANZIK, WFLOW_STEP_W2>(out, temp, in, epsilon));
+          launch<WFlow>(tp, stream, Arg<QUDA_WFLOW_TYPE_SYMANZIK, WFLOW_STEP_W2>(out, temp, in, epsilon, err));
           break;
         case WFLOW_STEP_VT:
-          launch<WFlow>(tp, stream, Arg<QUDA_WFLOW_TYPE_SYMANZIK, WFLOW_STEP_VT>(out, temp, in, epsilon));
+          launch<WFlow>(tp, stream, Arg<QUDA_WFLOW_TYPE_SYMANZIK, WFLOW_STEP_VT>(out, temp, in, epsilon, err));
           break;
         }
         break;
@@ -87,8 +92,19 @@ namespace quda {
       }
     }
 
-    void preTune() { out.backup(); temp.backup(); }
-    void postTune() { out.restore(); temp.restore(); }
+    void preTune()
+    {
+      out.backup();
+      temp.backup();
+      if (err) err->backup();
+    }
+
+    void postTune()
+    {
+      out.restore();
+      temp.restore();
+      if (err) err->restore();
+    }
 
     long long flops() const
     {
@@ -112,36 +128,78 @@ namespace quda {
       case QUDA_WFLOW_TYPE_SYMANZIK: links = 24; break;
       default : errorQuda("Unknown Wilson Flow type");
       }
-      auto temp_io = step_type == WFLOW_STEP_W2 ? 2 : step_type == WFLOW_STEP_VT ? 1 : 0;
+      auto temp_io = step_type == WFLOW_STEP_W2 ? (err ? 3 : 2) : step_type == WFLOW_STEP_VT ? 1 : 0;
       return ((1 + (wflow_dim - 1) * links) * in.Bytes() + out.Bytes() + temp_io * temp.Bytes());
     }
   }; // GaugeWFlowStep
 
+  template <typename Float, int nColor, QudaReconstructType recon> class GaugeWFlowError : TunableReduction2D<>
+  {
+    const GaugeField &out;
+    const GaugeField &in;
+    const GaugeField &err;
+    const double epsilon;
+    double &dist;
+
+  public:
+    GaugeWFlowError(const GaugeField &out, const GaugeField &in, const GaugeField &err, double epsilon, double &dist) :
+      TunableReduction2D(in),
+      out(out),
+      in(in),
+      err(err),
+      epsilon(epsilon),
+      dist(dist)
+    {
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      WFlowErrorArg<Float, nColor, recon> arg(out, in, err, epsilon);
+      launch<WFlowError, double, comm_reduce_max<double>>(dist, tp, stream, arg);
+    }
+
+    long long flops() const { return 4ll * in.LocalVolume() * 2 * nColor * nColor * (8 * nColor - 2); }
+    long long bytes() const { return out.Bytes() + in.Bytes() + err.Bytes(); }
+  };
+
 #ifdef GPU_GAUGE_TOOLS
-  void WFlowStep(GaugeField &out, GaugeField &temp, GaugeField &in, const double epsilon, const QudaWFlowType wflow_type)
+  double WFlowStep(GaugeField &out, GaugeField &temp, GaugeField &in, const double epsilon,
+                   const QudaWFlowType wflow_type, GaugeField *err)
   {
     checkPrecision(out, temp, in);
     checkReconstruct(out, in);
     checkNative(out, in);
     if (temp.Reconstruct() != QUDA_RECONSTRUCT_NO) errorQuda("Temporary vector must not use reconstruct");
+    if (err) {
+      checkPrecision(*err, temp);
+      if (err->Reconstruct() != QUDA_RECONSTRUCT_NO) errorQuda("Error estimate field must not use reconstruct");
+    }
 
     // Set each step type as an arg parameter, update halos if needed
     // Step W1
-    instantiate<GaugeWFlowStep,WilsonReconstruct>(out, temp, in, epsilon, wflow_type, WFLOW_STEP_W1);
+    instantiate<GaugeWFlowStep,WilsonReconstruct>(out, temp, in, epsilon, wflow_type, WFLOW_STEP_W1, err);
     out.exchangeExtendedGhost(out.R(), false);
 
     // Step W2
-    instantiate<GaugeWFlowStep,WilsonReconstruct>(in, temp, out, epsilon, wflow_type, WFLOW_STEP_W2);
+    instantiate<GaugeWFlowStep,WilsonReconstruct>(in, temp, out, epsilon, wflow_type, WFLOW_STEP_W2, err);
     in.exchangeExtendedGhost(in.R(), false);
 
     // Step Vt
-    instantiate<GaugeWFlowStep,WilsonReconstruct>(out, temp, in, epsilon, wflow_type, WFLOW_STEP_VT);
+    instantiate<GaugeWFlowStep,WilsonReconstruct>(out, temp, in, epsilon, wflow_type, WFLOW_STEP_VT, err);
     out.exchangeExtendedGhost(out.R(), false);
+
+    // Compare against the embedded second-order step, using W2 which is still in the input field
+    double dist = 0.0;
+    if (err) instantiate<GaugeWFlowError,WilsonReconstruct>(out, in, *err, epsilon, dist);
+    return dist;
   }
 #else
-  void WFlowStep(GaugeField &, GaugeField &, GaugeField &, const double, const QudaWFlowType)
+  double WFlowStep(GaugeField &, GaugeField &, GaugeField &, const double, const QudaWFlowType, GaugeField *)
   {
     errorQuda("Gauge tools are not built");
+    return 0.0;
   }
 #endif
 
@@ -0,0 +1,450 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <comm_quda.h>
+#include <hmc_integrator.h>
+#include <gauge_force_quda.h>
+#include <gauge_update_quda.h>
+#include <gauge_tools.h>
+#include <invert_quda.h>
+#include <momentum.h>
+
+namespace quda
+{
+
+  namespace
+  {
+
+    constexpr int flip(int dir) { return 7 - dir; }
+
+    /**
+       Scheme of a single step: the momentum updates (kick), gauge
+       updates (drift) and force-gradient momentum updates, in units
+       of the step size.  The first and last operations are plain
+       momentum updates so that they can be merged between steps.
+     */
+    enum step_op { KICK, DRIFT, KICK_FG };
+
+    struct step_scheme {
+      std::vector<step_op> op;
+      std::vector<double> coeff;
+    };
+
+    step_scheme getScheme(QudaHMCIntegratorType type, double lambda)
+    {
+      switch (type) {
+      case QUDA_HMC_LEAPFROG: return {{KICK, DRIFT, KICK}, {0.5, 1.0, 0.5}};
+      case QUDA_HMC_OMELYAN:
+        return {{KICK, DRIFT, KICK, DRIFT, KICK}, {lambda, 0.5, 1.0 - 2.0 * lambda, 0.5, lambda}};
+      case QUDA_HMC_FORCE_GRADIENT:
+        return {{KICK, DRIFT, KICK_FG, DRIFT, KICK}, {1.0 / 6.0, 0.5, 2.0 / 3.0, 0.5, 1.0 / 6.0}};
+      default: errorQuda("Unknown integrator %d", type);
+      }
+      return {};
+    }
+
+    /**
+       @brief Derive the momentum seed of a given trajectory, so that
+       consecutive trajectories with the same base seed draw
+       independent momenta.  The trajectory number is mixed in with
+       the splitmix64 finalizer, so nearby seeds and trajectories map
+       to unrelated streams.
+       @param[in] seed The base seed
+       @param[in] trajectory The trajectory number
+       @return The seed of the trajectory's momentum heat-bath
+     */
+    unsigned long long momentumSeed(unsigned long long seed, int trajectory)
+    {
+      unsigned long long z = seed + (static_cast<unsigned long long>(trajectory) + 1) * 0x9e3779b97f4a7c15ull;
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+      return z ^ (z >> 31);
+    }
+
+    std::vector<QudaHMCTelemetry> telemetry_history;
+    int telemetry_trajectories = 0;
+
+  } // namespace
+
+  std::vector<QudaHMCTelemetry> &hmcTelemetryHistory() { return telemetry_history; }
+
+  HMCIntegrator::HMCIntegrator(QudaHMCParam &param, GaugeField &u, GaugeField &u_ex, GaugeField &mom,
+                               const std::function<void(const GaugeField &)> &gauge_updated, TimeProfile &profile) :
+    param(param),
+    u(u),
+    u_ex(u_ex),
+    mom(mom),
+    gauge_updated(gauge_updated),
+    profile(profile),
+    telemetry(param.telemetry == QUDA_BOOLEAN_TRUE)
+  {
+    profile.TPSTART(QUDA_PROFILE_INIT);
+
+    // merge the gauge terms on each level into a single set of paths
+    double c0[QUDA_MAX_HMC_LEVEL] = {};
+    double c1[QUDA_MAX_HMC_LEVEL] = {};
+    for (int l = 0; l < param.n_level; l++) n_term[l] = n_external[l] = 0;
+    for (int i = 0; i < param.n_term; i++) {
+      auto &t = param.term[i];
+      n_term[t.level]++;
+      if (t.type == QUDA_HMC_EXTERNAL_TERM) n_external[t.level]++;
+      if (t.type != QUDA_HMC_GAUGE_TERM) continue;
+      c0[t.level] += t.beta * (1.0 - 8.0 * t.c1) / 3.0;
+      c1[t.level] += t.beta * t.c1 / 3.0;
+      if (gauge_paths[t.level].name.empty()) gauge_paths[t.level].name = t.name ? t.name : "gauge";
+      if (gauge_paths[t.level].term < 0) gauge_paths[t.level].term = i;
+    }
+
+    for (int l = 0; l < param.n_level; l++) {
+      auto &p = gauge_paths[l];
+      if (c0[l] == 0.0 && c1[l] == 0.0) continue;
+
+      // six plaquette staples, and eighteen rectangle staples when needed
+      p.num_paths = c1[l] != 0.0 ? 24 : 6;
+      p.path.resize(4 * p.num_paths * 5);
+      p.path_ptr.resize(4 * p.num_paths);
+      for (int dir = 0; dir < 4; dir++) {
+        int n = 0;
+        for (int i = 0; i < 4; i++) {
+          if (i == dir) continue;
+          std::vector<std::vector<int>> staple = {{i, flip(dir), flip(i)}, {flip(i), flip(dir), i}};
+          if (c1[l] != 0.0) {
+            staple.push_back({i, i, flip(dir), flip(i), flip(i)});
+            staple.push_back({flip(i), flip(i), flip(dir), i, i});
+            staple.push_back({dir, i, flip(dir), flip(dir), flip(i)});
+            staple.push_back({dir, flip(i), flip(dir), flip(dir), i});
+            staple.push_back({i, flip(dir), flip(dir), flip(i), dir});
+            staple.push_back({flip(i), flip(dir), flip(dir), i, dir});
+          }
+          for (auto &s : staple) {
+            int *path = p.path.data() + (dir * p.num_paths + n) * 5;
+            std::copy(s.begin(), s.end(), path);
+            p.path_ptr[dir * p.num_paths + n] = path;
+            if (dir == 0) {
+              p.length.push_back(s.size());
+              p.coeff.push_back(s.size() == 3 ? c0[l] : c1[l]);
+            }
+            n++;
+          }
+        }
+        p.input_path[dir] = p.path_ptr.data() + dir * p.num_paths;
+      }
+    }
+
+    GaugeFieldParam u_param(u);
+    u_param.create = QUDA_NULL_FIELD_CREATE;
+    if (param.accept_reject) u_init = std::unique_ptr<GaugeField>(GaugeField::Create(u_param));
+
+    bool force_gradient = false;
+    for (int l = 0; l < param.n_level; l++)
+      force_gradient = force_gradient || param.integrator[l] == QUDA_HMC_FORCE_GRADIENT;
+    if (force_gradient) {
+      u_fg = std::unique_ptr<GaugeField>(GaugeField::Create(u_param));
+      GaugeFieldParam mom_param(mom);
+      mom_param.create = QUDA_NULL_FIELD_CREATE;
+      f_fg = std::unique_ptr<GaugeField>(GaugeField::Create(mom_param));
+    }
+
+    if (telemetry) {
+      GaugeFieldParam f_param(mom);
+      f_param.create = QUDA_NULL_FIELD_CREATE;
+      f_tel = std::unique_ptr<GaugeField>(GaugeField::Create(f_param));
+    }
+
+    profile.TPSTOP(QUDA_PROFILE_INIT);
+  }
+
+  double HMCIntegrator::action(bool init)
+  {
+    bool plaq = false, rect = false;
+    for (int i = 0; i < param.n_term; i++) {
+      if (param.term[i].type != QUDA_HMC_GAUGE_TERM) continue;
+      plaq = true;
+      rect = rect || param.term[i].c1 != 0.0;
+    }
+
+    QudaGaugeObservableParam obs = newQudaGaugeObservableParam();
+    if (plaq) {
+      obs.compute_plaquette = QUDA_BOOLEAN_TRUE;
+      obs.compute_rectangle = rect ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+      profile.TPSTART(QUDA_PROFILE_COMPUTE);
+      gaugeObservablesFused(u_ex, obs, nullptr);
+      profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+    }
+
+    // S = beta sum_x [c0 sum_plaq (1 - Re Tr P / 3) + c1 sum_rect (1 - Re Tr R / 3)]
+    const double volume = static_cast<double>(u.Volume()) * comm_size();
+    double total = 0.0;
+    for (int i = 0; i < param.n_term; i++) {
+      auto &t = param.term[i];
+      double s = 0.0;
+      if (t.type == QUDA_HMC_GAUGE_TERM) {
+        s = t.beta * volume * (6.0 * (1.0 - 8.0 * t.c1) * (1.0 - obs.plaquette[0]));
+        if (t.c1 != 0.0) s += t.beta * volume * 12.0 * t.c1 * (1.0 - obs.rectangle[0]);
+      } else {
+        profile.TPSTART(QUDA_PROFILE_COMPUTE);
+        s = t.action(&u, t.context);
+        profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+      }
+      (init ? t.action_init : t.action_final) = s;
+      total += s;
+    }
+    return total;
+  }
+
+  void HMCIntegrator::updateGauge(double dt)
+  {
+    profile.TPSTART(QUDA_PROFILE_COMPUTE);
+    updateGaugeField(u, dt, u, mom, false, true);
+    profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+    gauge_updated(u);
+  }
+
+  void HMCIntegrator::applyForce(GaugeField &p, int level, int term, double dt,
+                                 const std::function<void(GaugeField &, double)> &force)
+  {
+    if (!telemetry) {
+      profile.TPSTART(QUDA_PROFILE_COMPUTE);
+      force(p, dt);
+      profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+      return;
+    }
+
+    auto &t = param.term[term];
+    const char *name = t.type == QUDA_HMC_GAUGE_TERM ? gauge_paths[level].name.c_str() : (t.name ? t.name : "external");
+    const SolverCost cost = solverCost();
+    host_timer_t timer;
+    qudaDeviceSynchronize();
+    timer.start();
+
+    // compute the force on its own, measure it, and then apply it
+    profile.TPSTART(QUDA_PROFILE_COMPUTE);
+    f_tel->zero();
+    force(*f_tel, 1.0);
+    auto norm = computeForceNorm(*f_tel);
+    updateMomentum(p, dt, *f_tel, name);
+    profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+
+    qudaDeviceSynchronize();
+    timer.stop();
+
+    QudaHMCTelemetry rec;
+    rec.trajectory = trajectory_index;
+    rec.level = level;
+    rec.step = step[level];
+    rec.term = term;
+    rec.force_gradient = fg_stage;
+    rec.dt = dt;
+    rec.force_mean = norm[0];
+    rec.force_max = norm[1];
+    rec.solver_iter = solverCost().iter - cost.iter;
+    rec.solver_secs = solverCost().secs - cost.secs;
+    rec.secs = timer.last();
+    records.push_back(rec);
+
+    t.n_force++;
+    t.force_mean += rec.force_mean;
+    t.force_max = std::max(t.force_max, rec.force_max);
+    t.solver_iter += rec.solver_iter;
+    t.solver_secs += rec.solver_secs;
+    t.force_secs += rec.secs;
+  }
+
+  void HMCIntegrator::updateMom(GaugeField &p, int level, double dt)
+  {
+    auto &g = gauge_paths[level];
+    if (g.num_paths > 0) {
+      applyForce(p, level, g.term, dt, [&](GaugeField &f, double eps) {
+        if (!forceMonitor() || telemetry) {
+          gaugeForce(f, u_ex, eps, g.input_path, g.length.data(), g.coeff.data(), g.num_paths, 5);
+        } else {
+          // if we are monitoring the force, separate the force computation from the momentum update
+          GaugeFieldParam f_param(f);
+          f_param.create = QUDA_ZERO_FIELD_CREATE;
+          std::unique_ptr<GaugeField> force(GaugeField::Create(f_param));
+          gaugeForce(*force, u_ex, 1.0, g.input_path, g.length.data(), g.coeff.data(), g.num_paths, 5);
+          updateMomentum(f, eps, *force, g.name.c_str());
+        }
+      });
+    }
+
+    for (int i = 0; i < param.n_term; i++) {
+      auto &t = param.term[i];
+      if (t.level != level || t.type != QUDA_HMC_EXTERNAL_TERM) continue;
+      applyForce(p, level, i, dt, [&](GaugeField &f, double eps) { t.force(&f, &u, eps, t.context); });
+    }
+
+    param.n_force += n_term[level];
+  }
+
+  void HMCIntegrator::updateMomForceGradient(int level, double dt, double xi)
+  {
+    // compute the force alone, leaving the momentum untouched
+    f_fg->zero();
+    fg_stage = 1;
+    updateMom(*f_fg, level, 1.0);
+
+    // form the displaced field exp(0 P + xi F) U with the fused update, into a
+    // temporary when only the gauge terms need it, and in place otherwise
+    const bool shifted = n_external[level] == 0;
+    profile.TPSTART(QUDA_PROFILE_COMPUTE);
+    if (shifted) {
+      updateGaugeField(*u_fg, 0.0, u, mom, xi, *f_fg, false);
+    } else {
+      u_fg->copy(u);
+      updateGaugeField(u, 0.0, *u_fg, mom, xi, *f_fg, false);
+    }
+    profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+    gauge_updated(shifted ? *u_fg : u);
+
+    // apply the force evaluated at the displaced field, and restore the gauge field
+    fg_stage = 2;
+    updateMom(mom, level, dt);
+    fg_stage = 0;
+    if (!shifted) u.copy(*u_fg);
+    gauge_updated(u);
+  }
+
+  void HMCIntegrator::integrate(int level, double tau)
+  {
+    const int n_step = param.n_step[level];
+    const double h = tau / n_step;
+    const auto scheme = getScheme(param.integrator[level], param.lambda[level]);
+    const int n_op = scheme.op.size();
+
+    for (int s = 0; s < n_step; s++) {
+      step[level] = s;
+      host_timer_t timer;
+      if (telemetry) {
+        qudaDeviceSynchronize();
+        timer.start();
+      }
+
+      for (int i = 0; i < n_op; i++) {
+        // the first kick of a step was merged into the last kick of the previous one
+        if (i == 0 && s > 0) continue;
+        double dt = scheme.coeff[i] * h;
+        if (i == n_op - 1 && s < n_step - 1) dt += scheme.coeff[0] * h;
+
+        switch (scheme.op[i]) {
+        case KICK: updateMom(mom, level, dt); break;
+        case KICK_FG: updateMomForceGradient(level, dt, h * h / 24.0); break;
+        case DRIFT:
+          if (level == param.n_level - 1)
+            updateGauge(dt);
+          else
+            integrate(level + 1, dt);
+          break;
+        }
+      }
+
+      if (telemetry) {
+        qudaDeviceSynchronize();
+        timer.stop();
+        QudaHMCTelemetry rec = {};
+        rec.trajectory = trajectory_index;
+        rec.level = level;
+        rec.step = s;
+        rec.term = -1;
+        rec.dt = h;
+        rec.secs = timer.last();
+        records.push_back(rec);
+      }
+    }
+  }
+
+  void HMCIntegrator::flushTelemetry()
+  {
+    for (int i = 0; i < param.n_term; i++) {
+      auto &t = param.term[i];
+      if (t.n_force > 0) t.force_mean /= t.n_force;
+      if (getVerbosity() >= QUDA_VERBOSE && t.n_force > 0)
+        printfQuda("HMC term %d (%s): %d forces, |F| mean = %e max = %e, %d solver iterations, %e secs\n", i,
+                   t.name ? t.name : "unnamed", t.n_force, t.force_mean, t.force_max, t.solver_iter, t.force_secs);
+    }
+
+    telemetry_history.insert(telemetry_history.end(), records.begin(), records.end());
+
+    if (param.telemetry_file[0] != '\0' && comm_rank() == 0) {
+      FILE *file = fopen(param.telemetry_file, "a");
+      if (file) {
+        if (ftell(file) == 0)
+          fprintf(file, "# trajectory level step term force_gradient dt force_mean force_max solver_iter solver_secs "
+                        "secs\n");
+        for (auto &rec : records)
+          fprintf(file, "%d %d %d %d %d %.6e %.8e %.8e %d %.6e %.6e\n", rec.trajectory, rec.level, rec.step, rec.term,
+                  rec.force_gradient, rec.dt, rec.force_mean, rec.force_max, rec.solver_iter, rec.solver_secs,
+                  rec.secs);
+        fclose(file);
+      } else {
+        warningQuda("Unable to open HMC telemetry file %s", param.telemetry_file);
+      }
+    }
+
+    if (param.telemetry_callback) param.telemetry_callback(records.data(), records.size(), param.telemetry_data);
+    records.clear();
+  }
+
+  void HMCIntegrator::trajectory()
+  {
+    param.n_force = 0;
+    if (u_init) u_init->copy(u);
+
+    if (telemetry) {
+      trajectory_index = telemetry_trajectories++;
+      for (int i = 0; i < param.n_term; i++) {
+        auto &t = param.term[i];
+        t.n_force = 0;
+        t.force_mean = 0.0;
+        t.force_max = 0.0;
+        t.solver_iter = 0;
+        t.solver_secs = 0.0;
+        t.force_secs = 0.0;
+      }
+    }
+
+    if (param.refresh_mom) {
+      profile.TPSTART(QUDA_PROFILE_COMPUTE);
+      gaugeGauss(mom, momentumSeed(param.seed, param.trajectory), 1.0);
+      profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+    }
+
+    for (int i = 0; i < param.n_term; i++) {
+      auto &t = param.term[i];
+      if (t.type == QUDA_HMC_EXTERNAL_TERM && t.refresh) {
+        profile.TPSTART(QUDA_PROFILE_COMPUTE);
+        t.refresh(&u, t.context);
+        profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+      }
+    }
+
+    profile.TPSTART(QUDA_PROFILE_COMPUTE);
+    param.mom_action_init = computeMomAction(mom);
+    profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+    double s_init = action(true);
+
+    integrate(0, param.tau);
+
+    profile.TPSTART(QUDA_PROFILE_COMPUTE);
+    param.mom_action_final = computeMomAction(mom);
+    profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+    double s_final = action(false);
+
+    param.delta_h = (param.mom_action_final + s_final) - (param.mom_action_init + s_init);
+    param.accepted = QUDA_BOOLEAN_TRUE;
+    if (param.accept_reject && param.uniform >= std::exp(-param.delta_h)) {
+      param.accepted = QUDA_BOOLEAN_FALSE;
+      u.copy(*u_init);
+      gauge_updated(u);
+    }
+
+    if (getVerbosity() >= QUDA_VERBOSE)
+      printfQuda("HMC trajectory: dH = %e with %d force evaluations, %s\n", param.delta_h, param.n_force,
+                 param.accepted ? "accepted" : "rejected");
+
+    // the force samples of the whole trajectory are written out together
+    flushForceMonitor();
+    if (telemetry) flushTelemetry();
+  }
+
+} // namespace quda
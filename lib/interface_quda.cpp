@@ -1,4 +1,5 @@
 #include <cmath>
+#include <limits>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -21,8 +22,11 @@
 #include <color_spinor_field.h>
 #include <clover_field.h>
 #include <llfat_quda.h>
+#include <gauge_field_arena.h>
 #include <unitarization_links.h>
 #include <algorithm>
+#include <map>
+#include <tuple>
 #include <staggered_oprod.h>
 #include <ks_improved_force.h>
 #include <ks_force_quda.h>
@@ -38,6 +42,7 @@
 
 #include <gauge_force_quda.h>
 #include <gauge_update_quda.h>
+#include <field_residency.h>
 
 #define MAX(a,b) ((a)>(b)? (a):(b))
 #define TDIFF(a,b) (b.tv_sec - a.tv_sec + 0.000001*(b.tv_usec - a.tv_usec))
@@ -61,6 +66,7 @@ void checkBLASParam(QudaBLASParam &param) { checkBLASParam(&param); }
 #include <gauge_tools.h>
 #include <contract_quda.h>
 #include <momentum.h>
+#include <hmc_integrator.h>
 
 using namespace quda;
 
@@ -129,6 +135,9 @@ CloverField *cloverEigensolver = nullptr;
 cudaGaugeField *momResident = nullptr;
 cudaGaugeField *extendedGaugeResident = nullptr;
 
+// device memory arena for the intermediate fields of computeHISQLinksQuda
+GaugeFieldArena *hisqArena = nullptr;
+
 std::vector<ColorSpinorField *> solutionResident;
 
 // vector of spinors used for forecasting solutions in HMC
@@ -136,6 +145,43 @@ std::vector<ColorSpinorField *> solutionResident;
 // each entry is one p
 std::vector< std::vector<ColorSpinorField*> > chronoResident(QUDA_MAX_CHRONO);
 
+// Pooled A * p for each chronological basis.  Entries are kept in
+// step with chronoResident, so that only basis vectors added since
+// the last forecast need the operator applied.  Only used when the
+// basis is stored at single precision or higher.
+struct ChronoAp {
+  std::vector<ColorSpinorField *> Ap; // A * p, stored at the chrono precision
+  std::vector<bool> valid;            // whether each Ap entry is current
+  uint64_t version = 0;               // operator version Ap was computed with
+  bool normal = false;                // whether Ap = M p or Ap = M^dag M p
+  QudaInvertParam param = {};         // parameters Ap was computed with
+};
+std::vector<ChronoAp> chronoAp(QUDA_MAX_CHRONO);
+
+// Select the sloppy precision for invertQuda when adaptive_precision
+// is enabled.  Solves with different operators or solvers converge
+// differently at a given precision, so each gets its own controller.
+using PrecisionControllerKey = std::tuple<QudaDslashType, QudaInverterType, QudaSolveType, QudaMatPCType, QudaPrecision,
+                                          double, double, double, double, double, double, double>;
+static std::map<PrecisionControllerKey, PrecisionController> precisionControllers;
+
+/**
+   @brief Return the adaptive precision controller for the operator
+   and solver described by param.  The sloppy precision is excluded
+   from the key, since it is what the controller selects.
+*/
+static PrecisionController &precisionController(const QudaInvertParam &param)
+{
+  PrecisionControllerKey key(param.dslash_type, param.inv_type, param.solve_type, param.matpc_type, param.cuda_prec,
+                             param.kappa, param.mass, param.mu, param.epsilon, param.clover_coeff, param.clover_csw,
+                             param.tol);
+  return precisionControllers[key];
+}
+
+// Incremented whenever the resident gauge or clover fields change,
+// and used to invalidate the pooled chronological A * p
+static uint64_t operator_version = 0;
+
 // Mapped memory buffer used to hold unitarization failures
 static int *num_failures_h = nullptr;
 static int *num_failures_d = nullptr;
@@ -169,6 +215,9 @@ static TimeProfile profileEigensolve("eigensolveQuda");
 //!< Profiler for computeFatLinkQuda
 static TimeProfile profileFatLink("computeKSLinkQuda");
 
+//!< Profiler for computeHISQLinksQuda
+static TimeProfile profileHISQLink("computeHISQLinksQuda");
+
 //!< Profiler for computeGaugeForceQuda
 static TimeProfile profileGaugeForce("computeGaugeForceQuda");
 
@@ -178,6 +227,9 @@ static TimeProfile profileGaugePath("computeGaugePathQuda");
 //!<Profiler for updateGaugeFieldQuda
 static TimeProfile profileGaugeUpdate("updateGaugeFieldQuda");
 
+//!< Profiler for hmcTrajectoryQuda
+static TimeProfile profileHMC("hmcTrajectoryQuda");
+
 //!<Profiler for createExtendedGaugeField
 static TimeProfile profileExtendedGauge("createExtendedGaugeField");
 
@@ -202,6 +254,9 @@ static TimeProfile profileGauss("gaussQuda");
 //!< Profiler for gaugeObservableQuda
 static TimeProfile profileGaugeObs("gaugeObservablesQuda");
 
+//!< Profiler for computeGaugeLoopsQuda
+static TimeProfile profileGaugeLoops("computeGaugeLoopsQuda");
+
 //!< Profiler for APEQuda
 static TimeProfile profileAPE("APEQuda");
 
@@ -553,6 +608,7 @@ static bool invalidate_clover = true;
 
 void loadGaugeQuda(void *h_gauge, QudaGaugeParam *param)
 {
+  operator_version++;
   profileGauge.TPSTART(QUDA_PROFILE_TOTAL);
 
   if (!initialized) errorQuda("QUDA not initialized");
@@ -676,6 +732,7 @@ void loadGaugeQuda(void *h_gauge, QudaGaugeParam *param)
   // for gaugeSmeared we are interested only in the precise version
   if (param->type == QUDA_SMEARED_LINKS) {
     gaugeSmeared = createExtendedGauge(*precise, R, profileGauge);
+    residency::add(*gaugeSmeared); // may be spilled to the host under memory pressure
 
     profileGauge.TPSTART(QUDA_PROFILE_FREE);
     delete precise;
@@ -830,7 +887,9 @@ void saveGaugeQuda(void *h_gauge, QudaGaugeParam *param)
     gauge_param.ghostExchange = QUDA_GHOST_EXCHANGE_PAD;
     gauge_param.pad = param->ga_pad;
     cudaGauge = new cudaGaugeField(gauge_param);
+    residency::acquire(*gaugeSmeared);
     copyExtendedGauge(*cudaGauge, *gaugeSmeared, QUDA_CUDA_FIELD_LOCATION);
+    residency::release(*gaugeSmeared);
     break;
   default: errorQuda("Invalid gauge type");
   }
@@ -846,9 +905,12 @@ void saveGaugeQuda(void *h_gauge, QudaGaugeParam *param)
 
 void loadSloppyCloverQuda(const QudaPrecision prec[]);
 void freeSloppyCloverQuda();
+static void createClover(QudaInvertParam *invertParam, bool invert, bool compute_tr_log);
+static cudaGaugeField *createCloverGauge();
 
 void loadCloverQuda(void *h_clover, void *h_clovinv, QudaInvertParam *inv_param)
 {
+  operator_version++;
   pushVerbosity(inv_param->verbosity);
   profileClover.TPSTART(QUDA_PROFILE_TOTAL);
   profileClover.TPSTART(QUDA_PROFILE_INIT);
@@ -868,6 +930,17 @@ void loadCloverQuda(void *h_clover, void *h_clovinv, QudaInvertParam *inv_param)
   }
   if (!h_clover && !device_calc) errorQuda("Uninverted clover term not loaded");
 
+  // the on-the-fly clover term is never stored, only its coefficient and a copy of the gauge field
+  const bool on_the_fly = inv_param->clover_on_the_fly == QUDA_BOOLEAN_TRUE;
+  if (on_the_fly) {
+    if (!clover::on_the_fly()) errorQuda("On-the-fly clover has not been built");
+    if (inv_param->dslash_type != QUDA_CLOVER_WILSON_DSLASH)
+      errorQuda("On-the-fly clover not supported for dslash_type %d", inv_param->dslash_type);
+    if (!device_calc) errorQuda("On-the-fly clover cannot be loaded from the host");
+    if (inv_param->return_clover || inv_param->return_clover_inverse)
+      errorQuda("On-the-fly clover cannot be returned to the host");
+  }
+
   if (gaugePrecise == nullptr) errorQuda("Gauge field must be loaded before clover");
   if ((inv_param->dslash_type != QUDA_CLOVER_WILSON_DSLASH) && (inv_param->dslash_type != QUDA_TWISTED_CLOVER_DSLASH)
       && (inv_param->dslash_type != QUDA_CLOVER_HASENBUSCH_TWIST_DSLASH)) {
@@ -899,7 +972,8 @@ void loadCloverQuda(void *h_clover, void *h_clovinv, QudaInvertParam *inv_param)
   double mu2_old = cloverPrecise ? cloverPrecise->Mu2() : 0.0;
   if (!cloverPrecise || invalidate_clover || inv_param->clover_coeff != coeff_old || inv_param->clover_csw != csw_old
       || inv_param->clover_csw != csw_old || inv_param->clover_rho != rho_old
-      || 4 * inv_param->kappa * inv_param->kappa * inv_param->mu * inv_param->mu != mu2_old)
+      || 4 * inv_param->kappa * inv_param->kappa * inv_param->mu * inv_param->mu != mu2_old
+      || cloverPrecise->OnTheFly() != on_the_fly)
     clover_update = true;
 
   // compute or download clover field only if gauge field has been updated or clover field doesn't exist
@@ -908,6 +982,11 @@ void loadCloverQuda(void *h_clover, void *h_clovinv, QudaInvertParam *inv_param)
     freeSloppyCloverQuda();
     if (cloverPrecise) delete cloverPrecise;
 
+    if (on_the_fly) {
+      clover_param.gauge = createCloverGauge();
+      clover_param.setPrecision(inv_param->clover_cuda_prec, true);
+    }
+
     profileClover.TPSTART(QUDA_PROFILE_INIT);
     cloverPrecise = new CloverField(clover_param);
 
@@ -926,21 +1005,24 @@ void loadCloverQuda(void *h_clover, void *h_clovinv, QudaInvertParam *inv_param)
     }
     profileClover.TPSTOP(QUDA_PROFILE_INIT);
 
+    const bool invert = (!h_clovinv || inv_param->compute_clover_inverse) && !clover::dynamic_inverse();
+
     if (!device_calc) {
       profileClover.TPSTART(QUDA_PROFILE_H2D);
       cloverPrecise->copy(*in, false);
       if ((h_clovinv && !inv_param->compute_clover_inverse) && !clover::dynamic_inverse())
         cloverPrecise->copy(*in, true);
       profileClover.TPSTOP(QUDA_PROFILE_H2D);
-    } else {
+    } else if (!on_the_fly) {
+      // the inverse and trace log are computed in the same pass as the clover field
       profileClover.TPSTOP(QUDA_PROFILE_TOTAL);
-      createCloverQuda(inv_param);
+      createClover(inv_param, invert, invert && inv_param->compute_clover_trlog);
       profileClover.TPSTART(QUDA_PROFILE_TOTAL);
     }
 
-    if ((!h_clovinv || inv_param->compute_clover_inverse) && !clover::dynamic_inverse()) {
+    if (invert) {
       profileClover.TPSTART(QUDA_PROFILE_COMPUTE);
-      cloverInvert(*cloverPrecise, inv_param->compute_clover_trlog);
+      if (!device_calc) cloverInvert(*cloverPrecise, inv_param->compute_clover_trlog);
       if (inv_param->compute_clover_trlog) {
         inv_param->trlogA[0] = cloverPrecise->TrLog()[0];
         inv_param->trlogA[1] = cloverPrecise->TrLog()[1];
@@ -1125,6 +1207,7 @@ void freeSloppyGaugeQuda()
 
 void freeGaugeQuda(void)
 {
+  operator_version++;
   if (!initialized) errorQuda("QUDA not initialized");
 
   freeSloppyGaugeQuda();
@@ -1388,6 +1471,7 @@ void freeSloppyCloverQuda()
 
 void freeCloverQuda(void)
 {
+  operator_version++;
   if (!initialized) errorQuda("QUDA not initialized");
   freeSloppyCloverQuda();
   if (cloverPrecise) delete cloverPrecise;
@@ -1405,8 +1489,35 @@ void flushChronoQuda(int i)
     if (v)  delete v;
   }
   basis.clear();
+
+  auto &cache = chronoAp[i];
+  for (auto v : cache.Ap) {
+    if (v) delete v;
+  }
+  cache.Ap.clear();
+  cache.valid.clear();
+}
+
+int getSolverTelemetryQuda(QudaSolverTelemetry *records, int max_records)
+{
+  auto &history = solverTelemetryHistory();
+  int n = std::min(max_records, static_cast<int>(history.size()));
+  if (n > 0) std::copy(history.begin(), history.begin() + n, records);
+  return history.size();
+}
+
+void flushSolverTelemetryQuda(void) { solverTelemetryHistory().clear(); }
+
+int getHMCTelemetryQuda(QudaHMCTelemetry *records, int max_records)
+{
+  auto &history = hmcTelemetryHistory();
+  int n = std::min(max_records, static_cast<int>(history.size()));
+  if (n > 0) std::copy(history.begin(), history.begin() + n, records);
+  return history.size();
 }
 
+void flushHMCTelemetryQuda(void) { hmcTelemetryHistory().clear(); }
+
 void endQuda(void)
 {
   profileEnd.TPSTART(QUDA_PROFILE_TOTAL);
@@ -1417,12 +1528,16 @@ void endQuda(void)
   freeCloverQuda();
 
   for (int i = 0; i < QUDA_MAX_CHRONO; i++) flushChronoQuda(i);
+  precisionControllers.clear();
 
   for (auto v : solutionResident) if (v) delete v;
   solutionResident.clear();
 
   if(momResident) delete momResident;
 
+  if (hisqArena) delete hisqArena;
+  hisqArena = nullptr;
+
   LatticeField::freeGhostBuffer();
   ColorSpinorField::freeGhostBuffer();
 
@@ -1464,8 +1579,10 @@ void endQuda(void)
     profileMulti.Print();
     profileEigensolve.Print();
     profileFatLink.Print();
+    profileHISQLink.Print();
     profileGaugeForce.Print();
     profileGaugeUpdate.Print();
+    profileHMC.Print();
     profileExtendedGauge.Print();
     profileCloverForce.Print();
     profileStaggeredForce.Print();
@@ -1475,6 +1592,7 @@ void endQuda(void)
     profileCovDev.Print();
     profilePlaq.Print();
     profileGaugeObs.Print();
+    profileGaugeLoops.Print();
     profileAPE.Print();
     profileSTOUT.Print();
     profileOvrImpSTOUT.Print();
@@ -1489,6 +1607,8 @@ void endQuda(void)
 
     printLaunchTimer();
     printAPIProfile();
+    printHaloCompressionStats();
+    residency::print_stats();
 
     printfQuda("\n");
     printPeakMemUsage();
@@ -1638,6 +1758,8 @@ namespace quda {
       diracParam.commDim[i] = 1;   // comms are always on
     }
 
+    diracParam.wilson_halo_precision = inv_param->halo_precision_sloppy;
+
     if (diracParam.gauge->Precision() != inv_param->cuda_prec_sloppy)
       errorQuda("Gauge precision %d does not match requested precision %d\n", diracParam.gauge->Precision(),
                 inv_param->cuda_prec_sloppy);
@@ -1680,6 +1802,7 @@ namespace quda {
     for (int i=0; i<4; i++) {
       diracParam.commDim[i] = comms ? 1 : 0;
     }
+    diracParam.wilson_halo_precision = inv_param->halo_precision_sloppy;
 
     // In the preconditioned staggered CG allow a different dslash type in the preconditioning
     if(inv_param->inv_type == QUDA_PCG_INVERTER && inv_param->dslash_type == QUDA_ASQTAD_DSLASH
@@ -2730,6 +2853,156 @@ void destroyDeflationQuda(void *df) {
   delete static_cast<deflated_solver*>(df);
 }
 
+/**
+   @brief Whether the operator parameters that the pooled chrono A * p
+   were computed with match those of the present solve
+*/
+static bool chronoOperatorMatch(const QudaInvertParam &a, const QudaInvertParam &b)
+{
+  return a.dslash_type == b.dslash_type && a.kappa == b.kappa && a.mass == b.mass && a.m5 == b.m5 && a.Ls == b.Ls
+    && a.mu == b.mu && a.epsilon == b.epsilon && a.tm_rho == b.tm_rho && a.twist_flavor == b.twist_flavor
+    && a.clover_coeff == b.clover_coeff && a.clover_csw == b.clover_csw && a.eofa_shift == b.eofa_shift
+    && a.mq1 == b.mq1 && a.mq2 == b.mq2 && a.mq3 == b.mq3 && a.matpc_type == b.matpc_type
+    && a.solve_type == b.solve_type && a.dagger == b.dagger && a.cuda_prec == b.cuda_prec
+    && a.cuda_prec_sloppy == b.cuda_prec_sloppy && a.chrono_precision == b.chrono_precision
+    && memcmp(a.b_5, b.b_5, sizeof(a.b_5)) == 0 && memcmp(a.c_5, b.c_5, sizeof(a.c_5)) == 0;
+}
+
+/**
+   @brief Form the chronological initial guess for the solve A x = b
+   using the resident basis p_i.  The A p_i are pooled across calls
+   and only recomputed for basis vectors that are new, or if the
+   operator has changed since they were last computed.  The basis may
+   be stored at any precision up to the outer precision: when it does
+   not match the outer or sloppy precision, the operator is applied
+   at the next highest of these on promoted copies.  For a half or
+   quarter precision basis the extrapolation itself also runs on
+   single precision copies, so the pooled p_i and A p_i are never
+   modified.
+   @param[out] x Initial guess
+   @param[in] b Source vector
+   @param[in] m Outer precision operator
+   @param[in] mSloppy Sloppy precision operator
+   @param[in] normal Whether the operator is the normal operator
+   @param[in] hermitian Whether the operator is Hermitian
+   @param[in] param Invert parameters for this solve
+*/
+static void chronoForecast(ColorSpinorField &x, const ColorSpinorField &b, const DiracMatrix &m,
+                           const DiracMatrix &mSloppy, bool normal, bool hermitian, const QudaInvertParam &param)
+{
+  profileInvert.TPSTART(QUDA_PROFILE_CHRONO);
+
+  auto &basis = chronoResident[param.chrono_index];
+  auto &cache = chronoAp[param.chrono_index];
+
+  if (param.chrono_precision > param.cuda_prec)
+    errorQuda("Chrono precision %d cannot exceed the outer precision %d", param.chrono_precision, param.cuda_prec);
+
+  // pooled A p are only valid if neither the fields nor the operator have changed
+  if (cache.version != operator_version || cache.normal != normal || !chronoOperatorMatch(cache.param, param)) {
+    std::fill(cache.valid.begin(), cache.valid.end(), false);
+    cache.version = operator_version;
+    cache.normal = normal;
+    cache.param = param;
+  }
+
+  ColorSpinorParam cs_param(*basis[0]);
+  cs_param.create = QUDA_NULL_FIELD_CREATE;
+  cache.Ap.resize(basis.size(), nullptr);
+  cache.valid.resize(basis.size(), false);
+  for (auto &ap : cache.Ap)
+    if (!ap) ap = ColorSpinorField::Create(cs_param);
+
+  // page back any basis vectors and A p spilled to the host since the last solve
+  residency::acquire(basis);
+  residency::acquire(cache.Ap);
+
+  std::vector<ColorSpinorField *> p, Ap;
+  for (auto i = 0u; i < basis.size(); i++) {
+    if (cache.valid[i]) continue;
+    p.push_back(basis[i]);
+    Ap.push_back(cache.Ap[i]);
+    cache.valid[i] = true;
+  }
+
+  if (p.size() > 0) {
+    if (getVerbosity() >= QUDA_VERBOSE)
+      printfQuda("Applying operator to %lu of %lu chrono basis vectors\n", p.size(), basis.size());
+
+    const bool outer = param.chrono_precision > param.cuda_prec_sloppy;
+    const DiracMatrix &op = outer ? m : mSloppy;
+    ColorSpinorParam op_param(cs_param);
+    op_param.setPrecision(outer ? param.cuda_prec : param.cuda_prec_sloppy);
+
+    ColorSpinorField *tmp1 = ColorSpinorField::Create(op_param);
+    ColorSpinorField *tmp2 = ColorSpinorField::Create(op_param);
+
+    if (op_param.Precision() == param.chrono_precision) {
+      op.apply(Ap, p, *tmp1, *tmp2);
+    } else {
+      // low-precision basis, so promote one vector at a time
+      ColorSpinorField *p_op = ColorSpinorField::Create(op_param);
+      ColorSpinorField *Ap_op = ColorSpinorField::Create(op_param);
+      for (auto i = 0u; i < p.size(); i++) {
+        blas::copy(*p_op, *p[i]);
+        op(*Ap_op, *p_op, *tmp1, *tmp2);
+        blas::copy(*Ap[i], *Ap_op);
+      }
+      delete Ap_op;
+      delete p_op;
+    }
+
+    delete tmp2;
+    delete tmp1;
+  }
+
+  // MinResExt orthonormalizes p and A p in place with the same
+  // transformation, so the pooled A p remain consistent with the
+  // basis afterwards.  At half or quarter precision the rounding of
+  // each in-place update would accumulate across forecasts, so the
+  // extrapolation is instead done on single precision copies.
+  bool orthogonal = true;
+  bool apply_mat = false;
+  MinResExt mre(m, orthogonal, apply_mat, hermitian, profileInvert);
+
+  const bool promote = param.chrono_precision < QUDA_SINGLE_PRECISION && param.cuda_prec >= QUDA_SINGLE_PRECISION;
+  ColorSpinorParam mre_param(cs_param);
+  if (promote) mre_param.setPrecision(QUDA_SINGLE_PRECISION);
+
+  std::vector<ColorSpinorField *> p_mre(basis), Ap_mre(cache.Ap);
+  if (promote) {
+    for (auto i = 0u; i < basis.size(); i++) {
+      p_mre[i] = ColorSpinorField::Create(mre_param);
+      Ap_mre[i] = ColorSpinorField::Create(mre_param);
+      blas::copy(*p_mre[i], *basis[i]);
+      blas::copy(*Ap_mre[i], *cache.Ap[i]);
+    }
+  }
+
+  ColorSpinorField *r = ColorSpinorField::Create(mre_param);
+  blas::copy(*r, b);
+  if (promote) {
+    ColorSpinorField *x_mre = ColorSpinorField::Create(mre_param);
+    mre(*x_mre, *r, p_mre, Ap_mre);
+    blas::copy(x, *x_mre);
+    delete x_mre;
+    for (auto i = 0u; i < basis.size(); i++) {
+      delete Ap_mre[i];
+      delete p_mre[i];
+    }
+  } else {
+    mre(x, *r, basis, cache.Ap);
+  }
+  delete r;
+
+  // between solves the basis and pooled A p may be spilled under memory pressure
+  residency::add(cache.Ap);
+  residency::release(basis);
+  residency::release(cache.Ap);
+
+  profileInvert.TPSTOP(QUDA_PROFILE_CHRONO);
+}
+
 void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
 {
   profilerStart(__func__);
@@ -2743,6 +3016,13 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
 
   checkInvertParam(param, hp_x, hp_b);
 
+  if (param->adaptive_precision == QUDA_BOOLEAN_TRUE) {
+    // the selection needs the defaults filled in by the check, and
+    // changes the sloppy and derived precisions, so check again
+    precisionController(*param).select(*param);
+    checkInvertParam(param, hp_x, hp_b);
+  }
+
   // check the gauge fields have been created
   cudaGaugeField *cudaGauge = checkGauge(param);
 
@@ -2764,6 +3044,8 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
   param->secs = 0;
   param->gflops = 0;
   param->iter = 0;
+  param->reliable_updates = 0;
+  param->max_reliable_gap = 0.0;
 
   Dirac *d = nullptr;
   Dirac *dSloppy = nullptr;
@@ -2944,44 +3226,8 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
     DiracM m(dirac), mSloppy(diracSloppy), mPre(diracPre), mEig(diracEig);
     SolverParam solverParam(*param);
     // chronological forecasting
-    if (param->chrono_use_resident && chronoResident[param->chrono_index].size() > 0) {
-      profileInvert.TPSTART(QUDA_PROFILE_CHRONO);
-
-      auto &basis = chronoResident[param->chrono_index];
-
-      ColorSpinorParam cs_param(*basis[0]);
-      ColorSpinorField *tmp = ColorSpinorField::Create(cs_param);
-      ColorSpinorField *tmp2 = (param->chrono_precision == out->Precision()) ? out : ColorSpinorField::Create(cs_param);
-      std::vector<ColorSpinorField*> Ap;
-      for (unsigned int k=0; k < basis.size(); k++) {
-        Ap.emplace_back((ColorSpinorField::Create(cs_param)));
-      }
-
-      if (param->chrono_precision == param->cuda_prec) {
-        for (unsigned int j=0; j<basis.size(); j++) m(*Ap[j], *basis[j], *tmp, *tmp2);
-      } else if (param->chrono_precision == param->cuda_prec_sloppy) {
-        for (unsigned int j=0; j<basis.size(); j++) mSloppy(*Ap[j], *basis[j], *tmp, *tmp2);
-      } else {
-        errorQuda("Unexpected precision %d for chrono vectors (doesn't match outer %d or sloppy precision %d)",
-                  param->chrono_precision, param->cuda_prec, param->cuda_prec_sloppy);
-      }
-
-      bool orthogonal = true;
-      bool apply_mat = false;
-      bool hermitian = false;
-      MinResExt mre(m, orthogonal, apply_mat, hermitian, profileInvert);
-
-      blas::copy(*tmp, *in);
-      mre(*out, *tmp, basis, Ap);
-
-      for (auto ap: Ap) {
-        if (ap) delete (ap);
-      }
-      delete tmp;
-      if (tmp2 != out) delete tmp2;
-
-      profileInvert.TPSTOP(QUDA_PROFILE_CHRONO);
-    }
+    if (param->chrono_use_resident && chronoResident[param->chrono_index].size() > 0)
+      chronoForecast(*out, *in, m, mSloppy, false, false, *param);
 
     Solver *solve = Solver::create(solverParam, m, mSloppy, mPre, mEig, profileInvert);
     (*solve)(*out, *in);
@@ -2992,44 +3238,8 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
     SolverParam solverParam(*param);
 
     // chronological forecasting
-    if (param->chrono_use_resident && chronoResident[param->chrono_index].size() > 0) {
-      profileInvert.TPSTART(QUDA_PROFILE_CHRONO);
-
-      auto &basis = chronoResident[param->chrono_index];
-
-      ColorSpinorParam cs_param(*basis[0]);
-      std::vector<ColorSpinorField*> Ap;
-      ColorSpinorField *tmp = ColorSpinorField::Create(cs_param);
-      ColorSpinorField *tmp2 = (param->chrono_precision == out->Precision()) ? out : ColorSpinorField::Create(cs_param);
-      for (unsigned int k=0; k < basis.size(); k++) {
-        Ap.emplace_back((ColorSpinorField::Create(cs_param)));
-      }
-
-      if (param->chrono_precision == param->cuda_prec) {
-        for (unsigned int j=0; j<basis.size(); j++) m(*Ap[j], *basis[j], *tmp, *tmp2);
-      } else if (param->chrono_precision == param->cuda_prec_sloppy) {
-        for (unsigned int j=0; j<basis.size(); j++) mSloppy(*Ap[j], *basis[j], *tmp, *tmp2);
-      } else {
-        errorQuda("Unexpected precision %d for chrono vectors (doesn't match outer %d or sloppy precision %d)",
-                  param->chrono_precision, param->cuda_prec, param->cuda_prec_sloppy);
-      }
-
-      bool orthogonal = true;
-      bool apply_mat = false;
-      bool hermitian = true;
-      MinResExt mre(m, orthogonal, apply_mat, hermitian, profileInvert);
-
-      blas::copy(*tmp, *in);
-      mre(*out, *tmp, basis, Ap);
-
-      for (auto ap: Ap) {
-        if (ap) delete(ap);
-      }
-      delete tmp;
-      if (tmp2 != out) delete tmp2;
-
-      profileInvert.TPSTOP(QUDA_PROFILE_CHRONO);
-    }
+    if (param->chrono_use_resident && chronoResident[param->chrono_index].size() > 0)
+      chronoForecast(*out, *in, m, mSloppy, true, true, *param);
 
     // if using a Schwarz preconditioner with a normal operator then we must use the DiracMdagMLocal operator
     if (param->inv_type_precondition != QUDA_INVALID_INVERTER && param->schwarz_type != QUDA_INVALID_SCHWARZ) {
@@ -3060,6 +3270,8 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
     printfQuda("Solution = %g\n",nx);
   }
 
+  if (param->adaptive_precision == QUDA_BOOLEAN_TRUE) precisionController(*param).update(*param);
+
   profileInvert.TPSTART(QUDA_PROFILE_EPILOGUE);
   if (param->chrono_make_resident) {
     if(param->chrono_max_dim < 1){
@@ -3071,6 +3283,8 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
       errorQuda("Requested chrono index %d is outside of max %d\n", i, QUDA_MAX_CHRONO);
 
     auto &basis = chronoResident[i];
+    auto &cache = chronoAp[i];
+    residency::acquire(basis);
 
     if(param->chrono_max_dim < (int)basis.size()){
       errorQuda("Requested chrono_max_dim %i is smaller than already existing chroology %i",param->chrono_max_dim,(int)basis.size());
@@ -3088,8 +3302,23 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
       ColorSpinorField *tmp = basis[basis.size()-1];
       for (unsigned int j=basis.size()-1; j>0; j--) basis[j] = basis[j-1];
         basis[0] = tmp;
+
+      // keep the pooled A p in step with the basis
+      cache.Ap.resize(basis.size(), nullptr);
+      cache.valid.resize(basis.size(), false);
+      ColorSpinorField *ap = cache.Ap[basis.size() - 1];
+      for (unsigned int j = basis.size() - 1; j > 0; j--) {
+        cache.Ap[j] = cache.Ap[j - 1];
+        cache.valid[j] = cache.valid[j - 1];
+      }
+      cache.Ap[0] = ap;
     }
     *(basis[0]) = *out; // set first entry to new solution
+    if (cache.valid.size() > 0) cache.valid[0] = false;
+
+    // the basis may be spilled to the host between solves under memory pressure
+    residency::add(basis);
+    residency::release(basis);
   }
   dirac.reconstruct(*x, b, param->solution_type);
 
@@ -4045,6 +4274,145 @@ void computeKSLinkQuda(void *fatlink, void *longlink, void *ulink, void *inlink,
   profileFatLink.TPSTOP(QUDA_PROFILE_TOTAL);
 }
 
+void computeHISQLinksQuda(void *fatlink, void *longlink, void *fatlink_eps, void *longlink_eps, void *wlink,
+                          void *inlink, double **path_coeff, double naik_epsilon, QudaGaugeParam *param)
+{
+  profileHISQLink.TPSTART(QUDA_PROFILE_TOTAL);
+  profileHISQLink.TPSTART(QUDA_PROFILE_INIT);
+
+  checkGaugeParam(param);
+  if (!fatlink) errorQuda("Fat-link output is required");
+
+  const bool compute_eps = fatlink_eps || longlink_eps;
+  const bool compute_long = longlink || longlink_eps;
+
+  // wrap the host fields
+  GaugeFieldParam gParam(*param, fatlink, QUDA_GENERAL_LINKS);
+  auto wrap = [&](void *ptr) { gParam.gauge = ptr; return ptr ? std::make_unique<cpuGaugeField>(gParam) : nullptr; };
+  auto cpuFatLink = wrap(fatlink);
+  auto cpuLongLink = wrap(longlink);
+  auto cpuFatLinkEps = wrap(fatlink_eps);
+  auto cpuLongLinkEps = wrap(longlink_eps);
+  auto cpuWLink = wrap(wlink);
+  gParam.link_type = param->type;
+  gParam.gauge = inlink;
+  cpuGaugeField cpuInLink(gParam);
+
+  // parameters of the device fields: the input links, the general
+  // links, and their extended counterparts (staples share the latter)
+  gParam.gauge = nullptr;
+  gParam.reconstruct = param->reconstruct;
+  gParam.setPrecision(param->cuda_prec, true);
+  gParam.ghostExchange = QUDA_GHOST_EXCHANGE_NO;
+  gParam.pad = 0;
+  GaugeFieldParam uParam(gParam);
+
+  gParam.link_type = QUDA_GENERAL_LINKS;
+  gParam.reconstruct = QUDA_RECONSTRUCT_NO;
+  gParam.setPrecision(param->cuda_prec, true);
+  GaugeFieldParam linkParam(gParam);
+
+  auto extend = [](GaugeFieldParam p) {
+    p.ghostExchange = QUDA_GHOST_EXCHANGE_EXTENDED;
+    p.nFace = 1;
+    for (int d = 0; d < 4; d++) {
+      p.x[d] += 2 * R[d];
+      p.r[d] = R[d];
+    }
+    p.setPrecision(p.Precision(), true);
+    return p;
+  };
+  GaugeFieldParam uExParam = extend(uParam);
+  GaugeFieldParam linkExParam = extend(linkParam);
+
+  // slots are shared by fields whose lifetimes do not overlap: U then
+  // W, the extended U then the extended W, and V then the fat link
+  enum { SLOT_LINK, SLOT_LINK_EX, SLOT_STAPLE, SLOT_STAPLE1, SLOT_FAT, SLOT_LONG, SLOT_FAT_EPS, SLOT_LONG_EPS };
+  std::vector<std::vector<GaugeFieldParam>> slots = {
+    {uParam, linkParam}, {uExParam, linkExParam}, {linkExParam}, {linkExParam}, {linkParam}};
+  if (compute_long) slots.push_back({linkParam});
+  if (compute_eps) {
+    if (!compute_long) slots.push_back({});
+    slots.push_back({linkParam});
+    if (compute_long) slots.push_back({linkParam});
+  }
+
+  if (!hisqArena) hisqArena = new GaugeFieldArena;
+  hisqArena->reserve(slots);
+  profileHISQLink.TPSTOP(QUDA_PROFILE_INIT);
+
+  // first level: V = fat7(U), W = unitarize(V)
+  auto link = hisqArena->create(SLOT_LINK, uParam);
+  link->loadCPUField(cpuInLink, profileHISQLink);
+
+  profileHISQLink.TPSTART(QUDA_PROFILE_COMPUTE);
+  auto linkEx = hisqArena->create(SLOT_LINK_EX, uExParam);
+  copyExtendedGauge(*linkEx, *link, QUDA_CUDA_FIELD_LOCATION);
+  profileHISQLink.TPSTOP(QUDA_PROFILE_COMPUTE);
+  linkEx->exchangeExtendedGhost(R, profileHISQLink);
+
+  profileHISQLink.TPSTART(QUDA_PROFILE_COMPUTE);
+  auto staple = hisqArena->create(SLOT_STAPLE, linkExParam);
+  auto staple1 = hisqArena->create(SLOT_STAPLE1, linkExParam);
+  auto fat = hisqArena->create(SLOT_FAT, linkParam);
+  fatLongKSLink({fat.get()}, {}, *linkEx, {path_coeff[0]}, *staple, *staple1);
+
+  {
+    const double unitarize_eps = 1e-14;
+    const double max_error = 1e-10;
+    const int reunit_allow_svd = 1;
+    const int reunit_svd_only = 0;
+    const double svd_rel_error = 1e-6;
+    const double svd_abs_error = 1e-6;
+    quda::setUnitarizeLinksConstants(unitarize_eps, max_error, reunit_allow_svd, reunit_svd_only, svd_rel_error,
+                                     svd_abs_error);
+  }
+
+  link = hisqArena->create(SLOT_LINK, linkParam);
+  *num_failures_h = 0;
+  quda::unitarizeLinks(*link, *fat, num_failures_d); // unitarize on the gpu
+  if (*num_failures_h > 0)
+    errorQuda("Error in unitarization component of the hisq fattening: %d failures", *num_failures_h);
+
+  linkEx = hisqArena->create(SLOT_LINK_EX, linkExParam);
+  copyExtendedGauge(*linkEx, *link, QUDA_CUDA_FIELD_LOCATION);
+  profileHISQLink.TPSTOP(QUDA_PROFILE_COMPUTE);
+  linkEx->exchangeExtendedGhost(R, profileHISQLink);
+
+  // second level: the regular and Naik-corrected links of W share their staples
+  profileHISQLink.TPSTART(QUDA_PROFILE_COMPUTE);
+  std::vector<double> coeff_eps(6);
+  for (int i = 0; i < 6; i++) coeff_eps[i] = path_coeff[1][i] + naik_epsilon * path_coeff[2][i];
+
+  std::vector<GaugeField *> fat_set = {fat.get()};
+  std::vector<GaugeField *> long_set;
+  std::vector<const double *> coeff_set = {path_coeff[1]};
+  std::unique_ptr<cudaGaugeField> lng, fat_eps, long_eps;
+  if (compute_long) {
+    lng = hisqArena->create(SLOT_LONG, linkParam);
+    long_set.push_back(lng.get());
+  }
+  if (compute_eps) {
+    fat_eps = hisqArena->create(SLOT_FAT_EPS, linkParam);
+    fat_set.push_back(fat_eps.get());
+    coeff_set.push_back(coeff_eps.data());
+    if (compute_long) {
+      long_eps = hisqArena->create(SLOT_LONG_EPS, linkParam);
+      long_set.push_back(long_eps.get());
+    }
+  }
+  fatLongKSLink(fat_set, long_set, *linkEx, coeff_set, *staple, *staple1);
+  profileHISQLink.TPSTOP(QUDA_PROFILE_COMPUTE);
+
+  if (cpuWLink) link->saveCPUField(*cpuWLink, profileHISQLink);
+  fat->saveCPUField(*cpuFatLink, profileHISQLink);
+  if (cpuLongLink) lng->saveCPUField(*cpuLongLink, profileHISQLink);
+  if (cpuFatLinkEps) fat_eps->saveCPUField(*cpuFatLinkEps, profileHISQLink);
+  if (cpuLongLinkEps) long_eps->saveCPUField(*cpuLongLinkEps, profileHISQLink);
+
+  profileHISQLink.TPSTOP(QUDA_PROFILE_TOTAL);
+}
+
 int computeGaugeForceQuda(void* mom, void* siteLink,  int*** input_path_buf, int* path_length,
 			  double* loop_coeff, int num_paths, int max_length, double eb3, QudaGaugeParam* qudaGaugeParam)
 {
@@ -4301,16 +4669,37 @@ void momResidentQuda(void *mom, QudaGaugeParam *param)
   profileGaugeForce.TPSTOP(QUDA_PROFILE_TOTAL);
 }
 
-void createCloverQuda(QudaInvertParam* invertParam)
+/**
+   @brief Return the extended gauge field the clover term is computed
+   from, creating it from the resident gauge field if needed.  The
+   extended field is preserved as the resident extended gauge field.
+ */
+static cudaGaugeField *createCloverGauge()
+{
+  if (!extendedGaugeResident) {
+    QudaReconstructType recon = (gaugePrecise->Reconstruct() == QUDA_RECONSTRUCT_8) ? QUDA_RECONSTRUCT_12 : gaugePrecise->Reconstruct();
+    // for clover we optimize to only send depth 1 halos in y/z/t (FIXME - make work for x, make robust in general)
+    int R[4];
+    for (int d=0; d<4; d++) R[d] = (d==0 ? 2 : 1) * (redundant_comms || commDimPartitioned(d));
+    extendedGaugeResident = createExtendedGauge(*gaugePrecise, R, profileClover, false, recon);
+  }
+  return extendedGaugeResident;
+}
+
+/**
+   @brief Compute the resident clover field from the resident gauge
+   field, together with its inverse and trace log if requested, in a
+   single pass that does not store the field strength tensor
+   @param[in] invertParam Parameters, which set the clover coefficient
+   @param[in] invert Whether to compute the inverse
+   @param[in] compute_tr_log Whether to compute the trace log
+ */
+static void createClover(QudaInvertParam *invertParam, bool invert, bool compute_tr_log)
 {
   profileClover.TPSTART(QUDA_PROFILE_TOTAL);
   if (!cloverPrecise) errorQuda("Clover field not allocated");
 
-  QudaReconstructType recon = (gaugePrecise->Reconstruct() == QUDA_RECONSTRUCT_8) ? QUDA_RECONSTRUCT_12 : gaugePrecise->Reconstruct();
-  // for clover we optimize to only send depth 1 halos in y/z/t (FIXME - make work for x, make robust in general)
-  int R[4];
-  for (int d=0; d<4; d++) R[d] = (d==0 ? 2 : 1) * (redundant_comms || commDimPartitioned(d));
-  cudaGaugeField *gauge = extendedGaugeResident ? extendedGaugeResident : createExtendedGauge(*gaugePrecise, R, profileClover, false, recon);
+  cudaGaugeField *gauge = createCloverGauge();
 
   profileClover.TPSTART(QUDA_PROFILE_INIT);
 
@@ -4322,26 +4711,18 @@ void createCloverQuda(QudaInvertParam* invertParam)
     ex = GaugeField::Create(param);
     ex->copy(*gauge);
   }
-
-  // create the Fmunu field
-  GaugeFieldParam tensorParam(gaugePrecise->X(), ex->Precision(), QUDA_RECONSTRUCT_NO, 0, QUDA_TENSOR_GEOMETRY);
-  tensorParam.siteSubset = QUDA_FULL_SITE_SUBSET;
-  tensorParam.order = QUDA_FLOAT2_GAUGE_ORDER;
-  tensorParam.ghostExchange = QUDA_GHOST_EXCHANGE_NO;
-  cudaGaugeField Fmunu(tensorParam);
   profileClover.TPSTOP(QUDA_PROFILE_INIT);
+
   profileClover.TPSTART(QUDA_PROFILE_COMPUTE);
-  computeFmunu(Fmunu, *ex);
-  computeClover(*cloverPrecise, Fmunu, invertParam->clover_coeff);
+  computeCloverInvert(*cloverPrecise, *ex, invertParam->clover_coeff, invert, compute_tr_log);
   profileClover.TPSTOP(QUDA_PROFILE_COMPUTE);
   profileClover.TPSTOP(QUDA_PROFILE_TOTAL);
 
   if (ex != gauge) delete ex;
-
-  // FIXME always preserve the extended gauge
-  extendedGaugeResident = gauge;
 }
 
+void createCloverQuda(QudaInvertParam* invertParam) { createClover(invertParam, false, false); }
+
 void* createGaugeFieldQuda(void* gauge, int geometry, QudaGaugeParam* param)
 {
   GaugeFieldParam gParam(*param, gauge, QUDA_GENERAL_LINKS);
@@ -4498,19 +4879,14 @@ void computeStaggeredForceQuda(void *h_mom, double dt, double delta, void *, voi
   profileStaggeredForce.TPSTOP(QUDA_PROFILE_FREE);
   profileStaggeredForce.TPSTART(QUDA_PROFILE_COMPUTE);
 
-  // compute quark-field outer product
-  for (int i=0; i<nvector; i++) {
-    ColorSpinorField &x = *(X[i]);
-    // second component is zero since we have no three hop term
-    double coeff[2] = {inv_param->residue[i], 0.0};
-
-    // Operate on even-parity sites
-    computeStaggeredOprod(cudaForce_, x, coeff, 1);
-  }
+  // compute the quark-field outer products of all shifts in a single pass
+  std::vector<std::array<double, 2>> oprod_coeff(nvector);
+  // second component is zero since we have no three hop term
+  for (int i = 0; i < nvector; i++) oprod_coeff[i] = {inv_param->residue[i], 0.0};
+  computeStaggeredOprod(cudaForce_, X, oprod_coeff, 1);
 
-  // mom += delta * [U * force]TA
-  applyU(cudaForce, *gaugePrecise);
-  updateMomentum(*cudaMom, dt * delta, cudaForce, "staggered");
+  // mom += delta * [U * force]TA, applying the link in the momentum update
+  updateMomentum(*cudaMom, dt * delta, cudaForce, *gaugePrecise, "staggered");
   qudaDeviceSynchronize();
 
   profileStaggeredForce.TPSTOP(QUDA_PROFILE_COMPUTE);
@@ -4636,63 +5012,55 @@ void computeHISQForceQuda(void* const milc_momentum,
     qParam.pad = 0;
     for (int dir=0; dir<4; ++dir) qParam.x[dir] = oParam.x[dir];
 
-    // create the device quark field
+    // create the device quark fields, the naik terms reuse the last num_naik_terms of them
     qParam.create = QUDA_NULL_FIELD_CREATE;
     qParam.fieldOrder = QUDA_FLOAT2_FIELD_ORDER;
     qParam.location = QUDA_CUDA_FIELD_LOCATION;
-    ColorSpinorField cudaQuark(qParam);
+    std::vector<ColorSpinorField *> cudaQuark(num_terms);
+    for (auto &q : cudaQuark) q = ColorSpinorField::Create(qParam);
 
     // create the host quark field
     qParam.location = QUDA_CPU_FIELD_LOCATION;
     qParam.create = QUDA_REFERENCE_FIELD_CREATE;
     qParam.fieldOrder = QUDA_SPACE_COLOR_SPIN_FIELD_ORDER;
-    qParam.v = fermion[0];
-
-    { // regular terms
-      GaugeField *oprod[2] = {stapleOprod, naikOprod};
 
-      // loop over different quark fields
-      for(int i=0; i<num_terms; ++i){
-
-        // Wrap the MILC quark field
-        profileHISQForce.TPSTART(QUDA_PROFILE_INIT);
-        qParam.v = fermion[i];
-        ColorSpinorField cpuQuark(qParam); // create host quark field
-        profileHISQForce.TPSTOP(QUDA_PROFILE_INIT);
+    // loop over different quark fields
+    for (int i = 0; i < num_terms; ++i) {
+      // Wrap the MILC quark field
+      profileHISQForce.TPSTART(QUDA_PROFILE_INIT);
+      qParam.v = fermion[i];
+      ColorSpinorField cpuQuark(qParam); // create host quark field
+      profileHISQForce.TPSTOP(QUDA_PROFILE_INIT);
+
+      profileHISQForce.TPSTART(QUDA_PROFILE_H2D);
+      *cudaQuark[i] = cpuQuark;
+      profileHISQForce.TPSTOP(QUDA_PROFILE_H2D);
+    }
 
-        profileHISQForce.TPSTART(QUDA_PROFILE_H2D);
-        cudaQuark = cpuQuark;
-        profileHISQForce.TPSTOP(QUDA_PROFILE_H2D);
+    { // regular terms, the outer products of all quark fields are accumulated in a single pass
+      GaugeField *oprod[2] = {stapleOprod, naikOprod};
+      std::vector<std::array<double, 2>> oprod_coeff(num_terms);
+      for (int i = 0; i < num_terms; ++i) oprod_coeff[i] = {coeff[i][0], coeff[i][1]};
 
-        profileHISQForce.TPSTART(QUDA_PROFILE_COMPUTE);
-        computeStaggeredOprod(oprod, cudaQuark, coeff[i], 3);
-        profileHISQForce.TPSTOP(QUDA_PROFILE_COMPUTE);
-      }
+      profileHISQForce.TPSTART(QUDA_PROFILE_COMPUTE);
+      computeStaggeredOprod(oprod, cudaQuark, oprod_coeff, 3);
+      profileHISQForce.TPSTOP(QUDA_PROFILE_COMPUTE);
     }
 
     { // naik terms
+      profileHISQForce.TPSTART(QUDA_PROFILE_COMPUTE);
       oneLinkOprod->copy(*stapleOprod);
       ax(level2_coeff[0], *oneLinkOprod);
       GaugeField *oprod[2] = {oneLinkOprod, naikOprod};
+      std::vector<ColorSpinorField *> naikQuark(cudaQuark.end() - num_naik_terms, cudaQuark.end());
+      std::vector<std::array<double, 2>> oprod_coeff(num_naik_terms);
+      for (int i = 0; i < num_naik_terms; ++i) oprod_coeff[i] = {coeff[i + num_terms][0], coeff[i + num_terms][1]};
 
-      // loop over different quark fields
-      for(int i=0; i<num_naik_terms; ++i){
-
-        // Wrap the MILC quark field
-        profileHISQForce.TPSTART(QUDA_PROFILE_INIT);
-        qParam.v = fermion[i + num_terms - num_naik_terms];
-        ColorSpinorField cpuQuark(qParam); // create host quark field
-        profileHISQForce.TPSTOP(QUDA_PROFILE_INIT);
-
-        profileHISQForce.TPSTART(QUDA_PROFILE_H2D);
-        cudaQuark = cpuQuark;
-        profileHISQForce.TPSTOP(QUDA_PROFILE_H2D);
-
-        profileHISQForce.TPSTART(QUDA_PROFILE_COMPUTE);
-        computeStaggeredOprod(oprod, cudaQuark, coeff[i + num_terms], 3);
-        profileHISQForce.TPSTOP(QUDA_PROFILE_COMPUTE);
-      }
+      computeStaggeredOprod(oprod, naikQuark, oprod_coeff, 3);
+      profileHISQForce.TPSTOP(QUDA_PROFILE_COMPUTE);
     }
+
+    for (auto q : cudaQuark) delete q;
   }
 
   profileHISQForce.TPSTART(QUDA_PROFILE_INIT);
@@ -4796,6 +5164,7 @@ void computeCloverForceQuda(void *h_mom, double dt, void **h_x, void **, double
 
   checkGaugeParam(gauge_param);
   if (!gaugePrecise) errorQuda("No resident gauge field");
+  if (cloverPrecise && cloverPrecise->OnTheFly()) errorQuda("Clover force not supported with on-the-fly clover");
 
   GaugeFieldParam fParam(*gauge_param, h_mom, QUDA_ASQTAD_MOM_LINKS);
   // create the host momentum field
@@ -4808,11 +5177,12 @@ void computeCloverForceQuda(void *h_mom, double dt, void **h_x, void **, double
   fParam.order = QUDA_FLOAT2_GAUGE_ORDER;
   cudaGaugeField cudaMom(fParam);
 
-  // create the device force field
+  // create the device force field: only its traceless anti-hermitian
+  // projection enters the momentum, so it is accumulated compressed
   fParam.link_type = QUDA_GENERAL_LINKS;
   fParam.create = QUDA_ZERO_FIELD_CREATE;
   fParam.order = QUDA_FLOAT2_GAUGE_ORDER;
-  fParam.reconstruct = QUDA_RECONSTRUCT_NO;
+  fParam.reconstruct = QUDA_RECONSTRUCT_10;
   cudaGaugeField cudaForce(fParam);
 
   ColorSpinorParam qParam;
@@ -4862,8 +5232,9 @@ void computeCloverForceQuda(void *h_mom, double dt, void **h_x, void **, double
 
   cudaGaugeField &gaugeEx = *extendedGaugeResident;
 
-  // create oprod and trace fields
+  // create oprod and trace fields, which are stored uncompressed
   fParam.geometry = QUDA_TENSOR_GEOMETRY;
+  fParam.reconstruct = QUDA_RECONSTRUCT_NO;
   cudaGaugeField oprod(fParam);
 
   profileCloverForce.TPSTOP(QUDA_PROFILE_INIT);
@@ -4975,6 +5346,7 @@ void updateGaugeFieldQuda(void* gauge,
 			  int exact,
 			  QudaGaugeParam* param)
 {
+  operator_version++;
   profileGaugeUpdate.TPSTART(QUDA_PROFILE_TOTAL);
 
   checkGaugeParam(param);
@@ -5068,7 +5440,62 @@ void updateGaugeFieldQuda(void* gauge,
   profileGaugeUpdate.TPSTOP(QUDA_PROFILE_TOTAL);
 }
 
+void hmcTrajectoryQuda(QudaHMCParam *param)
+{
+  profileHMC.TPSTART(QUDA_PROFILE_TOTAL);
+  checkHMCParam(param);
+  if (getVerbosity() >= QUDA_DEBUG_VERBOSE) printQudaHMCParam(param);
+  if (!gaugePrecise) errorQuda("No resident gauge field to use");
+
+  profileHMC.TPSTART(QUDA_PROFILE_INIT);
+  if (!momResident) {
+    if (!param->refresh_mom) errorQuda("No resident momentum field to use");
+    GaugeFieldParam gParam(*gaugePrecise);
+    gParam.create = QUDA_ZERO_FIELD_CREATE;
+    gParam.link_type = QUDA_ASQTAD_MOM_LINKS;
+    gParam.reconstruct = QUDA_RECONSTRUCT_10;
+    gParam.ghostExchange = QUDA_GHOST_EXCHANGE_NO;
+    gParam.pad = 0;
+    momResident = new cudaGaugeField(gParam);
+  }
+  profileHMC.TPSTOP(QUDA_PROFILE_INIT);
+
+  // the rectangle staples need the full halo depth R
+  for (int d = 0; d < 4 && extendedGaugeResident; d++) {
+    if (extendedGaugeResident->R()[d] < R[d]) {
+      delete extendedGaugeResident;
+      extendedGaugeResident = nullptr;
+    }
+  }
+  if (!extendedGaugeResident) extendedGaugeResident = createExtendedGauge(*gaugePrecise, R, profileHMC);
+
+  bool external = false;
+  for (int i = 0; i < param->n_term; i++) external = external || param->term[i].type == QUDA_HMC_EXTERNAL_TERM;
+
+  // keep the extended field in step with the field the gauge terms see, and the
+  // sloppy copies used by the external terms' solvers in step with gaugePrecise
+  std::function<void(const GaugeField &)> gauge_updated = [&](const GaugeField &src) {
+    operator_version++;
+    extendedGaugeResident->copy(src);
+    extendedGaugeResident->exchangeExtendedGhost(R, profileHMC, redundant_comms);
+    if (!external || &src != gaugePrecise) return;
+    std::vector<cudaGaugeField *> updated = {gaugePrecise};
+    for (auto g : {gaugeSloppy, gaugePrecondition, gaugeRefinement, gaugeEigensolver}) {
+      if (g && std::find(updated.begin(), updated.end(), g) == updated.end()) {
+        g->copy(*gaugePrecise);
+        updated.push_back(g);
+      }
+    }
+  };
+
+  HMCIntegrator hmc(*param, *gaugePrecise, *extendedGaugeResident, *momResident, gauge_updated, profileHMC);
+  hmc.trajectory();
+
+  profileHMC.TPSTOP(QUDA_PROFILE_TOTAL);
+}
+
  void projectSU3Quda(void *gauge_h, double tol, QudaGaugeParam *param) {
+   operator_version++;
    profileProject.TPSTART(QUDA_PROFILE_TOTAL);
 
    profileProject.TPSTART(QUDA_PROFILE_INIT);
@@ -5130,6 +5557,7 @@ void updateGaugeFieldQuda(void* gauge,
  }
 
  void staggeredPhaseQuda(void *gauge_h, QudaGaugeParam *param) {
+   operator_version++;
    profilePhase.TPSTART(QUDA_PROFILE_TOTAL);
 
    profilePhase.TPSTART(QUDA_PROFILE_INIT);
@@ -5243,6 +5671,7 @@ double momActionQuda(void* momentum, QudaGaugeParam* param)
 
 void gaussGaugeQuda(unsigned long long seed, double sigma)
 {
+  operator_version++;
   profileGauss.TPSTART(QUDA_PROFILE_TOTAL);
 
   if (!gaugePrecise) errorQuda("Cannot generate Gauss GaugeField as there is no resident gauge field");
@@ -5316,7 +5745,9 @@ void performWuppertalnStep(void *h_out, void *h_in, QudaInvertParam *inv_param,
     GaugeFieldParam gParam(*gaugePrecise);
     gParam.create = QUDA_NULL_FIELD_CREATE;
     precise = new cudaGaugeField(gParam);
+    residency::acquire(*gaugeSmeared);
     copyExtendedGauge(*precise, *gaugeSmeared, QUDA_CUDA_FIELD_LOCATION);
+    residency::release(*gaugeSmeared);
     precise->exchangeGhost();
   } else {
     if (getVerbosity() >= QUDA_VERBOSE)
@@ -5404,6 +5835,7 @@ void performAPEnStep(unsigned int n_steps, double alpha, int meas_interval)
   }
 
   delete cudaGaugeTemp;
+  residency::add(*gaugeSmeared); // may be spilled to the host under memory pressure
   profileAPE.TPSTOP(QUDA_PROFILE_TOTAL);
 }
 
@@ -5438,6 +5870,7 @@ void performSTOUTnStep(unsigned int n_steps, double rho, int meas_interval)
   }
 
   delete cudaGaugeTemp;
+  residency::add(*gaugeSmeared); // may be spilled to the host under memory pressure
   profileSTOUT.TPSTOP(QUDA_PROFILE_TOTAL);
 }
 
@@ -5472,6 +5905,7 @@ void performOvrImpSTOUTnStep(unsigned int n_steps, double rho, double epsilon, i
   }
 
   delete cudaGaugeTemp;
+  residency::add(*gaugeSmeared); // may be spilled to the host under memory pressure
   profileOvrImpSTOUT.TPSTOP(QUDA_PROFILE_TOTAL);
 }
 
@@ -5524,6 +5958,110 @@ void performWFlownStep(unsigned int n_steps, double step_size, int meas_interval
 
   delete gaugeTemp;
   delete gaugeAux;
+  residency::add(*gaugeSmeared); // may be spilled to the host under memory pressure
+  profileWFlow.TPSTOP(QUDA_PROFILE_TOTAL);
+  popOutputPrefix();
+}
+
+void performWFlowQuda(QudaGaugeFlowParam *param)
+{
+  pushOutputPrefix("performWFlowQuda: ");
+  profileWFlow.TPSTART(QUDA_PROFILE_TOTAL);
+
+  checkGaugeFlowParam(param);
+  for (int i = 0; i < param->n_meas; i++) checkGaugeObservableParam(&param->obs_param[i]);
+  if (getVerbosity() >= QUDA_DEBUG_VERBOSE) printQudaGaugeFlowParam(param);
+
+  if (gaugePrecise == nullptr) errorQuda("Gauge field must be loaded");
+
+  if (gaugeSmeared != nullptr) delete gaugeSmeared;
+  gaugeSmeared = createExtendedGauge(*gaugePrecise, R, profileWFlow);
+
+  profileWFlow.TPSTART(QUDA_PROFILE_INIT);
+  GaugeFieldParam gParamEx(*gaugeSmeared);
+  auto *gaugeAux = GaugeField::Create(gParamEx);
+
+  GaugeFieldParam gParam(*gaugePrecise);
+  gParam.reconstruct = QUDA_RECONSTRUCT_NO; // temporary field is not on manifold so cannot use reconstruct
+  auto *gaugeTemp = GaugeField::Create(gParam);
+
+  // adaptive stepping needs space for the error estimate, and a copy of the field to restart rejected steps from
+  const bool adaptive = param->adaptive == QUDA_BOOLEAN_TRUE;
+  GaugeField *gaugeErr = adaptive ? GaugeField::Create(gParam) : nullptr;
+  GaugeField *gaugeStart = adaptive ? GaugeField::Create(gParamEx) : nullptr;
+  profileWFlow.TPSTOP(QUDA_PROFILE_INIT);
+
+  GaugeField *in = gaugeSmeared;
+  GaugeField *out = gaugeAux;
+
+  double t = 0.0;
+  double epsilon = param->step_size;
+  param->n_steps = 0;
+  param->n_rejected = 0;
+
+  for (int m = 0; m < param->n_meas; m++) {
+    while (t < param->meas_time[m]) {
+      // shorten the step rather than flowing past the measurement time
+      const bool clipped = t + epsilon >= param->meas_time[m];
+      const double h = clipped ? param->meas_time[m] - t : epsilon;
+
+      profileWFlow.TPSTART(QUDA_PROFILE_COMPUTE);
+      if (adaptive) gaugeStart->copy(*in);
+      double dist = WFlowStep(*out, *gaugeTemp, *in, h, param->wflow_type, gaugeErr);
+      profileWFlow.TPSTOP(QUDA_PROFILE_COMPUTE);
+
+      if (adaptive) {
+        // the local error is third order in the step size, and a
+        // non-finite error means the step blew up, so shrink maximally
+        const bool finite = std::isfinite(dist);
+        double scale = !finite ? 0.2 : dist > 0.0 ? 0.95 * std::cbrt(param->tol / dist) : 2.0;
+        double next = h * std::min(std::max(scale, 0.2), 2.0);
+        if (param->step_size_max > 0.0) next = std::min(next, param->step_size_max);
+
+        if (!finite || dist > param->tol) {
+          if (next <= std::numeric_limits<double>::epsilon() * param->meas_time[m])
+            errorQuda("Step size %e underflow at t = %e with error %e", next, t, dist);
+          if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
+            printfQuda("Rejected step %e at t = %e with error %e, retrying with %e\n", h, t, dist, next);
+          in->copy(*gaugeStart);
+          in->exchangeExtendedGhost(in->R(), false);
+          epsilon = next;
+          param->n_rejected++;
+          continue;
+        }
+
+        // a step clipped to the measurement time says little about the next step size
+        if (!clipped || next > epsilon) epsilon = next;
+      }
+
+      std::swap(in, out); // output from this step becomes input for next step
+      t = clipped ? param->meas_time[m] : t + h;
+      param->n_steps++;
+    }
+
+    QudaGaugeObservableParam &obs = param->obs_param[m];
+    gaugeObservables(*in, obs, profileWFlow);
+    if (getVerbosity() >= QUDA_VERBOSE) {
+      printfQuda("t = %le (%d steps, step size %le)\n", t, param->n_steps, epsilon);
+      if (obs.compute_plaquette) printfQuda("plaquette %.16e\n", obs.plaquette[0]);
+      if (obs.compute_qcharge || obs.compute_qcharge_density)
+        printfQuda("E_tot %+.16e, Q charge %+.16e\n", obs.energy[0], obs.qcharge);
+    }
+  }
+
+  if (in != gaugeSmeared) {
+    gaugeSmeared->copy(*in);
+    gaugeSmeared->exchangeExtendedGhost(gaugeSmeared->R(), false);
+  }
+
+  if (getVerbosity() >= QUDA_SUMMARIZE)
+    printfQuda("Flowed to t = %e in %d steps (%d rejected)\n", t, param->n_steps, param->n_rejected);
+
+  delete gaugeStart;
+  delete gaugeErr;
+  delete gaugeTemp;
+  delete gaugeAux;
+  residency::add(*gaugeSmeared); // may be spilled to the host under memory pressure
   profileWFlow.TPSTOP(QUDA_PROFILE_TOTAL);
   popOutputPrefix();
 }
@@ -5533,6 +6071,7 @@ int computeGaugeFixingOVRQuda(void *gauge, const unsigned int gauge_dir, const u
                               const unsigned int reunit_interval, const unsigned int stopWtheta, QudaGaugeParam *param,
                               double *timeinfo)
 {
+  operator_version++;
   GaugeFixOVRQuda.TPSTART(QUDA_PROFILE_TOTAL);
 
   checkGaugeParam(param);
@@ -5607,6 +6146,7 @@ int computeGaugeFixingFFTQuda(void* gauge, const unsigned int gauge_dir,  const
   const unsigned int verbose_interval, const double alpha, const unsigned int autotune, const double tolerance, \
   const unsigned int  stopWtheta, QudaGaugeParam* param , double* timeinfo)
 {
+  operator_version++;
   GaugeFixFFTQuda.TPSTART(QUDA_PROFILE_TOTAL);
 
   checkGaugeParam(param);
@@ -5638,12 +6178,22 @@ int computeGaugeFixingFFTQuda(void* gauge, const unsigned int gauge_dir,  const
 
   GaugeFixFFTQuda.TPSTOP(QUDA_PROFILE_H2D);
 
-  // perform the update
-  GaugeFixFFTQuda.TPSTART(QUDA_PROFILE_COMPUTE);
+  if (comm_size() == 1) {
+    // perform the update
+    GaugeFixFFTQuda.TPSTART(QUDA_PROFILE_COMPUTE);
+    gaugeFixingFFT(*cudaInGauge, gauge_dir, Nsteps, verbose_interval, alpha, autotune, tolerance, stopWtheta);
+    GaugeFixFFTQuda.TPSTOP(QUDA_PROFILE_COMPUTE);
+  } else {
+    cudaGaugeField *cudaInGaugeEx = createExtendedGauge(*cudaInGauge, R, GaugeFixFFTQuda);
 
-  gaugeFixingFFT(*cudaInGauge, gauge_dir, Nsteps, verbose_interval, alpha, autotune, tolerance, stopWtheta);
+    // perform the update
+    GaugeFixFFTQuda.TPSTART(QUDA_PROFILE_COMPUTE);
+    gaugeFixingFFT(*cudaInGaugeEx, gauge_dir, Nsteps, verbose_interval, alpha, autotune, tolerance, stopWtheta);
+    GaugeFixFFTQuda.TPSTOP(QUDA_PROFILE_COMPUTE);
 
-  GaugeFixFFTQuda.TPSTOP(QUDA_PROFILE_COMPUTE);
+    copyExtendedGauge(*cudaInGauge, *cudaInGaugeEx, QUDA_CUDA_FIELD_LOCATION);
+    delete cudaInGaugeEx;
+  }
 
   // copy the gauge field back to the host
   GaugeFixFFTQuda.TPSTART(QUDA_PROFILE_D2H);
@@ -5725,6 +6275,110 @@ void contractQuda(const void *hp_x, const void *hp_y, void *h_result, const Quda
   profileContract.TPSTOP(QUDA_PROFILE_TOTAL);
 }
 
+void contractFTQuda(const void *hp_x, const void *hp_y, double *h_result, const QudaContractType cType,
+                    QudaInvertParam *param, const int *X, const int *source_position, const int *mom, int n_mom)
+{
+  profileContract.TPSTART(QUDA_PROFILE_TOTAL);
+  profileContract.TPSTART(QUDA_PROFILE_INIT);
+
+  // wrap CPU host side pointers
+  ColorSpinorParam cpuParam((void *)hp_x, *param, X, false, param->input_location);
+  ColorSpinorField *h_x = ColorSpinorField::Create(cpuParam);
+
+  cpuParam.v = (void *)hp_y;
+  ColorSpinorField *h_y = ColorSpinorField::Create(cpuParam);
+
+  // Create device parameter, with the Degrand-Rossi basis used for contractions
+  ColorSpinorParam cudaParam(cpuParam);
+  cudaParam.location = QUDA_CUDA_FIELD_LOCATION;
+  cudaParam.create = QUDA_NULL_FIELD_CREATE;
+  cudaParam.gammaBasis = QUDA_DEGRAND_ROSSI_GAMMA_BASIS;
+  cudaParam.setPrecision(cpuParam.Precision(), cpuParam.Precision(), true);
+
+  ColorSpinorField *x = ColorSpinorField::Create(cudaParam);
+  ColorSpinorField *y = ColorSpinorField::Create(cudaParam);
+
+  std::vector<Complex> result(n_mom * 16 * comm_dim(3) * X[3]);
+  profileContract.TPSTOP(QUDA_PROFILE_INIT);
+
+  profileContract.TPSTART(QUDA_PROFILE_H2D);
+  *x = *h_x;
+  *y = *h_y;
+  profileContract.TPSTOP(QUDA_PROFILE_H2D);
+
+  profileContract.TPSTART(QUDA_PROFILE_COMPUTE);
+  contractSummedQuda(*x, *y, result, cType, source_position, mom, n_mom);
+  profileContract.TPSTOP(QUDA_PROFILE_COMPUTE);
+
+  profileContract.TPSTART(QUDA_PROFILE_FREE);
+  memcpy(h_result, result.data(), result.size() * sizeof(Complex));
+  delete x;
+  delete y;
+  delete h_y;
+  delete h_x;
+  profileContract.TPSTOP(QUDA_PROFILE_FREE);
+
+  profileContract.TPSTOP(QUDA_PROFILE_TOTAL);
+}
+
+void contractPropagatorsQuda(void **props, int n_flavor, const int *flavors, int n_pair, const int *gamma,
+                             int n_gamma, double *meson, double *baryon, QudaInvertParam *param, const int *X)
+{
+  profileContract.TPSTART(QUDA_PROFILE_TOTAL);
+  profileContract.TPSTART(QUDA_PROFILE_INIT);
+
+  for (int p = 0; p < 2 * n_pair; p++)
+    if (flavors[p] < 0 || flavors[p] >= n_flavor) errorQuda("Invalid flavor %d", flavors[p]);
+
+  ColorSpinorParam cpuParam(props[0], *param, X, false, param->input_location);
+  ColorSpinorParam cudaParam(cpuParam);
+  cudaParam.location = QUDA_CUDA_FIELD_LOCATION;
+  cudaParam.create = QUDA_NULL_FIELD_CREATE;
+  cudaParam.gammaBasis = QUDA_DEGRAND_ROSSI_GAMMA_BASIS;
+  cudaParam.setPrecision(cpuParam.Precision(), cpuParam.Precision(), true);
+
+  std::vector<std::vector<ColorSpinorField *>> prop(n_flavor);
+  for (auto &f : prop)
+    for (int i = 0; i < 12; i++) f.push_back(ColorSpinorField::Create(cudaParam));
+  profileContract.TPSTOP(QUDA_PROFILE_INIT);
+
+  profileContract.TPSTART(QUDA_PROFILE_H2D);
+  for (int f = 0; f < n_flavor; f++) {
+    for (int i = 0; i < 12; i++) {
+      cpuParam.v = props[12 * f + i];
+      ColorSpinorField *h = ColorSpinorField::Create(cpuParam);
+      *prop[f][i] = *h;
+      delete h;
+    }
+  }
+  profileContract.TPSTOP(QUDA_PROFILE_H2D);
+
+  profileContract.TPSTART(QUDA_PROFILE_COMPUTE);
+  const int T = comm_dim(3) * X[3];
+  for (int p = 0; p < n_pair; p++) {
+    auto &S1 = prop[flavors[2 * p + 0]];
+    auto &S2 = prop[flavors[2 * p + 1]];
+    if (meson) {
+      std::vector<Complex> result(n_gamma * T);
+      contractMesonQuda(S1, S2, result, gamma, n_gamma);
+      memcpy(meson + 2 * p * n_gamma * T, result.data(), result.size() * sizeof(Complex));
+    }
+    if (baryon) {
+      std::vector<Complex> result(T);
+      contractBaryonQuda(S1, S2, result);
+      memcpy(baryon + 2 * p * T, result.data(), result.size() * sizeof(Complex));
+    }
+  }
+  profileContract.TPSTOP(QUDA_PROFILE_COMPUTE);
+
+  profileContract.TPSTART(QUDA_PROFILE_FREE);
+  for (auto &f : prop)
+    for (auto &s : f) delete s;
+  profileContract.TPSTOP(QUDA_PROFILE_FREE);
+
+  profileContract.TPSTOP(QUDA_PROFILE_TOTAL);
+}
+
 void gaugeObservablesQuda(QudaGaugeObservableParam *param)
 {
   profileGaugeObs.TPSTART(QUDA_PROFILE_TOTAL);
@@ -5738,6 +6392,70 @@ void gaugeObservablesQuda(QudaGaugeObservableParam *param)
     gauge = gaugeSmeared;
   }
 
+  residency::acquire(*gauge);
   gaugeObservables(*gauge, *param, profileGaugeObs);
+  residency::release(*gauge);
   profileGaugeObs.TPSTOP(QUDA_PROFILE_TOTAL);
 }
+
+void computeGaugeLoopsQuda(QudaGaugeLoopParam *param)
+{
+  profileGaugeLoops.TPSTART(QUDA_PROFILE_TOTAL);
+  checkGaugeLoopParam(param);
+
+  cudaGaugeField *gauge = nullptr;
+  if (!gaugeSmeared) {
+    if (!extendedGaugeResident) extendedGaugeResident = createExtendedGauge(*gaugePrecise, R, profileGaugeLoops);
+    gauge = extendedGaugeResident;
+  } else {
+    gauge = gaugeSmeared;
+  }
+  residency::acquire(*gauge);
+
+  if (param->compute_polyakov_loop) {
+    profileGaugeLoops.TPSTART(QUDA_PROFILE_INIT);
+    size_t size = 2 * sizeof(double) * gauge->LocalVolume() / gauge->LocalX()[3];
+    void *density = param->polyakov_loop_density ? pool_device_malloc(size) : nullptr;
+    profileGaugeLoops.TPSTOP(QUDA_PROFILE_INIT);
+
+    profileGaugeLoops.TPSTART(QUDA_PROFILE_COMPUTE);
+    polyakovLoop(param->polyakov_loop, density, *gauge);
+    profileGaugeLoops.TPSTOP(QUDA_PROFILE_COMPUTE);
+
+    if (density) {
+      profileGaugeLoops.TPSTART(QUDA_PROFILE_D2H);
+      qudaMemcpy(param->polyakov_loop_density, density, size, qudaMemcpyDeviceToHost);
+      pool_device_free(density);
+      profileGaugeLoops.TPSTOP(QUDA_PROFILE_D2H);
+    }
+  }
+
+  if (param->r_max > 0 && param->t_max > 0) {
+    // smear a copy of the spatial links, leaving the loaded field untouched
+    GaugeField *u = gauge;
+    std::unique_ptr<cudaGaugeField> smeared;
+    if (param->n_ape > 0) {
+      profileGaugeLoops.TPSTART(QUDA_PROFILE_INIT);
+      GaugeFieldParam gParam(*gauge);
+      smeared = std::make_unique<cudaGaugeField>(gParam);
+      cudaGaugeField tmp(gParam);
+      smeared->copy(*gauge);
+      smeared->exchangeExtendedGhost(smeared->R(), false);
+      profileGaugeLoops.TPSTOP(QUDA_PROFILE_INIT);
+
+      profileGaugeLoops.TPSTART(QUDA_PROFILE_COMPUTE);
+      for (int i = 0; i < param->n_ape; i++) APEStep(*smeared, tmp, param->ape_alpha);
+      profileGaugeLoops.TPSTOP(QUDA_PROFILE_COMPUTE);
+      u = smeared.get();
+    }
+
+    profileGaugeLoops.TPSTART(QUDA_PROFILE_COMPUTE);
+    std::vector<double> loops;
+    wilsonLoops(loops, *u, param->r_max, param->t_max);
+    std::copy(loops.begin(), loops.end(), param->wilson_loop);
+    profileGaugeLoops.TPSTOP(QUDA_PROFILE_COMPUTE);
+  }
+
+  residency::release(*gauge);
+  profileGaugeLoops.TPSTOP(QUDA_PROFILE_TOTAL);
+}
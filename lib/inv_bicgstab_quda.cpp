@@ -198,7 +198,9 @@ namespace quda {
     while ( !convergence(r2, heavy_quark_res, stop, param.tol_hq) && 
 	    k < param.maxiter) {
     
+      telemetryStart(SolverTimer::op);
       matSloppy(v, p, tmp);
+      telemetryStop(SolverTimer::op);
 
       Complex r0v;
       if (param.pipeline) {
@@ -213,7 +215,9 @@ namespace quda {
       // r -= alpha*v
       blas::caxpy(-alpha, v, rSloppy);
 
+      telemetryStart(SolverTimer::op);
       matSloppy(t, rSloppy, tmp);
+      telemetryStop(SolverTimer::op);
     
       int updateR = 0;
       if (param.pipeline) {
@@ -261,12 +265,17 @@ namespace quda {
       if (!param.pipeline) updateR = reliable(rNorm, maxrx, maxrr, r2, delta);
 
       if (updateR) {
+        if (telemetry) telemetry->reliableUpdate();
 	if (x.Precision() != xSloppy.Precision()) blas::copy(x, xSloppy);
       
 	blas::xpy(x, y); // swap these around?
 
+        double r2_iter = r2;
+        telemetryStart(SolverTimer::op);
 	mat(r, y, x);
+        telemetryStop(SolverTimer::op);
 	r2 = blas::xmyNorm(b, r);
+        reliableUpdate(delta, r2_iter, r2);
 
 	if (x.Precision() != rSloppy.Precision()) blas::copy(rSloppy, r);            
 	blas::zero(xSloppy);
@@ -298,6 +307,8 @@ namespace quda {
     if (x.Precision() != xSloppy.Precision()) blas::copy(x, xSloppy);
     blas::xpy(y, x);
 
+    if (param.adaptive_reliable) param.delta = delta;
+
     profile.TPSTOP(QUDA_PROFILE_COMPUTE);
     profile.TPSTART(QUDA_PROFILE_EPILOGUE);
 
@@ -480,10 +480,13 @@ namespace quda {
     }
 
     while ( !converged && k < param.maxiter ) {
+      telemetryStart(SolverTimer::op);
       matSloppy(Ap, *p[j], tmp, tmp2);  // tmp as tmp
+      telemetryStop(SolverTimer::op);
       double sigma;
 
       bool breakdown = false;
+      telemetryStart(SolverTimer::reduce);
       if (param.pipeline) {
         double Ap2;
         //TODO: alternative reliable updates - need r2, Ap2, pAp, p norm
@@ -524,6 +527,7 @@ namespace quda {
         r2 = real(cg_norm);  // (r_new, r_new)
         sigma = imag(cg_norm) >= 0.0 ? imag(cg_norm) : r2;  // use r2 if (r_k+1, r_k+1-r_k) breaks
       }
+      telemetryStop(SolverTimer::reduce);
 
       // reliable update conditions
       rNorm = sqrt(r2);
@@ -553,6 +557,7 @@ namespace quda {
       }
 
       if ( !(updateR || updateX )) {
+        telemetryStart(SolverTimer::blas);
         beta = sigma / r2_old;  // use the alternative beta computation
 
         if (param.pipeline && !breakdown) {
@@ -599,8 +604,10 @@ namespace quda {
             printfQuda("New dnew: %e (r %e , y %e)\n",d_new,u*rNorm,uhigh*Anorm * sqrt(blas::norm2(y)) );
         }
         steps_since_reliable++;
+        telemetryStop(SolverTimer::blas);
 
       } else {
+        if (telemetry) telemetry->reliableUpdate();
 
 	{
 	  std::vector<ColorSpinorField*> x_;
@@ -612,9 +619,13 @@ namespace quda {
 
         blas::copy(x, xSloppy); // nop when these pointers alias
 
+        double r2_iter = r2;
         blas::xpy(x, y); // swap these around?
+        telemetryStart(SolverTimer::op);
         mat(r, y, x, tmp3); //  here we can use x as tmp
+        telemetryStop(SolverTimer::op);
         r2 = blas::xmyNorm(b, r);
+        reliableUpdate(delta, r2_iter, r2);
 
         if (param.deflate && sqrt(r2) < maxr_deflate * param.tol_restart) {
           // Deflate and accumulate to solution vector
@@ -751,6 +762,8 @@ namespace quda {
     blas::copy(x, xSloppy);
     blas::xpy(y, x);
 
+    if (param.adaptive_reliable && delta > 0.0) param.delta = delta;
+
     if (!param.is_preconditioner) {
       profile.TPSTOP(QUDA_PROFILE_COMPUTE);
       profile.TPSTART(QUDA_PROFILE_EPILOGUE);
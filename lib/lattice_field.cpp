@@ -1,9 +1,11 @@
 #include <typeinfo>
+#include <limits>
 #include <quda_internal.h>
 #include <lattice_field.h>
 #include <color_spinor_field.h>
 #include <gauge_field.h>
 #include <clover_field.h>
+#include <field_residency.h>
 
 namespace quda {
 
@@ -83,7 +85,9 @@ namespace quda {
     mem_type(param.mem_type),
     backup_h(nullptr),
     backup_norm_h(nullptr),
-    backed_up(false)
+    backed_up(false),
+    spill_h(nullptr),
+    spilled(false)
   {
     precisionCheck();
 
@@ -185,7 +189,9 @@ namespace quda {
     mem_type(field.mem_type),
     backup_h(nullptr),
     backup_norm_h(nullptr),
-    backed_up(false)
+    backed_up(false),
+    spill_h(nullptr),
+    spilled(false)
   {
     precisionCheck();
 
@@ -227,7 +233,7 @@ namespace quda {
     setTuningString();
   }
 
-  LatticeField::~LatticeField() { }
+  LatticeField::~LatticeField() { residency::remove(*this); }
 
   void LatticeField::allocateGhostBuffer(size_t ghost_bytes) const
   {
@@ -618,4 +624,29 @@ namespace quda {
   QudaFieldLocation reorder_location() { return reorder_location_; }
   void reorder_location_set(QudaFieldLocation _reorder_location) { reorder_location_ = _reorder_location; }
 
+  static HaloCompressionStats halo_compression_stats;
+
+  const HaloCompressionStats &getHaloCompressionStats() { return halo_compression_stats; }
+
+  void recordHaloCompression(size_t bytes, size_t bytes_full, QudaPrecision ghost_precision)
+  {
+    // fixed-point halos are rounded relative to their norm, floating-point halos to their exponent
+    double bound = ghost_precision == QUDA_SINGLE_PRECISION ? 0.5 * std::numeric_limits<float>::epsilon() :
+                                                              0.5 / ((1 << (8 * ghost_precision - 1)) - 1);
+    auto &stats = halo_compression_stats;
+    stats.exchanges++;
+    stats.bytes += bytes;
+    stats.bytes_full += bytes_full;
+    stats.rounding_bound = std::max(stats.rounding_bound, bound);
+  }
+
+  void printHaloCompressionStats()
+  {
+    const auto &stats = halo_compression_stats;
+    if (stats.exchanges == 0) return;
+    printfQuda("Compressed halo exchanges: %lld, %.3e bytes sent of %.3e (%.1f%% saved), rounding bound %.3e\n",
+               stats.exchanges, stats.bytes, stats.bytes_full, 100.0 * (1.0 - stats.bytes / stats.bytes_full),
+               stats.rounding_bound);
+  }
+
 } // namespace quda
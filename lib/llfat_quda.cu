@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstdio>
 
 #include <quda_internal.h>
@@ -17,11 +18,12 @@ namespace quda {
     unsigned int minThreads() const { return arg.threads.x; }
 
   public:
-    LongLink(const GaugeField &u, GaugeField &lng, double coeff) :
-      TunableKernel3D(lng, 2, 4),
-      arg(lng, u, coeff)
+    LongLink(const GaugeField &u, const std::vector<GaugeField *> &lng, const std::vector<double> &coeff) :
+      TunableKernel3D(*lng[0], 2, 4),
+      arg(lng, {}, u, coeff)
     {
       strcat(aux, comm_dim_partitioned_string());
+      if (arg.n_set > 1) strcat(aux, ",n_set=2");
       apply(device::get_default_stream());
     }
 
@@ -30,11 +32,11 @@ namespace quda {
       launch<ComputeLongLink>(tp, stream, arg);
     }
 
-    long long flops() const { return 2*4*arg.threads.x*198; }
-    long long bytes() const { return 2*4*arg.threads.x*(3*arg.u.Bytes()+arg.link.Bytes()); }
+    long long flops() const { return 2*4*arg.threads.x*(198 + 18*(arg.n_set-1)); }
+    long long bytes() const { return 2*4*arg.threads.x*(3*arg.u.Bytes()+arg.n_set*arg.link[0].Bytes()); }
   };
 
-  void computeLongLink(GaugeField &lng, const GaugeField &u, double coeff)
+  void computeLongLink(const std::vector<GaugeField *> &lng, const GaugeField &u, const std::vector<double> &coeff)
   {
     instantiate<LongLink, ReconstructNo12>(u, lng, coeff); // u first arg so we pick its recon
   }
@@ -45,11 +47,12 @@ namespace quda {
     unsigned int minThreads() const { return arg.threads.x; }
 
   public:
-    OneLink(const GaugeField &u, GaugeField &fat, double coeff) :
-      TunableKernel3D(fat, 2, 4),
-      arg(fat, u, coeff)
+    OneLink(const GaugeField &u, const std::vector<GaugeField *> &fat, const std::vector<double> &coeff) :
+      TunableKernel3D(*fat[0], 2, 4),
+      arg(fat, {}, u, coeff)
     {
       strcat(aux, comm_dim_partitioned_string());
+      if (arg.n_set > 1) strcat(aux, ",n_set=2");
       apply(device::get_default_stream());
     }
 
@@ -58,19 +61,52 @@ namespace quda {
       launch<ComputeOneLink>(tp, stream, arg);
     }
 
-    long long flops() const { return 2*4*arg.threads.x*18; }
-    long long bytes() const { return 2*4*arg.threads.x*(arg.u.Bytes()+arg.link.Bytes()); }
+    long long flops() const { return 2*4*arg.threads.x*18*arg.n_set; }
+    long long bytes() const { return 2*4*arg.threads.x*(arg.u.Bytes()+arg.n_set*arg.link[0].Bytes()); }
   };
 
-  void computeOneLink(GaugeField &fat, const GaugeField &u, double coeff)
+  void computeOneLink(const std::vector<GaugeField *> &fat, const GaugeField &u, const std::vector<double> &coeff)
   {
     if (u.StaggeredPhase() != QUDA_STAGGERED_PHASE_MILC && u.Reconstruct() != QUDA_RECONSTRUCT_NO)
       errorQuda("Staggered phase type %d not supported", u.StaggeredPhase());
     instantiate<OneLink, ReconstructNo12>(u, fat, coeff);
   }
 
+  template <typename Float, int nColor, QudaReconstructType recon>
+  class OneLongLink : public TunableKernel3D {
+    LinkArg<Float, nColor, recon> arg;
+    unsigned int minThreads() const { return arg.threads.x; }
+
+  public:
+    OneLongLink(const GaugeField &u, const std::vector<GaugeField *> &fat, const std::vector<GaugeField *> &lng,
+                const std::vector<double> &coeff, const std::vector<double> &naik) :
+      TunableKernel3D(*fat[0], 2, 4),
+      arg(fat, lng, u, coeff, naik)
+    {
+      strcat(aux, comm_dim_partitioned_string());
+      if (arg.n_set > 1) strcat(aux, ",n_set=2");
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream) {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      launch<ComputeOneLongLink>(tp, stream, arg);
+    }
+
+    long long flops() const { return 2*4*arg.threads.x*(198 + 36*arg.n_set); }
+    long long bytes() const { return 2*4*arg.threads.x*(3*arg.u.Bytes()+2*arg.n_set*arg.link[0].Bytes()); }
+  };
+
+  void computeOneLongLink(const std::vector<GaugeField *> &fat, const std::vector<GaugeField *> &lng,
+                          const GaugeField &u, const std::vector<double> &coeff, const std::vector<double> &naik)
+  {
+    if (u.StaggeredPhase() != QUDA_STAGGERED_PHASE_MILC && u.Reconstruct() != QUDA_RECONSTRUCT_NO)
+      errorQuda("Staggered phase type %d not supported", u.StaggeredPhase());
+    instantiate<OneLongLink, ReconstructNo12>(u, fat, lng, coeff, naik);
+  }
+
   template <typename Float, int nColor, QudaReconstructType recon> class Staple : public TunableKernel3D {
-    GaugeField &fat;
+    const std::vector<GaugeField *> &fat;
     GaugeField &staple;
     const GaugeField &mulink;
     const GaugeField &u;
@@ -78,13 +114,13 @@ namespace quda {
     int mu_map[4];
     int dir1;
     int dir2;
-    Float coeff;
+    const std::vector<double> &coeff;
     bool save_staple;
 
     dim3 threads() const
     {
       dim3 t(1, 2, 1);
-      for (int d = 0; d < 4; d++) t.x *= (fat.X()[d] + u.X()[d]) / 2;
+      for (int d = 0; d < 4; d++) t.x *= (fat[0]->X()[d] + u.X()[d]) / 2;
       t.x /= 2; // account for parity in y dimension
       t.z = (3 - ( (dir1 > -1) ? 1 : 0 ) - ( (dir2 > -1) ? 1 : 0 ));
       return t;
@@ -92,9 +128,9 @@ namespace quda {
     unsigned int minThreads() const { return threads().x; }
 
   public:
-    Staple(const GaugeField &u, GaugeField &fat, GaugeField &staple, const GaugeField &mulink,
-           int nu, int dir1, int dir2, double coeff, bool save_staple) :
-      TunableKernel3D(fat, 2, (3 - ( (dir1 > -1) ? 1 : 0 ) - ( (dir2 > -1) ? 1 : 0 ))),
+    Staple(const GaugeField &u, const std::vector<GaugeField *> &fat, GaugeField &staple, const GaugeField &mulink,
+           int nu, int dir1, int dir2, const std::vector<double> &coeff, bool save_staple) :
+      TunableKernel3D(*fat[0], 2, (3 - ( (dir1 > -1) ? 1 : 0 ) - ( (dir2 > -1) ? 1 : 0 ))),
       fat(fat),
       staple(staple),
       mulink(mulink),
@@ -102,7 +138,7 @@ namespace quda {
       nu(nu),
       dir1(dir1),
       dir2(dir2),
-      coeff(static_cast<Float>(coeff)),
+      coeff(coeff),
       save_staple(save_staple)
     {
       // compute the map for z thread index to mu index in the kernel
@@ -120,6 +156,7 @@ namespace quda {
       strcat(aux, comm_dim_partitioned_string());
       std::stringstream aux_;
       aux_ << ",nu=" << nu << ",dir1=" << dir1 << ",dir2=" << dir2 << ",save=" << save_staple;
+      if (fat.size() > 1) aux_ << ",n_set=" << fat.size();
       strcat(aux, aux_.str().c_str());
 
       apply(device::get_default_stream());
@@ -148,19 +185,20 @@ namespace quda {
       }
     }
 
-    void preTune() { fat.backup(); staple.backup(); }
-    void postTune() { fat.restore(); staple.restore(); }
-    long long flops() const { return threads().x * threads().y * threads().z * (4 * 198 + 18 + 36 ); }
+    void preTune() { for (auto f : fat) f->backup(); staple.backup(); }
+    void postTune() { for (auto f : fat) f->restore(); staple.restore(); }
+    long long flops() const { return threads().x * threads().y * threads().z * (4 * 198 + (18 + 36) * fat.size()); }
     long long bytes() const {
-      return (fat.VolumeCB() * fat.Reconstruct() * 2 // fat load/store is only done on interior
+      return (fat[0]->VolumeCB() * fat[0]->Reconstruct() * 2 * fat.size() // fat load/store is only done on interior
               + threads().x * (4 * u.Reconstruct() + 2 * mulink.Reconstruct() + (save_staple ? staple.Reconstruct() : 0))) *
         threads().y * threads().z * u.Precision();
     }
   };
 
   // Compute the staple field for direction nu,excluding the directions dir1 and dir2.
-  void computeStaple(GaugeField &fat, GaugeField &staple, const GaugeField &mulink, const GaugeField &u,
-		     int nu, int dir1, int dir2, double coeff, bool save_staple)
+  void computeStaple(const std::vector<GaugeField *> &fat, GaugeField &staple, const GaugeField &mulink,
+                     const GaugeField &u, int nu, int dir1, int dir2, const std::vector<double> &coeff,
+                     bool save_staple)
   {
     instantiate<Staple, ReconstructNo12>(u, fat, staple, mulink, nu, dir1, dir2, coeff, save_staple);
   }
@@ -168,7 +206,7 @@ namespace quda {
 #ifdef GPU_FATLINK
   void longKSLink(GaugeField *lng, const GaugeField &u, const double *coeff)
   {
-    computeLongLink(*lng, u, coeff[1]);
+    computeLongLink({lng}, u, {coeff[1]});
   }
 
   void fatKSLink(GaugeField *fat, const GaugeField& u, const double *coeff)
@@ -180,32 +218,62 @@ namespace quda {
     auto staple = GaugeField::Create(gParam);
     auto staple1 = GaugeField::Create(gParam);
 
-    if ( ((fat->X()[0] % 2 != 0) || (fat->X()[1] % 2 != 0) || (fat->X()[2] % 2 != 0) || (fat->X()[3] % 2 != 0))
+    fatLongKSLink({fat}, {}, u, {coeff}, *staple, *staple1);
+
+    delete staple;
+    delete staple1;
+  }
+
+  void fatLongKSLink(const std::vector<GaugeField *> &fat, const std::vector<GaugeField *> &lng, const GaugeField &u,
+                     const std::vector<const double *> &coeff, GaugeField &staple, GaugeField &staple1)
+  {
+    if (fat.size() != coeff.size() || (lng.size() && lng.size() != fat.size()))
+      errorQuda("Mismatched number of fat links %lu, long links %lu and coefficient sets %lu", fat.size(), lng.size(),
+                coeff.size());
+
+    const int *X = fat[0]->X();
+    if (((X[0] % 2 != 0) || (X[1] % 2 != 0) || (X[2] % 2 != 0) || (X[3] % 2 != 0))
 	&& (u.Reconstruct()  != QUDA_RECONSTRUCT_NO)){
       errorQuda("Reconstruct %d and odd dimensionsize is not supported by link fattening code (yet)\n",
 		u.Reconstruct());
     }
 
-    computeOneLink(*fat, u, coeff[0]-6.0*coeff[5]);
+    // coefficient of path i in each set
+    auto path = [&](int i) {
+      std::vector<double> c(coeff.size());
+      for (auto s = 0u; s < coeff.size(); s++) c[s] = coeff[s][i];
+      return c;
+    };
+    auto above = [](const std::vector<double> &c, double min) {
+      return std::any_of(c.begin(), c.end(), [=](double ci) { return fabs(ci) > min; });
+    };
+
+    std::vector<double> one(coeff.size());
+    for (auto s = 0u; s < coeff.size(); s++) one[s] = coeff[s][0] - 6.0 * coeff[s][5];
+    if (lng.size()) computeOneLongLink(fat, lng, u, one, path(1));
+    else computeOneLink(fat, u, one);
+
+    auto staple3 = path(2), staple5 = path(3), staple7 = path(4), lepage = path(5);
 
     // Check the coefficients. If all of the following are zero, return.
-    if (fabs(coeff[2]) >= MIN_COEFF || fabs(coeff[3]) >= MIN_COEFF ||
-	fabs(coeff[4]) >= MIN_COEFF || fabs(coeff[5]) >= MIN_COEFF) {
+    if (above(staple3, MIN_COEFF) || above(staple5, MIN_COEFF) || above(staple7, MIN_COEFF)
+        || above(lepage, MIN_COEFF)) {
 
+      // each staple is computed once and accumulated into the fat link of every set
       for (int nu = 0; nu < 4; nu++) {
-        computeStaple(*fat, *staple, u, u, nu, -1, -1, coeff[2], 1);
+        computeStaple(fat, staple, u, u, nu, -1, -1, staple3, 1);
 
-        if (coeff[5] != 0.0) computeStaple(*fat, *staple, *staple, u, nu, -1, -1, coeff[5], 0);
+        if (above(lepage, 0.0)) computeStaple(fat, staple, staple, u, nu, -1, -1, lepage, 0);
 
         for (int rho = 0; rho < 4; rho++) {
           if (rho != nu) {
 
-            computeStaple(*fat, *staple1, *staple, u, rho, nu, -1, coeff[3], 1);
+            computeStaple(fat, staple1, staple, u, rho, nu, -1, staple5, 1);
 
-            if (fabs(coeff[4]) > MIN_COEFF) {
+            if (above(staple7, MIN_COEFF)) {
               for (int sig = 0; sig < 4; sig++) {
                 if (sig != nu && sig != rho) {
-                  computeStaple(*fat, *staple, *staple1, u, sig, nu, rho, coeff[4], 0);
+                  computeStaple(fat, staple, staple1, u, sig, nu, rho, staple7, 0);
                 }
               } //sig
             } // MIN_COEFF
@@ -213,9 +281,6 @@ namespace quda {
         } //rho
       } //nu
     }
-
-    delete staple;
-    delete staple1;
   }
 #else
   void longKSLink(GaugeField *, const GaugeField&, const double *)
@@ -227,6 +292,12 @@ namespace quda {
   {
     errorQuda("Fat-link computation not enabled");
   }
+
+  void fatLongKSLink(const std::vector<GaugeField *> &, const std::vector<GaugeField *> &, const GaugeField &,
+                     const std::vector<const double *> &, GaugeField &, GaugeField &)
+  {
+    errorQuda("Fat-link computation not enabled");
+  }
 #endif
 
 #undef MIN_COEFF
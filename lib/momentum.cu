@@ -5,6 +5,7 @@
 #include <reduce_helper.h>
 #include <instantiate.h>
 #include <fstream>
+#include <momentum.h>
 
 #include <tunable_reduction.h>
 #include <tunable_nd.h>
@@ -102,36 +103,112 @@ namespace quda {
     return action;
   }
 
+  template <typename Float, int nColor, QudaReconstructType recon>
+  class NormForce : TunableReduction2D<> {
+    const GaugeField &force;
+    std::array<double, 2> &norm;
+    bool max;
+
+  public:
+    NormForce(const GaugeField &force, std::array<double, 2> &norm) :
+      TunableReduction2D(force),
+      force(force),
+      norm(norm)
+    {
+      char aux2[TuneKey::aux_n];
+      strcpy(aux2, aux);
+
+      max = false;
+      strcat(aux, ",sum");
+      apply(device::get_default_stream());
+
+      max = true;
+      strcpy(aux, aux2);
+      strcat(aux, ",max");
+      apply(device::get_default_stream());
+
+      norm[0] /= static_cast<double>(force.Geometry()) * force.Volume() * comm_size();
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      if (max) {
+        ForceNormArg<Float, nColor, recon, true> arg(force);
+        launch<ForceNorm, double, comm_reduce_max<double>>(norm[1], tp, stream, arg);
+      } else {
+        ForceNormArg<Float, nColor, recon, false> arg(force);
+        launch<ForceNorm>(norm[0], tp, stream, arg);
+      }
+    }
+
+    long long flops() const { return force.Geometry() * force.Volume() * (36 + 20); }
+    long long bytes() const { return force.Bytes(); }
+  };
+
+  std::array<double, 2> computeForceNorm(const GaugeField &force)
+  {
+    if (!force.isNative()) errorQuda("Unsupported output ordering: %d\n", force.Order());
+    if (force.Geometry() != QUDA_VECTOR_GEOMETRY) errorQuda("Unsupported geometry %d", force.Geometry());
+    std::array<double, 2> norm = {};
+#ifdef GPU_GAUGE_TOOLS
+    instantiate<NormForce, ReconstructMom>(force, norm);
+#else
+    errorQuda("%s not build", __func__);
+#endif
+    return norm;
+  }
+
   template <typename Float, int nColor, QudaReconstructType recon>
   class UpdateMom : TunableReduction2D<> {
     const GaugeField &force;
     GaugeField &mom;
     double coeff;
+    const GaugeField *U;
     std::vector<double> force_max;
 
+    template <QudaReconstructType recon_u, bool apply_u> void launchU(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      UpdateMomArg<Float, nColor, recon, recon_u, apply_u> arg(mom, coeff, force, U ? *U : force);
+      launch<MomUpdate, double, comm_reduce_max<double>>(force_max, tp, stream, arg);
+    }
+
   public:
-    UpdateMom(const GaugeField &force, GaugeField &mom, double coeff, const char *fname) :
+    UpdateMom(const GaugeField &force, GaugeField &mom, double coeff, const GaugeField *U, const char *fname) :
       TunableReduction2D(mom),
       force(force),
       mom(mom),
       coeff(coeff),
+      U(U),
       force_max(2)
     {
+      if (U) strcat(aux, U->Reconstruct() == QUDA_RECONSTRUCT_NO ? ",apply_u,recon=18" : ",apply_u,recon=12");
       apply(device::get_default_stream());
       if (forceMonitor()) forceRecord(force_max, coeff, fname);
     }
 
     void apply(const qudaStream_t &stream)
     {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      UpdateMomArg<Float, nColor, recon> arg(mom, coeff, force);
-      launch<MomUpdate, double, comm_reduce_max<double>>(force_max, tp, stream, arg);
+      if (!U) {
+        launchU<QUDA_RECONSTRUCT_NO, false>(stream);
+      } else if (U->Reconstruct() == QUDA_RECONSTRUCT_NO) {
+        launchU<QUDA_RECONSTRUCT_NO, true>(stream);
+      } else if (U->Reconstruct() == QUDA_RECONSTRUCT_12) {
+        launchU<QUDA_RECONSTRUCT_12, true>(stream);
+      } else {
+        errorQuda("Reconstruct %d not supported", U->Reconstruct());
+      }
     }
 
     void preTune() { mom.backup();}
     void postTune() { mom.restore();}
-    long long flops() const { return 4 * mom.Volume() * (36+42); }
-    long long bytes() const { return 2 * mom.Bytes() + force.Bytes(); }
+    long long flops() const
+    {
+      int Nc = nColor;
+      return 4 * mom.Volume() * (36 + 42 + (U ? 8 * Nc * Nc * Nc - 2 * Nc * Nc : 0));
+    }
+    long long bytes() const { return 2 * mom.Bytes() + force.Bytes() + (U ? U->Bytes() : 0); }
   };
 
 #ifdef GPU_GAUGE_TOOLS
@@ -141,13 +218,31 @@ namespace quda {
       errorQuda("Momentum field with reconstruct %d not supported", mom.Reconstruct());
 
     checkPrecision(mom, force);
-    instantiate<UpdateMom, ReconstructMom>(force, mom, coeff, fname);
+    instantiate<UpdateMom, ReconstructMom>(force, mom, coeff, nullptr, fname);
+  }
+
+  void updateMomentum(GaugeField &mom, double coeff, GaugeField &force, const GaugeField &U, const char *fname)
+  {
+    if (mom.Reconstruct() != QUDA_RECONSTRUCT_10)
+      errorQuda("Momentum field with reconstruct %d not supported", mom.Reconstruct());
+    if (!U.isNative()) errorQuda("Unsupported gauge field ordering: %d\n", U.Order());
+    for (int d = 0; d < 4; d++)
+      if (U.X()[d] != force.X()[d])
+        errorQuda("Gauge and force dimensions do not match d=%d gauge=%d force=%d", d, U.X()[d], force.X()[d]);
+
+    checkPrecision(mom, force, U);
+    instantiate<UpdateMom, ReconstructMom>(force, mom, coeff, &U, fname);
   }
 #else
   void updateMomentum(GaugeField &, double, GaugeField &, const char *)
   {
     errorQuda("%s not built", __func__);
   }
+
+  void updateMomentum(GaugeField &, double, GaugeField &, const GaugeField &, const char *)
+  {
+    errorQuda("%s not built", __func__);
+  }
 #endif // GPU_GAUGE_TOOLS
 
   template <typename Float, int nColor, QudaReconstructType recon>
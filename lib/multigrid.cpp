@@ -4,6 +4,7 @@
 #include <tune_quda.h>
 #include <random_quda.h>
 #include <vector_io.h>
+#include <field_residency.h>
 
 // for building the KD inverse op
 #include <staggered_kd_build_xinv.h>
@@ -125,6 +126,10 @@ namespace quda
 
     if (getVerbosity() >= QUDA_VERBOSE) printfQuda("%s level %d\n", transfer ? "Resetting" : "Creating", param.level);
 
+    // page back any null-space vectors spilled to the host since the last setup
+    residency::acquire(param.B);
+    if (transfer) residency::acquire(*B_coarse);
+
     destroySmoother();
     destroyCoarseSolver();
 
@@ -204,6 +209,9 @@ namespace quda
       // (only if using managed memory and prefetching is enabled, otherwise no-op)
       for (int i = 0; i < param.Nvec; i++) { param.B[i]->prefetch(QUDA_CPU_FIELD_LOCATION); }
 
+      // similarly, they can be spilled to the host if device memory runs short
+      residency::add(param.B);
+
       createCoarseDirac();
     }
 
@@ -244,6 +252,9 @@ namespace quda
     diracSmoother->prefetch(QUDA_CUDA_FIELD_LOCATION);
     diracSmootherSloppy->prefetch(QUDA_CUDA_FIELD_LOCATION);
 
+    if (transfer) residency::release(*B_coarse);
+    residency::release(param.B);
+
     if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Setup of level %d done\n", param.level);
 
     popLevel();
@@ -1348,7 +1359,9 @@ namespace quda
     if (param.transfer_type != QUDA_TRANSFER_AGGREGATE) {
       warningQuda("Cannot dump near-null vectors for top level of staggered MG solve.");
     } else {
+      residency::acquire(param.B);
       saveVectors(param.B);
+      residency::release(param.B);
     }
     if (param.level < param.Nlevel - 2) coarse->dumpNullVectors();
   }
@@ -42,20 +42,20 @@ namespace quda {
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
       if (heatbath) {
-        launch<HB>(tp, stream, MonteArg<Float, nColor, recon, true>(U, beta, rng.State(), mu, parity));
+        launch<HB>(tp, stream, MonteArg<Float, nColor, recon, true>(U, beta, rng.Key(U), mu, parity));
       } else {
-        launch<HB>(tp, stream, MonteArg<Float, nColor, recon, false>(U, beta, rng.State(), mu, parity));
+        launch<HB>(tp, stream, MonteArg<Float, nColor, recon, false>(U, beta, rng.Key(U), mu, parity));
       }
     }
 
     void preTune() {
       U.backup();
-      if (heatbath) rng.backup();
+      rng.backup();
     }
 
     void postTune() {
       U.restore();
-      if (heatbath) rng.restore();
+      rng.restore();
     }
 
     long long flops() const
@@ -87,12 +87,10 @@ namespace quda {
       //NEED TO CHECK THIS!!!!!!
       if ( nColor == 3 ) {
         long long byte = 20LL * recon * sizeof(Float);
-        if (heatbath) byte += 2LL * sizeof(RNGState);
         byte *= U.LocalVolumeCB();
         return byte;
       } else {
         long long byte = 20LL * nColor * nColor * 2 * sizeof(Float);
-        if (heatbath) byte += 2LL * sizeof(RNGState);
         byte *= U.LocalVolumeCB();
         return byte;
       }
@@ -144,7 +142,7 @@ namespace quda {
   /** @brief Perform heatbath and overrelaxation. Performs nhb heatbath steps followed by nover overrelaxation steps.
    *
    * @param[in,out] data Gauge field
-   * @param[in,out] rngstate state of the CURAND random number generator
+   * @param[in,out] rngstate the random number generator
    * @param[in] Beta inverse of the gauge coupling, beta = 2 Nc / g_0^2
    * @param[in] nhb number of heatbath steps
    * @param[in] nover number of overrelaxation steps
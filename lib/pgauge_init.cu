@@ -52,7 +52,7 @@ namespace quda {
     void apply(const qudaStream_t &stream)
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      launch<HotStart>(tp, stream, InitGaugeHotArg<Float, nColors, recon>(U, rng.State()));
+      launch<HotStart>(tp, stream, InitGaugeHotArg<Float, nColors, recon>(U, rng.Key(U)));
     }
 
     void preTune() { rng.backup(); }
@@ -79,7 +79,7 @@ namespace quda {
    * in multi-GPU case.
    *
    * @param[in,out] data Gauge field
-   * @param[in,out] rngstate state of the CURAND random number generator
+   * @param[in,out] rngstate the random number generator
    */
   void InitGaugeField(GaugeField& data, RNG &rngstate)
   {
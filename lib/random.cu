@@ -1,71 +1,38 @@
 #include <util_quda.h>
 #include <random_quda.h>
-#include <malloc_quda.h>
-#include <tunable_nd.h>
-#include <kernels/random_init.cuh>
+#include <random_helper.h>
+#include <comm_quda.h>
 
 namespace quda {
 
-  class RNGInit : public TunableKernel2D {
-
-    RNG &rng;
-    const LatticeField &meta;
-    unsigned long long seed;
-    unsigned int minThreads() const { return meta.VolumeCB(); }
-    bool tuneSharedBytes() const { return false; }
-
-  public:
-    RNGInit(RNG &rng, const LatticeField &meta, unsigned long long seed) :
-      TunableKernel2D(meta, meta.SiteSubset()),
-      rng(rng),
-      meta(meta),
-      seed(seed)
-    {
-      apply(device::get_default_stream());
-    }
-
-    void apply(const qudaStream_t &stream)
-    {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      launch_device<init_random>(tp, stream, rngArg(rng.State(), seed, meta));
-    }
-
-    long long flops() const { return 0; }
-    long long bytes() const { return 0; }
-  };
-
-  RNG::RNG(const LatticeField &meta, unsigned long long seedin) :
-    size(meta.LocalVolume()),
-    state((RNGState *)device_malloc(size * sizeof(RNGState)), [](RNGState *ptr){ device_free(ptr); } ),
-    seed(seedin)
+  RNG::RNG(const LatticeField &meta, unsigned long long seedin) : seed(seedin), counter(0), backup_counter(0)
   {
-#if defined(XORWOW)
-    if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Using randStateXORWOW\n");
-#elif defined(RG32k3a)
-    if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Using randStateMRG32k3a\n");
-#else
-    if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Using randStateMRG32k3a\n");
-#endif
-
     if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
-      printfQuda("Allocated array of random numbers with size: %.2f MB\n",
-                 size * sizeof(RNGState) / (float)(1048576));
-
-    RNGInit(*this, meta, seed);
+      printfQuda("Using counter-based Philox4x32-10 RNG with seed %llu on %d-d lattice\n", seed, meta.Ndim());
   }
 
-  /*! @brief Backup CURAND array states initialization */
-  void RNG::backup()
+  RNGKey RNG::Key(const LatticeField &field)
   {
-    backup_state = (RNGState *)safe_malloc(size * sizeof(RNGState));
-    qudaMemcpy(backup_state, state.get(), size * sizeof(RNGState), qudaMemcpyDeviceToHost);
-  }
+    RNGKey key;
+    key.seed = seed;
+    key.counter = counter++;
+
+    key.volume_cb = 1;
+    for (int d = 0; d < 4; d++) {
+      // single-parity fields store the checkerboarded dimension
+      key.X[d] = field.LocalX()[d];
+      if (d == 0 && field.SiteSubset() == QUDA_PARITY_SITE_SUBSET) key.X[d] *= 2;
+      key.X_global[d] = key.X[d] * comm_dim(d);
+      key.offset[d] = key.X[d] * comm_coord(d);
+      key.volume_cb *= key.X[d];
+    }
+    key.volume_cb /= 2;
 
-  /*! @brief Restore CURAND array states initialization */
-  void RNG::restore()
-  {
-    qudaMemcpy(state.get(), backup_state, size * sizeof(RNGState), qudaMemcpyHostToDevice);
-    host_free(backup_state);
+    return key;
   }
 
+  void RNG::backup() { backup_counter = counter; }
+
+  void RNG::restore() { counter = backup_counter; }
+
 } // namespace quda
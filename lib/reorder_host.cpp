@@ -0,0 +1,303 @@
+#include <vector>
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <color_spinor_field.h>
+#include <gauge_field.h>
+#include <timer.h>
+
+namespace quda
+{
+
+  /**
+     @brief Description of a host field layout in terms of flat
+     arrays of real numbers.  Real component k of checkerboard site x
+     with parity p is found at comp[k][p * parity_stride + x * site_stride].
+     Every order handled here (site-major orders such as
+     SPACE_SPIN_COLOR, QDP and MILC, and the native FLOATN orders) fits
+     this description, with only the component pointers and strides
+     differing.
+   */
+  template <typename Float> struct HostLayout {
+    std::vector<Float *> comp;
+    size_t site_stride;
+    size_t parity_stride;
+  };
+
+  // working set of a single tile in bytes, sized to stay resident in L2 while it is reordered
+  constexpr size_t reorder_tile_bytes = 64 * 1024;
+
+  /**
+     @brief Reorder a field between two host layouts.  The sites are
+     split into tiles whose working set fits in cache, the tiles are
+     distributed over the OpenMP threads, and within a tile the
+     innermost loop runs over sites so that it vectorizes into SIMD
+     gathers and scatters.  When both layouts are site major the loop
+     order is swapped, so each site is streamed contiguously.
+     @return The number of bytes moved
+   */
+  template <typename Out, typename In>
+  static size_t reorderHost(const HostLayout<Out> &out, const HostLayout<In> &in, size_t volume_cb, int n_parity,
+                            int out_parity, int in_parity)
+  {
+    const int n_comp = out.comp.size();
+    if (in.comp.size() != out.comp.size())
+      errorQuda("Mismatched number of components %lu %lu", out.comp.size(), in.comp.size());
+
+    size_t tile = reorder_tile_bytes / (n_comp * (sizeof(Out) + sizeof(In)));
+    tile = std::max(static_cast<size_t>(8), (tile / 8) * 8);
+    const long n_tile = (volume_cb + tile - 1) / tile;
+    const bool site_major
+      = out.site_stride >= static_cast<size_t>(n_comp) && in.site_stride >= static_cast<size_t>(n_comp);
+
+    for (int parity = 0; parity < n_parity; parity++) {
+      const size_t out_offset = ((parity + out_parity) & 1) * out.parity_stride;
+      const size_t in_offset = ((parity + in_parity) & 1) * in.parity_stride;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for (long t = 0; t < n_tile; t++) {
+        const size_t x_begin = t * tile;
+        const size_t x_end = std::min(x_begin + tile, volume_cb);
+
+        if (site_major) {
+          for (size_t x = x_begin; x < x_end; x++) {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+            for (int k = 0; k < n_comp; k++)
+              out.comp[k][out_offset + x * out.site_stride] = static_cast<Out>(in.comp[k][in_offset + x * in.site_stride]);
+          }
+        } else {
+          for (int k = 0; k < n_comp; k++) {
+            Out *o = out.comp[k] + out_offset;
+            const In *i = in.comp[k] + in_offset;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+            for (size_t x = x_begin; x < x_end; x++) o[x * out.site_stride] = static_cast<Out>(i[x * in.site_stride]);
+          }
+        }
+      }
+    }
+
+    return n_parity * volume_cb * n_comp * (sizeof(Out) + sizeof(In));
+  }
+
+  static void reportReorder(const char *type, size_t bytes, host_timer_t &timer)
+  {
+    if (getVerbosity() >= QUDA_DEBUG_VERBOSE) {
+      int threads = 1;
+#ifdef _OPENMP
+      threads = omp_get_max_threads();
+#endif
+      printfQuda("Host %s reorder of %.3f MiB with %d threads in %e s: %.2f GB/s\n", type, bytes / (1024.0 * 1024.0),
+                 threads, timer.last(), 1e-9 * bytes / timer.last());
+    }
+  }
+
+  /**
+     @brief Precision-agnostic layout of a color-spinor field, expanded
+     into a HostLayout once the storage type is known.
+   */
+  struct SpinorLayout {
+    void *v;
+    QudaFieldOrder order;
+    int n_spin;
+    int n_color;
+    size_t volume_cb;
+    size_t bytes;
+
+    SpinorLayout(const ColorSpinorField &f, const void *v) :
+      v(const_cast<void *>(v ? v : f.V())),
+      order(f.FieldOrder()),
+      n_spin(f.Nspin()),
+      n_color(f.Ncolor()),
+      volume_cb(f.VolumeCB()),
+      bytes(f.Bytes())
+    {
+    }
+
+    template <typename Float> HostLayout<Float> get() const
+    {
+      const int length = 2 * n_spin * n_color;
+      HostLayout<Float> layout;
+      layout.comp.resize(length);
+      Float *base = static_cast<Float *>(v);
+
+      if (order == QUDA_SPACE_SPIN_COLOR_FIELD_ORDER || order == QUDA_SPACE_COLOR_SPIN_FIELD_ORDER) {
+        layout.site_stride = length;
+        layout.parity_stride = volume_cb * length;
+        for (int s = 0; s < n_spin; s++) {
+          for (int c = 0; c < n_color; c++) {
+            const int k = (s * n_color + c) * 2;
+            const int i = order == QUDA_SPACE_SPIN_COLOR_FIELD_ORDER ? k : (c * n_spin + s) * 2;
+            layout.comp[k + 0] = base + i + 0;
+            layout.comp[k + 1] = base + i + 1;
+          }
+        }
+      } else {
+        const int N = order;
+        layout.site_stride = N;
+        layout.parity_stride = bytes / (2 * sizeof(Float));
+        for (int k = 0; k < length; k++) layout.comp[k] = base + (k / N) * volume_cb * N + k % N;
+      }
+      return layout;
+    }
+  };
+
+  bool reorderHostSupported(const ColorSpinorField &dst, const ColorSpinorField &src)
+  {
+    auto supported = [](const ColorSpinorField &f) {
+      const int length = 2 * f.Nspin() * f.Ncolor();
+      switch (f.FieldOrder()) {
+      case QUDA_SPACE_SPIN_COLOR_FIELD_ORDER:
+      case QUDA_SPACE_COLOR_SPIN_FIELD_ORDER: break;
+      case QUDA_FLOAT2_FIELD_ORDER:
+      case QUDA_FLOAT4_FIELD_ORDER:
+      case QUDA_FLOAT8_FIELD_ORDER:
+        if (length % f.FieldOrder() != 0) return false;
+        break;
+      default: return false;
+      }
+      return (f.Precision() == QUDA_DOUBLE_PRECISION || f.Precision() == QUDA_SINGLE_PRECISION) && !f.IsComposite()
+        && (f.SiteOrder() == QUDA_EVEN_ODD_SITE_ORDER || f.SiteOrder() == QUDA_ODD_EVEN_SITE_ORDER);
+    };
+
+    return supported(dst) && supported(src) && dst.Nspin() == src.Nspin() && dst.Ncolor() == src.Ncolor()
+      && dst.VolumeCB() == src.VolumeCB() && dst.SiteSubset() == src.SiteSubset()
+      && (dst.Nspin() != 4 || dst.GammaBasis() == src.GammaBasis());
+  }
+
+  void reorderHost(ColorSpinorField &dst, const ColorSpinorField &src, void *Dst, const void *Src)
+  {
+    if (!reorderHostSupported(dst, src)) errorQuda("Host reordering not supported for these fields");
+
+    SpinorLayout out(dst, Dst);
+    SpinorLayout in(src, Src);
+    const int out_parity = dst.SiteOrder() == QUDA_ODD_EVEN_SITE_ORDER ? 1 : 0;
+    const int in_parity = src.SiteOrder() == QUDA_ODD_EVEN_SITE_ORDER ? 1 : 0;
+    const size_t volume_cb = src.VolumeCB();
+    const int n_parity = src.SiteSubset();
+
+    host_timer_t timer;
+    timer.start();
+    size_t bytes = 0;
+    if (dst.Precision() == QUDA_DOUBLE_PRECISION) {
+      if (src.Precision() == QUDA_DOUBLE_PRECISION)
+        bytes = reorderHost(out.get<double>(), in.get<double>(), volume_cb, n_parity, out_parity, in_parity);
+      else
+        bytes = reorderHost(out.get<double>(), in.get<float>(), volume_cb, n_parity, out_parity, in_parity);
+    } else {
+      if (src.Precision() == QUDA_DOUBLE_PRECISION)
+        bytes = reorderHost(out.get<float>(), in.get<double>(), volume_cb, n_parity, out_parity, in_parity);
+      else
+        bytes = reorderHost(out.get<float>(), in.get<float>(), volume_cb, n_parity, out_parity, in_parity);
+    }
+    timer.stop();
+    reportReorder("color-spinor", bytes, timer);
+  }
+
+  /**
+     @brief Precision-agnostic layout of the body of a gauge field
+     with no reconstruction, expanded into a HostLayout once the
+     storage type is known.  The link direction is folded into the
+     component index.
+   */
+  struct GaugeLayout {
+    void *v;
+    QudaGaugeFieldOrder order;
+    int geometry;
+    size_t volume_cb;
+    size_t stride;
+    size_t bytes;
+
+    GaugeLayout(const GaugeField &u, const void *v) :
+      v(const_cast<void *>(v ? v : u.Gauge_p())),
+      order(u.Order()),
+      geometry(u.Geometry()),
+      volume_cb(u.VolumeCB()),
+      stride(u.Stride()),
+      bytes(u.Bytes())
+    {
+    }
+
+    template <typename Float> HostLayout<Float> get() const
+    {
+      constexpr int length = 18;
+      HostLayout<Float> layout;
+      layout.comp.resize(geometry * length);
+
+      if (order == QUDA_QDP_GAUGE_ORDER) {
+        Float **base = static_cast<Float **>(v);
+        layout.site_stride = length;
+        layout.parity_stride = volume_cb * length;
+        for (int d = 0; d < geometry; d++)
+          for (int k = 0; k < length; k++) layout.comp[d * length + k] = base[d] + k;
+      } else if (order == QUDA_MILC_GAUGE_ORDER) {
+        Float *base = static_cast<Float *>(v);
+        layout.site_stride = geometry * length;
+        layout.parity_stride = volume_cb * geometry * length;
+        for (int d = 0; d < geometry; d++)
+          for (int k = 0; k < length; k++) layout.comp[d * length + k] = base + d * length + k;
+      } else {
+        Float *base = static_cast<Float *>(v);
+        const int N = order;
+        const int M = length / N;
+        layout.site_stride = N;
+        layout.parity_stride = bytes / (2 * sizeof(Float));
+        for (int d = 0; d < geometry; d++)
+          for (int k = 0; k < length; k++)
+            layout.comp[d * length + k] = base + ((d * M + k / N) * stride) * N + k % N;
+      }
+      return layout;
+    }
+  };
+
+  bool reorderHostSupported(const GaugeField &out, const GaugeField &in)
+  {
+    auto supported = [](const GaugeField &u) {
+      switch (u.Order()) {
+      case QUDA_QDP_GAUGE_ORDER:
+      case QUDA_MILC_GAUGE_ORDER:
+      case QUDA_FLOAT2_GAUGE_ORDER: break;
+      default: return false;
+      }
+      return (u.Precision() == QUDA_DOUBLE_PRECISION || u.Precision() == QUDA_SINGLE_PRECISION)
+        && u.Reconstruct() == QUDA_RECONSTRUCT_NO && u.Ncolor() == 3;
+    };
+
+    return supported(out) && supported(in) && out.Geometry() == in.Geometry() && out.VolumeCB() == in.VolumeCB()
+      && in.Geometry() != QUDA_COARSE_GEOMETRY;
+  }
+
+  void reorderHost(GaugeField &out, const GaugeField &in, void *Out, const void *In)
+  {
+    if (!reorderHostSupported(out, in)) errorQuda("Host reordering not supported for these fields");
+
+    GaugeLayout out_layout(out, Out);
+    GaugeLayout in_layout(in, In);
+    const size_t volume_cb = in.VolumeCB();
+
+    host_timer_t timer;
+    timer.start();
+    size_t bytes = 0;
+    if (out.Precision() == QUDA_DOUBLE_PRECISION) {
+      if (in.Precision() == QUDA_DOUBLE_PRECISION)
+        bytes = reorderHost(out_layout.get<double>(), in_layout.get<double>(), volume_cb, 2, 0, 0);
+      else
+        bytes = reorderHost(out_layout.get<double>(), in_layout.get<float>(), volume_cb, 2, 0, 0);
+    } else {
+      if (in.Precision() == QUDA_DOUBLE_PRECISION)
+        bytes = reorderHost(out_layout.get<float>(), in_layout.get<double>(), volume_cb, 2, 0, 0);
+      else
+        bytes = reorderHost(out_layout.get<float>(), in_layout.get<float>(), volume_cb, 2, 0, 0);
+    }
+    timer.stop();
+    reportReorder("gauge", bytes, timer);
+  }
+
+} // namespace quda
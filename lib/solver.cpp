@@ -2,6 +2,8 @@
 #include <invert_quda.h>
 #include <multigrid.h>
 #include <eigensolve_quda.h>
+#include <field_residency.h>
+#include <comm_quda.h>
 #include <cmath>
 #include <limits>
 
@@ -23,7 +25,8 @@ namespace quda {
     eig_solve(nullptr),
     deflate_init(false),
     deflate_compute(true),
-    recompute_evals(!param.eig_param.preserve_evals)
+    recompute_evals(!param.eig_param.preserve_evals),
+    telemetry(param.telemetry && !param.is_preconditioner ? new SolverTelemetry(param) : nullptr)
   {
     // compute parity of the node
     for (int i=0; i<4; i++) node_parity += commCoords(i);
@@ -32,6 +35,8 @@ namespace quda {
 
   Solver::~Solver()
   {
+    if (telemetry) telemetry->flush();
+
     if (eig_solve) {
       delete eig_solve;
       eig_solve = nullptr;
@@ -187,8 +192,9 @@ namespace quda {
           errorQuda("Preserved deflation space size %lu does not match expected %d", space->evecs.size(),
                     param.eig_param.n_conv);
 
-        // move vectors from preserved space to local space
+        // move vectors from preserved space to local space, paging back any that were spilled
         for (auto &vec : space->evecs) evecs.push_back(vec);
+        residency::acquire(evecs);
 
         if (param.eig_param.n_conv != (int)space->evals.size())
           errorQuda("Preserved eigenvalues %lu does not match expected %lu", space->evals.size(), evals.size());
@@ -241,6 +247,10 @@ namespace quda {
         space->evecs.reserve(evecs.size());
         for (auto &vec : evecs) space->evecs.push_back(vec);
 
+        // between solves the preserved space may be spilled to the host under memory pressure
+        residency::add(evecs);
+        residency::release(evecs);
+
         space->evals.reserve(evals.size());
         for (auto &val : evals) space->evals.push_back(val);
 
@@ -363,6 +373,8 @@ namespace quda {
   }
 
   void Solver::PrintStats(const char* name, int k, double r2, double b2, double hq2) {
+    if (telemetry) telemetry->record(k, r2, b2, hq2);
+
     if (getVerbosity() >= QUDA_VERBOSE) {
       if (param.residual_type & QUDA_HEAVY_QUARK_RESIDUAL) {
         printfQuda("%s: %5d iterations, <r,r> = %9.6e, |r|/|b| = %9.6e, heavy-quark residual = %9.6e\n", name, k, r2,
@@ -377,6 +389,8 @@ namespace quda {
 
   void Solver::PrintSummary(const char *name, int k, double r2, double b2,
                             double r2_tol, double hq_tol) {
+    if (telemetry) telemetry->flush();
+
     if (getVerbosity() >= QUDA_SUMMARIZE) {
       if (param.compute_true_res) {
 	if (param.residual_type & QUDA_HEAVY_QUARK_RESIDUAL) {
@@ -401,6 +415,167 @@ namespace quda {
     }
   }
 
+  void Solver::reliableUpdate(double &delta, double r2_iter, double r2_true)
+  {
+    // bounds and thresholds for the adaptive reliable-update delta
+    constexpr double gap_raise = 1.5;
+    constexpr double gap_lower = 1.05;
+    constexpr double delta_max = 0.5;
+    constexpr double delta_min = 1e-3;
+
+    double gap = r2_iter > 0.0 ? sqrt(r2_true / r2_iter) : 1.0;
+    param.reliable_updates++;
+    param.max_reliable_gap = std::max(param.max_reliable_gap, gap);
+
+    if (!param.adaptive_reliable || delta <= 0.0) return;
+
+    double delta_old = delta;
+    if (gap > gap_raise)
+      delta = std::min(2.0 * delta, delta_max);
+    else if (gap < gap_lower)
+      delta = std::max(0.5 * delta, delta_min);
+
+    if (delta != delta_old && getVerbosity() >= QUDA_DEBUG_VERBOSE)
+      printfQuda("Residual gap %e: reliable delta %e -> %e\n", gap, delta_old, delta);
+  }
+
+  void PrecisionController::select(QudaInvertParam &param)
+  {
+    if (param.cuda_prec_sloppy_min > param.cuda_prec)
+      errorQuda("Minimum sloppy precision %d exceeds the outer precision %d", param.cuda_prec_sloppy_min, param.cuda_prec);
+
+    if (!init || precision < param.cuda_prec_sloppy_min || precision > param.cuda_prec) {
+      precision = std::max(std::min(param.cuda_prec_sloppy, param.cuda_prec), param.cuda_prec_sloppy_min);
+      failed = QUDA_INVALID_PRECISION;
+      streak = 0;
+      patience = 2;
+      requested[0] = param.cuda_prec_precondition;
+      requested[1] = param.cuda_prec_refinement_sloppy;
+      requested[2] = param.cuda_prec_eigensolver;
+      init = true;
+    }
+
+    if (param.cuda_prec_sloppy != precision && getVerbosity() >= QUDA_SUMMARIZE)
+      printfQuda("Adaptive precision: sloppy precision %d -> %d\n", param.cuda_prec_sloppy, precision);
+    param.cuda_prec_sloppy = precision;
+
+    // the precisions derived from the sloppy one follow it down, and are restored as it is raised again
+    param.cuda_prec_precondition = std::min(requested[0], precision);
+    param.cuda_prec_refinement_sloppy = std::min(requested[1], precision);
+    param.cuda_prec_eigensolver = std::min(requested[2], precision);
+  }
+
+  void PrecisionController::update(const QudaInvertParam &param)
+  {
+    // how far the true residual may exceed the tolerance for a solve to count as converged
+    constexpr double true_res_slack = 10.0;
+    // residual gaps above which we raise, and below which we may lower, the precision
+    constexpr double gap_raise = 10.0;
+    constexpr double gap_lower = 2.0;
+    constexpr int patience_max = 64;
+
+    bool converged = param.iter < param.maxiter && (!param.compute_true_res || param.true_res <= true_res_slack * param.tol);
+
+    if (!converged || param.max_reliable_gap > gap_raise) {
+      if (precision < param.cuda_prec) {
+        // back off further before retrying a precision that has failed
+        if (precision == failed) patience = std::min(2 * patience, patience_max);
+        failed = precision;
+        precision = static_cast<QudaPrecision>(2 * precision);
+      }
+      streak = 0;
+    } else if (param.max_reliable_gap < gap_lower) {
+      if (++streak >= patience && precision > param.cuda_prec_sloppy_min) {
+        precision = static_cast<QudaPrecision>(precision / 2);
+        streak = 0;
+      }
+    } else {
+      streak = 0;
+    }
+  }
+
+  SolverCost &solverCost()
+  {
+    static SolverCost cost;
+    return cost;
+  }
+
+  static std::vector<QudaSolverTelemetry> telemetry_history;
+  static int telemetry_solves = 0;
+
+  std::vector<QudaSolverTelemetry> &solverTelemetryHistory() { return telemetry_history; }
+
+  SolverTelemetry::SolverTelemetry(const SolverParam &param) :
+    param(param), last {}, reliable_updates(0), precision(param.precision_sloppy), solve(-1)
+  {
+  }
+
+  void SolverTelemetry::record(int k, double r2, double b2, double hq2)
+  {
+    if (solve < 0) solve = telemetry_solves++; // first record of a new solve
+
+    QudaSolverTelemetry rec;
+    rec.solve = solve;
+    rec.inv_type = param.inv_type;
+    rec.iter = k;
+    rec.r2 = r2;
+    rec.b2 = b2;
+    rec.hq_res = hq2;
+    rec.reliable_update = reliable_updates;
+    rec.precision = precision;
+
+    double secs[static_cast<int>(SolverTimer::n)];
+    for (int t = 0; t < static_cast<int>(SolverTimer::n); t++) {
+      secs[t] = timer[t].time - last[t];
+      last[t] = timer[t].time;
+    }
+    rec.op_secs = secs[static_cast<int>(SolverTimer::op)];
+    rec.blas_secs = secs[static_cast<int>(SolverTimer::blas)];
+    rec.reduce_secs = secs[static_cast<int>(SolverTimer::reduce)];
+
+    // the residual is a host value, so we are synchronous with the device here
+    if (wall.running) {
+      wall.stop();
+      rec.secs = wall.last();
+    } else {
+      rec.secs = 0.0;
+    }
+    wall.start();
+
+    reliable_updates = 0;
+    records.push_back(rec);
+  }
+
+  void SolverTelemetry::flush()
+  {
+    if (wall.running) wall.stop();
+    if (records.size() == 0) return;
+
+    telemetry_history.insert(telemetry_history.end(), records.begin(), records.end());
+
+    if (!param.telemetry_file.empty() && comm_rank() == 0) {
+      FILE *file = fopen(param.telemetry_file.c_str(), "a");
+      if (file) {
+        if (ftell(file) == 0)
+          fprintf(file, "# solve inv_type iter r2 b2 hq_res reliable_update precision op_secs blas_secs "
+                        "reduce_secs secs\n");
+        for (auto &rec : records)
+          fprintf(file, "%d %d %d %.8e %.8e %.8e %d %d %.6e %.6e %.6e %.6e\n", rec.solve, rec.inv_type, rec.iter,
+                  rec.r2, rec.b2, rec.hq_res, rec.reliable_update, rec.precision, rec.op_secs,
+                  rec.blas_secs, rec.reduce_secs, rec.secs);
+        fclose(file);
+      } else {
+        warningQuda("Unable to open solver telemetry file %s", param.telemetry_file.c_str());
+      }
+    }
+
+    if (param.telemetry_callback) param.telemetry_callback(records.data(), records.size(), param.telemetry_data);
+
+    records.clear();
+    solve = -1;
+    reliable_updates = 0;
+  }
+
   double Solver::precisionEpsilon(QudaPrecision prec) const
   {
     double eps = 0.;
@@ -27,10 +27,10 @@ namespace quda {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
       switch (type) {
       case QUDA_NOISE_GAUSS:
-        launch<NoiseSpinor>(tp, stream, SpinorNoiseArg<real, Ns, Nc, order, QUDA_NOISE_GAUSS>(v, rng.State()));
+        launch<NoiseSpinor>(tp, stream, SpinorNoiseArg<real, Ns, Nc, order, QUDA_NOISE_GAUSS>(v, rng.Key(v)));
         break;
       case QUDA_NOISE_UNIFORM:
-        launch<NoiseSpinor>(tp, stream, SpinorNoiseArg<real, Ns, Nc, order, QUDA_NOISE_UNIFORM>(v, rng.State()));
+        launch<NoiseSpinor>(tp, stream, SpinorNoiseArg<real, Ns, Nc, order, QUDA_NOISE_UNIFORM>(v, rng.Key(v)));
         break;
       default: errorQuda("Noise type %d not implemented", type);
       }
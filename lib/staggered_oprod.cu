@@ -9,75 +9,107 @@ namespace quda {
 
   template <typename Float, int nColor, QudaReconstructType recon>
   class StaggeredOprod : public TunableKernel1D {
-    using real = typename mapper<Float>::type;
     template <int dim = -1> using Arg = StaggeredOprodArg<Float, nColor, dim>;
     GaugeField &U;
     GaugeField &L;
-    const ColorSpinorField &inA;
-    const ColorSpinorField &inB;
+    const std::vector<ColorSpinorField *> &inA;
+    const std::vector<ColorSpinorField *> &inB;
     const int parity;
-    const real coeff[2];
+    const std::vector<std::array<double, 2>> &coeff;
     const int nFace;
     OprodKernelType kernel;
     int dir;
     int displacement;
+    int first;    // first quark field of the current launch
+    int n_vector; // number of quark fields of the current launch
     unsigned int minThreads() const
     {
-      return kernel == INTERIOR ? inB.VolumeCB() : displacement * inB.GhostFaceCB()[dir];
+      return kernel == INTERIOR ? inB[first]->VolumeCB() : displacement * inB[first]->GhostFaceCB()[dir];
     }
 
   public:
-    StaggeredOprod(GaugeField &U, GaugeField &L, ColorSpinorField &inA, ColorSpinorField &inB,
-                   int parity, const double coeff[2], int nFace) :
+    StaggeredOprod(GaugeField &U, GaugeField &L, const std::vector<ColorSpinorField *> &inA,
+                   const std::vector<ColorSpinorField *> &inB, int parity,
+                   const std::vector<std::array<double, 2>> &coeff, int nFace) :
       TunableKernel1D(U),
       U(U),
       L(L),
       inA(inA),
       inB(inB),
       parity(parity),
-      coeff{static_cast<real>(coeff[0]), static_cast<real>(coeff[1])},
-      nFace(nFace)
+      coeff(coeff),
+      nFace(nFace),
+      displacement(1)
     {
       char aux2[TuneKey::aux_n];
       strcpy(aux2, aux);
+
+      // the interior contributions of a batch of fields are summed before the output is updated
       kernel = INTERIOR;
-      apply(device::get_default_stream());
-
-      for (int i = 3; i >= 0; i--) {
-        if (commDimPartitioned(i)) {
-          // update parameters for this exterior kernel
-          kernel = EXTERIOR;
-          dir = i;
-
-          // one and three hop terms
-          for (auto hop : std::array<int, 2>{1, 3}) {
-            if (hop == 3 && nFace != 3) continue;
-            displacement = hop;
-            strcpy(aux, aux2);
-            strcat(aux, ",dir=");
-            char tmp[2];
-            u32toa(tmp, dir);
-            strcat(aux, tmp);
-            strcat(aux, ",displacement=");
-            u32toa(tmp, displacement);
-            strcat(aux, tmp);
-            apply(device::get_default_stream());
+      const int size = inA.size();
+      for (first = 0; first < size; first += n_vector) {
+        n_vector = std::min(size - first, staggered_oprod_max_vector);
+        strcpy(aux, aux2);
+        strcat(aux, ",nvector=");
+        char tmp[16];
+        u32toa(tmp, n_vector);
+        strcat(aux, tmp);
+        apply(device::get_default_stream());
+      }
+
+      if (!comm_partitioned()) return;
+
+      // all fields share the ghost buffers, so the exterior contributions are applied one field at a time
+      kernel = EXTERIOR;
+      n_vector = 1;
+      for (first = 0; first < size; first++) {
+        inB[first]->exchangeGhost((QudaParity)(1 - parity), nFace, 0);
+
+        for (int i = 3; i >= 0; i--) {
+          if (commDimPartitioned(i)) {
+            // update parameters for this exterior kernel
+            dir = i;
+
+            // one and three hop terms
+            for (auto hop : std::array<int, 2>{1, 3}) {
+              if (hop == 3 && nFace != 3) continue;
+              displacement = hop;
+              strcpy(aux, aux2);
+              strcat(aux, ",dir=");
+              char tmp[2];
+              u32toa(tmp, dir);
+              strcat(aux, tmp);
+              strcat(aux, ",displacement=");
+              u32toa(tmp, displacement);
+              strcat(aux, tmp);
+              apply(device::get_default_stream());
+            }
           }
-        }
-      } // i=3,..,0
+        } // i=3,..,0
+
+        inB[first]->bufferIndex = (1 - inB[first]->bufferIndex);
+      }
     }
 
     void apply(const qudaStream_t &stream) {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
 
       if (kernel == INTERIOR) {
-        launch<Interior>(tp, stream, Arg<>(U, L, inA, inB, parity, displacement, nFace, coeff));
+        launch<Interior>(tp, stream, Arg<>(U, L, inA, inB, first, n_vector, parity, displacement, nFace, coeff));
       } else if (kernel == EXTERIOR) {
         switch (dir) {
-        case 0: launch<Exterior>(tp, stream, Arg<0>(U, L, inA, inB, parity, displacement, nFace, coeff)); break;
-        case 1: launch<Exterior>(tp, stream, Arg<1>(U, L, inA, inB, parity, displacement, nFace, coeff)); break;
-        case 2: launch<Exterior>(tp, stream, Arg<2>(U, L, inA, inB, parity, displacement, nFace, coeff)); break;
-        case 3: launch<Exterior>(tp, stream, Arg<3>(U, L, inA, inB, parity, displacement, nFace, coeff)); break;
+        case 0:
+          launch<Exterior>(tp, stream, Arg<0>(U, L, inA, inB, first, n_vector, parity, displacement, nFace, coeff));
+          break;
+        case 1:
+          launch<Exterior>(tp, stream, Arg<1>(U, L, inA, inB, first, n_vector, parity, displacement, nFace, coeff));
+          break;
+        case 2:
+          launch<Exterior>(tp, stream, Arg<2>(U, L, inA, inB, first, n_vector, parity, displacement, nFace, coeff));
+          break;
+        case 3:
+          launch<Exterior>(tp, stream, Arg<3>(U, L, inA, inB, first, n_vector, parity, displacement, nFace, coeff));
+          break;
         default: errorQuda("Unexpected direction %d", dir);
         }
       } else {
@@ -92,34 +124,52 @@ namespace quda {
     long long bytes() const { return 0; } // FIXME
   }; // StaggeredOprod
 
-  void computeStaggeredOprod(GaugeField &U, GaugeField &L, ColorSpinorField &inEven, ColorSpinorField &inOdd,
-                             int parity, const double coeff[2], int nFace)
+  void computeStaggeredOprod(GaugeField &U, GaugeField &L, const std::vector<ColorSpinorField *> &in, int parity,
+                             const std::vector<std::array<double, 2>> &coeff, int nFace)
   {
     checkNative(U, L);
-    ColorSpinorField &inA = (parity & 1) ? inOdd : inEven;
-    ColorSpinorField &inB = (parity & 1) ? inEven : inOdd;
+    std::vector<ColorSpinorField *> inA, inB;
+    for (auto f : in) {
+      checkPrecision(U, *f);
+      inA.push_back((parity & 1) ? &f->Odd() : &f->Even());
+      inB.push_back((parity & 1) ? &f->Even() : &f->Odd());
+    }
 
-    inB.exchangeGhost((QudaParity)(1-parity), nFace, 0);
     instantiate<StaggeredOprod, ReconstructNone>(U, L, inA, inB, parity, coeff, nFace);
-
-    inB.bufferIndex = (1 - inB.bufferIndex);
   }
 
 #ifdef GPU_STAGGERED_DIRAC
-  void computeStaggeredOprod(GaugeField *out[], ColorSpinorField& in, const double coeff[], int nFace)
+  void computeStaggeredOprod(GaugeField *out[], const std::vector<ColorSpinorField *> &in,
+                             const std::vector<std::array<double, 2>> &coeff, int nFace)
   {
+    if (in.size() != coeff.size())
+      errorQuda("Number of fields %lu and coefficients %lu differ", in.size(), coeff.size());
+    if (in.empty()) return;
+
     if (nFace == 1) {
-      computeStaggeredOprod(*out[0], *out[0], in.Even(), in.Odd(), 0, coeff, nFace);
-      double coeff_[2] = {-coeff[0],0.0}; // need to multiply by -1 on odd sites
-      computeStaggeredOprod(*out[0], *out[0], in.Even(), in.Odd(), 1, coeff_, nFace);
+      computeStaggeredOprod(*out[0], *out[0], in, 0, coeff, nFace);
+      auto coeff_ = coeff;
+      for (auto &c : coeff_) c = {-c[0], 0.0}; // need to multiply by -1 on odd sites
+      computeStaggeredOprod(*out[0], *out[0], in, 1, coeff_, nFace);
     } else if (nFace == 3) {
-      computeStaggeredOprod(*out[0], *out[1], in.Even(), in.Odd(), 0, coeff, nFace);
-      computeStaggeredOprod(*out[0], *out[1], in.Even(), in.Odd(), 1, coeff, nFace);
+      computeStaggeredOprod(*out[0], *out[1], in, 0, coeff, nFace);
+      computeStaggeredOprod(*out[0], *out[1], in, 1, coeff, nFace);
     } else {
       errorQuda("Invalid nFace=%d", nFace);
     }
   }
+
+  void computeStaggeredOprod(GaugeField *out[], ColorSpinorField& in, const double coeff[], int nFace)
+  {
+    computeStaggeredOprod(out, {&in}, {{coeff[0], coeff[1]}}, nFace);
+  }
 #else // GPU_STAGGERED_DIRAC not defined
+  void computeStaggeredOprod(GaugeField *[], const std::vector<ColorSpinorField *> &,
+                             const std::vector<std::array<double, 2>> &, int)
+  {
+    errorQuda("Staggered Outer Product has not been built!");
+  }
+
   void computeStaggeredOprod(GaugeField *[], ColorSpinorField &, const double [], int)
   {
     errorQuda("Staggered Outer Product has not been built!");
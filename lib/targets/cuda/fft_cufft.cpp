@@ -0,0 +1,112 @@
+#include <fft_quda.h>
+#ifdef GPU_GAUGE_ALG
+#include <cufft.h>
+#include <quda_cuda_api.h>
+#endif
+
+namespace quda
+{
+
+  namespace fft
+  {
+
+    namespace native
+    {
+
+#ifdef GPU_GAUGE_ALG
+
+      /**
+         @brief Helper function for decoding cuFFT return codes
+      */
+      static const char *cufftGetErrorEnum(cufftResult error)
+      {
+        switch (error) {
+        case CUFFT_SUCCESS: return "CUFFT_SUCCESS";
+        case CUFFT_INVALID_PLAN: return "CUFFT_INVALID_PLAN";
+        case CUFFT_ALLOC_FAILED: return "CUFFT_ALLOC_FAILED";
+        case CUFFT_INVALID_TYPE: return "CUFFT_INVALID_TYPE";
+        case CUFFT_INVALID_VALUE: return "CUFFT_INVALID_VALUE";
+        case CUFFT_INTERNAL_ERROR: return "CUFFT_INTERNAL_ERROR";
+        case CUFFT_EXEC_FAILED: return "CUFFT_EXEC_FAILED";
+        case CUFFT_SETUP_FAILED: return "CUFFT_SETUP_FAILED";
+        case CUFFT_INVALID_SIZE: return "CUFFT_INVALID_SIZE";
+        case CUFFT_UNALIGNED_DATA: return "CUFFT_UNALIGNED_DATA";
+        case CUFFT_INCOMPLETE_PARAMETER_LIST: return "CUFFT_INCOMPLETE_PARAMETER_LIST";
+        case CUFFT_INVALID_DEVICE: return "CUFFT_INVALID_DEVICE";
+        case CUFFT_PARSE_ERROR: return "CUFFT_PARSE_ERROR";
+        case CUFFT_NO_WORKSPACE: return "CUFFT_NO_WORKSPACE";
+        case CUFFT_NOT_IMPLEMENTED: return "CUFFT_NOT_IMPLEMENTED";
+        case CUFFT_LICENSE_ERROR: return "CUFFT_LICENSE_ERROR";
+        case CUFFT_NOT_SUPPORTED: return "CUFFT_NOT_SUPPORTED";
+        default: return "<unknown error>";
+        }
+      }
+
+#define CUFFT_SAFE_CALL(call)                                                                                          \
+  {                                                                                                                    \
+    cufftResult err = call;                                                                                            \
+    if (CUFFT_SUCCESS != err) { errorQuda("CUFFT error %s", cufftGetErrorEnum(err)); }                                 \
+  }
+
+      bool available() { return true; }
+
+      void *create(int rank, const int n[], int stride, int dist, int batch, QudaPrecision precision)
+      {
+        if (rank < 1 || rank > 3) errorQuda("Unsupported transform rank %d", rank);
+        auto type = precision == QUDA_DOUBLE_PRECISION ? CUFFT_Z2Z : CUFFT_C2C;
+        int embed[3];
+        for (int i = 0; i < rank; i++) embed[i] = n[i];
+
+        auto plan = new cufftHandle;
+        CUFFT_SAFE_CALL(cufftPlanMany(plan, rank, const_cast<int *>(n), embed, stride, dist, embed, stride, dist, type,
+                                      batch));
+        CUFFT_SAFE_CALL(cufftSetStream(*plan, target::cuda::get_stream(device::get_default_stream())));
+        return plan;
+      }
+
+      void execute(void *plan, void *data, int direction, QudaPrecision precision)
+      {
+        auto &handle = *static_cast<cufftHandle *>(plan);
+        int dir = direction == forward ? CUFFT_FORWARD : CUFFT_INVERSE;
+        if (precision == QUDA_DOUBLE_PRECISION) {
+          auto z = static_cast<cufftDoubleComplex *>(data);
+          CUFFT_SAFE_CALL(cufftExecZ2Z(handle, z, z, dir));
+        } else {
+          auto c = static_cast<cufftComplex *>(data);
+          CUFFT_SAFE_CALL(cufftExecC2C(handle, c, c, dir));
+        }
+      }
+
+      void destroy(void *plan)
+      {
+        auto handle = static_cast<cufftHandle *>(plan);
+        CUFFT_SAFE_CALL(cufftDestroy(*handle));
+        delete handle;
+      }
+
+#undef CUFFT_SAFE_CALL
+
+#else
+
+      bool available() { return false; }
+
+      void *create(int, const int[], int, int, int, QudaPrecision)
+      {
+        errorQuda("GPU_GAUGE_ALG is disabled so cuFFT is not available");
+        return nullptr;
+      }
+
+      void execute(void *, void *, int, QudaPrecision)
+      {
+        errorQuda("GPU_GAUGE_ALG is disabled so cuFFT is not available");
+      }
+
+      void destroy(void *) { errorQuda("GPU_GAUGE_ALG is disabled so cuFFT is not available"); }
+
+#endif
+
+    } // namespace native
+
+  } // namespace fft
+
+} // namespace quda
@@ -6,6 +6,7 @@
 #include <execinfo.h> // for backtrace
 #include <quda_internal.h>
 #include <device.h>
+#include <field_residency.h>
 #include <shmem_helper.cuh>
 
 #ifdef USE_QDPJIT
@@ -230,7 +231,12 @@ namespace quda
 
     a.size = a.base_size = size;
 
+    residency::reserve(size); // spill resident fields if this allocation would exceed the memory budget
     cudaError_t err = cudaMalloc(&ptr, size);
+    if (err != cudaSuccess && residency::evict(size) > 0) { // spill resident fields and retry
+      cudaGetLastError();
+      err = cudaMalloc(&ptr, size);
+    }
     if (err != cudaSuccess) {
       errorQuda("Failed to allocate device memory of size %zu (%s:%d in %s())\n", size, file, line, func);
     }
@@ -0,0 +1,32 @@
+#include <fft_quda.h>
+
+namespace quda
+{
+
+  namespace fft
+  {
+
+    /**
+       No native FFT library is used on this target, so device
+       transforms are staged through the host FFT.
+     */
+    namespace native
+    {
+
+      bool available() { return false; }
+
+      void *create(int, const int[], int, int, int, QudaPrecision)
+      {
+        errorQuda("Native FFTs are not supported on this target");
+        return nullptr;
+      }
+
+      void execute(void *, void *, int, QudaPrecision) { errorQuda("Native FFTs are not supported on this target"); }
+
+      void destroy(void *) { errorQuda("Native FFTs are not supported on this target"); }
+
+    } // namespace native
+
+  } // namespace fft
+
+} // namespace quda
@@ -6,6 +6,7 @@
 #include <execinfo.h> // for backtrace
 #include <quda_internal.h>
 #include <device.h>
+#include <field_residency.h>
 
 #ifdef USE_QDPJIT
 #include "qdp_quda.h"
@@ -204,7 +205,12 @@ namespace quda
 
     a.size = a.base_size = size;
 
+    residency::reserve(size); // spill resident fields if this allocation would exceed the memory budget
     hipError_t err = hipMalloc(&ptr, size);
+    if (err != hipSuccess && residency::evict(size) > 0) { // spill resident fields and retry
+      hipGetLastError();
+      err = hipMalloc(&ptr, size);
+    }
     if (err != hipSuccess) {
       errorQuda("Failed to allocate device memory of size %zu (%s:%d in %s())\n", size, file, line, func);
     }
@@ -71,26 +71,19 @@ namespace quda {
     }
 #endif
 
-    template <typename Float, typename Arg> void unitarizeForceCPU(Arg &arg)
+    /**
+       @brief Host unitarization of the force, which runs the device
+       kernel functor with the sites distributed over threads
+     */
+    template <typename Arg> void unitarizeForceCPU(Arg &arg)
     {
-      Matrix<complex<double>, 3> v, result, oprod;
-      Matrix<complex<Float>, 3> v_tmp, result_tmp, oprod_tmp;
-
-      for (int parity = 0; parity < 2; parity++) {
-        for (unsigned int i = 0; i < arg.threads.x; i++) {
-          for (int dir = 0; dir < 4; dir++) {
-            oprod_tmp = arg.force_old(dir, i, parity);
-            v_tmp = arg.u(dir, i, parity);
-            v = v_tmp;
-            oprod = oprod_tmp;
-
-            getUnitarizeForceSite<double>(result, v, oprod, arg);
-
-            result_tmp = result;
-            arg.force(dir, i, parity) = result_tmp;
-          }
-        }
-      }
+      UnitarizeForce<Arg> f(arg);
+      const long n = 2 * static_cast<long>(arg.threads.x);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+      for (long i = 0; i < n; i++) f(i % arg.threads.x, i / arg.threads.x);
     }
 
 #ifdef GPU_HISQ_FORCE
@@ -99,18 +92,17 @@ namespace quda {
       if (checkLocation(newForce, oldForce, u) != QUDA_CPU_FIELD_LOCATION) errorQuda("Location must be CPU");
       int num_failures = 0;
       constexpr int nColor = 3;
-      Matrix<complex<double>, nColor> old_force, new_force, v;
       if (u.Order() == QUDA_MILC_GAUGE_ORDER) {
         if (u.Precision() == QUDA_DOUBLE_PRECISION) {
           UnitarizeForceArg<double, nColor, QUDA_RECONSTRUCT_NO, QUDA_MILC_GAUGE_ORDER> arg(
             newForce, oldForce, u, &num_failures, unitarize_eps, force_filter, max_det_error, allow_svd, svd_only,
             svd_rel_error, svd_abs_error);
-          unitarizeForceCPU<double>(arg);
+          unitarizeForceCPU(arg);
         } else if (u.Precision() == QUDA_SINGLE_PRECISION) {
           UnitarizeForceArg<float, nColor, QUDA_RECONSTRUCT_NO, QUDA_MILC_GAUGE_ORDER> arg(
             newForce, oldForce, u, &num_failures, unitarize_eps, force_filter, max_det_error, allow_svd, svd_only,
             svd_rel_error, svd_abs_error);
-          unitarizeForceCPU<float>(arg);
+          unitarizeForceCPU(arg);
         } else {
           errorQuda("Precision = %d not supported", u.Precision());
         }
@@ -119,12 +111,12 @@ namespace quda {
           UnitarizeForceArg<double, nColor, QUDA_RECONSTRUCT_NO, QUDA_QDP_GAUGE_ORDER> arg(
             newForce, oldForce, u, &num_failures, unitarize_eps, force_filter, max_det_error, allow_svd, svd_only,
             svd_rel_error, svd_abs_error);
-          unitarizeForceCPU<double>(arg);
+          unitarizeForceCPU(arg);
         } else if (u.Precision() == QUDA_SINGLE_PRECISION) {
           UnitarizeForceArg<float, nColor, QUDA_RECONSTRUCT_NO, QUDA_QDP_GAUGE_ORDER> arg(
             newForce, oldForce, u, &num_failures, unitarize_eps, force_filter, max_det_error, allow_svd, svd_only,
             svd_rel_error, svd_abs_error);
-          unitarizeForceCPU<float>(arg);
+          unitarizeForceCPU(arg);
         } else {
           errorQuda("Precision = %d not supported", u.Precision());
         }
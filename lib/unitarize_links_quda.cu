@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <gauge_field.h>
 #include <unitarization_links.h>
 #include <tunable_nd.h>
@@ -53,27 +54,122 @@ namespace quda {
     }
   }
 
+  /**
+     Number of links the host unitarization processes together.  The
+     batch is stored as a structure of arrays, so that each link of
+     the batch maps to a SIMD lane.
+   */
+  constexpr int unitarize_host_batch = 16;
+
+  /**
+     @brief Apply a Newton step u = (u + u^{-dagger}) / 2 to each link
+     of a batch.  The inverse is formed from the cofactor matrix C,
+     with u^{-dagger} = conj(C) / conj(det u), which is branch free so
+     the batch vectorizes.
+     @param[in,out] ur Real parts of the links, indexed by element and lane
+     @param[in,out] ui Imaginary parts of the links, indexed by element and lane
+   */
+  template <int batch> inline void unitarizeNewtonStep(double (&ur)[9][batch], double (&ui)[9][batch])
+  {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (int l = 0; l < batch; l++) {
+      double cr[9], ci[9];
+      for (int r = 0; r < 3; r++) {
+        const int r1 = (r + 1) % 3, r2 = (r + 2) % 3;
+        for (int c = 0; c < 3; c++) {
+          const int c1 = (c + 1) % 3, c2 = (c + 2) % 3;
+          const int a = r1 * 3 + c1, b = r2 * 3 + c2, d = r1 * 3 + c2, e = r2 * 3 + c1;
+          cr[r * 3 + c] = ur[a][l] * ur[b][l] - ui[a][l] * ui[b][l] - ur[d][l] * ur[e][l] + ui[d][l] * ui[e][l];
+          ci[r * 3 + c] = ur[a][l] * ui[b][l] + ui[a][l] * ur[b][l] - ur[d][l] * ui[e][l] - ui[d][l] * ur[e][l];
+        }
+      }
+
+      double det_r = 0.0, det_i = 0.0;
+      for (int c = 0; c < 3; c++) {
+        det_r += ur[c][l] * cr[c] - ui[c][l] * ci[c];
+        det_i += ur[c][l] * ci[c] + ui[c][l] * cr[c];
+      }
+
+      // 1 / conj(det)
+      const double n = 1.0 / (det_r * det_r + det_i * det_i);
+      const double id_r = det_r * n, id_i = det_i * n;
+
+      for (int k = 0; k < 9; k++) {
+        ur[k][l] = 0.5 * (ur[k][l] + cr[k] * id_r + ci[k] * id_i);
+        ui[k][l] = 0.5 * (ui[k][l] + cr[k] * id_i - ci[k] * id_r);
+      }
+    }
+  }
+
+  /**
+     @brief Unitarize an array of links with the Newton iteration,
+     distributing batches of links over threads
+     @param[out] out The unitarized links
+     @param[in] in The input links
+     @param[in] n_link The number of links
+     @return The number of links whose unitarization is inconsistent with the input
+   */
+  template <typename Float> int unitarizeLinksHost(Float *out, const Float *in, size_t n_link)
+  {
+    constexpr int batch = unitarize_host_batch;
+    const long n_batch = (n_link + batch - 1) / batch;
+    int num_failures = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : num_failures)
+#endif
+    for (long b = 0; b < n_batch; b++) {
+      const int n = std::min<size_t>(batch, n_link - b * batch);
+      const Float *in_b = in + b * batch * 18;
+      Float *out_b = out + b * batch * 18;
+
+      // the lanes past the end of the array are padded with the identity
+      double ur[9][batch], ui[9][batch];
+      for (int k = 0; k < 9; k++) {
+        for (int l = 0; l < batch; l++) {
+          ur[k][l] = l < n ? in_b[l * 18 + k * 2 + 0] : (k % 4 == 0 ? 1.0 : 0.0);
+          ui[k][l] = l < n ? in_b[l * 18 + k * 2 + 1] : 0.0;
+        }
+      }
+
+      for (int i = 0; i < max_iter_newton; i++) unitarizeNewtonStep(ur, ui);
+
+      for (int l = 0; l < n; l++) {
+        Matrix<complex<double>, 3> inlink, outlink;
+        for (int k = 0; k < 9; k++) {
+          inlink.data[k] = complex<double>(in_b[l * 18 + k * 2 + 0], in_b[l * 18 + k * 2 + 1]);
+          outlink.data[k] = complex<double>(ur[k][l], ui[k][l]);
+          out_b[l * 18 + k * 2 + 0] = ur[k][l];
+          out_b[l * 18 + k * 2 + 1] = ui[k][l];
+        }
+        if (!isUnitarizedLinkConsistent(inlink, outlink, 0.0000001)) {
+          printf("ERROR: Unitarized link is not consistent with incoming link\n");
+          num_failures++;
+        }
+      }
+    }
+
+    return num_failures;
+  }
+
   void unitarizeLinksCPU(GaugeField &outfield, const GaugeField& infield)
   {
     if (checkLocation(outfield, infield) != QUDA_CPU_FIELD_LOCATION) errorQuda("Location must be CPU");
     checkPrecision(outfield, infield);
 
-    int num_failures = 0;
-    Matrix<complex<double>,3> inlink, outlink;
-
-    for (unsigned int i = 0; i < infield.Volume(); ++i) {
-      for (int dir=0; dir<4; ++dir){
-	if (infield.Precision() == QUDA_SINGLE_PRECISION) {
-	  copyArrayToLink(inlink, ((float*)(infield.Gauge_p()) + (i*4 + dir)*18)); // order of arguments?
-	  if (unitarizeLinkNewton(outlink, inlink, max_iter_newton) == false ) num_failures++;
-	  copyLinkToArray(((float*)(outfield.Gauge_p()) + (i*4 + dir)*18), outlink);
-	} else if (infield.Precision() == QUDA_DOUBLE_PRECISION) {
-	  copyArrayToLink(inlink, ((double*)(infield.Gauge_p()) + (i*4 + dir)*18)); // order of arguments?
-	  if (unitarizeLinkNewton(outlink, inlink, max_iter_newton) == false ) num_failures++;
-	  copyLinkToArray(((double*)(outfield.Gauge_p()) + (i*4 + dir)*18), outlink);
-	} // precision?
-      } // dir
-    }   // loop over volume
+    // the links are contiguous, site-major and direction-minor
+    const size_t n_link = 4 * infield.Volume();
+    if (infield.Precision() == QUDA_SINGLE_PRECISION) {
+      unitarizeLinksHost(static_cast<float *>(outfield.Gauge_p()), static_cast<const float *>(infield.Gauge_p()),
+                         n_link);
+    } else if (infield.Precision() == QUDA_DOUBLE_PRECISION) {
+      unitarizeLinksHost(static_cast<double *>(outfield.Gauge_p()), static_cast<const double *>(infield.Gauge_p()),
+                         n_link);
+    } else {
+      errorQuda("Precision = %d not supported", infield.Precision());
+    }
   }
 #else
   void unitarizeLinksCPU(GaugeField &, const GaugeField &)
@@ -0,0 +1,160 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+
+#include <quda.h>
+#include <color_spinor_field.h>
+#include <host_utils.h>
+#include <command_line_params.h>
+#include "misc.h"
+#include <gtest/gtest.h>
+
+// relative deviation of the momentum from a doubled step from twice
+// the momentum from a single step, and the norm of the latter
+static double force_deviation = 0.0;
+static double force_norm = 0.0;
+
+template <typename Float> static void compareMomentum(const void *mom1, const void *mom2, size_t n)
+{
+  auto m1 = static_cast<const Float *>(mom1);
+  auto m2 = static_cast<const Float *>(mom2);
+  double norm = 0.0, dev = 0.0;
+  for (size_t i = 0; i < n; i++) {
+    norm += (double)m1[i] * m1[i];
+    dev += ((double)m2[i] - 2.0 * m1[i]) * ((double)m2[i] - 2.0 * m1[i]);
+  }
+  force_norm = sqrt(norm);
+  force_deviation = norm > 0.0 ? sqrt(dev / (4.0 * norm)) : 0.0;
+}
+
+static void clover_force_test(int argc, char **argv)
+{
+  QudaGaugeParam gauge_param = newQudaGaugeParam();
+  setWilsonGaugeParam(gauge_param);
+  setDims(gauge_param.X);
+
+  QudaInvertParam inv_param = newQudaInvertParam();
+  setInvertParam(inv_param);
+  // the force is computed for the even-even preconditioned normal operator on DeGrand-Rossi host fields
+  inv_param.solve_type = QUDA_NORMOP_PC_SOLVE;
+  inv_param.solution_type = QUDA_MATPCDAG_MATPC_SOLUTION;
+  inv_param.matpc_type = QUDA_MATPC_EVEN_EVEN_ASYMMETRIC;
+  inv_param.gamma_basis = QUDA_DEGRAND_ROSSI_GAMMA_BASIS;
+
+  void *gauge[4];
+  for (int dir = 0; dir < 4; dir++) gauge[dir] = safe_malloc(V * gauge_site_size * host_gauge_data_type_size);
+  constructHostGaugeField(gauge, gauge_param, argc, argv);
+  loadGaugeQuda((void *)gauge, &gauge_param);
+
+  // the clover term and its inverse are computed from the resident gauge field
+  inv_param.compute_clover = 1;
+  inv_param.compute_clover_inverse = 1;
+  inv_param.return_clover = 0;
+  inv_param.return_clover_inverse = 0;
+  loadCloverQuda(nullptr, nullptr, &inv_param);
+
+  // random even-parity quark fields
+  const int nvector = 2;
+  quda::ColorSpinorParam cs_param;
+  constructWilsonTestSpinorParam(&cs_param, &inv_param, &gauge_param);
+  std::vector<quda::ColorSpinorField *> x(nvector);
+  std::vector<void *> x_h(nvector);
+  for (int i = 0; i < nvector; i++) {
+    x[i] = quda::ColorSpinorField::Create(cs_param);
+    x[i]->Source(QUDA_RANDOM_SOURCE);
+    x_h[i] = x[i]->V();
+  }
+  std::vector<double> coeff = {1.0, 0.5};
+
+  // the momentum is returned in MILC order
+  gauge_param.gauge_order = QUDA_MILC_GAUGE_ORDER;
+  size_t mom_bytes = 4 * V * mom_site_size * host_gauge_data_type_size;
+  void *mom1 = safe_malloc(mom_bytes);
+  void *mom2 = safe_malloc(mom_bytes);
+  memset(mom1, 0, mom_bytes);
+  memset(mom2, 0, mom_bytes);
+
+  // every contribution to the force is proportional to the step
+  // size, so starting from zero momentum a doubled step must give
+  // twice the momentum
+  const double dt = 0.1;
+  const double kappa2 = -inv_param.kappa * inv_param.kappa;
+  const double ck = 0.25 * inv_param.clover_coeff;
+  const double multiplicity = 1.0;
+
+  computeCloverForceQuda(mom1, dt, x_h.data(), nullptr, coeff.data(), kappa2, ck, nvector, multiplicity, gauge,
+                         &gauge_param, &inv_param);
+  computeCloverForceQuda(mom2, 2.0 * dt, x_h.data(), nullptr, coeff.data(), kappa2, ck, nvector, multiplicity, gauge,
+                         &gauge_param, &inv_param);
+
+  if (gauge_param.cpu_prec == QUDA_DOUBLE_PRECISION)
+    compareMomentum<double>(mom1, mom2, 4 * V * mom_site_size);
+  else
+    compareMomentum<float>(mom1, mom2, 4 * V * mom_site_size);
+  printfQuda("Clover force momentum norm = %e, step-size linearity deviation = %e\n", force_norm, force_deviation);
+
+  host_free(mom2);
+  host_free(mom1);
+  for (auto v : x) delete v;
+  freeCloverQuda();
+  freeGaugeQuda();
+  for (int dir = 0; dir < 4; dir++) host_free(gauge[dir]);
+}
+
+TEST(force, nonzero) { ASSERT_GT(force_norm, 0.0) << "Clover force did not update the momentum"; }
+
+TEST(force, linear)
+{
+  ASSERT_LE(force_deviation, getTolerance(cuda_prec)) << "Clover force is not proportional to the step size";
+}
+
+static void display_test_info()
+{
+  printfQuda("running the following test:\n");
+
+  printfQuda("link_precision           link_reconstruct           space_dim(x/y/z)              T_dimension\n");
+  printfQuda("%s                       %s                         %d/%d/%d                       %d\n",
+             get_prec_str(prec), get_recon_str(link_recon), xdim, ydim, zdim, tdim);
+}
+
+int main(int argc, char **argv)
+{
+  // initalize google test
+  ::testing::InitGoogleTest(&argc, argv);
+  // return code for google test
+  int test_rc = 0;
+
+  // command line options
+  auto app = make_app();
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  // the clover force is only implemented for the clover action
+  dslash_type = QUDA_CLOVER_WILSON_DSLASH;
+
+  initComms(argc, argv, gridsize_from_cmdline);
+
+  initQuda(device_ordinal);
+
+  display_test_info();
+
+  clover_force_test(argc, argv);
+
+  if (verify_results) {
+    // Ensure gtest prints only from rank 0
+    ::testing::TestEventListeners &listeners = ::testing::UnitTest::GetInstance()->listeners();
+    if (comm_rank() != 0) { delete listeners.Release(listeners.default_result_printer()); }
+
+    test_rc = RUN_ALL_TESTS();
+    if (test_rc != 0) warningQuda("Tests failed");
+  }
+
+  endQuda();
+  finalizeComms();
+  return test_rc;
+}
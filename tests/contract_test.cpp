@@ -3,6 +3,7 @@
 #include <time.h>
 #include <math.h>
 #include <string.h>
+#include <vector>
 
 #include <util_quda.h>
 #include <host_utils.h>
@@ -166,6 +167,140 @@ int test(int contractionType, QudaPrecision test_prec)
   return faults;
 }
 
+// Performs the momentum-projected contraction and compares against the host,
+// using either a few momenta (phase factors) or a dense set (FFT)
+int test_ft(int contractionType, QudaPrecision test_prec, bool dense)
+{
+  int X[4] = {xdim, ydim, zdim, tdim};
+
+  QudaInvertParam inv_param = newQudaInvertParam();
+  setContractInvertParam(inv_param);
+  inv_param.cpu_prec = test_prec;
+  inv_param.cuda_prec = test_prec;
+  inv_param.cuda_prec_sloppy = test_prec;
+  inv_param.cuda_prec_precondition = test_prec;
+
+  size_t data_size = (test_prec == QUDA_DOUBLE_PRECISION) ? sizeof(double) : sizeof(float);
+  void *spinorX = safe_malloc(V * spinor_site_size * data_size);
+  void *spinorY = safe_malloc(V * spinor_site_size * data_size);
+
+  if (test_prec == QUDA_SINGLE_PRECISION) {
+    for (int i = 0; i < V * spinor_site_size; i++) {
+      ((float *)spinorX)[i] = rand() / (float)RAND_MAX;
+      ((float *)spinorY)[i] = rand() / (float)RAND_MAX;
+    }
+  } else {
+    for (int i = 0; i < V * spinor_site_size; i++) {
+      ((double *)spinorX)[i] = rand() / (double)RAND_MAX;
+      ((double *)spinorY)[i] = rand() / (double)RAND_MAX;
+    }
+  }
+
+  std::vector<int> mom;
+  if (dense) {
+    for (int pz = -2; pz <= 2; pz++)
+      for (int py = -2; py <= 2; py++)
+        for (int px = -2; px <= 2; px++) mom.insert(mom.end(), {px, py, pz});
+  } else {
+    mom = {0, 0, 0, 1, 0, 0, 0, -1, 2};
+  }
+  int n_mom = mom.size() / 3;
+  int source_position[4] = {1, 2, 3, 0};
+
+  QudaContractType cType = contractionType == 0 ? QUDA_CONTRACT_TYPE_OPEN : QUDA_CONTRACT_TYPE_DR;
+
+  std::vector<double> d_result(2 * n_mom * 16 * tdim * comm_dim(3));
+  contractFTQuda(spinorX, spinorY, d_result.data(), cType, &inv_param, X, source_position, mom.data(), n_mom);
+
+  int faults = 0;
+  if (test_prec == QUDA_DOUBLE_PRECISION) {
+    faults = contraction_ft_reference((double *)spinorX, (double *)spinorY, d_result.data(), cType, source_position,
+                                      mom.data(), n_mom);
+  } else {
+    faults = contraction_ft_reference((float *)spinorX, (float *)spinorY, d_result.data(), cType, source_position,
+                                      mom.data(), n_mom);
+  }
+
+  printfQuda("Momentum projected contraction for contraction type %s with %d momenta complete with %d/%d faults\n",
+             get_contract_str(cType), n_mom, faults, (int)d_result.size() / 2);
+
+  host_free(spinorX);
+  host_free(spinorY);
+
+  return faults;
+}
+
+// Performs the batched meson and baryon contractions of two flavors and compares against the host
+int test_propagators(QudaPrecision test_prec)
+{
+  int X[4] = {xdim, ydim, zdim, tdim};
+
+  QudaInvertParam inv_param = newQudaInvertParam();
+  setContractInvertParam(inv_param);
+  inv_param.cpu_prec = test_prec;
+  inv_param.cuda_prec = test_prec;
+  inv_param.cuda_prec_sloppy = test_prec;
+  inv_param.cuda_prec_precondition = test_prec;
+
+  constexpr int n_flavor = 2;
+  size_t data_size = (test_prec == QUDA_DOUBLE_PRECISION) ? sizeof(double) : sizeof(float);
+  std::vector<void *> props(12 * n_flavor);
+  for (auto &p : props) {
+    p = safe_malloc(V * spinor_site_size * data_size);
+    for (int i = 0; i < V * spinor_site_size; i++) {
+      if (test_prec == QUDA_SINGLE_PRECISION)
+        ((float *)p)[i] = rand() / (float)RAND_MAX - 0.5f;
+      else
+        ((double *)p)[i] = rand() / (double)RAND_MAX - 0.5;
+    }
+  }
+
+  // all diagonal insertions plus two off-diagonal, which exceeds a single launch
+  std::vector<int> gamma;
+  for (int g = 0; g < 16; g++) gamma.insert(gamma.end(), {g, g});
+  gamma.insert(gamma.end(), {5, 9, 4, 0});
+  int n_gamma = gamma.size() / 2;
+  std::vector<int> flavors = {0, 1, 1, 1};
+  int n_pair = flavors.size() / 2;
+
+  const int T = tdim * comm_dim(3);
+  std::vector<double> meson(2 * n_pair * n_gamma * T);
+  std::vector<double> baryon(2 * n_pair * T);
+  contractPropagatorsQuda(props.data(), n_flavor, flavors.data(), n_pair, gamma.data(), n_gamma, meson.data(),
+                          baryon.data(), &inv_param, X);
+
+  double tol = (test_prec == QUDA_DOUBLE_PRECISION) ? 1e-10 : 1e-5;
+  auto compare = [tol](const double *d, const std::vector<std::complex<double>> &h) {
+    double norm = 0.0;
+    for (auto &c : h) norm = std::max(norm, abs(c));
+    int faults = 0;
+    for (size_t i = 0; i < h.size(); i++)
+      if (abs(std::complex<double>(d[2 * i], d[2 * i + 1]) - h[i]) > tol * (1.0 + norm)) faults++;
+    return faults;
+  };
+
+  int faults = 0;
+  for (int p = 0; p < n_pair; p++) {
+    void **S1 = props.data() + 12 * flavors[2 * p + 0];
+    void **S2 = props.data() + 12 * flavors[2 * p + 1];
+    std::vector<std::complex<double>> h_meson, h_baryon;
+    if (test_prec == QUDA_DOUBLE_PRECISION) {
+      meson_reference<double>(S1, S2, gamma.data(), n_gamma, h_meson);
+      baryon_reference<double>(S1, S2, h_baryon);
+    } else {
+      meson_reference<float>(S1, S2, gamma.data(), n_gamma, h_meson);
+      baryon_reference<float>(S1, S2, h_baryon);
+    }
+    faults += compare(meson.data() + 2 * p * n_gamma * T, h_meson);
+    faults += compare(baryon.data() + 2 * p * T, h_baryon);
+  }
+
+  printfQuda("Meson and baryon contractions of %d flavor pairs complete with %d faults\n", n_pair, faults);
+
+  for (auto &p : props) host_free(p);
+  return faults;
+}
+
 // The following tests gets each contraction type and precision using google testing framework
 using ::testing::Bool;
 using ::testing::Combine;
@@ -206,3 +341,47 @@ std::string getContractName(testing::TestParamInfo<::testing::tuple<int, int>> p
 
 // Instantiate all test cases
 INSTANTIATE_TEST_SUITE_P(QUDA, ContractionTest, Combine(Range(2, 4), Range(0, NcontractType)), getContractName);
+
+class ContractionFTTest : public ::testing::TestWithParam<::testing::tuple<int, int, bool>>
+{
+};
+
+TEST_P(ContractionFTTest, verify)
+{
+  QudaPrecision prec = getPrecision(::testing::get<0>(GetParam()));
+  int contractionType = ::testing::get<1>(GetParam());
+  bool dense = ::testing::get<2>(GetParam());
+  if ((QUDA_PRECISION & prec) == 0) GTEST_SKIP();
+  auto faults = test_ft(contractionType, prec, dense);
+  EXPECT_EQ(faults, 0) << "CPU and GPU momentum projections do not agree";
+}
+
+std::string getContractFTName(testing::TestParamInfo<::testing::tuple<int, int, bool>> param)
+{
+  int prec = ::testing::get<0>(param.param);
+  int contractType = ::testing::get<1>(param.param);
+  bool dense = ::testing::get<2>(param.param);
+  std::string str(names[contractType]);
+  str += std::string("_");
+  str += std::string(prec_str[prec]);
+  str += dense ? std::string("_dense") : std::string("_sparse");
+  return str;
+}
+
+INSTANTIATE_TEST_SUITE_P(QUDA, ContractionFTTest, Combine(Range(2, 4), Range(0, NcontractType), Bool()),
+                         getContractFTName);
+
+class PropagatorContractionTest : public ::testing::TestWithParam<int>
+{
+};
+
+TEST_P(PropagatorContractionTest, verify)
+{
+  QudaPrecision prec = getPrecision(GetParam());
+  if ((QUDA_PRECISION & prec) == 0) GTEST_SKIP();
+  auto faults = test_propagators(prec);
+  EXPECT_EQ(faults, 0) << "CPU and GPU meson and baryon contractions do not agree";
+}
+
+INSTANTIATE_TEST_SUITE_P(QUDA, PropagatorContractionTest, Range(2, 4),
+                         [](testing::TestParamInfo<int> param) { return std::string(prec_str[param.param]); });
@@ -37,6 +37,19 @@ TEST(dslash, verify)
   ASSERT_LE(deviation, tol) << "CPU and CUDA implementations do not agree";
 }
 
+TEST(dslash, halo_compression)
+{
+  if (dslash_type != QUDA_WILSON_DSLASH || dslash_test_wrapper.dtest_type != dslash_test_type::Dslash
+      || dslash_test_wrapper.test_split_grid || halo_prec_sloppy == QUDA_INVALID_PRECISION
+      || halo_prec_sloppy >= dslash_test_wrapper.inv_param.cuda_prec)
+    GTEST_SKIP();
+
+  // the halo sites are rounded to the halo precision, and contribute to the result at that precision
+  double deviation = dslash_test_wrapper.haloCompressionDeviation();
+  double tol = getTolerance(halo_prec_sloppy);
+  ASSERT_LE(deviation, tol) << "Compressed and uncompressed halo dslash do not agree";
+}
+
 int main(int argc, char **argv)
 {
   // initalize google test, includes command line options
@@ -1079,4 +1079,32 @@ struct DslashTestWrapper {
     }
     return deviation;
   }
+
+  /**
+     @brief Apply the Wilson dslash with the halo compressed to
+     halo_prec_sloppy, and return its L2 deviation relative to the
+     dslash with an uncompressed halo
+   */
+  double haloCompressionDeviation()
+  {
+    DiracParam diracParam;
+    setDiracParam(diracParam, &inv_param, true);
+    diracParam.tmp1 = tmp1.get();
+    diracParam.tmp2 = tmp2.get();
+    diracParam.wilson_halo_precision = halo_prec_sloppy;
+    Dirac *dirac_compressed = Dirac::create(diracParam);
+
+    ColorSpinorParam csParam(*cudaSpinorOut);
+    csParam.create = QUDA_NULL_FIELD_CREATE;
+    ColorSpinorField out_compressed(csParam);
+
+    dirac->Dslash(*cudaSpinorOut, *cudaSpinor, parity);
+    dirac_compressed->Dslash(out_compressed, *cudaSpinor, parity);
+    delete dirac_compressed;
+
+    double norm = blas::norm2(*cudaSpinorOut);
+    double deviation = sqrt(blas::xmyNorm(*cudaSpinorOut, out_compressed) / norm);
+    printfQuda("Compressed halo (precision %d): L2 relative deviation = %e\n", halo_prec_sloppy, deviation);
+    return deviation;
+  }
 };
@@ -3,6 +3,7 @@
 #include <math.h>
 #include <string.h>
 #include <algorithm>
+#include <complex>
 
 #include <timer.h>
 #include <host_utils.h>
@@ -159,6 +160,53 @@ int main(int argc, char **argv)
   eigensolveQuda(host_evecs, host_evals, &eig_param);
   host_timer.stop();
   printfQuda("Time for %s solution = %f\n", eig_param.arpack_check ? "ARPACK" : "QUDA", host_timer.last());
+  if (!eig_param.arpack_check && eig_param.n_restarts > 0)
+    printfQuda("Time for %s rotation = %f (%e per restart)\n",
+               eig_param.use_gemm_rotate == QUDA_BOOLEAN_TRUE ? "GEMM" : "batched", eig_param.rotate_secs,
+               eig_param.rotate_secs / eig_param.n_restarts);
+
+  // Optionally repeat the solve with the other rotation path and compare
+  bool rotate_match = true;
+  if (eig_compare_rotate && !eig_param.arpack_check) {
+    void **ref_evecs = (void **)safe_malloc(eig_n_conv * sizeof(void *));
+    for (int i = 0; i < eig_n_conv; i++) {
+      ref_evecs[i] = (void *)safe_malloc(V * eig_inv_param.Ls * spinor_site_size * eig_inv_param.cpu_prec);
+    }
+    double _Complex *ref_evals = (double _Complex *)safe_malloc(eig_param.n_ev * sizeof(double _Complex));
+
+    // the first solve with each path autotunes its kernels, so the
+    // timings are taken from a second solve with each path
+    const bool use_gemm = eig_param.use_gemm_rotate == QUDA_BOOLEAN_TRUE;
+    const QudaBoolean path[2] = {use_gemm ? QUDA_BOOLEAN_FALSE : QUDA_BOOLEAN_TRUE, eig_param.use_gemm_rotate};
+    double secs[2];
+    for (int p = 0; p < 2; p++) {
+      eig_param.use_gemm_rotate = path[p];
+      if (p == 0) eigensolveQuda(ref_evecs, ref_evals, &eig_param); // tunes the other path
+      eigensolveQuda(p == 0 ? ref_evecs : host_evecs, p == 0 ? ref_evals : host_evals, &eig_param);
+      secs[p] = eig_param.rotate_secs;
+    }
+
+    const double gemm_secs = use_gemm ? secs[1] : secs[0];
+    const double batched_secs = use_gemm ? secs[0] : secs[1];
+    printfQuda("Rotation time: GEMM = %f, batched = %f, speedup = %f\n", gemm_secs, batched_secs,
+               gemm_secs > 0.0 ? batched_secs / gemm_secs : 0.0);
+
+    // both paths converge to the same eigenpairs within the solver tolerance
+    auto evals = reinterpret_cast<std::complex<double> *>(host_evals);
+    auto ref = reinterpret_cast<std::complex<double> *>(ref_evals);
+    double max_dev = 0.0;
+    for (int i = 0; i < eig_n_conv; i++) {
+      double dev = std::abs(evals[i] - ref[i]) / std::max(std::abs(evals[i]), 1e-30);
+      max_dev = std::max(max_dev, dev);
+    }
+    rotate_match = max_dev < 10 * eig_tol;
+    printfQuda("Maximum relative eigenvalue deviation between rotation paths = %e (%s)\n", max_dev,
+               rotate_match ? "PASSED" : "FAILED");
+
+    for (int i = 0; i < eig_n_conv; i++) host_free(ref_evecs[i]);
+    host_free(ref_evecs);
+    host_free(ref_evals);
+  }
   // QUDA eigensolver test COMPLETE
   //----------------------------------------------------------------------------
 
@@ -180,5 +228,5 @@ int main(int argc, char **argv)
   endQuda();
   finalizeComms();
 
-  return 0;
+  return rotate_match ? 0 : 1;
 }
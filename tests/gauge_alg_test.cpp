@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <memory>
 #include <stdlib.h>
 #include <string.h>
 
@@ -267,21 +268,17 @@ protected:
   virtual void run_fft()
   {
     if (execute) {
-      if (!comm_partitioned()) {
-        printfQuda("Landau gauge fixing with steepest descent method with FFTs\n");
-        gaugeFixingFFT(*U, gf_gauge_dir, gf_maxiter, gf_verbosity_interval, gf_fft_alpha, gf_fft_autotune, gf_tolerance,
-                       gf_theta_condition);
-
-        auto plaq_gf = plaquette(*U);
-        printfQuda("Plaq:    %.16e, %.16e, %.16e\n", plaq.x, plaq.y, plaq.z);
-        printfQuda("Plaq GF: %.16e, %.16e, %.16e\n", plaq_gf.x, plaq_gf.y, plaq_gf.z);
-        ASSERT_TRUE(comparePlaquette(plaq, plaq_gf));
-        saveTuneCache();
-        // Save if output string is specified
-        if (gauge_store) save_gauge();
-      } else {
-        errorQuda("Cannot perform FFT gauge fixing with MPI partitions.");
-      }
+      printfQuda("Landau gauge fixing with steepest descent method with FFTs\n");
+      gaugeFixingFFT(*U, gf_gauge_dir, gf_maxiter, gf_verbosity_interval, gf_fft_alpha, gf_fft_autotune, gf_tolerance,
+                     gf_theta_condition);
+
+      auto plaq_gf = plaquette(*U);
+      printfQuda("Plaq:    %.16e, %.16e, %.16e\n", plaq.x, plaq.y, plaq.z);
+      printfQuda("Plaq GF: %.16e, %.16e, %.16e\n", plaq_gf.x, plaq_gf.y, plaq_gf.z);
+      ASSERT_TRUE(comparePlaquette(plaq, plaq_gf));
+      saveTuneCache();
+      // Save if output string is specified
+      if (gauge_store) save_gauge();
     }
   }
 
@@ -355,32 +352,52 @@ TEST_F(GaugeAlgTest, Coulomb_Overrelaxation)
 TEST_F(GaugeAlgTest, Landau_FFT)
 {
   if (execute) {
-    if (!comm_partitioned()) {
-      printfQuda("Landau gauge fixing with steepest descent method with FFTs\n");
-      gaugeFixingFFT(*U, 4, gf_maxiter, gf_verbosity_interval, gf_fft_alpha, gf_fft_autotune, gf_tolerance,
-                     gf_theta_condition);
-      auto plaq_gf = plaquette(*U);
-      printfQuda("Plaq:    %.16e, %.16e, %.16e\n", plaq.x, plaq.y, plaq.z);
-      printfQuda("Plaq GF: %.16e, %.16e, %.16e\n", plaq_gf.x, plaq_gf.y, plaq_gf.z);
-      ASSERT_TRUE(comparePlaquette(plaq, plaq_gf));
-      saveTuneCache();
-    }
+    printfQuda("Landau gauge fixing with steepest descent method with FFTs\n");
+    gaugeFixingFFT(*U, 4, gf_maxiter, gf_verbosity_interval, gf_fft_alpha, gf_fft_autotune, gf_tolerance,
+                   gf_theta_condition);
+    auto plaq_gf = plaquette(*U);
+    printfQuda("Plaq:    %.16e, %.16e, %.16e\n", plaq.x, plaq.y, plaq.z);
+    printfQuda("Plaq GF: %.16e, %.16e, %.16e\n", plaq_gf.x, plaq_gf.y, plaq_gf.z);
+    ASSERT_TRUE(comparePlaquette(plaq, plaq_gf));
+    saveTuneCache();
   }
 }
 
 TEST_F(GaugeAlgTest, Coulomb_FFT)
 {
   if (execute) {
-    if (!comm_partitioned()) {
-      printfQuda("Coulomb gauge fixing with steepest descent method with FFTs\n");
-      gaugeFixingFFT(*U, 4, gf_maxiter, gf_verbosity_interval, gf_fft_alpha, gf_fft_autotune, gf_tolerance,
-                     gf_theta_condition);
-      auto plaq_gf = plaquette(*U);
-      printfQuda("Plaq:    %.16e, %.16e, %.16e\n", plaq.x, plaq.y, plaq.z);
-      printfQuda("Plaq GF: %.16e, %.16e, %.16e\n", plaq_gf.x, plaq_gf.y, plaq_gf.z);
-      ASSERT_TRUE(comparePlaquette(plaq, plaq_gf));
-      saveTuneCache();
-    }
+    printfQuda("Coulomb gauge fixing with steepest descent method with FFTs\n");
+    gaugeFixingFFT(*U, 4, gf_maxiter, gf_verbosity_interval, gf_fft_alpha, gf_fft_autotune, gf_tolerance,
+                   gf_theta_condition);
+    auto plaq_gf = plaquette(*U);
+    printfQuda("Plaq:    %.16e, %.16e, %.16e\n", plaq.x, plaq.y, plaq.z);
+    printfQuda("Plaq GF: %.16e, %.16e, %.16e\n", plaq_gf.x, plaq_gf.y, plaq_gf.z);
+    ASSERT_TRUE(comparePlaquette(plaq, plaq_gf));
+    saveTuneCache();
+  }
+}
+
+TEST_F(GaugeAlgTest, Landau_FFT_Host)
+{
+  if (execute) {
+    printfQuda("Landau gauge fixing with steepest descent method with FFTs on the host\n");
+    GaugeFieldParam host_param(*U);
+    host_param.location = QUDA_CPU_FIELD_LOCATION;
+    host_param.create = QUDA_NULL_FIELD_CREATE;
+    host_param.reconstruct = QUDA_RECONSTRUCT_NO;
+    host_param.pad = 0;
+    host_param.setPrecision(U->Precision(), true);
+    std::unique_ptr<GaugeField> host(GaugeField::Create(host_param));
+    host->copy(*U);
+
+    gaugeFixingFFT(*host, 4, gf_maxiter, gf_verbosity_interval, gf_fft_alpha, gf_fft_autotune, gf_tolerance,
+                   gf_theta_condition);
+    U->copy(*host);
+    auto plaq_gf = plaquette(*U);
+    printfQuda("Plaq:    %.16e, %.16e, %.16e\n", plaq.x, plaq.y, plaq.z);
+    printfQuda("Plaq GF: %.16e, %.16e, %.16e\n", plaq_gf.x, plaq_gf.y, plaq_gf.z);
+    ASSERT_TRUE(comparePlaquette(plaq, plaq_gf));
+    saveTuneCache();
   }
 }
 
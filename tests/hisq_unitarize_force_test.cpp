@@ -9,6 +9,7 @@
 #include "misc.h"
 #include "hisq_force_reference.h"
 #include "ks_improved_force.h"
+#include <timer.h>
 #include <sys/time.h>
 #include <gtest/gtest.h>
 
@@ -127,11 +128,24 @@ TEST(hisq_force_unitarize, verify)
   printfQuda("Calling unitarizeForce\n");
   fermion_force::unitarizeForce(*cudaResult, *cudaOprod, *cudaFatLink, num_failures_dev);
 
+  // time a second, tuned, call for the comparison with the host implementation
+  host_timer_t device_timer;
+  qudaDeviceSynchronize();
+  device_timer.start();
+  fermion_force::unitarizeForce(*cudaResult, *cudaOprod, *cudaFatLink, num_failures_dev);
+  qudaDeviceSynchronize();
+  device_timer.stop();
+
   device_free(num_failures_dev);
 
   if (verify_results) {
     printfQuda("Calling unitarizeForceCPU\n");
+    host_timer_t host_timer;
+    host_timer.start();
     fermion_force::unitarizeForceCPU(*cpuResult, *cpuOprod, *cpuFatLink);
+    host_timer.stop();
+    printfQuda("unitarizeForce time: device %g ms, host %g ms (%g x)\n", device_timer.last() * 1000,
+               host_timer.last() * 1000, host_timer.last() / device_timer.last());
   }
 
   cudaResult->saveCPUField(*cpuReference);
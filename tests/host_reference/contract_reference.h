@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <vector>
 #include <host_utils.h>
 #include <quda_internal.h>
 #include "color_spinor_field.h"
@@ -231,3 +233,180 @@ int contraction_reference(Float *spinorX, Float *spinorY, Float *d_result, QudaC
   host_free(h_result);
   return faults;
 };
+
+template <typename Float>
+int contraction_ft_reference(Float *spinorX, Float *spinorY, double *d_result, QudaContractType cType,
+                             const int *source_position, const int *mom, int n_mom)
+{
+  int faults = 0;
+  double tol = (sizeof(Float) == sizeof(double) ? 1e-10 : 1e-5);
+  void *h_result = safe_malloc(V * 2 * 16 * sizeof(Float));
+
+  // compute the site contractions
+  contractColor(spinorX, spinorY, (Float *)h_result);
+  if (cType == QUDA_CONTRACT_TYPE_DR) contractDegrandRossi((Float *)h_result);
+
+  // project onto the momenta and sum over timeslices
+  int L[4];
+  for (int d = 0; d < 4; d++) L[d] = Z[d] * comm_dim(d);
+  std::vector<complex<double>> h_ft(n_mom * 16 * L[3], 0.0);
+  for (int i = 0; i < V; i++) {
+    int Y = fullLatticeIndex(i % Vh, i / Vh);
+    int x[4] = {Y % Z[0], (Y / Z[0]) % Z[1], (Y / (Z[1] * Z[0])) % Z[2], Y / (Z[2] * Z[1] * Z[0])};
+    for (int d = 0; d < 4; d++) x[d] += comm_coord(d) * Z[d];
+
+    for (int m = 0; m < n_mom; m++) {
+      double theta = 0.0;
+      for (int d = 0; d < 3; d++) theta += 2.0 * M_PI * mom[3 * m + d] * (x[d] - source_position[d]) / L[d];
+      complex<double> phase(cos(theta), -sin(theta));
+      for (int g = 0; g < 16; g++) {
+        complex<double> c(((Float *)h_result)[32 * i + 2 * g], ((Float *)h_result)[32 * i + 2 * g + 1]);
+        h_ft[(m * 16 + g) * L[3] + x[3]] += phase * c;
+      }
+    }
+  }
+  comm_allreduce_array(reinterpret_cast<double *>(h_ft.data()), 2 * h_ft.size());
+
+  // compare relative to the largest correlator
+  double norm = 0.0;
+  for (auto &c : h_ft) norm = std::max(norm, abs(c));
+  for (size_t i = 0; i < h_ft.size(); i++) {
+    complex<double> d(d_result[2 * i], d_result[2 * i + 1]);
+    if (abs(d - h_ft[i]) > tol * (1.0 + norm)) faults++;
+  }
+
+  host_free(h_result);
+  return faults;
+}
+
+// Degrand-Rossi gamma structures in the ordering of QUDA_CONTRACT_TYPE_DR:
+// row mu of gamma g has a single entry dr_phase[g][mu] in column dr_col[g][mu]
+static const int dr_col[16][4] = {{0, 1, 2, 3}, {3, 2, 1, 0}, {3, 2, 1, 0}, {2, 3, 0, 1}, {2, 3, 0, 1}, {0, 1, 2, 3},
+                                  {3, 2, 1, 0}, {3, 2, 1, 0}, {2, 3, 0, 1}, {2, 3, 0, 1}, {0, 1, 2, 3}, {2, 3, 0, 1},
+                                  {1, 0, 3, 2}, {1, 0, 3, 2}, {1, 0, 3, 2}, {0, 1, 2, 3}};
+static const complex<double> dr_phase[16][4]
+  = {{1, 1, 1, 1},
+     {{0, 1}, {0, 1}, {0, -1}, {0, -1}},
+     {-1, 1, 1, -1},
+     {{0, 1}, {0, -1}, {0, -1}, {0, 1}},
+     {1, 1, 1, 1},
+     {1, 1, -1, -1},
+     {{0, 1}, {0, 1}, {0, 1}, {0, 1}},
+     {-1, 1, -1, 1},
+     {{0, 1}, {0, -1}, {0, 1}, {0, -1}},
+     {1, 1, -1, -1},
+     {1, -1, 1, -1},
+     {{0, -1}, {0, -1}, {0, 1}, {0, 1}},
+     {-1, -1, 1, 1},
+     {1, 1, 1, 1},
+     {{0, -1}, {0, 1}, {0, 1}, {0, -1}},
+     {-1, -1, 1, 1}};
+
+using spin_matrix = std::array<std::array<complex<double>, 4>, 4>;
+
+inline spin_matrix dr_gamma(int g)
+{
+  spin_matrix G {};
+  for (int mu = 0; mu < 4; mu++) G[mu][dr_col[g][mu]] = dr_phase[g][mu];
+  return G;
+}
+
+inline spin_matrix operator*(const spin_matrix &A, const spin_matrix &B)
+{
+  spin_matrix C {};
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 4; j++)
+      for (int k = 0; k < 4; k++) C[i][j] += A[i][k] * B[k][j];
+  return C;
+}
+
+inline complex<double> trace(const spin_matrix &A) { return A[0][0] + A[1][1] + A[2][2] + A[3][3]; }
+
+// element (spin mu, color c) of the propagator column (source spin nu, color d) at host site i
+template <typename Float>
+inline complex<double> prop_elem(void **prop, int i, int mu, int c, int nu, int d)
+{
+  const Float *v = static_cast<const Float *>(prop[3 * nu + d]);
+  return complex<double>(v[24 * i + 6 * mu + 2 * c], v[24 * i + 6 * mu + 2 * c + 1]);
+}
+
+// host site i to global coordinates
+inline void global_coords(int i, int x[4])
+{
+  int Y = fullLatticeIndex(i % Vh, i / Vh);
+  x[0] = Y % Z[0];
+  x[1] = (Y / Z[0]) % Z[1];
+  x[2] = (Y / (Z[1] * Z[0])) % Z[2];
+  x[3] = Y / (Z[2] * Z[1] * Z[0]);
+  for (int d = 0; d < 4; d++) x[d] += comm_coord(d) * Z[d];
+}
+
+// C(t) = sum_x Tr[G_snk S_1(x) G_src g5 S_2(x)^dag g5], computed with dense spin-color matrices
+template <typename Float>
+void meson_reference(void **S1, void **S2, const int *gamma, int n_gamma, std::vector<complex<double>> &result)
+{
+  const int T = Z[3] * comm_dim(3);
+  result.assign(n_gamma * T, 0.0);
+  const double g5[4] = {1, 1, -1, -1};
+
+  for (int i = 0; i < V; i++) {
+    int x[4];
+    global_coords(i, x);
+    for (int k = 0; k < n_gamma; k++) {
+      spin_matrix Gsnk = dr_gamma(gamma[2 * k + 0]);
+      spin_matrix Gsrc = dr_gamma(gamma[2 * k + 1]);
+      complex<double> sum = 0.0;
+      for (int a = 0; a < 4; a++)         // sink spin, trace index
+        for (int b = 0; b < 4; b++)       // sink spin of S_1
+          for (int e = 0; e < 4; e++)     // source spin of S_1
+            for (int f = 0; f < 4; f++) { // source spin of S_2
+              complex<double> g = Gsnk[a][b] * Gsrc[e][f] * g5[f] * g5[a];
+              if (g == 0.0) continue;
+              for (int c = 0; c < 3; c++)
+                for (int d = 0; d < 3; d++)
+                  sum += g * prop_elem<Float>(S1, i, b, c, e, d) * conj(prop_elem<Float>(S2, i, a, c, f, d));
+            }
+      result[k * T + x[3]] += sum;
+    }
+  }
+  comm_allreduce_array(reinterpret_cast<double *>(result.data()), 2 * result.size());
+}
+
+// C(t) = sum_x eps_abc eps_a'b'c' { Tr[P S_1^{aa'}] Tr[S_1^{bb'} Q^{cc'}] + Tr[P S_1^{aa'} Q^{cc'} S_1^{bb'}] }
+// with Q^{cc'} = (C g5 S_2^{cc'} C g5)^T, P = (1 + g4) / 2 and C = g2 g4
+template <typename Float> void baryon_reference(void **S1, void **S2, std::vector<complex<double>> &result)
+{
+  const int T = Z[3] * comm_dim(3);
+  result.assign(T, 0.0);
+  const int eps[6][4] = {{0, 1, 2, 1}, {1, 2, 0, 1}, {2, 0, 1, 1}, {0, 2, 1, -1}, {2, 1, 0, -1}, {1, 0, 2, -1}};
+
+  spin_matrix Cg5 = dr_gamma(2) * dr_gamma(4) * dr_gamma(5);
+  spin_matrix P = dr_gamma(4);
+  for (int mu = 0; mu < 4; mu++) P[mu][mu] += 1.0;
+  for (auto &row : P)
+    for (auto &p : row) p *= 0.5;
+
+  for (int i = 0; i < V; i++) {
+    int x[4];
+    global_coords(i, x);
+    complex<double> sum = 0.0;
+    for (auto &e : eps) {
+      for (auto &e_ : eps) {
+        spin_matrix A, B, D;
+        for (int mu = 0; mu < 4; mu++) {
+          for (int nu = 0; nu < 4; nu++) {
+            A[mu][nu] = prop_elem<Float>(S1, i, mu, e[0], nu, e_[0]);
+            B[mu][nu] = prop_elem<Float>(S1, i, mu, e[1], nu, e_[1]);
+            D[mu][nu] = prop_elem<Float>(S2, i, mu, e[2], nu, e_[2]);
+          }
+        }
+        spin_matrix GDG = Cg5 * D * Cg5, Q;
+        for (int mu = 0; mu < 4; mu++)
+          for (int nu = 0; nu < 4; nu++) Q[mu][nu] = GDG[nu][mu];
+        sum += static_cast<double>(e[3] * e_[3]) * (trace(P * A) * trace(B * Q) + trace(P * A * Q * B));
+      }
+    }
+    result[x[3]] += sum;
+  }
+  comm_allreduce_array(reinterpret_cast<double *>(result.data()), 2 * result.size());
+}
@@ -242,6 +242,14 @@ int main(int argc, char **argv)
     }
     // Load the clover terms to the device
     loadCloverQuda(clover, clover_inv, &inv_param);
+    if (clover_on_the_fly) {
+      // reload the clover term to be recomputed in the dslash, keeping the host copy for verification
+      if (!compute_clover) errorQuda("--clover-on-the-fly requires --compute-clover");
+      inv_param.clover_on_the_fly = QUDA_BOOLEAN_TRUE;
+      inv_param.return_clover = 0;
+      inv_param.return_clover_inverse = 0;
+      loadCloverQuda(nullptr, nullptr, &inv_param);
+    }
     if (inv_multigrid) {
       // Restore actual solve_type we want to do
       inv_param.solve_type = solve_type;
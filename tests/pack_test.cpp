@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <iostream>
 
 #include <gauge_field.h>
@@ -10,6 +11,8 @@
 #include <color_spinor_field.h>
 #include <blas_quda.h>
 #include <timer.h>
+#include <malloc_quda.h>
+#include <field_residency.h>
 
 using namespace quda;
 
@@ -168,6 +171,92 @@ void packTest()
   ColorSpinorField::Compare(*spinor, *spinor2, 1);
 }
 
+/**
+   Check the threaded host reordering engine, used for host to host
+   copies, against the generic reordering done on the device: the
+   native-order host field must match the device field bit for bit,
+   and reordering back must match the field restored from the device.
+   Must be called after packTest.
+ */
+bool reorderTest()
+{
+  if (prec != QUDA_DOUBLE_PRECISION && prec != QUDA_SINGLE_PRECISION) {
+    printfQuda("Host reorder test skipped for precision %d\n", prec);
+    return true;
+  }
+
+  ColorSpinorParam nativeParam(*cudaSpinor);
+  nativeParam.location = QUDA_CPU_FIELD_LOCATION;
+  nativeParam.create = QUDA_NULL_FIELD_CREATE;
+  ColorSpinorField hostNative(nativeParam);
+  ColorSpinorField deviceNative(nativeParam);
+
+  ColorSpinorParam hostParam(*spinor);
+  hostParam.create = QUDA_NULL_FIELD_CREATE;
+  ColorSpinorField spinor3(hostParam);
+
+  host_timer_t host_timer;
+  host_timer.start();
+  hostNative = *spinor;
+  host_timer.stop();
+  printfQuda("Host reorder to native time = %e seconds\n", host_timer.last());
+
+  qudaMemcpy(deviceNative.V(), cudaSpinor->V(), cudaSpinor->Bytes(), qudaMemcpyDeviceToHost);
+  bool native_match = memcmp(hostNative.V(), deviceNative.V(), hostNative.Length() * hostNative.Precision()) == 0;
+  printfQuda("Host reorder vs device reorder: %s\n", native_match ? "PASSED" : "FAILED");
+
+  host_timer.start();
+  spinor3 = hostNative;
+  host_timer.stop();
+  printfQuda("Host reorder from native time = %e seconds\n", host_timer.last());
+
+  bool round_trip = memcmp(spinor3.V(), spinor2->V(), spinor2->Length() * spinor2->Precision()) == 0;
+  printfQuda("Host reorder round trip vs device round trip: %s\n", round_trip ? "PASSED" : "FAILED");
+
+  return native_match && round_trip;
+}
+
+/**
+   Check the device-memory residency manager: register a copy of the
+   device spinor, oversubscribe a memory budget so that it is
+   spilled to the host, then acquire it so that it is refilled, and
+   check that its contents survived the round trip bit for bit.
+   Must be called after packTest.
+ */
+bool residencyTest()
+{
+  ColorSpinorParam residentParam(*cudaSpinor);
+  residentParam.create = QUDA_NULL_FIELD_CREATE;
+  ColorSpinorField resident(residentParam);
+  resident = *cudaSpinor;
+  residency::add(resident);
+
+  // leave room for less than one more field, so the next allocation must spill the resident one
+  pool::flush_device();
+  const auto spills = residency::get_stats().spills;
+  residency::set_budget(device_allocated() + resident.Bytes() / 2);
+  bool spilled;
+  {
+    ColorSpinorField oversubscribe(residentParam);
+    spilled = resident.Spilled() && residency::get_stats().spills > spills;
+  }
+  residency::set_budget(0);
+  printfQuda("Residency spill under oversubscription: %s\n", spilled ? "PASSED" : "FAILED");
+
+  residency::acquire(resident);
+  bool refilled = !resident.Spilled();
+  ColorSpinorField diff(residentParam);
+  diff = resident;
+  double deviation = blas::xmyNorm(*cudaSpinor, diff);
+  residency::release(resident);
+  residency::remove(resident);
+
+  bool match = refilled && deviation == 0.0;
+  printfQuda("Residency refill contents: deviation = %e: %s\n", deviation, match ? "PASSED" : "FAILED");
+
+  return spilled && match;
+}
+
 int main(int argc, char **argv) {
   // command line options
   auto app = make_app();
@@ -181,8 +270,12 @@ int main(int argc, char **argv) {
 
   init();
   packTest();
+  bool pass = reorderTest();
+  pass = residencyTest() && pass;
   end();
 
   finalizeComms();
+
+  return pass ? 0 : 1;
 }
 
@@ -3,6 +3,8 @@
 #include <time.h>
 #include <math.h>
 #include <string.h>
+#include <vector>
+#include <algorithm>
 
 #include <util_quda.h>
 #include <host_utils.h>
@@ -24,7 +26,18 @@ int smear_steps = 50;
 double wflow_epsilon = 0.01;
 int wflow_steps = 100;
 QudaWFlowType wflow_type = QUDA_WFLOW_TYPE_WILSON;
+double wflow_tol = 0.0;
 int measurement_interval = 5;
+int wloop_r_max = 0;
+int wloop_t_max = 0;
+double hmc_beta = 6.0;
+double hmc_c1 = 0.0;
+double hmc_tau = 1.0;
+int hmc_steps = 10;
+int hmc_trajectories = 5;
+double hmc_tol = 0.2;
+QudaHMCIntegratorType hmc_integrator = QUDA_HMC_OMELYAN;
+std::string hmc_telemetry_file;
 
 void display_test_info()
 {
@@ -59,8 +72,18 @@ void display_test_info()
     printfQuda(" - epsilon %f\n", wflow_epsilon);
     printfQuda(" - Wilson flow steps %d\n", wflow_steps);
     printfQuda(" - Wilson flow type %s\n", wflow_type == QUDA_WFLOW_TYPE_WILSON ? "Wilson" : "Symanzik");
+    if (wflow_tol > 0.0) printfQuda(" - Adaptive step size with tolerance %e\n", wflow_tol);
     printfQuda(" - Measurement interval %d\n", measurement_interval);
     break;
+  case 4:
+    printfQuda("\nHMC\n");
+    printfQuda(" - beta %f\n", hmc_beta);
+    printfQuda(" - c1 %f\n", hmc_c1);
+    printfQuda(" - trajectory length %f\n", hmc_tau);
+    printfQuda(" - steps per trajectory %d\n", hmc_steps);
+    printfQuda(" - trajectories %d\n", hmc_trajectories);
+    printfQuda(" - <exp(-dH)> tolerance %e\n", hmc_tol);
+    break;
   default: errorQuda("Undefined test type %d given", test_type);
   }
 
@@ -96,8 +119,43 @@ void add_su3_option_group(std::shared_ptr<QUDAApp> quda_app)
     ->transform(CLI::QUDACheckedTransformer(wflow_type_map));
   ;
 
+  opgroup->add_option("--su3-wflow-tol", wflow_tol,
+                      "Local error tolerance for adaptive step-size Wilson flow, flowing to the same flow times as "
+                      "the fixed-step flow and failing if the two disagree beyond the accumulated tolerance "
+                      "(default 0, fixed step size)");
+
   opgroup->add_option("--su3-measurement-interval", measurement_interval,
                       "Measure the field energy and topological charge every Nth step (default 5) ");
+
+  opgroup->add_option("--su3-wloop-r-max", wloop_r_max,
+                      "Maximum spatial extent of the Wilson loops measured on the initial field (default 0, none)");
+
+  opgroup->add_option("--su3-wloop-t-max", wloop_t_max,
+                      "Maximum temporal extent of the Wilson loops measured on the initial field (default 0, none)");
+
+  CLI::TransformPairs<QudaHMCIntegratorType> hmc_integrator_map {{"leapfrog", QUDA_HMC_LEAPFROG},
+                                                                 {"omelyan", QUDA_HMC_OMELYAN},
+                                                                 {"force-gradient", QUDA_HMC_FORCE_GRADIENT}};
+
+  opgroup->add_option("--su3-hmc-beta", hmc_beta, "Gauge coupling of the HMC test (default 6.0)");
+
+  opgroup->add_option("--su3-hmc-c1", hmc_c1,
+                      "Rectangle coefficient of the HMC gauge action (default 0, Wilson; -1/12 for Symanzik)");
+
+  opgroup->add_option("--su3-hmc-tau", hmc_tau, "Trajectory length of the HMC test (default 1.0)");
+
+  opgroup->add_option("--su3-hmc-steps", hmc_steps, "Integration steps per HMC trajectory (default 10)");
+
+  opgroup->add_option("--su3-hmc-trajectories", hmc_trajectories, "Number of HMC trajectories (default 5)");
+
+  opgroup->add_option("--su3-hmc-tol", hmc_tol,
+                      "Maximum deviation of <exp(-dH)> from one in the HMC test (default 0.2)");
+
+  opgroup->add_option("--su3-hmc-integrator", hmc_integrator, "HMC integration scheme (default omelyan)")
+    ->transform(CLI::QUDACheckedTransformer(hmc_integrator_map));
+
+  opgroup->add_option("--su3-hmc-telemetry", hmc_telemetry_file,
+                      "Append per-force and per-step HMC telemetry to <file> (default none)");
 }
 
 int main(int argc, char **argv)
@@ -105,7 +163,7 @@ int main(int argc, char **argv)
 
   auto app = make_app();
   add_su3_option_group(app);
-  CLI::TransformPairs<int> test_type_map {{"APE", 0}, {"Stout", 1}, {"Over-Improved Stout", 2}, {"Wilson Flow", 3}};
+  CLI::TransformPairs<int> test_type_map {{"APE", 0}, {"Stout", 1}, {"Over-Improved Stout", 2}, {"Wilson Flow", 3}, {"HMC", 4}};
   app->add_option("--test", test_type, "Test method")->transform(CLI::CheckedTransformer(test_type_map));
 
   try {
@@ -149,6 +207,9 @@ int main(int argc, char **argv)
   printfQuda("Computed plaquette gauge precise is %.16e (spatial = %.16e, temporal = %.16e)\n", plaq[0], plaq[1],
              plaq[2]);
 
+  // Whether all the checks performed have passed
+  bool pass = true;
+
 #ifdef GPU_GAUGE_TOOLS
 
   // All user inputs now defined
@@ -163,9 +224,11 @@ int main(int argc, char **argv)
   // start the timer
   double time0 = -((double)clock());
   QudaGaugeObservableParam param = newQudaGaugeObservableParam();
+  param.compute_plaquette = QUDA_BOOLEAN_TRUE;
   param.compute_qcharge = QUDA_BOOLEAN_TRUE;
   param.compute_qcharge_density = QUDA_BOOLEAN_TRUE;
   param.qcharge_density = qDensity;
+  param.compute_rectangle = QUDA_BOOLEAN_TRUE;
 
   gaugeObservablesQuda(&param);
 
@@ -174,6 +237,8 @@ int main(int argc, char **argv)
   time0 /= CLOCKS_PER_SEC;
   printfQuda("Computed Etot, Es, Et, Q is\n%.16e %.16e, %.16e %.16e\nDone in %g secs\n", param.energy[0],
              param.energy[1], param.energy[2], param.qcharge, time0);
+  printfQuda("Computed plaquette %.16e (%.16e, %.16e), rectangle %.16e (%.16e, %.16e)\n", param.plaquette[0],
+             param.plaquette[1], param.plaquette[2], param.rectangle[0], param.rectangle[1], param.rectangle[2]);
 
   // Ensure host array sums to return value
   if (prec == QUDA_DOUBLE_PRECISION) {
@@ -191,6 +256,28 @@ int main(int argc, char **argv)
   printfQuda("GPU value %e and host density sum %e. Q charge deviation: %e\n", param.qcharge, q_charge_check,
              param.qcharge - q_charge_check);
 
+  // Polyakov loop, and Wilson loops if requested, where the 1x1 loop must match the temporal plaquette
+  QudaGaugeLoopParam loop_param = newQudaGaugeLoopParam();
+  loop_param.compute_polyakov_loop = QUDA_BOOLEAN_TRUE;
+  std::vector<double> wloop(wloop_r_max * wloop_t_max);
+  loop_param.r_max = wloop_r_max;
+  loop_param.t_max = wloop_t_max;
+  loop_param.wilson_loop = wloop.data();
+  computeGaugeLoopsQuda(&loop_param);
+
+  printfQuda("Computed Polyakov loop (%.16e, %.16e)\n", loop_param.polyakov_loop[0], loop_param.polyakov_loop[1]);
+  for (int r = 0; r < wloop_r_max; r++) {
+    for (int t = 0; t < wloop_t_max; t++) printfQuda("W(%d, %d) = %.16e\n", r + 1, t + 1, wloop[r * wloop_t_max + t]);
+  }
+  if (wloop.size() > 0) {
+    double wloop_dev = fabs(wloop[0] - param.plaquette[2]);
+    double wloop_tol = prec == QUDA_DOUBLE_PRECISION ? 1e-12 : 1e-5;
+    bool wloop_pass = wloop_dev <= wloop_tol;
+    printfQuda("W(1, 1) deviation from the temporal plaquette: %e, tolerance %e: %s\n", wloop_dev, wloop_tol,
+               wloop_pass ? "PASSED" : "FAILED");
+    pass = pass && wloop_pass;
+  }
+
   // Gauge Smearing Routines
   //---------------------------------------------------------------------------
   // Stout smearing should be equivalent to APE smearing
@@ -234,12 +321,106 @@ int main(int argc, char **argv)
     // Wilson Flow
     // Start the timer
     time0 = -((double)clock());
-    performWFlownStep(wflow_steps, wflow_epsilon, measurement_interval, wflow_type);
+    if (wflow_tol > 0.0) {
+      // measure at the same flow times as the fixed-step flow
+      int n_meas = wflow_steps / measurement_interval;
+      std::vector<double> meas_time(n_meas);
+      std::vector<QudaGaugeObservableParam> obs_param(n_meas, newQudaGaugeObservableParam());
+      std::vector<QudaGaugeObservableParam> obs_fixed(n_meas, newQudaGaugeObservableParam());
+      for (int i = 0; i < n_meas; i++) {
+        meas_time[i] = (i + 1) * measurement_interval * wflow_epsilon;
+        obs_param[i].compute_plaquette = obs_fixed[i].compute_plaquette = QUDA_BOOLEAN_TRUE;
+        obs_param[i].compute_qcharge = obs_fixed[i].compute_qcharge = QUDA_BOOLEAN_TRUE;
+      }
+
+      QudaGaugeFlowParam flow_param = newQudaGaugeFlowParam();
+      flow_param.wflow_type = wflow_type;
+      flow_param.step_size = wflow_epsilon;
+      flow_param.adaptive = QUDA_BOOLEAN_FALSE;
+      flow_param.n_meas = n_meas;
+      flow_param.meas_time = meas_time.data();
+      flow_param.obs_param = obs_fixed.data();
+      performWFlowQuda(&flow_param);
+      const int n_steps_fixed = flow_param.n_steps;
+
+      // both flows start from the resident field
+      flow_param.adaptive = QUDA_BOOLEAN_TRUE;
+      flow_param.tol = wflow_tol;
+      flow_param.obs_param = obs_param.data();
+      performWFlowQuda(&flow_param);
+
+      // each flow accumulates at most its per-step error bound over its steps
+      const double flow_check_tol = wflow_tol * std::max(flow_param.n_steps, n_steps_fixed);
+      double max_dev = 0.0;
+      printfQuda("flow t, plaquette, E_tot, E_spatial, E_temporal, Q charge, E_tot deviation from fixed step\n");
+      for (int i = 0; i < n_meas; i++) {
+        double plaq_dev = fabs(obs_param[i].plaquette[0] - obs_fixed[i].plaquette[0]);
+        double energy_dev
+          = fabs(obs_param[i].energy[0] - obs_fixed[i].energy[0]) / std::max(fabs(obs_fixed[i].energy[0]), 1.0);
+        double dev = std::max(plaq_dev, energy_dev);
+        max_dev = std::max(max_dev, dev);
+        printfQuda("%le %.16e %+.16e %+.16e %+.16e %+.16e %e\n", meas_time[i], obs_param[i].plaquette[0],
+                   obs_param[i].energy[0], obs_param[i].energy[1], obs_param[i].energy[2], obs_param[i].qcharge,
+                   obs_param[i].energy[0] - obs_fixed[i].energy[0]);
+      }
+      bool flow_pass = max_dev <= flow_check_tol;
+      printfQuda("Adaptive flow (%d steps, %d rejected) vs fixed step (%d steps): max deviation %e, tolerance %e: %s\n",
+                 flow_param.n_steps, flow_param.n_rejected, n_steps_fixed, max_dev, flow_check_tol,
+                 flow_pass ? "PASSED" : "FAILED");
+      pass = pass && flow_pass;
+    } else {
+      performWFlownStep(wflow_steps, wflow_epsilon, measurement_interval, wflow_type);
+    }
     // stop the timer
     time0 += clock();
     time0 /= CLOCKS_PER_SEC;
     printfQuda("Total time for Wilson Flow = %g secs\n", time0);
     break;
+  case 4: {
+    // pure-gauge HMC on the resident field: <exp(-dH)> should be close to one
+    QudaHMCTerm term = {};
+    term.type = QUDA_HMC_GAUGE_TERM;
+    term.level = 0;
+    term.name = "gauge";
+    term.beta = hmc_beta;
+    term.c1 = hmc_c1;
+
+    QudaHMCParam hmc_param = newQudaHMCParam();
+    hmc_param.tau = hmc_tau;
+    hmc_param.n_level = 1;
+    hmc_param.integrator[0] = hmc_integrator;
+    hmc_param.n_step[0] = hmc_steps;
+    hmc_param.n_term = 1;
+    hmc_param.term = &term;
+    if (!hmc_telemetry_file.empty()) {
+      hmc_param.telemetry = QUDA_BOOLEAN_TRUE;
+      strncpy(hmc_param.telemetry_file, hmc_telemetry_file.c_str(), sizeof(hmc_param.telemetry_file) - 1);
+    }
+
+    time0 = -((double)clock());
+    double exp_dh = 0.0;
+    for (int i = 0; i < hmc_trajectories; i++) {
+      hmc_param.trajectory = i;
+      hmcTrajectoryQuda(&hmc_param);
+      plaqQuda(plaq);
+      exp_dh += exp(-hmc_param.delta_h);
+      printfQuda("Trajectory %d: dH = %+e, S_gauge = %.10e, plaquette = %.16e, force evaluations = %d\n", i,
+                 hmc_param.delta_h, term.action_final, plaq[0], hmc_param.n_force);
+      if (hmc_param.telemetry)
+        printfQuda("Trajectory %d: gauge force |F| mean = %e max = %e, force time = %g secs\n", i, term.force_mean,
+                   term.force_max, term.force_secs);
+    }
+    time0 += clock();
+    time0 /= CLOCKS_PER_SEC;
+    // with N trajectories the average fluctuates by O(sqrt(<dH^2>/N)), so allow a generous statistical margin
+    exp_dh /= hmc_trajectories;
+    printfQuda("<exp(-dH)> = %e\n", exp_dh);
+    bool hmc_pass = fabs(exp_dh - 1.0) <= hmc_tol;
+    printfQuda("|<exp(-dH)> - 1| = %e, tolerance %e: %s\n", fabs(exp_dh - 1.0), hmc_tol, hmc_pass ? "PASSED" : "FAILED");
+    pass = pass && hmc_pass;
+    printfQuda("Total time for HMC = %g secs\n", time0);
+    break;
+  }
   default: errorQuda("Undefined test type %d given", test_type);
   }
 
@@ -258,5 +439,5 @@ int main(int argc, char **argv)
   endQuda();
 
   finalizeComms();
-  return 0;
+  return pass ? 0 : 1;
 }
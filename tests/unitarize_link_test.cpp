@@ -39,10 +39,18 @@ cudaGaugeField *cudaFatLink, *cudaULink;
 
 const double unittol = (prec == QUDA_DOUBLE_PRECISION) ? 1e-10 : 1e-6;
 
+static double gpu_time; // time of the device unitarization in seconds
+
 TEST(unitarization, verify) {
+  struct timeval t0, t1;
+  gettimeofday(&t0, NULL);
   unitarizeLinksCPU(*cpuULink, *cpuFatLink);
+  gettimeofday(&t1, NULL);
   cudaULink->saveCPUField(*cudaResult);
 
+  printfQuda("Host unitarization time: %g ms (%g x the device time)\n", TDIFF(t0, t1) * 1000,
+             TDIFF(t0, t1) / gpu_time);
+
   int res = compare_floats(cudaResult->Gauge_p(), cpuULink->Gauge_p(), 4 * cudaResult->Volume() * gauge_site_size,
                            unittol, cpu_prec);
 
@@ -169,9 +177,12 @@ static int unitarize_link_test(int &test_rc)
 
   struct timeval t0, t1;
 
+  qudaDeviceSynchronize();
   gettimeofday(&t0,NULL);
   unitarizeLinks(*cudaULink, *cudaFatLink, num_failures_d);
+  qudaDeviceSynchronize();
   gettimeofday(&t1,NULL);
+  gpu_time = TDIFF(t0, t1);
 
   if (verify_results) {
     test_rc = RUN_ALL_TESTS();
@@ -30,6 +30,7 @@ QudaPrecision prec_precondition = QUDA_INVALID_PRECISION;
 QudaPrecision prec_eigensolver = QUDA_INVALID_PRECISION;
 QudaPrecision prec_null = QUDA_INVALID_PRECISION;
 QudaPrecision prec_ritz = QUDA_INVALID_PRECISION;
+QudaPrecision halo_prec_sloppy = QUDA_INVALID_PRECISION;
 QudaVerbosity verbosity = QUDA_SUMMARIZE;
 std::array<int, 4> dim = {24, 24, 24, 24};
 int &xdim = dim[0];
@@ -83,12 +84,16 @@ double clover_csw = 1.0;
 double clover_coeff = 0.0;
 bool compute_clover = false;
 bool compute_clover_trlog = true;
+bool clover_on_the_fly = false;
 bool compute_fatlong = false;
 double tol = 1e-7;
 double tol_precondition = 1e-1;
 double tol_hq = 0.;
 double reliable_delta = 0.1;
 bool alternative_reliable = false;
+char solver_telemetry_file[256] = "";
+bool adaptive_reliable = false;
+bool adaptive_precision = false;
 QudaTwistFlavorType twist_flavor = QUDA_TWIST_SINGLET;
 QudaMassNormalization normalization = QUDA_KAPPA_NORMALIZATION;
 QudaMatPCType matpc_type = QUDA_MATPC_EVEN_EVEN;
@@ -181,6 +186,9 @@ int eig_n_kr = 32;
 int eig_n_conv = -1;        // If unchanged, will be set to n_ev
 int eig_n_ev_deflate = -1;  // If unchanged, will be set to n_conv
 int eig_batched_rotate = 0; // If unchanged, will be set to maximum
+bool eig_use_gemm_rotate = false;
+int eig_gemm_rotate_workspace = 4;
+bool eig_compare_rotate = false;
 bool eig_require_convergence = true;
 int eig_check_interval = 10;
 int eig_max_restarts = 1000;
@@ -394,6 +402,9 @@ std::shared_ptr<QUDAApp> make_app(std::string app_description, std::string app_n
                        "Compute the clover field or use random numbers (default false)");
   quda_app->add_option("--compute-clover-trlog", compute_clover_trlog,
                        "Compute the clover inverse trace log to check for singularity (default false)");
+  quda_app->add_option("--clover-on-the-fly", clover_on_the_fly,
+                       "Recompute the clover term from the gauge field in the dslash instead of storing it, requires "
+                       "--compute-clover (default false)");
   quda_app->add_option("--compute-fat-long", compute_fatlong,
                        "Compute the fat/long field or use random numbers (default false)");
 
@@ -475,6 +486,11 @@ std::shared_ptr<QUDAApp> make_app(std::string app_description, std::string app_n
 
   quda_app->add_option("--prec-sloppy", prec_sloppy, "Sloppy precision in GPU")->transform(prec_transform);
 
+  quda_app
+    ->add_option("--halo-prec-sloppy", halo_prec_sloppy,
+                 "Compress the halo exchange of the sloppy and preconditioner operators below their precision")
+    ->transform(prec_transform);
+
   quda_app->add_option("--prec-null", prec_null, "Precison TODO")->transform(prec_transform);
 
   quda_app->add_option("--precon-type", precon_type, "The type of solver to use (default none (=unspecified)).")
@@ -502,6 +518,12 @@ std::shared_ptr<QUDAApp> make_app(std::string app_description, std::string app_n
     ->transform(CLI::QUDACheckedTransformer(reconstruct_type_map));
 
   quda_app->add_option("--reliable-delta", reliable_delta, "Set reliable update delta factor");
+  quda_app->add_option("--solver-telemetry", solver_telemetry_file,
+                       "Append per-iteration solver telemetry to <file> (default none)");
+  quda_app->add_option("--adaptive-reliable", adaptive_reliable,
+                       "Adapt the reliable update delta from the observed residual gap (default false)");
+  quda_app->add_option("--adaptive-precision", adaptive_precision,
+                       "Adapt the sloppy precision across solves, bounded below by --prec-precondition (default false)");
   quda_app->add_option("--save-gauge", gauge_outfile,
                        "Save gauge field \" file \" for the test (requires QIO, heatbath test only)");
 
@@ -626,6 +648,13 @@ void add_eigen_option_group(std::shared_ptr<QUDAApp> quda_app)
   opgroup->add_option("--eig-n-kr", eig_n_kr, "The size of the Krylov subspace to use in the eigensolver");
   opgroup->add_option("--eig-batched-rotate", eig_batched_rotate,
                       "The maximum number of extra eigenvectors the solver may allocate to perform a Ritz rotation.");
+  opgroup->add_option("--eig-use-gemm-rotate", eig_use_gemm_rotate,
+                      "Perform the Ritz rotation in place using tiled dense GEMMs (default false)");
+  opgroup->add_option("--eig-gemm-rotate-workspace", eig_gemm_rotate_workspace,
+                      "The workspace, in units of single vectors, available to the tiled GEMM rotation (default 4)");
+  opgroup->add_option("--eig-compare-rotate", eig_compare_rotate,
+                      "Repeat the solve with the other Ritz rotation path (tiled GEMM vs multi-BLAS) and compare the "
+                      "rotation time and eigenvalues (default false)");
   opgroup->add_option("--eig-poly-deg", eig_poly_deg, "TODO");
   opgroup->add_option(
     "--eig-require-convergence",
@@ -167,6 +167,7 @@ extern QudaPrecision prec_precondition;
 extern QudaPrecision prec_eigensolver;
 extern QudaPrecision prec_null;
 extern QudaPrecision prec_ritz;
+extern QudaPrecision halo_prec_sloppy;
 extern QudaVerbosity verbosity;
 extern std::array<int, 4> dim;
 extern int &xdim;
@@ -220,12 +221,16 @@ extern double clover_csw;
 extern double clover_coeff;
 extern bool compute_clover;
 extern bool compute_clover_trlog;
+extern bool clover_on_the_fly;
 extern bool compute_fatlong;
 extern double tol;
 extern double tol_precondition;
 extern double tol_hq;
 extern double reliable_delta;
 extern bool alternative_reliable;
+extern char solver_telemetry_file[256];
+extern bool adaptive_reliable;
+extern bool adaptive_precision;
 extern QudaTwistFlavorType twist_flavor;
 extern QudaMassNormalization normalization;
 extern QudaMatPCType matpc_type;
@@ -304,6 +309,9 @@ extern int eig_n_kr;
 extern int eig_n_conv;         // If unchanged, will be set to n_ev
 extern int eig_n_ev_deflate;   // If unchanged, will be set to n_conv
 extern int eig_batched_rotate; // If unchanged, will be set to maximum
+extern bool eig_use_gemm_rotate;
+extern int eig_gemm_rotate_workspace;
+extern bool eig_compare_rotate;
 extern bool eig_require_convergence;
 extern int eig_check_interval;
 extern int eig_max_restarts;
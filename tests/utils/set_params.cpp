@@ -219,6 +219,12 @@ void setInvertParam(QudaInvertParam &inv_param)
   }
   inv_param.maxiter = niter;
   inv_param.reliable_delta = reliable_delta;
+  inv_param.solver_telemetry = strlen(solver_telemetry_file) > 0 ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+  strcpy(inv_param.solver_telemetry_file, solver_telemetry_file);
+  inv_param.adaptive_reliable = adaptive_reliable ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+  inv_param.adaptive_precision = adaptive_precision ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+  inv_param.cuda_prec_sloppy_min = std::min(prec_sloppy, prec_precondition);
+  inv_param.halo_precision_sloppy = halo_prec_sloppy;
   inv_param.use_alternative_reliable = alternative_reliable;
   inv_param.use_sloppy_partial_accumulator = 0;
   inv_param.solution_accumulator_pipeline = solution_accumulator_pipeline;
@@ -294,6 +300,8 @@ void setEigParam(QudaEigParam &eig_param)
   eig_param.tol = eig_tol;
   eig_param.qr_tol = eig_qr_tol;
   eig_param.batched_rotate = eig_batched_rotate;
+  eig_param.use_gemm_rotate = eig_use_gemm_rotate ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+  eig_param.gemm_rotate_workspace = eig_gemm_rotate_workspace;
   eig_param.require_convergence = eig_require_convergence ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
   eig_param.check_interval = eig_check_interval;
   eig_param.max_restarts = eig_max_restarts;
@@ -875,6 +883,12 @@ void setStaggeredInvertParam(QudaInvertParam &inv_param)
   inv_param.tol_restart = tol_restart;
   inv_param.maxiter = niter;
   inv_param.reliable_delta = reliable_delta;
+  inv_param.solver_telemetry = strlen(solver_telemetry_file) > 0 ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+  strcpy(inv_param.solver_telemetry_file, solver_telemetry_file);
+  inv_param.adaptive_reliable = adaptive_reliable ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+  inv_param.adaptive_precision = adaptive_precision ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+  inv_param.cuda_prec_sloppy_min = std::min(prec_sloppy, prec_precondition);
+  inv_param.halo_precision_sloppy = halo_prec_sloppy;
   inv_param.use_alternative_reliable = alternative_reliable;
   inv_param.use_sloppy_partial_accumulator = false;
   inv_param.solution_accumulator_pipeline = solution_accumulator_pipeline;
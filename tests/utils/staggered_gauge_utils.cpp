@@ -35,15 +35,11 @@ void computeHISQLinksGPU(void **qdp_fatlink, void **qdp_longlink, void **qdp_fat
   void *milc_inlink = pinned_malloc(4 * V * gauge_site_size * gSize);
   reorderQDPtoMILC(milc_inlink, qdp_inlink, V, gauge_site_size, gauge_param.cpu_prec, gauge_param.cpu_prec);
 
-  // Paths for step 1:
-  void *milc_vlink = pinned_malloc(4 * V * gauge_site_size * gSize); // V links
-  void *milc_wlink = pinned_malloc(4 * V * gauge_site_size * gSize); // W links
+  // Final fat ("X") and long links
+  void *milc_fatlink = pinned_malloc(4 * V * gauge_site_size * gSize);
+  void *milc_longlink = pinned_malloc(4 * V * gauge_site_size * gSize);
 
-  // Paths for step 2:
-  void *milc_fatlink = pinned_malloc(4 * V * gauge_site_size * gSize);  // final fat ("X") links
-  void *milc_longlink = pinned_malloc(4 * V * gauge_site_size * gSize); // final long links
-
-  // Place to accumulate Naiks, step 3:
+  // Naik-corrected links
   void *milc_fatlink_eps = nullptr;
   void *milc_longlink_eps = nullptr;
   if (n_naiks > 1) {
@@ -51,29 +47,9 @@ void computeHISQLinksGPU(void **qdp_fatlink, void **qdp_longlink, void **qdp_fat
     milc_longlink_eps = pinned_malloc(4 * V * gauge_site_size * gSize); // epsilon long naiks
   }
 
-  // Create V links (fat7 links) and W links (unitarized V links), 1st path table set
-  computeKSLinkQuda(milc_vlink, nullptr, milc_wlink, milc_inlink, act_path_coeffs[0], &gauge_param);
-
-  if (n_naiks > 1) {
-    // Create Naiks, 3rd path table set
-    computeKSLinkQuda(milc_fatlink, milc_longlink, nullptr, milc_wlink, act_path_coeffs[2], &gauge_param);
-
-    // Rescale+copy Naiks into Naik field
-    cpu_axy(gauge_param.cpu_prec, eps_naik, milc_fatlink, milc_fatlink_eps, V * 4 * gauge_site_size);
-    cpu_axy(gauge_param.cpu_prec, eps_naik, milc_longlink, milc_longlink_eps, V * 4 * gauge_site_size);
-  } else {
-    memset(milc_fatlink, 0, V * 4 * gauge_site_size * gSize);
-    memset(milc_longlink, 0, V * 4 * gauge_site_size * gSize);
-  }
-
-  // Create X and long links, 2nd path table set
-  computeKSLinkQuda(milc_fatlink, milc_longlink, nullptr, milc_wlink, act_path_coeffs[1], &gauge_param);
-
-  if (n_naiks > 1) {
-    // Add into Naik field
-    cpu_xpy(gauge_param.cpu_prec, milc_fatlink, milc_fatlink_eps, V * 4 * gauge_site_size);
-    cpu_xpy(gauge_param.cpu_prec, milc_longlink, milc_longlink_eps, V * 4 * gauge_site_size);
-  }
+  // Create the V, W, X and long links, and the Naik-corrected links, in a single pass
+  computeHISQLinksQuda(milc_fatlink, milc_longlink, milc_fatlink_eps, milc_longlink_eps, nullptr, milc_inlink,
+                       act_path_coeffs, eps_naik, &gauge_param);
 
   // Copy back
   reorderMILCtoQDP(qdp_fatlink, milc_fatlink, V, gauge_site_size, gauge_param.cpu_prec, gauge_param.cpu_prec);
@@ -87,8 +63,6 @@ void computeHISQLinksGPU(void **qdp_fatlink, void **qdp_longlink, void **qdp_fat
 
   // Clean up GPU compute links
   host_free(milc_inlink);
-  host_free(milc_vlink);
-  host_free(milc_wlink);
   host_free(milc_fatlink);
   host_free(milc_longlink);
 